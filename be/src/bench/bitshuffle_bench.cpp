@@ -0,0 +1,100 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "storage/rowset/bitshuffle_wrapper.h"
+
+namespace starrocks {
+
+// Benchmark the fused bitshuffle+LZ4 page codec across the element widths used by
+// BitshufflePage (1/2/4/8 bytes). The actual kernel (scalar/AVX2/AVX-512) is selected
+// at process start-up by bitshuffle_wrapper.cpp based on the host CPU, so the numbers
+// reflect whatever this machine dispatches to.
+class BitshuffleBench {
+public:
+    BitshuffleBench(size_t num_elems, size_t elem_size) : _num_elems(num_elems), _elem_size(elem_size) {}
+
+    void SetUp() {
+        // low-cardinality values compress well and resemble typical dictionary codes
+        std::mt19937 rng(20210101);
+        std::uniform_int_distribution<uint8_t> dist(0, 15);
+        _input.resize(_num_elems * _elem_size);
+        for (auto& b : _input) {
+            b = dist(rng);
+        }
+        _compressed.resize(bitshuffle::compress_lz4_bound(_num_elems, _elem_size, 0));
+        _compressed_size =
+                bitshuffle::compress_lz4(_input.data(), _compressed.data(), _num_elems, _elem_size, 0);
+        CHECK_GT(_compressed_size, 0);
+        _decompressed.resize(_input.size());
+    }
+
+    void do_compress(benchmark::State& state) {
+        int64_t r = bitshuffle::compress_lz4(_input.data(), _compressed.data(), _num_elems, _elem_size, 0);
+        benchmark::DoNotOptimize(r);
+    }
+
+    void do_decompress(benchmark::State& state) {
+        int64_t r = bitshuffle::decompress_lz4(_compressed.data(), _decompressed.data(), _num_elems, _elem_size, 0);
+        benchmark::DoNotOptimize(r);
+    }
+
+    size_t input_bytes() const { return _input.size(); }
+
+private:
+    size_t _num_elems = 0;
+    size_t _elem_size = 0;
+    int64_t _compressed_size = 0;
+    std::vector<uint8_t> _input;
+    std::vector<uint8_t> _compressed;
+    std::vector<uint8_t> _decompressed;
+};
+
+static void BM_Bitshuffle_Arg(benchmark::internal::Benchmark* b) {
+    // 64KB worth of elements per page at each element width
+    for (size_t elem_size : {1, 2, 4, 8}) {
+        b->Args({static_cast<int64_t>(65536 / elem_size), static_cast<int64_t>(elem_size)});
+    }
+}
+
+static void BM_Bitshuffle_Compress(benchmark::State& state) {
+    BitshuffleBench bench(state.range(0), state.range(1));
+    bench.SetUp();
+    for (auto _ : state) {
+        bench.do_compress(state);
+    }
+    state.SetBytesProcessed(state.iterations() * bench.input_bytes());
+}
+
+static void BM_Bitshuffle_Decompress(benchmark::State& state) {
+    BitshuffleBench bench(state.range(0), state.range(1));
+    bench.SetUp();
+    for (auto _ : state) {
+        bench.do_decompress(state);
+    }
+    state.SetBytesProcessed(state.iterations() * bench.input_bytes());
+}
+
+BENCHMARK(BM_Bitshuffle_Compress)->Apply(BM_Bitshuffle_Arg);
+BENCHMARK(BM_Bitshuffle_Decompress)->Apply(BM_Bitshuffle_Arg);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
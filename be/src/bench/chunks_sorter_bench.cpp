@@ -309,6 +309,77 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     suite.TearDown();
 }
 
+// Simulate the partition sort sinkers of one fragment: `num_sorters` TopN sorters fed
+// round-robin, either each filtering only by its local Kth row or all pruning by the
+// tightest boundary any of them published through SharedTopnBoundary.
+static void do_bench_topn_shared_boundary(benchmark::State& state, bool share_boundary) {
+    ChunkSorterBase suite;
+    suite.SetUp();
+
+    const int num_sorters = state.range(0);
+    const int num_chunks = state.range(1);
+    const int limit = state.range(2);
+
+    TypeDescriptor type_desc = TypeDescriptor(TYPE_INT);
+    Columns columns;
+    std::vector<std::unique_ptr<ColumnRef>> exprs;
+    std::vector<ExprContext*> sort_exprs;
+    std::vector<bool> asc_arr{true};
+    std::vector<bool> null_first{true};
+    Chunk::SlotHashMap map;
+
+    auto [column, expr] = suite.build_column(type_desc, 0, false, false);
+    columns.push_back(column);
+    exprs.emplace_back(std::move(expr));
+    auto sort_expr = new ExprContext(exprs.back().get());
+    ASSERT_OK(sort_expr->prepare(suite._runtime_state.get()));
+    ASSERT_OK(sort_expr->open(suite._runtime_state.get()));
+    sort_exprs.push_back(sort_expr);
+    map[0] = 0;
+    auto chunk = std::make_shared<Chunk>(columns, map);
+
+    RuntimeState* runtime_state = suite._runtime_state.get();
+    int64_t item_processed = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        RuntimeProfile profile("dummy");
+        SharedTopnBoundary shared_boundary;
+        std::vector<std::unique_ptr<ChunksSorterTopn>> sorters;
+        for (int i = 0; i < num_sorters; i++) {
+            auto sorter = std::make_unique<ChunksSorterTopn>(runtime_state, &sort_exprs, &asc_arr, &null_first, "", 0,
+                                                             limit, TTopNType::ROW_NUMBER,
+                                                             ChunksSorterTopn::tunning_buffered_chunks(limit));
+            sorter->setup_runtime(runtime_state, &profile, suite._runtime_state->instance_mem_tracker());
+            if (share_boundary) {
+                sorter->set_shared_topn_boundary(&shared_boundary);
+            }
+            sorters.emplace_back(std::move(sorter));
+        }
+
+        for (int i = 0; i < num_chunks; i++) {
+            auto cloned = chunk->clone_empty();
+            cloned->append_safe(*chunk);
+            ChunkPtr ck(cloned.release());
+
+            state.ResumeTiming();
+            sorters[i % num_sorters]->update(runtime_state, ck);
+            state.PauseTiming();
+        }
+
+        state.ResumeTiming();
+        for (auto& sorter : sorters) {
+            sorter->done(runtime_state);
+        }
+        item_processed += (int64_t)num_chunks * chunk->num_rows();
+        state.PauseTiming();
+    }
+    state.counters["rows_sorted"] += item_processed;
+    state.SetItemsProcessed(item_processed);
+
+    suite.TearDown();
+}
+
 static void do_heap_merge(benchmark::State& state, int num_runs, bool use_merger = true) {
     constexpr int num_columns = 3;
     constexpr int num_chunks_per_run = 1;
@@ -484,6 +555,12 @@ static void BM_topn_limit_mergesort_nullable(benchmark::State& state) {
     params.nullable = true;
     do_bench(state, MergeSort, TYPE_INT, state.range(0), state.range(1), params);
 }
+static void BM_topn_limit_shared_boundary(benchmark::State& state) {
+    do_bench_topn_shared_boundary(state, true);
+}
+static void BM_topn_limit_local_boundary(benchmark::State& state) {
+    do_bench_topn_shared_boundary(state, false);
+}
 static void BM_topn_buffered_chunks(benchmark::State& state) {
     SortParameters params;
     params.max_buffered_chunks = state.range(0);
@@ -545,6 +622,11 @@ BENCHMARK(BM_topn_limit_heapsort)->Apply(CustomArgsLimit);
 BENCHMARK(BM_topn_limit_mergesort_notnull)->Apply(CustomArgsLimit);
 BENCHMARK(BM_topn_limit_mergesort_nullable)->Apply(CustomArgsLimit);
 
+// Sharing the best-known Kth row across the sorters of one local sort
+// num_sorters/num_chunks/limit
+BENCHMARK(BM_topn_limit_shared_boundary)->Args({4, 4096, 100})->Args({16, 16384, 100})->Args({16, 16384, 10'000});
+BENCHMARK(BM_topn_limit_local_boundary)->Args({4, 4096, 100})->Args({16, 16384, 100})->Args({16, 16384, 10'000});
+
 // Tunning the parameter buffered_chunks of TopN
 BENCHMARK(BM_topn_buffered_chunks)->RangeMultiplier(4)->Ranges({{10, 10'000}, {100, 100'000}});
 BENCHMARK(BM_topn_buffered_chunks_tunned)->RangeMultiplier(4)->Ranges({{10, 10'000}, {100, 100'000}});
@@ -0,0 +1,209 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Micro benchmarks for the column kernels every scan goes through: Column::filter_range
+// and Column::append_selective. The dataset shape is controlled through the benchmark
+// arguments (row count, selectivity / null ratio in percent, index clustering), so a run
+// can reproduce both the dense and the sparse shapes we see in production scans.
+//
+// To compare two builds, run each binary with --benchmark_format=json and diff the
+// outputs with the compare.py tool shipped with google-benchmark (see README.md).
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "column/vectorized_fwd.h"
+
+namespace starrocks {
+
+static std::shared_ptr<Int32Column> gen_int_column(std::mt19937& rng, size_t rows) {
+    auto column = Int32Column::create();
+    column->reserve(rows);
+    std::uniform_int_distribution<int32_t> dist(0, 1'000'000);
+    for (size_t i = 0; i < rows; i++) {
+        column->append(dist(rng));
+    }
+    return column;
+}
+
+static std::shared_ptr<BinaryColumn> gen_binary_column(std::mt19937& rng, size_t rows, size_t max_len) {
+    static const std::string alphanum =
+            "0123456789"
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            "abcdefghijklmnopqrstuvwxyz";
+    auto column = BinaryColumn::create();
+    column->reserve(rows);
+    std::uniform_int_distribution<size_t> len_dist(1, max_len);
+    std::uniform_int_distribution<size_t> start_dist(0, alphanum.size() - max_len - 1);
+    for (size_t i = 0; i < rows; i++) {
+        column->append(Slice(alphanum.data() + start_dist(rng), len_dist(rng)));
+    }
+    return column;
+}
+
+// Selects `select_percent` percent of the rows uniformly at random.
+static Filter gen_filter(std::mt19937& rng, size_t rows, int select_percent) {
+    Filter filter(rows, 0);
+    std::uniform_int_distribution<int> dist(0, 99);
+    for (size_t i = 0; i < rows; i++) {
+        filter[i] = dist(rng) < select_percent;
+    }
+    return filter;
+}
+
+// args: rows, selectivity percent
+static void BM_FilterRange_Int32(benchmark::State& state) {
+    const size_t rows = state.range(0);
+    const int select_percent = state.range(1);
+    std::mt19937 rng(20240815);
+    auto src = gen_int_column(rng, rows);
+    Filter filter = gen_filter(rng, rows, select_percent);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto column = src->clone();
+        state.ResumeTiming();
+        column->filter_range(filter, 0, rows);
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// args: rows, selectivity percent, null percent
+static void BM_FilterRange_NullableInt32(benchmark::State& state) {
+    const size_t rows = state.range(0);
+    const int select_percent = state.range(1);
+    const int null_percent = state.range(2);
+    std::mt19937 rng(20240815);
+    auto data = gen_int_column(rng, rows);
+    auto nulls = NullColumn::create();
+    nulls->reserve(rows);
+    std::uniform_int_distribution<int> dist(0, 99);
+    for (size_t i = 0; i < rows; i++) {
+        nulls->append(dist(rng) < null_percent);
+    }
+    auto src = NullableColumn::create(std::move(data), std::move(nulls));
+    src->update_has_null();
+    Filter filter = gen_filter(rng, rows, select_percent);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto column = src->clone();
+        state.ResumeTiming();
+        column->filter_range(filter, 0, rows);
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// args: rows, selectivity percent
+static void BM_FilterRange_Binary(benchmark::State& state) {
+    const size_t rows = state.range(0);
+    const int select_percent = state.range(1);
+    std::mt19937 rng(20240815);
+    auto src = gen_binary_column(rng, rows, 20);
+    Filter filter = gen_filter(rng, rows, select_percent);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto column = src->clone();
+        state.ResumeTiming();
+        column->filter_range(filter, 0, rows);
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// args: rows, 0 for sequential indexes (clustered pick) or 1 for shuffled indexes
+static void BM_AppendSelective_Int32(benchmark::State& state) {
+    const size_t rows = state.range(0);
+    const bool shuffled = state.range(1);
+    std::mt19937 rng(20240815);
+    auto src = gen_int_column(rng, rows);
+    std::vector<uint32_t> indexes(rows);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    if (shuffled) {
+        std::shuffle(indexes.begin(), indexes.end(), rng);
+    }
+
+    for (auto _ : state) {
+        auto dest = Int32Column::create();
+        dest->append_selective(*src, indexes.data(), 0, static_cast<uint32_t>(indexes.size()));
+        benchmark::DoNotOptimize(dest);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// args: rows, max string length, 0 for sequential indexes or 1 for shuffled indexes
+static void BM_AppendSelective_Binary(benchmark::State& state) {
+    const size_t rows = state.range(0);
+    const size_t max_len = state.range(1);
+    const bool shuffled = state.range(2);
+    std::mt19937 rng(20240815);
+    auto src = gen_binary_column(rng, rows, max_len);
+    std::vector<uint32_t> indexes(rows);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    if (shuffled) {
+        std::shuffle(indexes.begin(), indexes.end(), rng);
+    }
+
+    for (auto _ : state) {
+        auto dest = BinaryColumn::create();
+        dest->append_selective(*src, indexes.data(), 0, static_cast<uint32_t>(indexes.size()));
+        benchmark::DoNotOptimize(dest);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+BENCHMARK(BM_FilterRange_Int32)
+        ->Args({4096, 1})
+        ->Args({4096, 10})
+        ->Args({4096, 50})
+        ->Args({4096, 90})
+        ->Args({4096, 99})
+        ->Args({1048576, 10})
+        ->Args({1048576, 90});
+
+BENCHMARK(BM_FilterRange_NullableInt32)
+        ->Args({4096, 10, 1})
+        ->Args({4096, 10, 30})
+        ->Args({4096, 90, 1})
+        ->Args({4096, 90, 30})
+        ->Args({1048576, 50, 10});
+
+BENCHMARK(BM_FilterRange_Binary)
+        ->Args({4096, 10})
+        ->Args({4096, 50})
+        ->Args({4096, 90})
+        ->Args({1048576, 50});
+
+BENCHMARK(BM_AppendSelective_Int32)->Args({4096, 0})->Args({4096, 1})->Args({1048576, 0})->Args({1048576, 1});
+
+BENCHMARK(BM_AppendSelective_Binary)
+        ->Args({4096, 20, 0})
+        ->Args({4096, 20, 1})
+        ->Args({4096, 40, 1})
+        ->Args({1048576, 20, 1});
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "util/faststring.h"
+#include "util/frame_of_reference_coding.h"
+
+namespace starrocks {
+
+// Benchmark ForDecoder::get_batch, the inner loop of frame-of-reference pages
+// (ordinal indexes and bit-packed integer columns). The bit width of the packed
+// deltas is controlled through the value range; the ascending case exercises the
+// delta-coded storage format that ordinal pages produce.
+template <typename T>
+class ForDecoderBench {
+public:
+    ForDecoderBench(size_t num_values, int bit_width, bool ascending)
+            : _num_values(num_values), _bit_width(bit_width), _ascending(ascending) {}
+
+    void SetUp() {
+        std::mt19937_64 rng(20210101);
+        const uint64_t max_delta = (uint64_t(1) << _bit_width) - 1;
+        std::uniform_int_distribution<uint64_t> dist(0, max_delta);
+        std::vector<T> values(_num_values);
+        T pre_value = 0;
+        for (auto& v : values) {
+            if (_ascending) {
+                pre_value += static_cast<T>(dist(rng));
+                v = pre_value;
+            } else {
+                v = static_cast<T>(dist(rng));
+            }
+        }
+        ForEncoder<T> encoder(&_buffer);
+        encoder.put_batch(values.data(), values.size());
+        encoder.flush();
+        _decoded.resize(_num_values);
+    }
+
+    void do_decode() {
+        ForDecoder<T> decoder(_buffer.data(), _buffer.size());
+        CHECK(decoder.init());
+        CHECK(decoder.get_batch(_decoded.data(), _num_values));
+        benchmark::DoNotOptimize(_decoded.data());
+    }
+
+    size_t decoded_bytes() const { return _num_values * sizeof(T); }
+
+private:
+    size_t _num_values = 0;
+    int _bit_width = 0;
+    bool _ascending = false;
+    faststring _buffer;
+    std::vector<T> _decoded;
+};
+
+static void BM_ForDecode_Arg(benchmark::internal::Benchmark* b) {
+    // one page worth of random values across typical bit widths
+    for (int64_t bit_width : {1, 4, 8, 16, 24, 32}) {
+        b->Args({65536, bit_width, 0});
+    }
+    // ascending runs with small deltas, the shape ordinal index pages produce
+    for (int64_t bit_width : {1, 4, 8}) {
+        b->Args({65536, bit_width, 1});
+    }
+}
+
+template <typename T>
+static void BM_ForDecode(benchmark::State& state) {
+    ForDecoderBench<T> bench(state.range(0), state.range(1), state.range(2));
+    bench.SetUp();
+    for (auto _ : state) {
+        bench.do_decode();
+    }
+    state.SetBytesProcessed(state.iterations() * bench.decoded_bytes());
+}
+
+static void BM_ForDecode_Int32(benchmark::State& state) {
+    BM_ForDecode<int32_t>(state);
+}
+
+static void BM_ForDecode_Int64(benchmark::State& state) {
+    BM_ForDecode<int64_t>(state);
+}
+
+BENCHMARK(BM_ForDecode_Int32)->Apply(BM_ForDecode_Arg);
+BENCHMARK(BM_ForDecode_Int64)->Apply(BM_ForDecode_Arg);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+#include "types/hll.h"
+#include "util/random.h"
+
+namespace starrocks {
+
+// Measure update/merge throughput and per-object memory of HyperLogLog across
+// its representation stages: explicit (<= 160 values), the sparse register map
+// (<= HLL_SPARSE_PROMOTION_NUM non-zero registers) and the dense registers.
+class HllSparseMemTest {
+public:
+    explicit HllSparseMemTest(size_t value_count) : _value_count(value_count), _rand(0) {
+        _tracker = std::make_unique<MemTracker>();
+    }
+
+    void do_bench(benchmark::State& state);
+
+private:
+    static constexpr size_t kHllCount = 100;
+
+    std::vector<HyperLogLog> _hlls;
+    std::unique_ptr<MemTracker> _tracker;
+
+    size_t _value_count = 0;
+    Random _rand;
+};
+
+void HllSparseMemTest::do_bench(benchmark::State& state) {
+    CurrentThread::current().set_mem_tracker(_tracker.get());
+
+    size_t start_size = CurrentThread::current().mem_tracker()->consumption();
+
+    _hlls.resize(kHllCount);
+    for (auto _ : state) {
+        for (size_t i = 0; i < _value_count; i++) {
+            uint64_t hash = _rand.Next64();
+            for (size_t j = 0; j < kHllCount; j++) {
+                _hlls[j].update(hash);
+            }
+        }
+
+        HyperLogLog merged;
+        for (size_t j = 0; j < kHllCount; j++) {
+            merged.merge(_hlls[j]);
+        }
+        benchmark::DoNotOptimize(merged.estimate_cardinality());
+    }
+
+    size_t end_size = CurrentThread::current().mem_tracker()->consumption();
+
+    LOG(INFO) << "MEM_USAGE: " << (end_size - start_size) / kHllCount;
+    LOG(INFO) << "SERIALIZED_SIZE: " << _hlls[0].max_serialized_size();
+    CurrentThread::current().set_mem_tracker(nullptr);
+}
+
+static void bench_func(benchmark::State& state) {
+    size_t value_count = state.range(0);
+
+    HllSparseMemTest perf(value_count);
+    perf.do_bench(state);
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    b->Args({100})->Iterations(1);
+    b->Args({500})->Iterations(1);
+    b->Args({1000})->Iterations(1);
+    b->Args({5000})->Iterations(1);
+    b->Args({100000})->Iterations(1);
+}
+
+BENCHMARK(bench_func)->Apply(process_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
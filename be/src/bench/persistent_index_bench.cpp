@@ -84,6 +84,7 @@ public:
     ~PersistentIndexBenchTest() { fs::remove_all(_index_dir); }
 
     void do_bench(benchmark::State& state);
+    void do_point_get_bench(benchmark::State& state, bool keep_bf);
     void do_verify();
 
 private:
@@ -166,6 +167,50 @@ void PersistentIndexBenchTest::do_bench(benchmark::State& state) {
     do_verify();
 }
 
+void PersistentIndexBenchTest::do_point_get_bench(benchmark::State& state, bool keep_bf) {
+    const uint64_t total_step = _params.total_record / _params.each_upsert_record;
+    vector<Key> keys(_params.each_upsert_record);
+    vector<Slice> key_slices(_params.each_upsert_record);
+    vector<IndexValue> values(_params.each_upsert_record);
+    ASSERT_CHECK(_index->load(_index_meta));
+
+    // fill the index first so point gets have to go through the L1/L2 shards
+    for (int i = 0; i < total_step; i++) {
+        for (int j = 0; j < _params.each_upsert_record; j++) {
+            keys[j] = "persistent_index_bench_" + std::to_string(j + i * _params.each_upsert_record);
+            values[j] = j + i * _params.each_upsert_record;
+            key_slices[j] = keys[j];
+        }
+        IOStat stat;
+        std::vector<IndexValue> old_values(_params.each_upsert_record, IndexValue(NullIndexValue));
+        ASSERT_CHECK(_index->prepare(EditVersion(_cur_version++, 0), _params.each_upsert_record));
+        ASSERT_CHECK(
+                _index->upsert(_params.each_upsert_record, key_slices.data(), values.data(), old_values.data(), &stat));
+        ASSERT_CHECK(_index->commit(&_index_meta, &stat));
+        ASSERT_CHECK(_index->on_commited());
+    }
+
+    // simulate the memory pressure response: with keep_pindex_bf off the resident bloom
+    // filters get released and further loads are skipped, so gets fall back to shard reads
+    StorageEngine::instance()->update_manager()->set_keep_pindex_bf(keep_bf);
+    const size_t batch_size = 128;
+    vector<Key> get_keys(batch_size);
+    vector<Slice> get_key_slices(batch_size);
+    std::vector<IndexValue> get_values(batch_size);
+    uint64_t next = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < batch_size; i++) {
+            get_keys[i] = "persistent_index_bench_" + std::to_string((next + i * 7919) % _params.total_record);
+            get_key_slices[i] = get_keys[i];
+        }
+        next += batch_size;
+        state.ResumeTiming();
+        ASSERT_CHECK(_index->get(batch_size, get_key_slices.data(), get_values.data()));
+    }
+    StorageEngine::instance()->update_manager()->set_keep_pindex_bf(true);
+}
+
 static void bench_func(benchmark::State& state) {
     BenchParams params;
     params.key_size = 0;
@@ -191,6 +236,23 @@ static void process_args(benchmark::internal::Benchmark* b) {
 
 BENCHMARK(bench_func)->Apply(process_args);
 
+static void bench_point_get_func(benchmark::State& state) {
+    BenchParams params;
+    params.key_size = 0;
+    params.total_record = state.range(0);
+    params.each_upsert_record = state.range(1);
+    bool keep_bf = state.range(2);
+
+    PersistentIndexBenchTest perf(params);
+    perf.do_point_get_bench(state, keep_bf);
+}
+
+static void process_point_get_args(benchmark::internal::Benchmark* b) {
+    b->Args({1000000, 5000, 1})->Args({1000000, 5000, 0})->Iterations(1000);
+}
+
+BENCHMARK(bench_point_get_func)->Apply(process_point_get_args);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
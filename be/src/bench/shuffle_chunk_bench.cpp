@@ -49,7 +49,8 @@ public:
     ColumnPtr init_dest_column(const TypeDescriptor& type);
     void do_hash(const ColumnPtr& col);
     void do_shuffle(const Chunk& src_chunk);
-    void do_bench(benchmark::State& state);
+    void do_scatter(const Chunk& src_chunk);
+    void do_bench(benchmark::State& state, bool use_scatter);
 
 private:
     int _chunk_count = 400;
@@ -163,7 +164,34 @@ void ShuffleChunkPerf::do_shuffle(const Chunk& src_chunk) {
     }
 }
 
-void ShuffleChunkPerf::do_bench(benchmark::State& state) {
+void ShuffleChunkPerf::do_scatter(const Chunk& src_chunk) {
+    // group row indexes by destination with a counting sort, like Partitioner::partition_chunk
+    size_t num_rows = _shuffle_idxs.size();
+    _select_idxs.resize(num_rows);
+    std::vector<uint32_t> start_points(_node_count + 1, 0);
+    for (uint32_t idx : _shuffle_idxs) {
+        start_points[idx]++;
+    }
+    for (int i = 1; i <= _node_count; i++) {
+        start_points[i] += start_points[i - 1];
+    }
+    for (int i = num_rows - 1; i >= 0; i--) {
+        _select_idxs[start_points[_shuffle_idxs[i]] - 1] = i;
+        start_points[_shuffle_idxs[i]]--;
+    }
+
+    std::vector<Chunk*> dsts(_node_count);
+    std::vector<uint32_t> froms(_node_count);
+    std::vector<uint32_t> sizes(_node_count);
+    for (int n = 0; n < _node_count; n++) {
+        dsts[n] = _dest_chunks[n].get();
+        froms[n] = start_points[n];
+        sizes[n] = start_points[n + 1] - start_points[n];
+    }
+    src_chunk.scatter_selective(dsts, _select_idxs.data(), froms, sizes);
+}
+
+void ShuffleChunkPerf::do_bench(benchmark::State& state, bool use_scatter) {
     init_types();
     _dest_chunks.resize(_node_count, nullptr);
 
@@ -178,7 +206,11 @@ void ShuffleChunkPerf::do_bench(benchmark::State& state) {
 
         init_dest_chunks();
 
-        do_shuffle(*src_chunk);
+        if (use_scatter) {
+            do_scatter(*src_chunk);
+        } else {
+            do_shuffle(*src_chunk);
+        }
 
         reset_dest_chunks();
     }
@@ -193,7 +225,18 @@ static void bench_func(benchmark::State& state) {
     int null_percent = state.range(4);
 
     ShuffleChunkPerf perf(chunk_count, column_count, node_count, src_chunk_size, null_percent);
-    perf.do_bench(state);
+    perf.do_bench(state, false);
+}
+
+static void bench_scatter_func(benchmark::State& state) {
+    int chunk_count = state.range(0);
+    int column_count = state.range(1);
+    int node_count = state.range(2);
+    int src_chunk_size = state.range(3);
+    int null_percent = state.range(4);
+
+    ShuffleChunkPerf perf(chunk_count, column_count, node_count, src_chunk_size, null_percent);
+    perf.do_bench(state, true);
 }
 
 static void process_args(benchmark::internal::Benchmark* b) {
@@ -226,6 +269,7 @@ static void process_args(benchmark::internal::Benchmark* b) {
 }
 
 BENCHMARK(bench_func)->Apply(process_args);
+BENCHMARK(bench_scatter_func)->Apply(process_args);
 
 } // namespace starrocks
 
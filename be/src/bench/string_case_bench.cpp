@@ -0,0 +1,80 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+#include <testutil/assert.h>
+
+#include <memory>
+
+#include "bench.h"
+#include "exprs/string_functions.h"
+
+namespace starrocks {
+
+class StringCaseBench {
+public:
+    StringCaseBench(size_t num_rows, size_t slice_len) : _num_rows(num_rows), _slice_len(slice_len) {}
+
+    void SetUp() {
+        _columns.push_back(Bench::create_random_column(type_desc, _num_rows, false, false, _slice_len));
+    }
+
+    void do_bench(benchmark::State& state, bool to_upper) {
+        std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+        if (to_upper) {
+            ColumnPtr result = StringFunctions::upper(ctx.get(), _columns).value();
+            benchmark::DoNotOptimize(result);
+        } else {
+            ColumnPtr result = StringFunctions::lower(ctx.get(), _columns).value();
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+private:
+    const TypeDescriptor type_desc = TypeDescriptor(TYPE_VARCHAR);
+    size_t _num_rows = 0;
+    size_t _slice_len = 0;
+    Columns _columns{};
+};
+
+static void BM_StringCase_Eval_Arg(benchmark::internal::Benchmark* b) {
+    b->Args({4096, 16, true});
+    b->Args({4096, 16, false});
+    b->Args({4096, 64, true});
+    b->Args({4096, 64, false});
+    b->Args({4096, 256, true});
+    b->Args({4096, 256, false});
+    b->Iterations(10000);
+}
+
+static void BM_StringCase_Eval(benchmark::State& state) {
+    size_t num_rows = state.range(0);
+    size_t slice_len = state.range(1);
+    bool to_upper = state.range(2);
+
+    StringCaseBench bench(num_rows, slice_len);
+    bench.SetUp();
+
+    for (auto _ : state) {
+        bench.do_bench(state, to_upper);
+    }
+}
+
+BENCHMARK(BM_StringCase_Eval)->Apply(BM_StringCase_Eval_Arg);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
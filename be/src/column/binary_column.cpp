@@ -23,6 +23,7 @@
 #include "common/logging.h"
 #include "gutil/bits.h"
 #include "gutil/casts.h"
+#include "simd/simd.h"
 #include "gutil/strings/fastmem.h"
 #include "util/hash_util.hpp"
 #include "util/mysql_row_buffer.h"
@@ -421,8 +422,15 @@ ColumnPtr BinaryColumnBase<T>::cut(size_t start, size_t length) const {
 
 template <typename T>
 size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size_t to) {
-    auto start_offset = from;
-    auto result_offset = from;
+    // Rows before the first filtered-out one already sit where they belong; skip the
+    // surviving prefix so a high-selectivity filter doesn't copy it onto itself.
+    size_t first_zero = SIMD::find_zero(filter, from, to - from);
+    if (first_zero >= to) {
+        this->resize(to);
+        return to;
+    }
+    auto start_offset = first_zero;
+    auto result_offset = first_zero;
 
     uint8_t* data = _bytes.data();
 
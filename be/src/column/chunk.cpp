@@ -270,6 +270,22 @@ void Chunk::rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32
     }
 }
 
+void Chunk::scatter_selective(const std::vector<Chunk*>& dsts, const uint32_t* indexes,
+                              const std::vector<uint32_t>& froms, const std::vector<uint32_t>& sizes) const {
+    DCHECK_EQ(dsts.size(), froms.size());
+    DCHECK_EQ(dsts.size(), sizes.size());
+    for (size_t c = 0; c < _columns.size(); ++c) {
+        const Column& src_column = *_columns[c];
+        for (size_t p = 0; p < dsts.size(); ++p) {
+            if (sizes[p] == 0) {
+                continue;
+            }
+            DCHECK_EQ(_columns.size(), dsts[p]->columns().size());
+            dsts[p]->columns()[c]->append_selective(src_column, indexes, froms[p], sizes[p]);
+        }
+    }
+}
+
 size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
     if (!force && SIMD::count_zero(selection) == 0) {
         return num_rows();
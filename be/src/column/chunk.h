@@ -194,6 +194,14 @@ public:
     // Peak memory usage can be reduced when src chunk has a large number of rows and columns
     void rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32_t from, uint32_t size);
 
+    // Scatter rows of this chunk into several destination chunks in one pass:
+    // dsts[i] receives the rows indexes[froms[i] .. froms[i] + sizes[i]).
+    // Unlike calling append_selective() once per destination, the outer loop here is over
+    // columns, so every source column is gathered for all destinations while its data is
+    // still cache-resident instead of re-touching each column once per destination.
+    void scatter_selective(const std::vector<Chunk*>& dsts, const uint32_t* indexes,
+                           const std::vector<uint32_t>& froms, const std::vector<uint32_t>& sizes) const;
+
     // Remove rows from this chunk according to the vector |selection|.
     // The n-th row will be removed if selection[n] is zero.
     // The size of |selection| must be equal to the number of rows.
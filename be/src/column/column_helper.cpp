@@ -19,10 +19,12 @@
 #include "column/adaptive_nullable_column.h"
 #include "column/array_column.h"
 #include "column/chunk.h"
+#include "column/column_pool.h"
 #include "column/json_column.h"
 #include "column/map_column.h"
 #include "column/struct_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "gutil/casts.h"
 #include "simd/simd.h"
 #include "types/logical_type_infra.h"
@@ -250,6 +252,27 @@ int64_t ColumnHelper::find_first_not_equal(Column* column, int64_t target, int64
     return end - 1;
 }
 
+bool ColumnHelper::is_single_value_run(const Column& column) {
+    const size_t num_rows = column.size();
+    if (num_rows <= 1) {
+        return num_rows == 1 && !column.has_null();
+    }
+    if (column.has_null()) {
+        return false;
+    }
+    // probe the rows most likely to differ first, so the common non-run case stays O(1)
+    if (column.compare_at(0, num_rows - 1, column, -1) != 0 ||
+        column.compare_at(0, num_rows / 2, column, -1) != 0) {
+        return false;
+    }
+    for (size_t i = 1; i < num_rows; i++) {
+        if (column.compare_at(0, i, column, -1) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // expression trees' return column should align return type when some return columns maybe diff from the required
 // return type, as well the null flag. e.g., concat_ws returns col from create_const_null_column(), it's type is
 // Nullable(int8), but required return type is nullable(string), so col need align return type to nullable(string).
@@ -277,6 +300,32 @@ ColumnPtr ColumnHelper::create_column(const TypeDescriptor& type_desc, bool null
     return create_column(type_desc, nullable, false, 0);
 }
 
+namespace {
+
+// Returns scratch columns to the thread-local column pool when the last reference
+// goes away, so per-chunk expression results recycle their buffers instead of
+// churning the allocator. A column surviving into the output chunk simply keeps the
+// pool out of the picture until the chunk itself is released.
+template <typename T>
+struct ScratchColumnDeleter {
+    void operator()(Column* ptr) const { return_column<T>(down_cast<T*>(ptr), config::vector_chunk_size); }
+};
+
+template <typename T>
+std::shared_ptr<T> create_scratch_column() {
+    if constexpr (HasColumnPool<T>::value) {
+        if (config::enable_expr_column_pool) {
+            T* ptr = get_column<T, true>();
+            if (LIKELY(ptr != nullptr)) {
+                return std::shared_ptr<T>(ptr, ScratchColumnDeleter<T>());
+            }
+        }
+    }
+    return T::create();
+}
+
+} // namespace
+
 struct ColumnBuilder {
     template <LogicalType ltype>
     ColumnPtr operator()(const TypeDescriptor& type_desc, size_t size) {
@@ -296,6 +345,9 @@ struct ColumnBuilder {
         case TYPE_DECIMAL128:
             return Decimal128Column::create(type_desc.precision, type_desc.scale, size);
         default:
+            if (size == 0) {
+                return create_scratch_column<RunTimeColumnType<ltype>>();
+            }
             return RunTimeColumnType<ltype>::create(size);
         }
     }
@@ -351,10 +403,11 @@ ColumnPtr ColumnHelper::create_column(const TypeDescriptor& type_desc, bool null
         return ConstColumn::create(p, size);
     }
     if (nullable) {
+        auto null_column = size == 0 ? create_scratch_column<NullColumn>() : NullColumn::create(size, DATUM_NULL);
         if (use_adaptive_nullable_column) {
-            return AdaptiveNullableColumn::create(p, NullColumn::create(size, DATUM_NULL));
+            return AdaptiveNullableColumn::create(p, std::move(null_column));
         } else {
-            return NullableColumn::create(p, NullColumn::create(size, DATUM_NULL));
+            return NullableColumn::create(p, std::move(null_column));
         }
     }
     return p;
@@ -33,6 +33,7 @@
 #include "gutil/bits.h"
 #include "gutil/casts.h"
 #include "gutil/cpu.h"
+#include "simd/simd.h"
 #include "types/logical_type.h"
 #include "types/logical_type_infra.h"
 #include "util/phmap/phmap.h"
@@ -86,6 +87,12 @@ public:
     // Find first value in range [start, end) that not equal to target
     static int64_t find_first_not_equal(Column* column, int64_t target, int64_t start, int64_t end);
 
+    // Whether every row of the column holds one identical non-null value, i.e. the column
+    // is a single run. The last and the middle rows are probed first, so columns that are
+    // not one run are rejected with O(1) comparisons; a positive answer costs one
+    // comparison per row. Constant columns are not considered, check is_constant() first.
+    static bool is_single_value_run(const Column& column);
+
     template <LogicalType Type>
     static inline ColumnPtr create_const_column(const RunTimeCppType<Type>& value, size_t chunk_size) {
         static_assert(!lt_is_decimal<Type>,
@@ -360,8 +367,14 @@ public:
     static size_t compute_bytes_size(ColumnsConstIterator const& begin, ColumnsConstIterator const& end);
     template <typename T, bool avx512f>
     static size_t t_filter_range(const Filter& filter, T* data, size_t from, size_t to) {
-        auto start_offset = from;
-        auto result_offset = from;
+        // Rows before the first filtered-out one already sit where they belong; skip the
+        // surviving prefix so a high-selectivity filter doesn't copy it onto itself.
+        size_t first_zero = SIMD::find_zero(filter, from, to - from);
+        if (first_zero >= to) {
+            return to;
+        }
+        auto start_offset = first_zero;
+        auto result_offset = first_zero;
 
 #ifdef __AVX2__
         const uint8_t* f_data = filter.data();
@@ -149,6 +149,13 @@ class CACHELINE_ALIGNED ColumnPool {
                 delete ptr;
                 return;
             }
+            if constexpr (std::is_same_v<BinaryColumn, T>) {
+                // The offsets check above only bounds the number of rows; a transient binary
+                // column can still carry an arbitrarily large byte buffer. Free such buffers
+                // at return instead of parking them in the pool until the next explicit trim,
+                // using the same average-string-size bound as the scanners' trim calls.
+                release_column_if_large(ptr, chunk_size * 512);
+            }
             auto bytes = column_bytes(ptr);
             if (_curr_free.nfree < kBlockSize) {
                 ASAN_POISON_MEMORY_REGION(ptr, sizeof(T));
@@ -235,10 +235,10 @@ void FixedLengthColumnBase<T>::crc32_hash(uint32_t* hash, uint32_t from, uint32_
         } else if constexpr (IsDecimal<T>) {
             int64_t int_val = _data[i].int_value();
             int32_t frac_val = _data[i].frac_value();
-            uint32_t seed = HashUtil::zlib_crc_hash(&int_val, sizeof(int_val), hash[i]);
-            hash[i] = HashUtil::zlib_crc_hash(&frac_val, sizeof(frac_val), seed);
+            uint32_t seed = HashUtil::zlib_crc_hash_fixed<sizeof(int_val)>(&int_val, hash[i]);
+            hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(frac_val)>(&frac_val, seed);
         } else {
-            hash[i] = HashUtil::zlib_crc_hash(&_data[i], sizeof(ValueType), hash[i]);
+            hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(ValueType)>(&_data[i], hash[i]);
         }
     }
 }
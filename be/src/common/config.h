@@ -111,10 +111,22 @@ CONF_Int32(delete_worker_count_high_priority, "1");
 CONF_mInt32(alter_tablet_worker_count, "3");
 // The count of parallel clone task per storage path
 CONF_mInt32(parallel_clone_task_per_path, "8");
+// whether a full clone of an existing tablet may skip downloading the data files of
+// rowsets whose exact version span already exists locally. Rowset files are immutable,
+// so replicas sharing a version hold byte-equivalent data for it.
+CONF_mBool(enable_clone_reuse_local_rowsets, "true");
+// whether to warm up freshly cloned tablets in the background by opening their segments
+// and loading the short key indexes, so the first queries don't pay the cold-open cost
+CONF_mBool(enable_clone_prewarm, "false");
 // The count of thread to clone. Deprecated
 CONF_Int32(clone_worker_count, "3");
 // The count of thread to clone.
 CONF_Int32(storage_medium_migrate_count, "3");
+// Max bytes per second a storage migration may copy onto one destination data dir.
+// Only applies when the source and destination dirs live on different filesystems;
+// otherwise the immutable files are hard-linked and no data is copied at all.
+// <= 0 means no limit.
+CONF_mInt64(migration_max_bytes_per_disk_per_sec, "0");
 // The count of thread to check consistency.
 CONF_Int32(check_consistency_worker_count, "1");
 // The count of thread to update scheam
@@ -206,6 +218,15 @@ CONF_mInt32(scanner_thread_pool_thread_num, "48");
 // Number of olap/external scanner thread pool size.
 CONF_Int32(scanner_thread_pool_queue_size, "102400");
 CONF_Int32(udf_thread_pool_size, "1");
+// evaluate projections that contain java UDFs on the udf thread pool and let the pipeline
+// driver yield instead of blocking the driver thread in JNI
+CONF_mBool(enable_async_java_udf_project, "true");
+// evaluate a projection with at least this many output expressions by splitting the
+// expressions across tasks on the general thread pool, joining before the chunk is
+// emitted. Values <= 0 disable parallel projection.
+CONF_mInt32(pipeline_parallel_project_min_exprs, "64");
+// number of evaluation tasks one wide projection is split into
+CONF_mInt32(pipeline_parallel_project_task_num, "4");
 // Port on which to run StarRocks test backend.
 CONF_Int32(port, "20001");
 // Default thrift client connect timeout(in seconds).
@@ -225,6 +246,10 @@ CONF_mInt32(max_scan_key_num, "1024");
 CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 // (Advanced) Maximum size of per-query receive-side buffer.
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
+// Use the parallel merge-path receiver for a merging exchange with at least this many
+// senders even when the plan did not ask for it, a single-driver merge serializes such
+// high fan-in merges. Values <= 0 leave the choice entirely to the plan.
+CONF_mInt32(exchange_parallel_merge_min_senders, "0");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
 
@@ -271,6 +296,24 @@ CONF_Int32(data_page_size, "65536");
 CONF_mString(storage_page_cache_limit, "20%");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
+// whether to additionally cache compressed pages, so pages evicted from the
+// decompressed working set cost one decompression instead of one IO on reuse
+CONF_mBool(enable_compressed_page_cache, "false");
+// Scans without pushed-down predicates whose tablet is larger than this fraction of the
+// page cache capacity (e.g. full-table exports) still probe the page cache but do not
+// populate it, so a one-shot scan cannot evict the working set of repeated small queries.
+// <= 0 disables the bypass.
+CONF_mDouble(page_cache_scan_bypass_ratio, "0.5");
+// whether each resource group gets a soft page cache quota proportional to its memory
+// limit. A group over its quota keeps probing the cache but stops populating it, so one
+// group's scan-heavy workload cannot evict the working sets of the other groups.
+CONF_mBool(enable_page_cache_group_quota, "false");
+// whether to cache zone-map pruning results keyed by (segment file, predicate digest), so a
+// repeated scan with the same predicate shape skips the per-column zone-map evaluation.
+// Segment files are immutable, so cached entries never go stale.
+CONF_mBool(enable_segment_row_range_cache, "false");
+// capacity in bytes of the segment row range cache
+CONF_Int64(segment_row_range_cache_capacity, "16777216");
 // whether to enable the bitmap index memory cache
 CONF_mBool(enable_bitmap_index_memory_page_cache, "false");
 // whether to enable the zonemap index memory cache
@@ -279,6 +322,8 @@ CONF_mBool(enable_zonemap_index_memory_page_cache, "false");
 CONF_mBool(enable_ordinal_index_memory_page_cache, "false");
 // whether to disable column pool
 CONF_Bool(disable_column_pool, "true");
+// whether to recycle expression result columns through the column pool
+CONF_Bool(enable_expr_column_pool, "false");
 
 CONF_mInt32(base_compaction_check_interval_seconds, "60");
 CONF_mInt64(min_base_compaction_num_singleton_deltas, "5");
@@ -320,10 +365,21 @@ CONF_mInt64(update_compaction_result_bytes, "1073741824");
 CONF_mInt32(update_compaction_delvec_file_io_amp_ratio, "2");
 // This config defines the maximum percentage of data allowed per compaction
 CONF_mDouble(update_compaction_ratio_threshold, "0.5");
+// Force pick a rowset for update compaction once one of its segments has to stitch at
+// least this many delta column group files on read. Stacked dcgs from column mode partial
+// updates degrade scan latency linearly, and the size based compaction score never
+// notices them because the dcg-bearing update rowsets themselves hold zero rows.
+// Values <= 0 disable the forced pick.
+CONF_mInt32(update_compaction_dcg_io_amp_threshold, "16");
 
 CONF_mInt32(repair_compaction_interval_seconds, "600"); // 10 min
 CONF_Int32(manual_compaction_threads, "4");
 
+// whether heap merges (compaction and key-ordered reads) prefetch one chunk ahead per child
+CONF_mBool(enable_merge_prefetch, "false");
+// max threads of the merge prefetch thread pool
+CONF_Int32(merge_prefetch_max_threads, "8");
+
 // if compaction of a tablet failed, this tablet should not be chosen to
 // compaction until this interval passes.
 CONF_mInt64(min_compaction_failure_interval_sec, "120"); // 2 min
@@ -338,9 +394,30 @@ CONF_mInt64(min_cumulative_compaction_failure_interval_sec, "30"); // 30s
 // This config can be set to 0, which means to forbid any compaction, for some special cases.
 CONF_mInt32(max_compaction_concurrency, "-1");
 
+// Let the compaction scheduler grow its task limit beyond the configured concurrency, one task
+// at a time up to the number of cores, while the process cpu usage stays below the low
+// watermark, and fall back to the configured concurrency once usage crosses the high watermark.
+// This lets compaction use the capacity an idle load/query side leaves on the table.
+CONF_mBool(enable_adaptive_compaction_concurrency, "false");
+CONF_mInt32(adaptive_compaction_cpu_low_water_permille, "300");
+CONF_mInt32(adaptive_compaction_cpu_high_water_permille, "700");
+
 // Threshold to logging compaction trace, in seconds.
 CONF_mInt32(compaction_trace_threshold, "60");
 
+// Max bytes/s all compaction tasks together may read+write on one data dir. The
+// tasks draw from a per-DataDir token bucket, so query IO keeps the rest of the
+// disk bandwidth regardless of how many compactions run concurrently.
+// <= 0 means unlimited.
+CONF_mInt64(compaction_max_bytes_per_disk_per_sec, "0");
+
+// When positive, a horizontal compaction whose input exceeds this many bytes merges and
+// commits consecutive input batches of roughly this size one by one, so queries read
+// partially compacted data while the task is still running and an interrupted task keeps
+// the batches already committed. Inputs carrying delete predicates are never split.
+// <= 0 disables incremental publishing.
+CONF_mInt64(compaction_incremental_publish_batch_bytes, "0");
+
 // If enabled, will verify compaction/schema-change output rowset correctness
 CONF_mBool(enable_rowset_verify, "false");
 
@@ -378,6 +455,10 @@ CONF_Int64(load_data_reserve_hours, "4");
 // log error log will be removed after this time
 CONF_mInt64(load_error_log_reserve_hours, "48");
 CONF_mInt32(number_tablet_writer_threads, "16");
+// split the delta writer threads into this many shards and pin each tablet to one shard
+// by tablet id, so that a tablet's ingestion pipeline always runs on the same small set
+// of threads for better cache locality. 0 means no sharding, use the shared pool
+CONF_Int32(number_tablet_writer_shards, "0");
 CONF_mInt64(max_queueing_memtable_per_tablet, "2");
 // when memory limit exceed and memtable last update time exceed this time, memtable will be flushed
 CONF_mInt64(stale_memtable_flush_time_sec, "30");
@@ -397,6 +478,15 @@ CONF_Double(dictionary_encoding_ratio, "0.7");
 // performance degradation.
 CONF_Int32(dictionary_page_size, "1048576");
 
+// Whether the segment writers of one rowset seed their string dictionaries from the
+// dictionary of the previously finished segment, so that low-cardinality columns stop
+// rebuilding an identical dictionary per segment and shared values keep the same code
+// in every segment of the rowset.
+CONF_mBool(enable_rowset_shared_dict, "false");
+// Dictionaries bigger than this are not shared across segments, since every later
+// segment would inherit values it may never contain.
+CONF_mInt64(rowset_shared_dict_max_bytes, "131072");
+
 // Just like dictionary_encoding_ratio, dictionary_encoding_ratio_for_non_string_column is used for
 // no-string column.
 CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
@@ -436,6 +526,11 @@ CONF_Int32(make_snapshot_rpc_timeout_ms, "20000");
 CONF_mInt32(olap_table_sink_send_interval_ms, "10");
 
 CONF_Bool(enable_load_segment_parallel, "false");
+
+// Warm the lake metacache with the tablet metadata of all scan ranges of a scan node
+// concurrently when the scan is prepared, so cold tablets overlap their object storage
+// round trips instead of paying one per tablet serially when the readers open.
+CONF_mBool(enable_lake_tablet_metadata_prefetch, "true");
 CONF_Int32(load_segment_thread_pool_num_max, "128");
 CONF_Int32(load_segment_thread_pool_queue_size, "10240");
 
@@ -444,6 +539,15 @@ CONF_Int32(fragment_pool_thread_num_min, "64");
 CONF_Int32(fragment_pool_thread_num_max, "4096");
 CONF_Int32(fragment_pool_queue_size, "2048");
 
+// Whether to reject new plan-fragment executions while the query rpc pool is backlogged,
+// so that already started queries keep their data flowing instead of every query timing out.
+CONF_mBool(enable_rpc_admission_control, "false");
+// A new fragment is rejected when even the least-delayed rpc task of the last observation
+// interval waited longer than this before it started executing.
+CONF_mInt64(rpc_admission_target_delay_ms, "100");
+// length in milliseconds of the rpc queue delay observation interval
+CONF_Int64(rpc_admission_interval_ms, "1000");
+
 // Spill to disk when query
 // Writable scratch directories, splitted by ";"
 CONF_String(query_scratch_dirs, "${STARROCKS_HOME}");
@@ -493,7 +597,8 @@ CONF_String(scratch_dirs, "/tmp");
 // then only the first writable directory is used
 // CONF_Bool(allow_multiple_scratch_dirs_per_device, "false");
 
-// Linux transparent huge page.
+// Advise Linux transparent huge pages for large allocations (aggregation hash
+// table backing arrays and mmap-ed memory chunks), see util/hugepage.h.
 CONF_Bool(madvise_huge_pages, "false");
 
 // Whether use mmap to allocate memory.
@@ -507,6 +612,26 @@ CONF_Int32(memory_max_alignment, "16");
 
 // write buffer size before flush
 CONF_mInt64(write_buffer_size, "104857600");
+// for partial updates loaded in AUTO_MODE: use column mode (write delta column files carrying
+// only the updated columns) when their estimated bytes are at most this fraction of the full
+// row, otherwise fall back to row mode and rewrite full rows
+CONF_mDouble(partial_update_auto_mode_column_ratio, "0.3");
+// Whether one memtable may be encoded into multiple segment files concurrently during flush.
+// The sorted memtable is range-partitioned into contiguous slices, so every segment still
+// covers an ascending key range and the per-tablet ordering invariant holds.
+CONF_mBool(enable_parallel_memtable_flush, "false");
+// The minimum number of rows a segment must get before a memtable flush is split.
+CONF_mInt64(parallel_memtable_flush_rows_per_segment, "262144");
+// The maximum number of segments one memtable flush may be split into.
+CONF_mInt32(parallel_memtable_flush_max_segments, "8");
+// Whether memtable finalize merges the sorted runs produced by the intermediate
+// sort+aggregate rounds instead of re-sorting the whole buffer from scratch.
+// Fallback switch, expected to stay on.
+CONF_mBool(enable_memtable_finalize_by_merge, "true");
+// Whether the tablets channel sorts every incoming chunk by the sort key once before
+// splitting it into per-tablet slices, so each duplicate-key memtable receives sorted
+// runs and its finalize degrades to a run merge instead of a full sort.
+CONF_mBool(enable_load_channel_presort, "false");
 
 // Following 2 configs limit the memory consumption of load process on a Backend.
 // eg: memory limit to 80% of mem limit config but up to 100GB(default)
@@ -615,6 +740,9 @@ CONF_mInt32(flush_thread_num_per_store, "2");
 // Config for tablet meta checkpoint.
 CONF_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
 CONF_mInt32(tablet_meta_checkpoint_min_interval_secs, "600");
+// number of threads one checkpoint sweep uses to checkpoint the tablets of a data dir,
+// 1 makes the sweep sequential.
+CONF_mInt32(tablet_meta_checkpoint_thread_num, "4");
 
 // Maximum size of a single message body in all protocols.
 CONF_Int64(brpc_max_body_size, "2147483648");
@@ -652,6 +780,18 @@ CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
 
+// The target in-memory bytes of a chunk re-batched by the accumulate operators. Wide rows
+// reach this size well before vector_chunk_size rows and are emitted early so that a batch
+// stays cache-resident, while narrow rows still accumulate up to vector_chunk_size.
+// <= 0 disables the byte-based target.
+CONF_mInt64(chunk_accumulate_target_bytes, "4194304"); // 4MB
+
+// When all arguments of a scalar function hold a single run of one value over the whole
+// chunk (common for columns the data is clustered by, e.g. a date column in time-sorted
+// data), evaluate the function on one row and expand the result instead of recomputing
+// the same value per row.
+CONF_mBool(enable_expr_run_folding, "true");
+
 // Valid range: [0-1000].
 // `0` will disable late materialization.
 // `1000` will enable late materialization always.
@@ -689,6 +829,13 @@ CONF_mInt16(null_encoding, "0");
 // Do pre-aggregate if effect greater than the factor, factor range:[1-100].
 CONF_Int16(pre_aggregate_factor, "80");
 
+// Let sorted streaming aggregation accept the concatenation of several sorted runs, e.g. a driver
+// scanning more than one tablet of a duplicate key table sorted by the group by keys. Each run is
+// pre-aggregated as it streams in and the reduced runs are cascade-merged and combined when the
+// sink finishes, instead of falling back to hash aggregation. Emission is deferred to the merge,
+// so plans that are known to produce a single run per driver are better served with this off.
+CONF_mBool(enable_sorted_aggregate_merge_runs, "false");
+
 #ifdef __x86_64__
 // Enable genearate minidump for crash.
 CONF_Bool(sys_minidump_enable, "false");
@@ -723,6 +870,13 @@ CONF_Int64(pipeline_scan_thread_pool_thread_num, "0");
 CONF_mDouble(pipeline_connector_scan_thread_num_per_cpu, "8");
 // Queue size of scan thread pool for pipeline engine.
 CONF_Int64(pipeline_scan_thread_pool_queue_size, "102400");
+// Whether the scan executors adjust their worker count online by hill climbing on measured
+// throughput instead of always running with the configured thread number.
+CONF_mBool(enable_scan_executor_auto_tune, "false");
+// Seconds between two worker-count adjustments of an auto-tuned scan executor.
+CONF_mInt32(scan_executor_auto_tune_interval_seconds, "10");
+// Lower bound of the worker count for an auto-tuned scan executor.
+CONF_mInt32(scan_executor_auto_tune_min_threads, "4");
 // The number of execution threads for pipeline engine.
 CONF_Int64(pipeline_exec_thread_pool_thread_num, "0");
 // The number of threads for preparing fragment instances in pipeline engine, vCPUs by default.
@@ -742,11 +896,46 @@ CONF_Int64(pipeline_sink_brpc_dop, "64");
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
 CONF_mBool(pipeline_print_profile, "false");
+// Fuse runs of adjacent stateless pipeline operators (select, project, chunk_accumulate)
+// into one operator, which evaluates the filter first and projects only the surviving rows.
+CONF_mBool(enable_pipeline_stateless_operator_fusion, "false");
+// Build a one-bit-per-bucket occupancy filter for big join hash tables, so that the
+// probe rows of selective joins are rejected in cache instead of missing on the much
+// larger bucket array. Only kicks in when the table is large enough to miss cache.
+CONF_mBool(enable_join_probe_bucket_filter, "true");
+// Buffered bytes in one multi cast local exchanger above which chunks already consumed by
+// the fastest consumer are kept LZ4-compressed until a slow consumer needs them, trading
+// codec cpu for a smaller long-lived buffer when consumers progress at different speeds.
+// Values <= 0 disable the compression.
+CONF_mInt64(multi_cast_local_exchange_compress_threshold_bytes, "67108864");
+// How many chunks of the next bucket a colocate bucket-process operator may buffer while
+// the current bucket is still draining on the source side, overlapping the next bucket's
+// scan with the current bucket's finalize. Values <= 0 disable the overlap.
+CONF_mInt32(pipeline_bucket_process_max_buffered_chunks, "16");
+// Run fragments that consist of a single pipeline driver synchronously on the thread that
+// delivers them, skipping the driver queue round trips that dominate sub-10ms queries.
+CONF_mBool(enable_inline_fragment_execution, "false");
+// time budget of one inline execution, the driver is handed to the driver executor once
+// it blocks or the budget is used up
+CONF_mInt64(inline_fragment_execution_budget_ms, "5");
 
 // The arguments of multilevel feedback pipeline_driver_queue. It prioritizes small queries over larger ones,
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
+// A query whose drivers together consume more CPU time than this quota within one scheduling
+// epoch is demoted in the multilevel feedback queue, one level per exhausted quota.
+// The per-driver time slices cannot see this: a query with many fresh drivers keeps
+// every driver at a high level. <= 0 disables the per-query quota.
+CONF_mInt64(pipeline_driver_queue_query_cpu_quota_ns_per_epoch, "0");
+// The length of the scheduling epoch used by the per-query cpu quota above.
+CONF_mInt64(pipeline_driver_queue_epoch_ns, "1000000000");
+// Whether to partition the pipeline driver queue per NUMA node on multi-socket machines.
+// Drivers of the same fragment instance are routed to one node-local queue, and an executor
+// thread only steals from the queues of remote nodes when its local queue is empty,
+// which reduces remote-memory accesses of the chunks flowing through a driver.
+// It only takes effect when enable_resource_group is false.
+CONF_Bool(enable_numa_aware_pipeline_driver_queue, "false");
 // 0 represents PriorityScanTaskQueue (by default), while 1 represents MultiLevelFeedScanTaskQueue.
 // - PriorityScanTaskQueue prioritizes scan tasks with lower committed times.
 // - MultiLevelFeedScanTaskQueue prioritizes scan tasks with shorter execution time.
@@ -756,6 +945,11 @@ CONF_Int64(pipeline_scan_queue_mode, "0");
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_scan_queue_level_time_slice_base_ns, "100000000");
 CONF_Double(pipeline_scan_queue_ratio_of_adjacent_queue, "1.5");
+// Seed the initial sub-queue level of MultiLevelFeedScanTaskQueue from the morsel count of the
+// scan node: a scan with at least init_level_morsel_num morsels starts at level 1 and one level
+// deeper for every doubling, so a large backfill does not compete with point queries at the top
+// level before any of its runtime has accrued. 0 (by default) starts every scan at level 0.
+CONF_mInt64(pipeline_scan_queue_init_level_morsel_num, "0");
 
 CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
@@ -818,12 +1012,31 @@ CONF_Int64(object_storage_connect_timeout_ms, "-1");
 // value is greater than 0 and less than 1000.
 // When it's 0, low speed limit check will be disabled.
 CONF_Int64(object_storage_request_timeout_ms, "-1");
+// submit an async range-GET for the next sequential range while the caller is consuming
+// the bytes it just read, hiding the S3 round trip for sequential scans. The readahead
+// is dropped on a non-sequential read, so random readers only waste one request
+CONF_mBool(enable_s3_stream_prefetch, "false");
+// issue a duplicate range-GET and take the first response when a request runs far beyond
+// the recent latency of its stream, bounding the S3 tail latency of a single slow GET
+CONF_mBool(enable_s3_hedged_read, "false");
+// floor of the adaptive hedge threshold, a GET never gets hedged earlier than this
+CONF_mInt64(s3_hedged_read_min_threshold_ms, "500");
+// upper bound of duplicate GETs one stream may issue, bounds cost amplification
+CONF_mInt64(s3_hedged_read_max_requests, "16");
+// split reads of at least this many bytes into concurrent sub-range GETs, <= 0 disables
+CONF_mInt64(s3_parallel_read_min_bytes, "8388608");
+// target size of one sub-range GET of a parallel read
+CONF_mInt64(s3_parallel_read_part_bytes, "4194304");
 
 CONF_Strings(fallback_to_hadoop_fs_list, "");
 CONF_Strings(s3_compatible_fs_list, "s3n://, s3a://, s3://, oss://, cos://, cosn://, obs://, ks3://, tos://");
 
 // Lake
 CONF_mBool(io_coalesce_lake_read_enable, "false");
+// Apply the same page-read coalescing to local segment scans: the data pages a scan range
+// touches are resolved from the ordinal index up front and fetched with a few large reads
+// instead of one pread per page.
+CONF_mBool(io_coalesce_local_read_enable, "false");
 
 // orc reader
 CONF_Bool(enable_orc_late_materialization, "true");
@@ -842,6 +1055,10 @@ CONF_Int32(orc_loading_buffer_size, "8388608");
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
+// Register the page ranges of every selected row group with the shared buffered stream up
+// front, so coalesced reads span row-group boundaries and the tail read of one group also
+// brings in the head pages of the next. Buffers are still released group by group.
+CONF_mBool(parquet_cross_row_group_coalesce_enable, "false");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
@@ -855,6 +1072,10 @@ CONF_Int32(connector_io_tasks_adjust_smooth, "4");
 CONF_Int32(connector_io_tasks_slow_io_latency_ms, "50");
 CONF_mDouble(scan_use_query_mem_ratio, "0.25");
 CONF_Double(connector_scan_use_query_mem_ratio, "0.3");
+// When a connector scan's morsel queue holds fewer morsels than there are drivers, split
+// the remaining big parquet/orc files at row-group/stripe granularity so the scan tail
+// keeps every driver busy instead of pinning one thread per large file.
+CONF_mBool(enable_connector_scan_tail_split, "true");
 
 // hdfs hedged read
 CONF_Bool(hdfs_client_enable_hedged_read, "false");
@@ -958,6 +1179,18 @@ CONF_mInt32(starlet_delete_files_max_key_in_batch, "1000");
 #endif
 
 CONF_mInt64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
+// whether lake segments are cached with durable priority, so that bulky tablet
+// metadata and txn logs are evicted before small hot segment footers
+CONF_mBool(lake_metacache_pin_segments, "true");
+// whether to cache the absence of txn log files, so that repeated publish retries
+// do not re-read the same missing log from the object store
+CONF_mBool(lake_metacache_negative_txn_log, "false");
+// whether tablet metadata objects are zstd-compressed before being written to the
+// object store. publish rewrites the full metadata once per tablet per version, so
+// compression cuts most of the bytes uploaded by frequent loads. Readers detect
+// compressed objects by a magic prefix; keep this disabled until every node in the
+// cluster runs a version that understands the prefix.
+CONF_mBool(lake_compress_tablet_metadata, "false");
 CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
@@ -1016,6 +1249,9 @@ CONF_mInt32(spill_init_partition, "16");
 // make sure 2^spill_max_partition_level < spill_max_partition_size
 CONF_Int32(spill_max_partition_level, "7");
 CONF_Int32(spill_max_partition_size, "1024");
+// A spilled block is stored compressed only when uncompressed/compressed size
+// exceeds this ratio, otherwise the raw payload is written.
+CONF_mDouble(spill_compress_ratio_threshold, "1.1");
 
 // The maximum size of a single log block container file, this is not a hard limit.
 // If the file size exceeds this limit, a new file will be created to store the block.
@@ -1024,9 +1260,36 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 // be the same with storage path. Spill will return with error when used size has exceeded
 // the limit.
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
+// The readahead size used when restoring a spilled block from remote storage.
+// Every read of a remote block is a network round trip, so the reader fetches
+// data in batches of this size instead of per-chunk reads.
+CONF_mInt64(spill_remote_block_readahead_bytes, "1048576"); // 1MB
+// readahead size for restoring spilled blocks from local disk, 0 disables the buffering
+CONF_mInt64(spill_local_block_readahead_bytes, "262144"); // 256KB
+// The number of chunks each spilled input stream buffers ahead of the merge during
+// restore. A deeper buffer lets the concurrent restore IO tasks keep all sorted runs
+// fed instead of stalling the merge after every consumed chunk.
+CONF_mInt32(spill_input_stream_buffer_chunk_num, "2");
+// While a spilled hash join probes one set of build partitions, start restore IO for
+// the partitions predicted for the next round so their input stream buffers are warm
+// when the next hash tables are built, instead of alternating io-idle and cpu-idle
+// phases between rounds.
+CONF_mBool(enable_spill_hash_join_build_prefetch, "true");
+// When process memory usage crosses this fraction of the process limit, spillable
+// operators holding a meaningful amount of revocable memory are switched to
+// low-memory mode even though their own query is still below its spill threshold,
+// so global pressure is relieved by spilling instead of by failing queries.
+// Values <= 0 disable the process-level trigger.
+CONF_mDouble(spill_process_mem_limit_threshold, "0.9");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
 
+// Deserialize the columns of a received exchange chunk in parallel when its serialized
+// payload is at least this large. Values <= 0 keep deserialization single-threaded.
+CONF_mInt64(parallel_chunk_deserialize_min_bytes, "-1");
+// Number of threads of the pool shared by all parallel chunk deserializations.
+CONF_Int32(chunk_deserialize_thread_num, "4");
+
 /*
  * When compile with ENABLE_STATUS_FAILED, every use of RETURN_INJECT has probability of 1/cardinality_of_inject
  * to inject error through return random status(except ok).
@@ -1070,6 +1333,13 @@ CONF_Bool(datacache_adaptor_enable, "true");
 CONF_Int64(datacache_skip_read_factor, "1");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// Files at least this large are classified as scan-class for the datacache: blocks
+// populated from them carry a TTL so one-off bulk scans (ETL, backfill) age out of
+// the cache quickly instead of evicting the hot working set. 0 disables the
+// classification.
+CONF_mInt64(datacache_scan_class_file_size, "0");
+// The TTL (second) attached to blocks populated by scan-class streams.
+CONF_mInt64(datacache_scan_class_ttl_seconds, "600");
 // DataCache engines, alternatives: cachelib, starcache.
 // Set the default value empty to indicate whether it is manully configured by users.
 // If not, we need to adjust the default engine based on build switches like "WITH_CACHELIB" and "WITH_STARCACHE".
@@ -1089,6 +1359,12 @@ CONF_Int64(block_cache_mem_size, "2147483648"); // 2GB
 CONF_Int64(block_cache_max_concurrent_inserts, "1500000");
 CONF_Bool(block_cache_checksum_enable, "false");
 CONF_Bool(block_cache_direct_io_enable, "false");
+// Whether CacheInputStream reads ahead of a sequential cold scan and populates the
+// block cache with the prefetched blocks. The readahead window starts small, doubles
+// on every sequential cache miss and decays while the reads keep hitting the cache.
+CONF_mBool(block_cache_readahead_enable, "false");
+// The maximum readahead window, in blocks of block_cache_block_size.
+CONF_mInt64(block_cache_readahead_max_blocks, "16");
 CONF_String(block_cache_engine, "");
 
 CONF_mInt64(l0_l1_merge_ratio, "10");
@@ -1115,6 +1391,10 @@ CONF_mInt64(pindex_major_compaction_schedule_interval_seconds, "15");
 CONF_mInt64(pindex_shared_data_gc_evict_interval_seconds, "18000"); // 5 hour
 // enable use bloom filter for pindex or not
 CONF_mBool(enable_pindex_filter, "true");
+// release bloom filters that are already resident in memory when the index cache exceeds
+// the high watermark, instead of only skipping new loads. They will be reloaded from the
+// index file on demand once memory usage drops back
+CONF_mBool(enable_pindex_bf_reclaim, "true");
 // enable persistent index compression
 CONF_mBool(enable_pindex_compression, "true");
 // use bloom filter in pindex can reduce disk io, but in the following scenarios, we should skip the bloom filter
@@ -1127,6 +1407,10 @@ CONF_mInt32(max_bf_read_bytes_percent, "10");
 // If primary compaction pick all rowsets, we could rebuild pindex directly and skip read from index.
 CONF_mBool(enable_pindex_rebuild_in_compaction, "true");
 
+// when compacting persistent index, raise the output shard count if the input shards are
+// size-skewed, so oversized shards get split instead of being carried over
+CONF_mBool(enable_pindex_shard_split, "true");
+
 // enable read pindex by page
 CONF_mBool(enable_pindex_read_by_page, "false");
 
@@ -1166,6 +1450,11 @@ CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
+// Whether the streaming aggregate auto mode flushes the accumulated hash table
+// downstream when the reduction ratio collapses and the operator settles into
+// pass-through, so the memory is released instead of being pinned until the query
+// ends. The table is rebuilt once the reduction recovers.
+CONF_mBool(streaming_agg_release_ht_on_pass_through, "true");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
 
 // Max size of a binlog file. The default is 512MB.
@@ -1180,9 +1469,27 @@ CONF_mInt32(update_cache_evict_internal_sec, "11");
 CONF_mBool(enable_auto_evict_update_cache, "true");
 
 CONF_mInt64(load_tablet_timeout_seconds, "60");
+// number of threads each data dir uses to deserialize and init tablets from rocksdb metas on
+// startup. The meta scan itself stays sequential; 1 disables the parallelism.
+CONF_Int32(load_tablet_thread_num, "4");
 
 CONF_mBool(enable_pk_value_column_zonemap, "true");
 
+// whether newly written segments also store a zone map per fixed-size row block in
+// addition to the per-page zone maps, letting the reader prune at a finer granularity
+// than data pages. Older readers ignore the extra index.
+CONF_mBool(enable_block_zone_map, "false");
+// number of rows covered by each block zone map entry, <= 0 disables the block index
+CONF_mInt32(block_zone_map_row_granularity, "4096");
+
+// Share unchanged roaring containers between consecutive delete vector versions instead of
+// deep-copying the whole bitmap on every publish of a primary key table.
+CONF_mBool(enable_del_vector_cow, "true");
+
+// Build a per-column HyperLogLog sketch for every written segment and store it in the
+// segment footer, so approximate distinct counts can be answered from segment metas.
+CONF_mBool(enable_segment_ndv_sketch, "false");
+
 // Used by default mv resource group
 CONF_Double(default_mv_resource_group_memory_limit, "0.8");
 CONF_Int32(default_mv_resource_group_cpu_limit, "1");
@@ -14,8 +14,10 @@
 
 #include "connector/binlog_connector.h"
 
+#include "common/config.h"
 #include "runtime/descriptors.h"
 #include "storage/chunk_helper.h"
+#include "storage/predicate_parser.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
 
@@ -64,10 +66,14 @@ Status BinlogDataSource::open(RuntimeState* state) {
     ASSIGN_OR_RETURN(_tablet, _get_tablet())
     RETURN_IF_ERROR(_tablet->support_binlog());
     ASSIGN_OR_RETURN(_binlog_read_schema, _build_binlog_schema())
+    RETURN_IF_ERROR(_init_column_predicates())
 
     BinlogReaderParams reader_params;
     reader_params.chunk_size = state->chunk_size();
     reader_params.output_schema = _binlog_read_schema;
+    if (!_predicates.empty()) {
+        reader_params.predicates = &_predicates;
+    }
     _binlog_reader = std::make_shared<BinlogReader>(_tablet, reader_params);
     RETURN_IF_ERROR(_binlog_reader->init());
 
@@ -124,6 +130,38 @@ Status BinlogDataSource::get_next(RuntimeState* state, ChunkPtr* chunk) {
     return status;
 }
 
+// Translate the pushable conjuncts into storage-level column predicates, which the binlog
+// reader evaluates right after each segment read so that non-matching change events are
+// dropped before they are shipped to the consumer. Best effort: if any conjunct cannot be
+// translated (e.g. it references a binlog meta column), pushdown is skipped entirely. The
+// conjuncts themselves are still evaluated by the operators above, so pushdown is purely
+// additive filtering and never changes query results.
+Status BinlogDataSource::_init_column_predicates() {
+    if (_conjunct_ctxs.empty() || _runtime_filters == nullptr) {
+        return Status::OK();
+    }
+    OlapScanConjunctsManager& cm = _conjuncts_manager;
+    cm.conjunct_ctxs_ptr = &_conjunct_ctxs;
+    cm.tuple_desc = _tuple_desc;
+    cm.obj_pool = &_obj_pool;
+    cm.key_column_names = &_key_column_names; // empty, binlog reads have no scan keys
+    cm.runtime_filters = _runtime_filters;
+    cm.runtime_state = _runtime_state;
+    RETURN_IF_ERROR(cm.parse_conjuncts(true, config::max_scan_key_num));
+
+    auto* parser = _obj_pool.add(new PredicateParser(_tablet->tablet_schema()));
+    Status st = cm.get_column_predicates(parser, &_predicate_free_pool);
+    if (!st.ok()) {
+        VLOG(3) << "Skip binlog predicate pushdown, tablet: " << _tablet->full_name() << ", " << st;
+        _predicate_free_pool.clear();
+        return Status::OK();
+    }
+    for (auto& pred : _predicate_free_pool) {
+        _predicates.add(pred.get());
+    }
+    return Status::OK();
+}
+
 Status BinlogDataSource::_prepare_non_stream_pipeline() {
     BinlogRange binlog_range = _tablet->binlog_manager()->current_binlog_range();
     if (binlog_range.is_empty()) {
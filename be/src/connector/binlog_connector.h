@@ -19,9 +19,12 @@
 #include "column/stream_chunk.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/object_pool.h"
 #include "connector/connector.h"
+#include "exec/olap_scan_prepare.h"
 #include "exec/pipeline/fragment_context.h"
 #include "gen_cpp/PlanNodes_constants.h"
+#include "storage/conjunctive_predicates.h"
 #include "storage/tablet.h"
 
 namespace starrocks::connector {
@@ -87,6 +90,7 @@ private:
     BinlogMetaFieldMap _build_binlog_meta_fields(ColumnId start_cid);
     StatusOr<Schema> _build_binlog_schema();
     Status _prepare_non_stream_pipeline();
+    Status _init_column_predicates();
 
     const PlanNodesConstants _column_name_constants;
     const BinlogDataSourceProvider* _provider;
@@ -98,6 +102,13 @@ private:
     Schema _binlog_read_schema;
     BinlogReaderSharedPtr _binlog_reader;
 
+    // conjuncts translated into storage-level predicates, evaluated inside the binlog reader
+    ObjectPool _obj_pool;
+    OlapScanConjunctsManager _conjuncts_manager;
+    std::vector<std::string> _key_column_names;
+    std::vector<std::unique_ptr<ColumnPredicate>> _predicate_free_pool;
+    ConjunctivePredicates _predicates;
+
     // whether to need do a seek before read data
     std::atomic<bool> _need_seek_binlog{true};
     std::atomic<int64_t> _start_version;
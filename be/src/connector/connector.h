@@ -85,6 +85,13 @@ public:
     };
     void update_profile(const Profile& profile);
     void set_morsel(pipeline::ScanMorsel* morsel) { _morsel = morsel; }
+    // Set by the scan operator before open(): how many morsels its queue still holds and
+    // how many drivers consume them. When the queue can no longer feed every driver,
+    // splittable sources cut their scan range at a finer granularity to refill it.
+    void set_morsel_queue_hint(size_t queued_morsels, int32_t scan_dop) {
+        _queued_morsels = queued_morsels;
+        _scan_dop = scan_dop;
+    }
 
 protected:
     int64_t _read_limit = -1; // no limit
@@ -98,6 +105,8 @@ protected:
 
     virtual void _init_chunk(ChunkPtr* chunk, size_t n) { *chunk = ChunkHelper::new_chunk(*_tuple_desc, n); }
     pipeline::ScanMorsel* _morsel = nullptr;
+    size_t _queued_morsels = SIZE_MAX;
+    int32_t _scan_dop = 0;
 };
 
 class StreamDataSource : public DataSource {
@@ -15,6 +15,7 @@
 #include "connector/file_connector.h"
 
 #include "connector_sink/file_chunk_sink.h"
+#include "exec/arrow_ipc_scanner.h"
 #include "exec/avro_scanner.h"
 #include "exec/csv_scanner.h"
 #include "exec/exec_node.h"
@@ -95,6 +96,8 @@ Status FileDataSource::_create_scanner() {
         _scanner = std::make_unique<JsonScanner>(_runtime_state, _runtime_profile, _scan_range, &_counter);
     } else if (_scan_range.ranges[0].format_type == TFileFormatType::FORMAT_AVRO) {
         _scanner = std::make_unique<AvroScanner>(_runtime_state, _runtime_profile, _scan_range, &_counter);
+    } else if (_scan_range.ranges[0].format_type == TFileFormatType::FORMAT_ARROW_IPC) {
+        _scanner = std::make_unique<ArrowIPCScanner>(_runtime_state, _runtime_profile, _scan_range, &_counter);
     } else {
         _scanner = std::make_unique<CSVScanner>(_runtime_state, _runtime_profile, _scan_range, &_counter);
     }
@@ -16,6 +16,7 @@
 
 #include <filesystem>
 
+#include "common/config.h"
 #include "connector_sink/hive_chunk_sink.h"
 #include "exec/exec_node.h"
 #include "exec/hdfs_scanner_orc.h"
@@ -786,6 +787,18 @@ Status HiveDataSource::_init_scanner(RuntimeState* state) {
     if (state->query_options().__isset.connector_max_split_size) {
         scanner_params.connector_max_split_size = state->query_options().connector_max_split_size;
     }
+    // Scan-tail splitting: when the morsel queue holds fewer morsels than there are
+    // drivers, the remaining big files are what pins the scan tail on a few threads.
+    // Split them at row-group/stripe granularity even if the FE did not plan split
+    // tasks, aiming for enough splits to occupy the whole operator.
+    if (config::enable_connector_scan_tail_split && _scan_dop > 0 &&
+        _queued_morsels < static_cast<size_t>(_scan_dop)) {
+        scanner_params.enable_split_tasks = true;
+        if (scanner_params.connector_max_split_size > 0) {
+            scanner_params.connector_max_split_size =
+                    std::max<int64_t>(scanner_params.connector_max_split_size / _scan_dop, 16L * 1024 * 1024);
+        }
+    }
 
     if (!_equality_delete_slots.empty()) {
         MORParams& mor_params = scanner_params.mor_params;
@@ -15,14 +15,17 @@
 #include "connector/lake_connector.h"
 
 #include "exec/connector_scan_node.h"
+#include "runtime/exec_env.h"
 #include "runtime/global_dict/parser.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/lake/metacache.h"
 #include "storage/lake/tablet.h"
 #include "storage/olap_runtime_range_pruner.hpp"
 #include "storage/predicate_parser.h"
 #include "storage/projection_iterator.h"
 #include "storage/rowset/short_key_range_option.h"
 #include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
 
 namespace starrocks::connector {
 
@@ -102,6 +105,8 @@ void LakeDataSource::close(RuntimeState* state) {
         _reader.reset();
     }
     _predicate_free_pool.clear();
+    // Reduce the memory usage if the the average string size is greater than 512.
+    release_large_columns<BinaryColumn>(state->chunk_size() * 512);
 }
 
 Status LakeDataSource::get_next(RuntimeState* state, ChunkPtr* chunk) {
@@ -603,6 +608,9 @@ StatusOr<pipeline::MorselQueuePtr> LakeDataSourceProvider::convert_scan_range_to
         const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
         bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
         size_t num_total_scan_ranges) {
+    if (config::enable_lake_tablet_metadata_prefetch) {
+        _prefetch_tablet_metadata(scan_ranges);
+    }
     auto morsel_queue = DataSourceProvider::convert_scan_range_to_morsel_queue(
             scan_ranges, node_id, pipeline_dop, enable_tablet_internal_parallel, tablet_internal_parallel_mode,
             num_total_scan_ranges);
@@ -618,6 +626,41 @@ StatusOr<pipeline::MorselQueuePtr> LakeDataSourceProvider::convert_scan_range_to
     return morsel_queue;
 }
 
+void LakeDataSourceProvider::_prefetch_tablet_metadata(const std::vector<TScanRangeParams>& scan_ranges) {
+#ifdef BE_TEST
+    lake::TabletManager* tablet_manager = _tablet_manager;
+#else
+    lake::TabletManager* tablet_manager = ExecEnv::GetInstance()->lake_tablet_manager();
+#endif
+    auto* thread_pool = ExecEnv::GetInstance()->load_rowset_thread_pool();
+    if (tablet_manager == nullptr || thread_pool == nullptr) {
+        return;
+    }
+    for (const auto& scan_range : scan_ranges) {
+        const auto& internal_scan_range = scan_range.scan_range.internal_scan_range;
+        int64_t tablet_id = internal_scan_range.tablet_id;
+        int64_t version = std::stoll(internal_scan_range.version);
+        if (tablet_manager->metacache()->lookup_tablet_metadata(
+                    tablet_manager->tablet_metadata_location(tablet_id, version)) != nullptr) {
+            continue;
+        }
+        // Fire and forget: the task only fills the metacache, a tablet that is not
+        // prefetched resolves its metadata on demand when the data source opens.
+        auto st = thread_pool->submit_func([tablet_manager, tablet_id, version]() {
+            auto res = tablet_manager->get_tablet_metadata(tablet_id, version);
+            if (!res.ok()) {
+                VLOG(2) << "prefetch lake tablet metadata failed. tablet: " << tablet_id << ", version: " << version
+                        << ", error: " << res.status();
+            }
+        });
+        if (!st.ok()) {
+            // the pool is saturated, let the remaining tablets fetch their metadata on demand
+            VLOG(2) << "submit lake tablet metadata prefetch task failed: " << st;
+            return;
+        }
+    }
+}
+
 StatusOr<bool> LakeDataSourceProvider::_could_tablet_internal_parallel(
         const std::vector<TScanRangeParams>& scan_ranges, int32_t pipeline_dop, size_t num_total_scan_ranges,
         TTabletInternalParallelMode::type tablet_internal_parallel_mode, int64_t* scan_dop,
@@ -626,12 +669,9 @@ StatusOr<bool> LakeDataSourceProvider::_could_tablet_internal_parallel(
     //    return false;
     //}
     bool force_split = tablet_internal_parallel_mode == TTabletInternalParallelMode::type::FORCE_SPLIT;
-    // The enough number of tablets shouldn't use tablet internal parallel.
-    if (!force_split && num_total_scan_ranges >= pipeline_dop) {
-        return false;
-    }
 
     int64_t num_table_rows = 0;
+    int64_t max_tablet_rows = 0;
     for (const auto& tablet_scan_range : scan_ranges) {
         int64_t version = std::stoll(scan_ranges[0].scan_range.internal_scan_range.version);
 #ifdef BE_TEST
@@ -645,6 +685,14 @@ StatusOr<bool> LakeDataSourceProvider::_could_tablet_internal_parallel(
                                  tablet_scan_range.scan_range.internal_scan_range.tablet_id, version));
         num_table_rows += static_cast<int64_t>(tablet_num_rows);
 #endif
+        max_tablet_rows = std::max<int64_t>(max_tablet_rows, tablet_num_rows);
+    }
+
+    // The enough number of tablets shouldn't use tablet internal parallel,
+    // unless one tablet holds most of the rows: then the tablet count doesn't help,
+    // a single morsel bounds the scan tail, and splitting is still worthwhile.
+    if (!force_split && num_total_scan_ranges >= pipeline_dop && max_tablet_rows * 2 <= num_table_rows) {
+        return false;
     }
 
     // splitted_scan_rows is restricted in the range [min_splitted_scan_rows, max_splitted_scan_rows].
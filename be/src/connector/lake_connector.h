@@ -203,9 +203,15 @@ protected:
     const TLakeScanNode _t_lake_scan_node;
 
     // for ut
-    lake::TabletManager* _tablet_manager;
+    lake::TabletManager* _tablet_manager = nullptr;
 
 private:
+    // Warm the metacache with the tablet metadata of all scan ranges through the load
+    // rowset thread pool, so cold tablets fetch their metadata concurrently instead of
+    // serially when each data source opens. Best effort: a tablet that is not prefetched
+    // resolves its metadata on demand as before.
+    void _prefetch_tablet_metadata(const std::vector<TScanRangeParams>& scan_ranges);
+
     StatusOr<bool> _could_tablet_internal_parallel(const std::vector<TScanRangeParams>& scan_ranges,
                                                    int32_t pipeline_dop, size_t num_total_scan_ranges,
                                                    TTabletInternalParallelMode::type tablet_internal_parallel_mode,
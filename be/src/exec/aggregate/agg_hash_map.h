@@ -29,9 +29,11 @@
 #include "exec/aggregate/agg_profile.h"
 #include "gutil/casts.h"
 #include "gutil/strings/fastmem.h"
+#include "runtime/global_dict/config.h"
 #include "runtime/mem_pool.h"
 #include "util/fixed_hash_map.h"
 #include "util/hash_util.hpp"
+#include "util/hugepage.h"
 #include "util/phmap/phmap.h"
 #include "util/phmap/phmap_dump.h"
 
@@ -41,47 +43,75 @@ const constexpr int32_t prefetch_threhold = 8192;
 
 using AggDataPtr = uint8_t*;
 
+// The flat arrays of big aggregation hash maps are the hottest randomly-accessed
+// memory in a query, so back them with huge pages (config::madvise_huge_pages) to
+// cut dTLB misses.
+template <typename K>
+using AggHashMapAlloc = HugePageAdvisedAllocator<phmap::priv::Pair<const K, AggDataPtr>>;
+template <typename K>
+using AggHashMapEq = phmap::priv::hash_default_eq<K>;
+
 // =====================
 // one level agg hash map
 template <PhmapSeed seed>
 using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
-using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
+using Int16AggHashMap =
+        phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>, AggHashMapEq<int16_t>,
+                             AggHashMapAlloc<int16_t>>;
+template <PhmapSeed seed>
+using Int32AggHashMap =
+        phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>, AggHashMapEq<int32_t>,
+                             AggHashMapAlloc<int32_t>>;
 template <PhmapSeed seed>
-using Int32AggHashMap = phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int64AggHashMap =
+        phmap::flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>, AggHashMapEq<int64_t>,
+                             AggHashMapAlloc<int64_t>>;
 template <PhmapSeed seed>
-using Int64AggHashMap = phmap::flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
+using Int128AggHashMap = phmap::flat_hash_map<int128_t, AggDataPtr, Hash128WithSeed<seed>, AggHashMapEq<int128_t>,
+                                              AggHashMapAlloc<int128_t>>;
 template <PhmapSeed seed>
-using Int128AggHashMap = phmap::flat_hash_map<int128_t, AggDataPtr, Hash128WithSeed<seed>>;
+using DateAggHashMap = phmap::flat_hash_map<DateValue, AggDataPtr, StdHashWithSeed<DateValue, seed>,
+                                            AggHashMapEq<DateValue>, AggHashMapAlloc<DateValue>>;
 template <PhmapSeed seed>
-using DateAggHashMap = phmap::flat_hash_map<DateValue, AggDataPtr, StdHashWithSeed<DateValue, seed>>;
+using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, StdHashWithSeed<TimestampValue, seed>,
+                                                 AggHashMapEq<TimestampValue>, AggHashMapAlloc<TimestampValue>>;
 template <PhmapSeed seed>
-using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, StdHashWithSeed<TimestampValue, seed>>;
+using SliceAggHashMap =
+        phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual, AggHashMapAlloc<Slice>>;
+// Low-cardinality global-dict codes are TYPE_INT columns whose values are bounded by
+// DICT_DECODE_MAX_SIZE, so a direct-indexed table beats a general int32 hash map.
 template <PhmapSeed seed>
-using SliceAggHashMap = phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
+using DictCodeAggHashMap = SmallFixedSizeHashMap<int32_t, AggDataPtr, seed, DICT_DECODE_MAX_SIZE + 1>;
 
 // ==================
 // one level fixed size slice hash map
 template <PhmapSeed seed>
-using FixedSize4SliceAggHashMap = phmap::flat_hash_map<SliceKey4, AggDataPtr, FixedSizeSliceKeyHash<SliceKey4, seed>>;
+using FixedSize4SliceAggHashMap =
+        phmap::flat_hash_map<SliceKey4, AggDataPtr, FixedSizeSliceKeyHash<SliceKey4, seed>, AggHashMapEq<SliceKey4>,
+                             AggHashMapAlloc<SliceKey4>>;
 template <PhmapSeed seed>
-using FixedSize8SliceAggHashMap = phmap::flat_hash_map<SliceKey8, AggDataPtr, FixedSizeSliceKeyHash<SliceKey8, seed>>;
+using FixedSize8SliceAggHashMap =
+        phmap::flat_hash_map<SliceKey8, AggDataPtr, FixedSizeSliceKeyHash<SliceKey8, seed>, AggHashMapEq<SliceKey8>,
+                             AggHashMapAlloc<SliceKey8>>;
 template <PhmapSeed seed>
 using FixedSize16SliceAggHashMap =
-        phmap::flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
+        phmap::flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>, AggHashMapEq<SliceKey16>,
+                             AggHashMapAlloc<SliceKey16>>;
 
 // =====================
 // two level agg hash map
 template <PhmapSeed seed>
-using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int32AggTwoLevelHashMap =
+        phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>, AggHashMapEq<int32_t>,
+                                      AggHashMapAlloc<int32_t>>;
 
 // The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
 // The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
 static constexpr uint8_t PHMAPN = 4;
 template <PhmapSeed seed>
-using SliceAggTwoLevelHashMap =
-        phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
-                                      phmap::priv::Allocator<phmap::priv::Pair<const Slice, AggDataPtr>>, PHMAPN>;
+using SliceAggTwoLevelHashMap = phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
+                                                              AggHashMapAlloc<Slice>, PHMAPN>;
 
 // This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
 static constexpr size_t AGG_HASH_MAP_DEFAULT_PREFETCH_DIST = 16;
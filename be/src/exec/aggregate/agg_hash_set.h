@@ -19,6 +19,7 @@
 #include "column/hash_set.h"
 #include "column/type_traits.h"
 #include "gutil/casts.h"
+#include "runtime/global_dict/config.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "util/fixed_hash_map.h"
@@ -46,6 +47,10 @@ using TimeStampAggHashSet = phmap::flat_hash_set<TimestampValue, StdHashWithSeed
 template <PhmapSeed seed>
 using SliceAggHashSet =
         phmap::flat_hash_set<TSliceWithHash<seed>, THashOnSliceWithHash<seed>, TEqualOnSliceWithHash<seed>>;
+// Low-cardinality global-dict codes are TYPE_INT columns whose values are bounded by
+// DICT_DECODE_MAX_SIZE, so a direct-indexed table beats a general int32 hash set.
+template <PhmapSeed seed>
+using DictCodeAggHashSet = SmallFixedSizeHashSet<int32_t, seed, DICT_DECODE_MAX_SIZE + 1>;
 
 // ==================
 // one level fixed size slice hash set
@@ -89,7 +89,11 @@ namespace starrocks {
     M(phase1_slice_fx16)             \
     M(phase2_slice_fx4)              \
     M(phase2_slice_fx8)              \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)             \
+    M(phase1_dict32)                 \
+    M(phase1_null_dict32)            \
+    M(phase2_dict32)                 \
+    M(phase2_null_dict32)
 
 // Aggregate Hash maps
 
@@ -116,6 +120,8 @@ template <PhmapSeed seed>
 using DateAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_DATE, DateAggHashMap<seed>>;
 template <PhmapSeed seed>
 using TimeStampAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_DATETIME, TimeStampAggHashMap<seed>>;
+template <PhmapSeed seed>
+using DictCodeAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, DictCodeAggHashMap<seed>>;
 // nullable single key maps:
 template <PhmapSeed seed>
 using NullUInt8AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_BOOLEAN, Int8AggHashMap<seed>>;
@@ -144,6 +150,8 @@ using NullDateAggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TY
 template <PhmapSeed seed>
 using NullTimeStampAggHashMapWithOneNumberKey =
         AggHashMapWithOneNullableNumberKey<TYPE_DATETIME, TimeStampAggHashMap<seed>>;
+template <PhmapSeed seed>
+using NullDictCodeAggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_INT, DictCodeAggHashMap<seed>>;
 
 // For string type, we use slice type as hashmap key
 template <PhmapSeed seed>
@@ -190,6 +198,8 @@ template <PhmapSeed seed>
 using DateAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_DATE, DateAggHashSet<seed>>;
 template <PhmapSeed seed>
 using TimeStampAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_DATETIME, TimeStampAggHashSet<seed>>;
+template <PhmapSeed seed>
+using DictCodeAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, DictCodeAggHashSet<seed>>;
 
 template <PhmapSeed seed>
 using NullUInt8AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_BOOLEAN, Int8AggHashSet<seed>>;
@@ -216,6 +226,8 @@ using NullDateAggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_D
 template <PhmapSeed seed>
 using NullTimeStampAggHashSetOfOneNumberKey =
         AggHashSetOfOneNullableNumberKey<TYPE_DATETIME, TimeStampAggHashSet<seed>>;
+template <PhmapSeed seed>
+using NullDictCodeAggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_INT, DictCodeAggHashSet<seed>>;
 
 // For string type, we use slice type as hash key
 template <PhmapSeed seed>
@@ -334,7 +346,11 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>,
+        std::unique_ptr<DictCodeAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullDictCodeAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<DictCodeAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullDictCodeAggHashMapWithOneNumberKey<PhmapSeed2>>>;
 
 using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<UInt8AggHashSetOfOneNumberKey<PhmapSeed1>>,
@@ -394,7 +410,11 @@ using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>,
+        std::unique_ptr<DictCodeAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullDictCodeAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<DictCodeAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullDictCodeAggHashSetOfOneNumberKey<PhmapSeed2>>>;
 } // namespace detail
 struct AggHashMapVariant {
     enum class Type {
@@ -461,6 +481,12 @@ struct AggHashMapVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        // dense maps for low-cardinality global-dict codes.
+        phase1_dict32,
+        phase1_null_dict32,
+        phase2_dict32,
+        phase2_null_dict32,
     };
 
     detail::AggHashMapWithKeyPtr hash_map_with_key;
@@ -564,6 +590,12 @@ struct AggHashSetVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        // dense sets for low-cardinality global-dict codes.
+        phase1_dict32,
+        phase1_null_dict32,
+        phase2_dict32,
+        phase2_null_dict32,
     };
 
     detail::AggHashSetWithKeyPtr hash_set_with_key;
@@ -28,6 +28,7 @@
 #include "exec/pipeline/operator.h"
 #include "exec/spill/spiller.hpp"
 #include "exprs/anyval_util.h"
+#include "exprs/column_ref.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -267,6 +268,10 @@ Status Aggregator::open(RuntimeState* state) {
             _agg_states_total_size = ALIGN_TO(_agg_states_total_size, _max_agg_state_align_size);
             _state_allocator.aggregate_key_size = _agg_states_total_size;
             _state_allocator.pool = _mem_pool.get();
+            // count/sum only aggregations initialize new group states with one memset
+            _agg_states_zero_initialized =
+                    std::all_of(_agg_functions.begin(), _agg_functions.end(),
+                                [](const auto* agg_func) { return agg_func->is_zero_initialized_state(); });
         }
     }
 
@@ -1076,6 +1081,9 @@ void Aggregator::_finalize_to_chunk(ConstAggDataPtr __restrict state, const Colu
 
 void Aggregator::_destroy_state(AggDataPtr __restrict state) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        if (_agg_functions[i]->is_pod_state()) {
+            continue;
+        }
         _agg_functions[i]->destroy(_agg_fn_ctxs[i], state + _agg_states_offsets[i]);
     }
 }
@@ -1266,6 +1274,26 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
         }
     }
 
+    // A single TYPE_INT group-by column holding low-cardinality global-dict codes is bounded
+    // by DICT_DECODE_MAX_SIZE, so a dense direct-indexed table replaces the general int32
+    // hash table. Aggregation stays on the codes, they are only decoded at output by
+    // DictDecodeOperator.
+    if (_group_by_expr_ctxs.size() == 1 && _group_by_expr_ctxs[0]->root()->is_slotref()) {
+        const auto& dict_map = _state->get_query_global_dict_map();
+        auto* column_ref = down_cast<ColumnRef*>(_group_by_expr_ctxs[0]->root());
+        if (dict_map.find(column_ref->slot_id()) != dict_map.end()) {
+            if (type == HashVariantType::Type::phase1_int32) {
+                type = HashVariantType::Type::phase1_dict32;
+            } else if (type == HashVariantType::Type::phase1_null_int32) {
+                type = HashVariantType::Type::phase1_null_dict32;
+            } else if (type == HashVariantType::Type::phase2_int32) {
+                type = HashVariantType::Type::phase2_dict32;
+            } else if (type == HashVariantType::Type::phase2_null_int32) {
+                type = HashVariantType::Type::phase2_null_dict32;
+            }
+        }
+    }
+
     bool has_null_column = false;
     int fixed_byte_size = 0;
     // this optimization don't need to be limited to multi-column group by.
@@ -1541,12 +1569,20 @@ void Aggregator::_release_agg_memory() {
     // then we don't have to traverse the hash table to call destroy method.
     //
     _hash_map_variant.visit([&](auto& hash_map_with_key) {
-        bool skip_destroy = std::all_of(_agg_functions.begin(), _agg_functions.end(),
-                                        [](auto* func) { return func->is_pod_state(); });
-        if (hash_map_with_key != nullptr && !skip_destroy) {
+        // POD states don't need their destructor invoked, their memory is released
+        // in bulk with the state allocator. Only walk the non-POD functions, so a
+        // mixed aggregate like count + array_agg pays one destroy per group instead
+        // of one per function.
+        std::vector<int> non_pod_agg_func_ids;
+        for (int i = 0; i < _agg_functions.size(); i++) {
+            if (!_agg_functions[i]->is_pod_state()) {
+                non_pod_agg_func_ids.push_back(i);
+            }
+        }
+        if (hash_map_with_key != nullptr && !non_pod_agg_func_ids.empty()) {
             auto null_data_ptr = hash_map_with_key->get_null_key_data();
             if (null_data_ptr != nullptr) {
-                for (int i = 0; i < _agg_functions.size(); i++) {
+                for (int i : non_pod_agg_func_ids) {
                     _agg_functions[i]->destroy(_agg_fn_ctxs[i], null_data_ptr + _agg_states_offsets[i]);
                 }
             }
@@ -1554,7 +1590,7 @@ void Aggregator::_release_agg_memory() {
             auto end = _state_allocator.end();
 
             while (it != end) {
-                for (int i = 0; i < _agg_functions.size(); i++) {
+                for (int i : non_pod_agg_func_ids) {
                     _agg_functions[i]->destroy(_agg_fn_ctxs[i], it.value() + _agg_states_offsets[i]);
                 }
                 it.next();
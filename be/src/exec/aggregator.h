@@ -18,6 +18,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <new>
@@ -271,6 +272,8 @@ public:
     bool only_group_by_exprs() { return _is_only_group_by_columns; }
     const std::vector<ExprContext*>& conjunct_ctxs() { return _conjunct_ctxs; }
     const std::vector<ExprContext*>& group_by_expr_ctxs() { return _group_by_expr_ctxs; }
+    // valid after evaluate_groupby_exprs
+    const Columns& group_by_columns() { return _group_by_columns; }
     const std::vector<FunctionContext*>& agg_fn_ctxs() { return _agg_fn_ctxs; }
     const std::vector<std::vector<ExprContext*>>& agg_expr_ctxs() { return _agg_expr_ctxs; }
     int64_t limit() { return _limit; }
@@ -446,6 +449,10 @@ protected:
     size_t _agg_states_total_size = 0;
     // The max align size for all aggregate state
     size_t _max_agg_state_align_size = 1;
+    // True when every aggregate function has an all-zero initial state (count/sum only
+    // aggregations), so a new group's state block is created with one memset instead of
+    // a virtual create() call per function.
+    bool _agg_states_zero_initialized = false;
     // The followings are aggregate function information:
     std::vector<FunctionContext*> _agg_fn_ctxs;
     std::vector<const AggregateFunction*> _agg_functions;
@@ -570,6 +577,11 @@ template <class HashMapWithKey>
 inline AggDataPtr AllocateState<HashMapWithKey>::operator()(const typename HashMapWithKey::KeyType& key) {
     AggDataPtr agg_state = aggregator->_state_allocator.allocate();
     *reinterpret_cast<typename HashMapWithKey::KeyType*>(agg_state) = key;
+    if (aggregator->_agg_states_zero_initialized) {
+        memset(agg_state + aggregator->_agg_states_offsets[0], 0,
+               aggregator->_agg_states_total_size - aggregator->_agg_states_offsets[0]);
+        return agg_state;
+    }
     size_t created = 0;
     size_t aggregate_function_sz = aggregator->_agg_fn_ctxs.size();
     try {
@@ -592,6 +604,11 @@ inline AggDataPtr AllocateState<HashMapWithKey>::operator()(const typename HashM
 template <class HashMapWithKey>
 inline AggDataPtr AllocateState<HashMapWithKey>::operator()(std::nullptr_t) {
     AggDataPtr agg_state = aggregator->_state_allocator.allocate_null_key_data();
+    if (aggregator->_agg_states_zero_initialized) {
+        memset(agg_state + aggregator->_agg_states_offsets[0], 0,
+               aggregator->_agg_states_total_size - aggregator->_agg_states_offsets[0]);
+        return agg_state;
+    }
     size_t created = 0;
     size_t aggregate_function_sz = aggregator->_agg_fn_ctxs.size();
     try {
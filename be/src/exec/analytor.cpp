@@ -111,6 +111,37 @@ Analytor::Analytor(const TPlanNode& tnode, const RowDescriptor& child_row_desc,
     }
 }
 
+bool Analytor::_support_removable_cumulative_process(const TFunction& fn) {
+    const std::string& name = fn.name.function_name;
+    if (name == "sum" || name == "avg" || name == "count") {
+        return true;
+    }
+    if ((name == "max" || name == "min") && !fn.arg_types.empty()) {
+        // min/max only provide the removable implementation for fixed-length comparable types,
+        // strings and jsons still evaluate each frame from scratch.
+        switch (TypeDescriptor::from_thrift(fn.arg_types[0]).type) {
+        case TYPE_BOOLEAN:
+        case TYPE_TINYINT:
+        case TYPE_SMALLINT:
+        case TYPE_INT:
+        case TYPE_BIGINT:
+        case TYPE_LARGEINT:
+        case TYPE_FLOAT:
+        case TYPE_DOUBLE:
+        case TYPE_DECIMALV2:
+        case TYPE_DECIMAL32:
+        case TYPE_DECIMAL64:
+        case TYPE_DECIMAL128:
+        case TYPE_DATE:
+        case TYPE_DATETIME:
+            return true;
+        default:
+            return false;
+        }
+    }
+    return false;
+}
+
 Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile* runtime_profile) {
     _state = state;
 
@@ -166,7 +197,7 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
             _need_partition_materializing = true;
         }
 
-        if (!(fn.name.function_name == "sum" || fn.name.function_name == "avg" || fn.name.function_name == "count")) {
+        if (!_support_removable_cumulative_process(fn)) {
             _use_removable_cumulative_process = false;
         }
 
@@ -237,6 +237,9 @@ private:
         return function_name == "cume_dist" || function_name == "percent_rank";
     }
 
+    // Whether the window function can evaluate a sliding frame in removable cumulative manner.
+    bool _support_removable_cumulative_process(const TFunction& fn);
+
     RuntimeState* _state = nullptr;
     bool _is_closed = false;
     // TPlanNode is only valid in the PREPARE and INIT phase
@@ -0,0 +1,328 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/arrow_ipc_scanner.h"
+
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+
+#include <fmt/format.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "exec/parquet_scanner.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks {
+
+ArrowIPCScanner::ArrowIPCScanner(RuntimeState* state, RuntimeProfile* profile, const TBrokerScanRange& scan_range,
+                                 ScannerCounter* counter, bool schema_only)
+        : FileScanner(state, profile, scan_range.params, counter, schema_only),
+          _scan_range(scan_range),
+          _max_chunk_size(state->chunk_size() ? state->chunk_size() : 4096) {
+    _chunk_filter.reserve(_max_chunk_size);
+    _conv_ctx.state = state;
+}
+
+ArrowIPCScanner::~ArrowIPCScanner() = default;
+
+Status ArrowIPCScanner::open() {
+    RETURN_IF_ERROR(FileScanner::open());
+    if (_scan_range.ranges.empty()) {
+        return Status::OK();
+    }
+    auto range = _scan_range.ranges[0];
+    _num_of_columns_from_file = range.__isset.num_of_columns_from_file
+                                        ? implicit_cast<int>(range.num_of_columns_from_file)
+                                        : implicit_cast<int>(_src_slot_descriptors.size());
+
+    for (auto i = 0; i < _num_of_columns_from_file; ++i) {
+        _conv_funcs.emplace_back(std::make_unique<ConvertFuncTree>());
+    }
+    _cast_exprs.resize(_num_of_columns_from_file, nullptr);
+
+    // column from path
+    if (range.__isset.num_of_columns_from_file) {
+        int nums = range.columns_from_path.size();
+        for (const auto& rng : _scan_range.ranges) {
+            if (nums != rng.columns_from_path.size()) {
+                return Status::InternalError("Different range different columns.");
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status ArrowIPCScanner::new_arrow_input_file(const TBrokerRangeDesc& range_desc,
+                                             std::shared_ptr<arrow::io::RandomAccessFile>* out) {
+    if (range_desc.file_type == TFileType::FILE_LOCAL) {
+        // memory-map local files so the IPC reader adopts buffers directly out of the
+        // mapping instead of issuing read calls into freshly allocated memory.
+        auto mmap_res = arrow::io::MemoryMappedFile::Open(range_desc.path, arrow::io::FileMode::READ);
+        if (!mmap_res.ok()) {
+            return Status::InternalError(
+                    fmt::format("Failed to mmap arrow file {}: {}", range_desc.path, mmap_res.status().ToString()));
+        }
+        *out = std::move(mmap_res).ValueOrDie();
+        return Status::OK();
+    }
+    std::shared_ptr<RandomAccessFile> file;
+    RETURN_IF_ERROR(create_random_access_file(range_desc, _scan_range.broker_addresses[0], _scan_range.params,
+                                              CompressionTypePB::NO_COMPRESSION, &file));
+    *out = std::make_shared<ParquetChunkFile>(file, 0, _counter);
+    return Status::OK();
+}
+
+Status ArrowIPCScanner::open_next_reader() {
+    if (_next_file >= _scan_range.ranges.size()) {
+        _scanner_eof = true;
+        return Status::OK();
+    }
+    const TBrokerRangeDesc& range_desc = _scan_range.ranges[_next_file];
+    std::shared_ptr<arrow::io::RandomAccessFile> file;
+    RETURN_IF_ERROR(new_arrow_input_file(range_desc, &file));
+    _conv_ctx.current_file = range_desc.path;
+    auto reader_res = arrow::ipc::RecordBatchFileReader::Open(file);
+    if (!reader_res.ok()) {
+        return Status::InternalError(
+                fmt::format("Failed to open arrow IPC file {}: {}", range_desc.path, reader_res.status().ToString()));
+    }
+    _curr_file_reader = std::move(reader_res).ValueOrDie();
+    _next_batch_idx = 0;
+    _next_file++;
+
+    // resolve the field index of each source slot by name
+    auto schema = _curr_file_reader->schema();
+    _field_indexes.assign(_num_of_columns_from_file, -1);
+    for (auto i = 0; i < _num_of_columns_from_file; ++i) {
+        SlotDescriptor* slot_desc = _src_slot_descriptors[i];
+        if (slot_desc == nullptr) {
+            continue;
+        }
+        int idx = schema->GetFieldIndex(slot_desc->col_name());
+        if (idx < 0) {
+            return Status::InternalError(fmt::format("Column {} is not found in arrow IPC file {}",
+                                                     slot_desc->col_name(), range_desc.path));
+        }
+        _field_indexes[i] = idx;
+    }
+    return Status::OK();
+}
+
+Status ArrowIPCScanner::next_batch() {
+    SCOPED_RAW_TIMER(&_counter->read_batch_ns);
+    _batch_start_idx = 0;
+    if (_curr_file_reader == nullptr) {
+        RETURN_IF_ERROR(open_next_reader());
+    }
+    while (!_scanner_eof) {
+        if (_next_batch_idx >= _curr_file_reader->num_record_batches()) {
+            return Status::EndOfFile("eof");
+        }
+        auto batch_res = _curr_file_reader->ReadRecordBatch(_next_batch_idx++);
+        if (!batch_res.ok()) {
+            return Status::InternalError(
+                    fmt::format("Failed to read arrow record batch: {}", batch_res.status().ToString()));
+        }
+        _batch = std::move(batch_res).ValueOrDie();
+        if (_batch->num_rows() == 0) {
+            continue;
+        }
+        return Status::OK();
+    }
+    return Status::EndOfFile("eof");
+}
+
+Status ArrowIPCScanner::initialize_src_chunk(ChunkPtr* chunk) {
+    SCOPED_RAW_TIMER(&_counter->init_chunk_ns);
+    _pool.clear();
+    (*chunk) = std::make_shared<Chunk>();
+    _chunk_filter.clear();
+    for (auto i = 0; i < _num_of_columns_from_file; ++i) {
+        SlotDescriptor* slot_desc = _src_slot_descriptors[i];
+        if (slot_desc == nullptr) {
+            continue;
+        }
+        auto* array = _batch->column(_field_indexes[i]).get();
+        ColumnPtr column;
+        RETURN_IF_ERROR(ParquetScanner::new_column(array->type().get(), slot_desc, &column, _conv_funcs[i].get(),
+                                                   &_cast_exprs[i], _pool, _strict_mode));
+        column->reserve(_max_chunk_size);
+        (*chunk)->append_column(column, slot_desc->id());
+    }
+    return Status::OK();
+}
+
+Status ArrowIPCScanner::append_batch_to_src_chunk(ChunkPtr* chunk) {
+    SCOPED_RAW_TIMER(&_counter->fill_ns);
+    size_t num_elements =
+            std::min<size_t>((_max_chunk_size - _chunk_start_idx), (_batch->num_rows() - _batch_start_idx));
+    _chunk_filter.resize(_chunk_filter.size() + num_elements, 1);
+    for (auto i = 0; i < _num_of_columns_from_file; ++i) {
+        SlotDescriptor* slot_desc = _src_slot_descriptors[i];
+        if (slot_desc == nullptr) {
+            continue;
+        }
+        _conv_ctx.current_slot = slot_desc;
+        auto* array = _batch->column(_field_indexes[i]).get();
+        auto& column = (*chunk)->get_column_by_slot_id(slot_desc->id());
+        // rectify the timezone embedded in the array to the session timezone, the
+        // convert function obtains the timezone from the array.
+        if (array->type_id() == ArrowTypeId::TIMESTAMP) {
+            auto* timestamp_type = down_cast<arrow::TimestampType*>(array->type().get());
+            auto& mutable_timezone = (std::string&)timestamp_type->timezone();
+            mutable_timezone = _state->timezone();
+        }
+        RETURN_IF_ERROR(ParquetScanner::convert_array_to_column(_conv_funcs[i].get(), num_elements, array, column,
+                                                                _batch_start_idx, _chunk_start_idx, &_chunk_filter,
+                                                                &_conv_ctx));
+    }
+
+    _chunk_start_idx += num_elements;
+    _batch_start_idx += num_elements;
+    return Status::OK();
+}
+
+Status ArrowIPCScanner::finalize_src_chunk(ChunkPtr* chunk) {
+    auto num_rows = (*chunk)->filter(_chunk_filter);
+    _counter->num_rows_filtered += _chunk_start_idx - num_rows;
+    ChunkPtr cast_chunk = std::make_shared<Chunk>();
+    {
+        SCOPED_RAW_TIMER(&_counter->cast_chunk_ns);
+        for (auto i = 0; i < _num_of_columns_from_file; ++i) {
+            SlotDescriptor* slot_desc = _src_slot_descriptors[i];
+            if (slot_desc == nullptr) {
+                continue;
+            }
+
+            ASSIGN_OR_RETURN(auto column, _cast_exprs[i]->evaluate_checked(nullptr, (*chunk).get()));
+            column = ColumnHelper::unfold_const_column(slot_desc->type(), (*chunk)->num_rows(), column);
+            cast_chunk->append_column(column, slot_desc->id());
+        }
+        auto range = _scan_range.ranges.at(_next_file - 1);
+        if (range.__isset.num_of_columns_from_file) {
+            fill_columns_from_path(cast_chunk, range.num_of_columns_from_file, range.columns_from_path,
+                                   cast_chunk->num_rows());
+        }
+    }
+    ASSIGN_OR_RETURN(auto dest_chunk, materialize(*chunk, cast_chunk));
+    *chunk = dest_chunk;
+    _chunk_start_idx = 0;
+    return Status::OK();
+}
+
+bool ArrowIPCScanner::chunk_is_full() const {
+    return _chunk_start_idx >= _max_chunk_size;
+}
+
+bool ArrowIPCScanner::batch_is_exhausted() const {
+    return _scanner_eof || _batch == nullptr || _batch_start_idx >= _batch->num_rows();
+}
+
+StatusOr<ChunkPtr> ArrowIPCScanner::get_next() {
+    SCOPED_RAW_TIMER(&_counter->total_ns);
+    ChunkPtr chunk;
+    if (batch_is_exhausted()) {
+        while (true) {
+            Status status = next_batch();
+            if (_scanner_eof) {
+                return status;
+            }
+            if (status.ok()) {
+                break;
+            }
+            if (status.is_end_of_file()) {
+                _curr_file_reader.reset();
+                continue;
+            }
+            return status;
+        }
+    }
+    RETURN_IF_ERROR(initialize_src_chunk(&chunk));
+    while (!_scanner_eof) {
+        RETURN_IF_ERROR(append_batch_to_src_chunk(&chunk));
+        if (chunk_is_full()) {
+            break;
+        }
+        auto status = next_batch();
+        // obtain next batch if current batch is ok
+        if (status.ok()) {
+            continue;
+        }
+        // just return error except end of file.
+        if (!status.is_end_of_file()) {
+            return status;
+        }
+
+        // if chunk is not empty, then just break the loop and finalize the chunk
+        _curr_file_reader.reset();
+        if (chunk->num_rows() > 0) {
+            break;
+        }
+        // the chunk is empty and the file reached its end, switch to the next file
+        // and re-initialize the src chunk.
+        RETURN_IF_ERROR(next_batch());
+        RETURN_IF_ERROR(initialize_src_chunk(&chunk));
+    }
+    RETURN_IF_ERROR(finalize_src_chunk(&chunk));
+    return std::move(chunk);
+}
+
+Status ArrowIPCScanner::get_schema(std::vector<SlotDescriptor>* schema) {
+    // TODO: infer schema from more files.
+    const TBrokerRangeDesc& range_desc = _scan_range.ranges[0];
+    std::shared_ptr<arrow::io::RandomAccessFile> file;
+    RETURN_IF_ERROR(new_arrow_input_file(range_desc, &file));
+    auto reader_res = arrow::ipc::RecordBatchFileReader::Open(file);
+    if (!reader_res.ok()) {
+        return Status::InternalError(
+                fmt::format("Failed to open arrow IPC file {}: {}", range_desc.path, reader_res.status().ToString()));
+    }
+    auto arrow_schema = reader_res.ValueOrDie()->schema();
+    for (auto i = 0; i < arrow_schema->num_fields(); ++i) {
+        const auto& field = arrow_schema->field(i);
+        auto lt = get_strict_type(field->type()->id());
+        if (lt == TYPE_UNKNOWN) {
+            return Status::NotSupported(fmt::format("Unsupported arrow type {} of column {}", field->type()->name(),
+                                                    field->name()));
+        }
+        TypeDescriptor tp(lt);
+        switch (lt) {
+        case TYPE_VARCHAR:
+            tp.len = TypeDescriptor::MAX_VARCHAR_LENGTH;
+            break;
+        case TYPE_CHAR:
+            tp.len = TypeDescriptor::MAX_CHAR_LENGTH;
+            break;
+        case TYPE_DECIMAL128: {
+            const auto* decimal_type = down_cast<const arrow::Decimal128Type*>(field->type().get());
+            tp.precision = decimal_type->precision();
+            tp.scale = decimal_type->scale();
+            break;
+        }
+        default:
+            break;
+        }
+        schema->emplace_back(i, field->name(), tp);
+    }
+    return Status::OK();
+}
+
+void ArrowIPCScanner::close() {
+    FileScanner::close();
+    _curr_file_reader.reset();
+    _pool.clear();
+}
+
+} // namespace starrocks
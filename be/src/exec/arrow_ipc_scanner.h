@@ -0,0 +1,87 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "exec/arrow_to_starrocks_converter.h"
+#include "exec/file_scanner.h"
+#include "exec/parquet_reader.h"
+#include "util/runtime_profile.h"
+
+namespace arrow::ipc {
+class RecordBatchFileReader;
+} // namespace arrow::ipc
+
+namespace starrocks {
+
+// Scanner for Arrow IPC (a.k.a. Feather V2) files. Record batches are read directly
+// from the file without a Parquet detour: local files are memory-mapped so that the
+// IPC reader only slices buffers out of the mapping, and the per-column converters
+// from arrow_to_starrocks_converter.cpp copy each batch into chunks exactly once.
+class ArrowIPCScanner final : public FileScanner {
+public:
+    ArrowIPCScanner(RuntimeState* state, RuntimeProfile* profile, const TBrokerScanRange& scan_range,
+                    ScannerCounter* counter, bool schema_only = false);
+
+    ~ArrowIPCScanner() override;
+
+    Status open() override;
+
+    StatusOr<ChunkPtr> get_next() override;
+
+    Status get_schema(std::vector<SlotDescriptor>* schema) override;
+
+    void close() override;
+
+private:
+    Status open_next_reader();
+    Status next_batch();
+    Status initialize_src_chunk(ChunkPtr* chunk);
+    Status append_batch_to_src_chunk(ChunkPtr* chunk);
+    Status finalize_src_chunk(ChunkPtr* chunk);
+    bool chunk_is_full() const;
+    bool batch_is_exhausted() const;
+
+    // open |range_desc| as an arrow input file. Local files are memory-mapped,
+    // everything else goes through the generic RandomAccessFile adapter.
+    Status new_arrow_input_file(const TBrokerRangeDesc& range_desc,
+                                std::shared_ptr<arrow::io::RandomAccessFile>* out);
+
+    const TBrokerScanRange& _scan_range;
+    size_t _next_file = 0;
+    std::shared_ptr<arrow::ipc::RecordBatchFileReader> _curr_file_reader;
+    // index of the next record batch to read from _curr_file_reader
+    int _next_batch_idx = 0;
+    // maps source slot position to the field index in the current file's schema
+    std::vector<int> _field_indexes;
+    bool _scanner_eof = false;
+    RecordBatchPtr _batch;
+    const size_t _max_chunk_size;
+    size_t _batch_start_idx = 0;
+    size_t _chunk_start_idx = 0;
+    int _num_of_columns_from_file = 0;
+    std::vector<std::unique_ptr<ConvertFuncTree>> _conv_funcs;
+    std::vector<Expr*> _cast_exprs;
+    ObjectPool _pool;
+    Filter _chunk_filter;
+    ArrowConvertContext _conv_ctx;
+};
+
+} // namespace starrocks
@@ -110,11 +110,24 @@ Status ChunksSorterFullSort::_partial_sort(RuntimeState* state, bool done) {
 
         SCOPED_TIMER(_sort_timer);
         DataSegment segment(_sort_exprs, _unsorted_chunk);
-        _sort_permutation.resize(0);
-        RETURN_IF_ERROR(
-                sort_and_tie_columns(state->cancelled_ref(), segment.order_by_columns, _sort_desc, &_sort_permutation));
-        auto sorted_chunk = _unsorted_chunk->clone_empty_with_slot(_unsorted_chunk->num_rows());
-        materialize_by_permutation(sorted_chunk.get(), {_unsorted_chunk}, _sort_permutation);
+        ChunkUniquePtr sorted_chunk;
+        // Clustered inputs (e.g. ORDER BY dt on a time-series table) often arrive already
+        // ordered on the sort key. The check exits on the first out-of-order row, so it costs
+        // one comparison per row on ordered data and almost nothing on random data. Ordered
+        // big-chunks skip both the sort and the gather-by-permutation, and the cascade merge
+        // later short-circuits runs without overlap, so a fully clustered input is produced
+        // with linear work.
+        SortedRun input_run(_unsorted_chunk, segment.order_by_columns);
+        if (input_run.is_sorted(_sort_desc)) {
+            COUNTER_UPDATE(_profiler->num_presorted_runs, 1);
+            sorted_chunk = input_run.clone_slice();
+        } else {
+            _sort_permutation.resize(0);
+            RETURN_IF_ERROR(sort_and_tie_columns(state->cancelled_ref(), segment.order_by_columns, _sort_desc,
+                                                 &_sort_permutation));
+            sorted_chunk = _unsorted_chunk->clone_empty_with_slot(_unsorted_chunk->num_rows());
+            materialize_by_permutation(sorted_chunk.get(), {_unsorted_chunk}, _sort_permutation);
+        }
         RETURN_IF_ERROR(sorted_chunk->upgrade_if_overflow());
 
         _sorted_chunks.emplace_back(std::move(sorted_chunk));
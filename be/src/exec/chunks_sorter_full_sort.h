@@ -26,11 +26,14 @@ struct ChunksSorterFullSortProfiler {
             : profile(runtime_profile) {
         input_required_memory = ADD_COUNTER(profile, "InputRequiredMemory", TUnit::BYTES);
         num_sorted_runs = ADD_COUNTER(profile, "NumSortedRuns", TUnit::UNIT);
+        num_presorted_runs = ADD_COUNTER(profile, "NumPresortedRuns", TUnit::UNIT);
     }
 
     RuntimeProfile* profile{};
     RuntimeProfile::Counter* input_required_memory = nullptr;
     RuntimeProfile::Counter* num_sorted_runs = nullptr;
+    // runs that arrived already ordered on the sort key and skipped the sort
+    RuntimeProfile::Counter* num_presorted_runs = nullptr;
 };
 class ChunksSorterFullSort : public ChunksSorter {
 public:
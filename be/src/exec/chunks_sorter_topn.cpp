@@ -29,6 +29,38 @@
 
 namespace starrocks {
 
+void SharedTopnBoundary::update_if_tighter(const Columns& order_by_columns, size_t row_id,
+                                           const SortDescs& sort_desc) {
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!_boundary_columns.empty()) {
+        int cmp = 0;
+        for (size_t i = 0; i < order_by_columns.size(); ++i) {
+            const SortDesc& desc = sort_desc.descs[i];
+            cmp = order_by_columns[i]->compare_at(row_id, 0, *_boundary_columns[i], desc.null_first) * desc.sort_order;
+            if (cmp != 0) {
+                break;
+            }
+        }
+        if (cmp >= 0) {
+            return;
+        }
+    }
+    Columns boundary;
+    boundary.reserve(order_by_columns.size());
+    for (const auto& column : order_by_columns) {
+        ColumnPtr one_row = column->clone_empty();
+        one_row->append(*column, row_id, 1);
+        boundary.emplace_back(std::move(one_row));
+    }
+    _boundary_columns = std::move(boundary);
+    _inited.store(true, std::memory_order_release);
+}
+
+Columns SharedTopnBoundary::boundary_columns() const {
+    std::lock_guard<std::mutex> guard(_mutex);
+    return _boundary_columns;
+}
+
 ChunksSorterTopn::ChunksSorterTopn(RuntimeState* state, const std::vector<ExprContext*>* sort_exprs,
                                    const std::vector<bool>* is_asc_order, const std::vector<bool>* is_null_first,
                                    const std::string& sort_keys, size_t offset, size_t limit,
@@ -211,6 +243,17 @@ Status ChunksSorterTopn::_build_sorting_data(RuntimeState* state, Permutation& p
     }
     _raw_chunks.clear();
 
+    if (_shared_boundary != nullptr && _shared_boundary->inited() &&
+        (!_init_merged_segment || _merged_segment.chunk->num_rows() < _get_number_of_rows_to_sort())) {
+        // The local merged segment can not provide a tight bound yet, but a sibling driver
+        // has already found its Kth row, so prune the input by that boundary first.
+        RETURN_IF_ERROR(_prune_by_shared_boundary(segments));
+        row_count = 0;
+        for (const auto& segment : segments) {
+            row_count += segment.chunk->num_rows();
+        }
+    }
+
     // This time, because we will filter chunks before initialize permutations, so we just check memory usage.
     if (!_init_merged_segment) {
         // This time, just initialized permutations.second.
@@ -229,6 +272,58 @@ Status ChunksSorterTopn::_build_sorting_data(RuntimeState* state, Permutation& p
     return Status::OK();
 }
 
+Status ChunksSorterTopn::_prune_by_shared_boundary(DataSegments& segments) {
+    Columns boundary = _shared_boundary->boundary_columns();
+    if (boundary.empty()) {
+        return Status::OK();
+    }
+    SCOPED_TIMER(_sort_filter_timer);
+
+    std::vector<Datum> boundary_values;
+    boundary_values.reserve(boundary.size());
+    for (const auto& column : boundary) {
+        boundary_values.push_back(column->get(0));
+    }
+
+    for (auto& segment : segments) {
+        const size_t rows = segment.chunk->num_rows();
+        if (rows == 0) {
+            continue;
+        }
+        CompareVector compare_results(rows, 0);
+        compare_columns(segment.order_by_columns, compare_results, boundary_values, _sort_desc);
+
+        Filter filter(rows);
+        size_t rows_to_keep = 0;
+        for (size_t i = 0; i < rows; ++i) {
+            // rows equal with the boundary must be kept, for rank type topn they may tie
+            // with the final Kth row
+            filter[i] = compare_results[i] <= 0;
+            rows_to_keep += filter[i];
+        }
+        if (rows_to_keep == rows) {
+            continue;
+        }
+
+        // The order by columns may alias the chunk's columns, or each other when the sort
+        // keys are duplicated, so only filter the columns still holding the original rows.
+        for (const auto& column : segment.chunk->columns()) {
+            if (column->size() == rows) {
+                column->filter(filter);
+            }
+        }
+        for (const auto& column : segment.order_by_columns) {
+            if (column->size() == rows) {
+                column->filter(filter);
+            }
+        }
+        if (_sort_filter_rows != nullptr) {
+            COUNTER_UPDATE(_sort_filter_rows, rows - rows_to_keep);
+        }
+    }
+    return Status::OK();
+}
+
 void ChunksSorterTopn::_set_permutation_before(Permutation& permutation, size_t size,
                                                std::vector<std::vector<uint8_t>>& filter_array) {
     uint32_t first_size = 0;
@@ -373,12 +468,21 @@ Status ChunksSorterTopn::_merge_sort_data_as_merged_segment(RuntimeState* state,
 
     if (_init_merged_segment) {
         RETURN_IF_ERROR(_hybrid_sort_common(state, new_permutation, segments));
-    } else {
+    } else if (!new_permutation.second.empty()) {
         // The first batch chunks, just new_permutation.second.
+        // The batch may be completely pruned by the shared boundary, in which case there is
+        // nothing to merge yet and the merged segment stays uninitialized.
         RETURN_IF_ERROR(_hybrid_sort_first_time(state, new_permutation.second, segments));
         _init_merged_segment = true;
     }
 
+    const size_t rows_to_sort = _get_number_of_rows_to_sort();
+    if (_shared_boundary != nullptr && _merged_segment.chunk->num_rows() >= rows_to_sort) {
+        // This sorter has a full K rows now, publish its Kth row so the sibling drivers
+        // can prune by it as well.
+        _shared_boundary->update_if_tighter(_merged_segment.order_by_columns, rows_to_sort - 1, _sort_desc);
+    }
+
     // Include release memory's time in _merge_timer.
     Permutation().swap(new_permutation.first);
     Permutation().swap(new_permutation.second);
@@ -14,12 +14,38 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include "column/vectorized_fwd.h"
 #include "exec/chunks_sorter.h"
 #include "exprs/expr_context.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
+
+// The best-known top-n boundary, i.e. the order-by values of the Kth row, shared by all the
+// ChunksSorterTopn instances of one local sort. Each sorter publishes its own boundary once
+// its merged segment holds at least K rows, and prunes its input against the tightest
+// boundary any sibling driver has published, instead of only its local one.
+class SharedTopnBoundary {
+public:
+    // Replace the boundary with the row at `row_id` of `order_by_columns`, if that row is
+    // strictly tighter under `sort_desc`.
+    void update_if_tighter(const Columns& order_by_columns, size_t row_id, const SortDescs& sort_desc);
+
+    // Columns holding a single row: the tightest boundary published so far.
+    // Empty if no sorter has accumulated K rows yet.
+    Columns boundary_columns() const;
+
+    bool inited() const { return _inited.load(std::memory_order_acquire); }
+
+private:
+    mutable std::mutex _mutex;
+    Columns _boundary_columns;
+    std::atomic<bool> _inited{false};
+};
+
 // Sort Chunks in memory with specified order by rules.
 class ChunksSorterTopn : public ChunksSorter {
 public:
@@ -80,6 +106,10 @@ public:
 
     std::vector<JoinRuntimeFilter*>* runtime_filters(ObjectPool* pool) override;
 
+    // Share the top-n boundary with the sibling sorters of one local sort, so every driver
+    // can prune against the best-known Kth row. The sorter does not own the object.
+    void set_shared_topn_boundary(SharedTopnBoundary* boundary) { _shared_boundary = boundary; }
+
 private:
     size_t _get_number_of_rows_to_sort() const { return _offset + _limit; }
 
@@ -113,6 +143,10 @@ private:
     [[nodiscard]] Status _partial_sort_col_wise(RuntimeState* state, std::pair<Permutation, Permutation>& permutations,
                                                 DataSegments& segments);
 
+    // Drop the rows of segments that are strictly larger than the boundary published by
+    // sibling sorters. Only used before the local merged segment holds K rows itself.
+    [[nodiscard]] Status _prune_by_shared_boundary(DataSegments& segments);
+
     // For rank type topn, it may keep more data than we need during processing,
     // therefor, pruning should be performed when processing is finished
     // For example, given the sorted set [1, 2, 3, 3, 3, 4, 5] with limit = 3,
@@ -148,6 +182,8 @@ private:
 
     std::vector<JoinRuntimeFilter*> _runtime_filter;
 
+    SharedTopnBoundary* _shared_boundary = nullptr;
+
     RuntimeProfile::Counter* _sort_filter_rows = nullptr;
     RuntimeProfile::Counter* _sort_filter_timer = nullptr;
 };
@@ -258,11 +258,21 @@ pipeline::OpFactories ExchangeNode::decompose_to_pipeline(pipeline::PipelineBuil
         exchange_source_op->set_degree_of_parallelism(context->degree_of_parallelism());
         operators.emplace_back(exchange_source_op);
     } else {
-        if (_is_parallel_merge || _sort_exec_exprs.is_constant_lhs_ordering()) {
+        // A single-driver heap merge serializes high fan-in merges, so fall back to the
+        // parallel merge-path receiver once the number of senders crosses the threshold,
+        // even when the plan did not ask for a parallel merge.
+        const bool force_parallel_merge = config::exchange_parallel_merge_min_senders > 0 &&
+                                          _num_senders >= config::exchange_parallel_merge_min_senders &&
+                                          context->degree_of_parallelism() > 1;
+        if (_is_parallel_merge || _sort_exec_exprs.is_constant_lhs_ordering() || force_parallel_merge) {
             auto exchange_merge_sort_source_operator = std::make_shared<ExchangeParallelMergeSourceOperatorFactory>(
                     context->next_operator_id(), id(), _num_senders, _input_row_desc, &_sort_exec_exprs, _is_asc_order,
                     _nulls_first, _offset, _limit);
-            exchange_merge_sort_source_operator->set_degree_of_parallelism(context->degree_of_parallelism());
+            // The leaves of the merge tree are the sender streams, so drivers beyond the
+            // number of streams only add coordination overhead to every merge stage.
+            const size_t merge_dop =
+                    std::min(context->degree_of_parallelism(), static_cast<size_t>(std::max(_num_senders, 1)));
+            exchange_merge_sort_source_operator->set_degree_of_parallelism(merge_dop);
             operators.emplace_back(std::move(exchange_merge_sort_source_operator));
             // This particular exchange source will be executed in a concurrent way, and finally we need to gather them into one
             // stream to satisfied the ordering property
@@ -18,6 +18,7 @@
 #include <sstream>
 
 #include "column/chunk.h"
+#include "exec/arrow_ipc_scanner.h"
 #include "exec/avro_scanner.h"
 #include "exec/csv_scanner.h"
 #include "exec/json_scanner.h"
@@ -211,6 +212,8 @@ std::unique_ptr<FileScanner> FileScanNode::_create_scanner(const TBrokerScanRang
         return std::make_unique<JsonScanner>(runtime_state(), runtime_profile(), scan_range, counter);
     } else if (scan_range.ranges[0].format_type == TFileFormatType::FORMAT_AVRO) {
         return std::make_unique<AvroScanner>(runtime_state(), runtime_profile(), scan_range, counter);
+    } else if (scan_range.ranges[0].format_type == TFileFormatType::FORMAT_ARROW_IPC) {
+        return std::make_unique<ArrowIPCScanner>(runtime_state(), runtime_profile(), scan_range, counter);
     } else {
         return std::make_unique<CSVScanner>(runtime_state(), runtime_profile(), scan_range, counter);
     }
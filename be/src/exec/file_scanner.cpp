@@ -20,6 +20,7 @@
 #include "column/column_helper.h"
 #include "column/hash_set.h"
 #include "column/vectorized_fwd.h"
+#include "exec/arrow_ipc_scanner.h"
 #include "exec/csv_scanner.h"
 #include "exec/orc_scanner.h"
 #include "exec/parquet_scanner.h"
@@ -435,6 +436,10 @@ Status FileScanner::sample_schema(RuntimeState* state, const TBrokerScanRange& s
             p_scanner = std::make_unique<CSVScanner>(state, &profile, sample_range, &counter, true);
             break;
 
+        case TFileFormatType::FORMAT_ARROW_IPC:
+            p_scanner = std::make_unique<ArrowIPCScanner>(state, &profile, sample_range, &counter, true);
+            break;
+
         default:
             auto err_msg = fmt::format("get file schema failed, format: {} not supported", to_string(tp));
             LOG(WARNING) << err_msg;
@@ -226,6 +226,12 @@ Status HdfsScanner::open_random_access_file() {
                                                                      _scanner_params.modification_time);
         _cache_input_stream->set_enable_populate_cache(_scanner_params.enable_populate_datacache);
         _cache_input_stream->set_enable_block_buffer(config::datacache_block_buffer_enable);
+        if (config::datacache_scan_class_file_size > 0 && file_size >= config::datacache_scan_class_file_size) {
+            // Large files are typically read by one-off bulk scans (ETL, backfill). Demote
+            // their blocks with a TTL so they age out quickly instead of flushing the hot
+            // working set out of the cache.
+            _cache_input_stream->set_populate_ttl_seconds(config::datacache_scan_class_ttl_seconds);
+        }
         _shared_buffered_input_stream->set_align_size(_cache_input_stream->get_align_size());
         input_stream = _cache_input_stream;
     }
@@ -419,6 +419,10 @@ Status HdfsOrcScanner::resolve_columns(orc::Reader* reader) {
     return Status::OK();
 }
 
+// Split tasks are how one ORC file fans out over many cores: each task covers a
+// stripe range, reuses the serialized file tail instead of re-reading the footer,
+// and is decoded by an independent scan driver with its own coalesced stripe IO.
+// This replaces any need for intra-scanner stripe threads or a reorder queue.
 Status HdfsOrcScanner::build_split_tasks(orc::Reader* reader, const std::vector<DiskRange>& stripes) {
     // we can split task if we enable split tasks feature and have >= 2 stripes.
     // but if we have splitted tasks before, we don't want to split again, to avoid infinite loop.
@@ -639,17 +643,37 @@ StatusOr<size_t> HdfsOrcScanner::_do_get_next(ChunkPtr* chunk) {
             continue;
         }
 
+        // Runs of filtered-out rows at either edge of the batch need not be decoded
+        // at all: seek past the leading run and shrink the read for the trailing one.
+        // Only valid when no dict filter was applied, since the dict filter is
+        // positioned against the full batch read from the stripe.
+        size_t leading_skip = 0;
+        size_t trailing_skip = 0;
+        if (!has_used_dict_filter && rows_read != origin_rows_read) {
+            while (_chunk_filter[leading_skip] == 0) {
+                ++leading_skip;
+            }
+            while (_chunk_filter[_chunk_filter.size() - 1 - trailing_skip] == 0) {
+                ++trailing_skip;
+            }
+        }
         {
             SCOPED_RAW_TIMER(&_app_stats.column_read_ns);
-            RETURN_IF_ERROR(_orc_reader->lazy_seek_to(position.row_in_stripe));
-            RETURN_IF_ERROR(_orc_reader->lazy_read_next(read_num_values));
+            RETURN_IF_ERROR(_orc_reader->lazy_seek_to(position.row_in_stripe + leading_skip));
+            RETURN_IF_ERROR(_orc_reader->lazy_read_next(read_num_values - leading_skip - trailing_skip));
+            _app_stats.late_materialize_skip_rows += leading_skip + trailing_skip;
         }
         {
             SCOPED_RAW_TIMER(&_app_stats.column_convert_ns);
             if (has_used_dict_filter) {
                 _orc_reader->lazy_filter_on_cvb(&_dict_filter);
+                _orc_reader->lazy_filter_on_cvb(&_chunk_filter);
+            } else if (leading_skip + trailing_skip > 0) {
+                Filter trimmed_filter(_chunk_filter.begin() + leading_skip, _chunk_filter.end() - trailing_skip);
+                _orc_reader->lazy_filter_on_cvb(&trimmed_filter);
+            } else {
+                _orc_reader->lazy_filter_on_cvb(&_chunk_filter);
             }
-            _orc_reader->lazy_filter_on_cvb(&_chunk_filter);
             StatusOr<ChunkPtr> ret = _orc_reader->get_lazy_chunk();
             RETURN_IF_ERROR(ret);
             Chunk& ret_ck = *(ret.value());
@@ -81,8 +81,8 @@ void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* t
     table_items->build_pool = std::make_unique<MemPool>();
 }
 
-void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
-                                                   HashTableProbeState* probe_state) {
+Status SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                                     HashTableProbeState* probe_state) {
     uint32_t row_count = table_items->row_count;
 
     // prepare columns
@@ -116,6 +116,7 @@ void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHash
 
     if (!null_columns.empty()) {
         for (size_t i = 0; i < quo; i++) {
+            RETURN_IF_CANCELLED(state);
             _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * i,
                                     state->chunk_size(), &ptr);
         }
@@ -123,12 +124,14 @@ void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHash
                                 rem, &ptr);
     } else {
         for (size_t i = 0; i < quo; i++) {
+            RETURN_IF_CANCELLED(state);
             _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * i, state->chunk_size(),
                            &ptr);
         }
         _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem, &ptr);
     }
     table_items->calculate_ht_info(serialize_size);
+    return Status::OK();
 }
 
 void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
@@ -197,41 +200,47 @@ void SerializedJoinProbeFunc::lookup_init(const JoinHashTableItems& table_items,
         }
     }
 
-    // allocate memory for serialize key columns
-    size_t serialize_size = 0;
+    // allocate memory for serialize key columns. the keys are written at a fixed stride of
+    // the maximum row size, so each column serializes its whole array in one batched call
+    // instead of one virtual call per row, which dominates composite-key probe cost.
+    size_t max_one_row_size = 0;
     for (const auto& data_column : data_columns) {
-        serialize_size += serde::ColumnArraySerde::max_serialized_size(*data_column);
+        max_one_row_size += data_column->max_one_element_serialize_size();
     }
-    uint8_t* ptr = probe_state->probe_pool->allocate(serialize_size);
+    uint8_t* ptr = probe_state->probe_pool->allocate(max_one_row_size * probe_state->probe_row_count);
 
     // serialize and init search
     if (!null_columns.empty()) {
-        _probe_nullable_column(table_items, probe_state, data_columns, null_columns, ptr);
+        _probe_nullable_column(table_items, probe_state, data_columns, null_columns, ptr, max_one_row_size);
     } else {
-        _probe_column(table_items, probe_state, data_columns, ptr);
+        _probe_column(table_items, probe_state, data_columns, ptr, max_one_row_size);
     }
     probe_state->consider_probe_time_locality();
 }
 
 void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
-                                            const Columns& data_columns, uint8_t* ptr) {
+                                            const Columns& data_columns, uint8_t* ptr, uint32_t max_one_row_size) {
     uint32_t row_count = probe_state->probe_row_count;
 
+    probe_state->probe_slice_sizes.assign(row_count, 0);
+    for (const auto& data_column : data_columns) {
+        data_column->serialize_batch(ptr, probe_state->probe_slice_sizes, row_count, max_one_row_size);
+    }
+
     for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->probe_slice[i] = JoinHashMapHelper::get_hash_key(data_columns, i, ptr);
+        probe_state->probe_slice[i] = Slice(ptr + i * max_one_row_size, probe_state->probe_slice_sizes[i]);
         probe_state->buckets[i] =
                 JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-        ptr += probe_state->probe_slice[i].size;
     }
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, probe_state->buckets, row_count,
+                                                 &probe_state->next);
 }
 
 void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& table_items,
                                                      HashTableProbeState* probe_state, const Columns& data_columns,
-                                                     const NullColumns& null_columns, uint8_t* ptr) {
+                                                     const NullColumns& null_columns, uint8_t* ptr,
+                                                     uint32_t max_one_row_size) {
     uint32_t row_count = probe_state->probe_row_count;
 
     for (uint32_t i = 0; i < row_count; i++) {
@@ -244,22 +253,24 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
     }
 
     probe_state->null_array = &null_columns[0]->get_data();
-    for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->probe_slice[i] = JoinHashMapHelper::get_hash_key(data_columns, i, ptr);
-            ptr += probe_state->probe_slice[i].size;
-        }
+
+    // null rows get serialized too, a branchless batched pass beats per-row virtual calls
+    // even with the wasted bytes; their slices and buckets are simply never read.
+    probe_state->probe_slice_sizes.assign(row_count, 0);
+    for (const auto& data_column : data_columns) {
+        data_column->serialize_batch(ptr, probe_state->probe_slice_sizes, row_count, max_one_row_size);
     }
 
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
+            probe_state->probe_slice[i] = Slice(ptr + i * max_one_row_size, probe_state->probe_slice_sizes[i]);
             probe_state->buckets[i] =
                     JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
         }
     }
+
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, probe_state->buckets, probe_state->is_nulls,
+                                                 row_count, &probe_state->next);
 }
 
 JoinHashTable JoinHashTable::clone_readable_table() {
@@ -459,7 +470,7 @@ Status JoinHashTable::build(RuntimeState* state) {
         _##NAME = std::make_unique<typename decltype(_##NAME)::element_type>(_table_items.get(), _probe_state.get()); \
         _##NAME->build_prepare(state);                                                                                \
         _##NAME->probe_prepare(state);                                                                                \
-        _##NAME->build(state);                                                                                        \
+        RETURN_IF_ERROR(_##NAME->build(state));                                                                       \
         break;
         APPLY_FOR_JOIN_VARIANTS(M)
 #undef M
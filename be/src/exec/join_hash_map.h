@@ -28,6 +28,8 @@
 #include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/compiler_util.h"
+#include "common/config.h"
 #include "simd/simd.h"
 #include "util/phmap/phmap.h"
 
@@ -126,6 +128,11 @@ struct JoinHashTableItems {
     size_t used_buckets = 0;
     bool cache_miss_serious = false;
     bool mor_reader_mode = false;
+    // One bit per bucket, set iff the bucket chain is non-empty. 32x denser than first[],
+    // so when first[] is too large to stay in cache, the probe rows of a selective join
+    // are mostly rejected by this cache-resident bitmap and never touch first[] at all.
+    // Only built for the tables where cache misses are serious; empty otherwise.
+    Buffer<uint8_t> bucket_filter;
 
     float get_keys_per_bucket() const { return keys_per_bucket; }
     bool ht_cache_miss_serious() const { return cache_miss_serious; }
@@ -143,6 +150,12 @@ struct JoinHashTableItems {
                                   (probe_bytes > (1UL << 26) && keys_per_bucket > 1.5) || probe_bytes > (1UL << 27));
             VLOG_QUERY << "ht cache miss serious = " << cache_miss_serious << " row# = " << row_count
                        << " , bytes = " << probe_bytes << " , depth = " << keys_per_bucket;
+            if (config::enable_join_probe_bucket_filter && cache_miss_serious) {
+                bucket_filter.assign((bucket_size + 7) / 8, 0);
+                for (size_t i = 0; i < bucket_size; i++) {
+                    bucket_filter[i >> 3] |= (first[i] != 0) << (i & 0b111);
+                }
+            }
         }
     }
 
@@ -160,6 +173,8 @@ struct HashTableProbeState {
     Buffer<uint32_t> probe_index;
     Buffer<uint32_t> next;
     Buffer<Slice> probe_slice;
+    // per-row serialized key sizes, scratch of the batched probe key serialization
+    Buffer<uint32_t> probe_slice_sizes;
     Buffer<uint8_t>* null_array = nullptr;
     ColumnPtr probe_key_column;
     const Columns* key_columns = nullptr;
@@ -225,6 +240,7 @@ struct HashTableProbeState {
               probe_index(rhs.probe_index),
               next(rhs.next),
               probe_slice(rhs.probe_slice),
+              probe_slice_sizes(rhs.probe_slice_sizes),
               null_array(rhs.null_array),
               probe_key_column(rhs.probe_key_column == nullptr ? nullptr : rhs.probe_key_column->clone()),
               key_columns(rhs.key_columns),
@@ -312,6 +328,14 @@ class JoinHashMapHelper {
 public:
     // maxinum bucket size
     const static uint32_t MAX_BUCKET_SIZE = 1 << 31;
+    // how far ahead of the cursor bucket-head prefetches are issued during lookup_init,
+    // same distance as the aggregate hash maps use.
+    const static uint32_t LOOKUP_PREFETCH_DISTANCE = 16;
+    // bucket arrays smaller than this stay cache-resident, prefetching them is pure overhead.
+    const static uint32_t MIN_BUCKET_SIZE_TO_PREFETCH = 8192;
+    // long build loops probe for cancellation once per this many rows (must be a power
+    // of two), so cancelling a fragment stops a runaway build within a bounded latency
+    const static uint32_t BUILD_CANCEL_CHECK_INTERVAL = 32768;
 
     static uint32_t calc_bucket_size(uint32_t size) {
         size_t expect_bucket_size = static_cast<size_t>(size) + (size - 1) / 7;
@@ -345,6 +369,73 @@ public:
         return {buffer, byte_size};
     }
 
+    static bool bucket_filter_hit(const Buffer<uint8_t>& bucket_filter, uint32_t bucket) {
+        return (bucket_filter[bucket >> 3] >> (bucket & 0b111)) & 1;
+    }
+
+    // Load the head of each probe row's bucket chain from first[] into next[].
+    // Each load is an independent random access over the whole bucket array, so issue
+    // software prefetches a fixed distance ahead of the cursor to overlap the cache
+    // misses instead of paying them one by one. When the table carries a bucket filter,
+    // probe rows whose bucket bit is clear are rejected without touching first[].
+    static void lookup_init_with_prefetch(const JoinHashTableItems& table_items, const Buffer<uint32_t>& buckets,
+                                          uint32_t row_count, Buffer<uint32_t>* next) {
+        const auto& first = table_items.first;
+        const auto& bucket_filter = table_items.bucket_filter;
+        if (!bucket_filter.empty()) {
+            for (uint32_t i = 0; i < row_count; i++) {
+                if (i + LOOKUP_PREFETCH_DISTANCE < row_count &&
+                    bucket_filter_hit(bucket_filter, buckets[i + LOOKUP_PREFETCH_DISTANCE])) {
+                    PREFETCH(first.data() + buckets[i + LOOKUP_PREFETCH_DISTANCE]);
+                }
+                (*next)[i] = bucket_filter_hit(bucket_filter, buckets[i]) ? first[buckets[i]] : 0;
+            }
+            return;
+        }
+        if (first.size() < MIN_BUCKET_SIZE_TO_PREFETCH) {
+            for (uint32_t i = 0; i < row_count; i++) {
+                (*next)[i] = first[buckets[i]];
+            }
+            return;
+        }
+        for (uint32_t i = 0; i < row_count; i++) {
+            if (i + LOOKUP_PREFETCH_DISTANCE < row_count) {
+                PREFETCH(first.data() + buckets[i + LOOKUP_PREFETCH_DISTANCE]);
+            }
+            (*next)[i] = first[buckets[i]];
+        }
+    }
+
+    // Same as above for nullable probe keys: null rows get an empty chain, and their
+    // bucket num may be uninitialized so they must not be prefetched or filtered either.
+    static void lookup_init_with_prefetch(const JoinHashTableItems& table_items, const Buffer<uint32_t>& buckets,
+                                          const Buffer<uint8_t>& is_nulls, uint32_t row_count, Buffer<uint32_t>* next) {
+        const auto& first = table_items.first;
+        const auto& bucket_filter = table_items.bucket_filter;
+        if (!bucket_filter.empty()) {
+            for (uint32_t i = 0; i < row_count; i++) {
+                if (i + LOOKUP_PREFETCH_DISTANCE < row_count && is_nulls[i + LOOKUP_PREFETCH_DISTANCE] == 0 &&
+                    bucket_filter_hit(bucket_filter, buckets[i + LOOKUP_PREFETCH_DISTANCE])) {
+                    PREFETCH(first.data() + buckets[i + LOOKUP_PREFETCH_DISTANCE]);
+                }
+                (*next)[i] = is_nulls[i] == 0 && bucket_filter_hit(bucket_filter, buckets[i]) ? first[buckets[i]] : 0;
+            }
+            return;
+        }
+        if (first.size() < MIN_BUCKET_SIZE_TO_PREFETCH) {
+            for (uint32_t i = 0; i < row_count; i++) {
+                (*next)[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+            }
+            return;
+        }
+        for (uint32_t i = 0; i < row_count; i++) {
+            if (i + LOOKUP_PREFETCH_DISTANCE < row_count && is_nulls[i + LOOKUP_PREFETCH_DISTANCE] == 0) {
+                PREFETCH(first.data() + buckets[i + LOOKUP_PREFETCH_DISTANCE]);
+            }
+            (*next)[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+        }
+    }
+
     // combine keys into fixed size key by column.
     template <LogicalType LT>
     static void serialize_fixed_size_key_column(const Columns& key_columns, Column* fixed_size_key_column,
@@ -372,8 +463,15 @@ public:
 
     static void prepare(RuntimeState* runtime, JoinHashTableItems* table_items);
     static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items);
-    static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
-                                     HashTableProbeState* probe_state);
+    static Status construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                       HashTableProbeState* probe_state);
+
+private:
+    static void _build_keys(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
+                            const Buffer<CppType>& data, uint32_t start, uint32_t count);
+    static void _build_nullable_keys(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
+                                     const Buffer<CppType>& data, const Buffer<uint8_t>& null_array, uint32_t start,
+                                     uint32_t count);
 };
 
 template <LogicalType LT>
@@ -384,8 +482,8 @@ public:
 
     static void prepare(RuntimeState* runtime, JoinHashTableItems* table_items);
     static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items);
-    static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
-                                     HashTableProbeState* probe_state);
+    static Status construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                       HashTableProbeState* probe_state);
 };
 
 template <LogicalType LT>
@@ -399,8 +497,8 @@ public:
     static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items) {
         return ColumnHelper::as_raw_column<const ColumnType>(table_items.build_key_column)->get_data();
     }
-    static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
-                                     HashTableProbeState* probe_state);
+    static Status construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                       HashTableProbeState* probe_state);
 
 private:
     static void _build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
@@ -415,8 +513,8 @@ class SerializedJoinBuildFunc {
 public:
     static void prepare(RuntimeState* state, JoinHashTableItems* table_items);
     static const Buffer<Slice>& get_key_data(const JoinHashTableItems& table_items) { return table_items.build_slice; }
-    static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
-                                     HashTableProbeState* probe_state);
+    static Status construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                       HashTableProbeState* probe_state);
 
 private:
     static void _build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
@@ -485,6 +583,7 @@ public:
     static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {
         probe_state->probe_pool = std::make_unique<MemPool>();
         probe_state->probe_slice.resize(state->chunk_size());
+        probe_state->probe_slice_sizes.resize(state->chunk_size());
         probe_state->is_nulls.resize(state->chunk_size());
     }
 
@@ -494,9 +593,10 @@ public:
 
 private:
     static void _probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
-                              const Columns& data_columns, uint8_t* ptr);
+                              const Columns& data_columns, uint8_t* ptr, uint32_t max_one_row_size);
     static void _probe_nullable_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
-                                       const Columns& data_columns, const NullColumns& null_columns, uint8_t* ptr);
+                                       const Columns& data_columns, const NullColumns& null_columns, uint8_t* ptr,
+                                       uint32_t max_one_row_size);
 };
 
 // When hash table is empty, specific its implemention.
@@ -508,7 +608,7 @@ public:
 
     void build_prepare(RuntimeState* state) { return; }
     void probe_prepare(RuntimeState* state) { return; }
-    void build(RuntimeState* state) { return; }
+    Status build(RuntimeState* state) { return Status::OK(); }
     void probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
                bool* has_remain) {
         DCHECK_EQ(0, _table_items->row_count);
@@ -606,7 +706,7 @@ public:
     void build_prepare(RuntimeState* state);
     void probe_prepare(RuntimeState* state);
 
-    void build(RuntimeState* state);
+    Status build(RuntimeState* state);
     void probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
                bool* has_remain);
     void probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* has_remain);
@@ -51,27 +51,59 @@ const Buffer<typename JoinBuildFunc<LT>::CppType>& JoinBuildFunc<LT>::get_key_da
 }
 
 template <LogicalType LT>
-void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
-                                             HashTableProbeState* probe_state) {
+Status JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                               HashTableProbeState* probe_state) {
     auto& data = get_key_data(*table_items);
+    uint32_t row_count = table_items->row_count;
+    uint32_t quo = row_count / state->chunk_size();
+    uint32_t rem = row_count % state->chunk_size();
+
     if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
-        for (size_t i = 1; i < table_items->row_count + 1; i++) {
-            if (null_array[i] == 0) {
-                uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
-                table_items->next[i] = table_items->first[bucket_num];
-                table_items->first[bucket_num] = i;
-            }
+        for (uint32_t i = 0; i < quo; i++) {
+            RETURN_IF_CANCELLED(state);
+            _build_nullable_keys(table_items, probe_state, data, null_array, 1 + state->chunk_size() * i,
+                                 state->chunk_size());
         }
+        _build_nullable_keys(table_items, probe_state, data, null_array, 1 + state->chunk_size() * quo, rem);
     } else {
-        for (size_t i = 1; i < table_items->row_count + 1; i++) {
-            uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
-            table_items->next[i] = table_items->first[bucket_num];
-            table_items->first[bucket_num] = i;
+        for (uint32_t i = 0; i < quo; i++) {
+            RETURN_IF_CANCELLED(state);
+            _build_keys(table_items, probe_state, data, 1 + state->chunk_size() * i, state->chunk_size());
         }
+        _build_keys(table_items, probe_state, data, 1 + state->chunk_size() * quo, rem);
     }
     table_items->calculate_ht_info(table_items->key_columns[0]->byte_size());
+    return Status::OK();
+}
+
+template <LogicalType LT>
+void JoinBuildFunc<LT>::_build_keys(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
+                                    const Buffer<CppType>& data, uint32_t start, uint32_t count) {
+    // Two-pass insert like FixedSizeJoinBuildFunc: computing all bucket nums of a batch first
+    // keeps the hash computation out of the chained-store loop, which is the only serial
+    // dependency left.
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
+        table_items->first[probe_state->buckets[i]] = start + i;
+    }
+}
+
+template <LogicalType LT>
+void JoinBuildFunc<LT>::_build_nullable_keys(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
+                                             const Buffer<CppType>& data, const Buffer<uint8_t>& null_array,
+                                             uint32_t start, uint32_t count) {
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (null_array[start + i] == 0) {
+            table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
+            table_items->first[probe_state->buckets[i]] = start + i;
+        }
+    }
 }
 
 template <LogicalType LT>
@@ -95,8 +127,8 @@ const Buffer<typename DirectMappingJoinBuildFunc<LT>::CppType>& DirectMappingJoi
 }
 
 template <LogicalType LT>
-void DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
-                                                          HashTableProbeState* probe_state) {
+Status DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                                            HashTableProbeState* probe_state) {
     static constexpr CppType MIN_VALUE = RunTimeTypeLimits<LT>::min_value();
 
     auto& data = get_key_data(*table_items);
@@ -104,6 +136,9 @@ void DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, J
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
+            if ((i & (JoinHashMapHelper::BUILD_CANCEL_CHECK_INTERVAL - 1)) == 0) {
+                RETURN_IF_CANCELLED(state);
+            }
             if (null_array[i] == 0) {
                 size_t buckets = data[i] - MIN_VALUE;
                 table_items->next[i] = table_items->first[buckets];
@@ -112,12 +147,16 @@ void DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, J
         }
     } else {
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
+            if ((i & (JoinHashMapHelper::BUILD_CANCEL_CHECK_INTERVAL - 1)) == 0) {
+                RETURN_IF_CANCELLED(state);
+            }
             size_t buckets = data[i] - MIN_VALUE;
             table_items->next[i] = table_items->first[buckets];
             table_items->first[buckets] = i;
         }
     }
     table_items->calculate_ht_info(table_items->key_columns[0]->byte_size());
+    return Status::OK();
 }
 
 template <LogicalType LT>
@@ -129,8 +168,8 @@ void FixedSizeJoinBuildFunc<LT>::prepare(RuntimeState* state, JoinHashTableItems
 }
 
 template <LogicalType LT>
-void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
-                                                      HashTableProbeState* probe_state) {
+Status FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                                        HashTableProbeState* probe_state) {
     uint32_t row_count = table_items->row_count;
 
     // prepare columns
@@ -156,6 +195,7 @@ void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinH
 
     if (!null_columns.empty()) {
         for (size_t i = 0; i < quo; i++) {
+            RETURN_IF_CANCELLED(state);
             _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * i,
                                     state->chunk_size());
         }
@@ -163,11 +203,13 @@ void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinH
                                 rem);
     } else {
         for (size_t i = 0; i < quo; i++) {
+            RETURN_IF_CANCELLED(state);
             _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * i, state->chunk_size());
         }
         _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem);
     }
     table_items->calculate_ht_info(table_items->build_key_column->byte_size());
+    return Status::OK();
 }
 
 template <LogicalType LT>
@@ -270,27 +312,20 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
 
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
-            for (size_t i = 0; i < probe_row_count; i++) {
-                if (null_array[i] == 0) {
-                    probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-                } else {
-                    probe_state->next[i] = 0;
-                }
-            }
+            JoinHashMapHelper::lookup_init_with_prefetch(table_items, probe_state->buckets, null_array,
+                                                         probe_row_count, &probe_state->next);
             probe_state->null_array = &nullable_column->null_column()->get_data();
         } else {
-            for (size_t i = 0; i < probe_row_count; i++) {
-                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-            }
+            JoinHashMapHelper::lookup_init_with_prefetch(table_items, probe_state->buckets, probe_row_count,
+                                                         &probe_state->next);
             probe_state->null_array = nullptr;
         }
         probe_state->consider_probe_time_locality();
         return;
     }
 
-    for (size_t i = 0; i < probe_row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, probe_state->buckets, probe_row_count,
+                                                 &probe_state->next);
     probe_state->consider_probe_time_locality();
     probe_state->null_array = nullptr;
 }
@@ -351,9 +386,8 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, probe_state->buckets, row_count,
+                                                 &probe_state->next);
 }
 
 template <LogicalType LT>
@@ -377,13 +411,8 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
-        }
-    }
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, probe_state->buckets, probe_state->is_nulls,
+                                                 row_count, &probe_state->next);
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -411,8 +440,8 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::probe_prepare(RuntimeState* state) {
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
-void JoinHashMap<LT, BuildFunc, ProbeFunc>::build(RuntimeState* state) {
-    BuildFunc().construct_hash_table(state, _table_items, _probe_state);
+Status JoinHashMap<LT, BuildFunc, ProbeFunc>::build(RuntimeState* state) {
+    return BuildFunc().construct_hash_table(state, _table_items, _probe_state);
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
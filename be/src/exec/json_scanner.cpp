@@ -399,6 +399,9 @@ Status JsonReader::close() {
  *      value2     30
  */
 Status JsonReader::read_chunk(Chunk* chunk, int32_t rows_to_read) {
+    if (!_scanner->_json_paths.empty()) {
+        _build_jsonpath_column_plan(chunk);
+    }
     int32_t rows_read = 0;
     while (rows_read < rows_to_read) {
         if (_empty_parser) {
@@ -610,19 +613,31 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
     return Status::OK();
 }
 
+void JsonReader::_build_jsonpath_column_plan(Chunk* chunk) {
+    _jsonpath_column_plan.assign(_slot_descs.size(), {});
+    for (size_t i = 0; i < _slot_descs.size(); i++) {
+        if (_slot_descs[i] == nullptr) {
+            continue;
+        }
+        auto& item = _jsonpath_column_plan[i];
+        // The columns in JsonReader's chunk are all in NullableColumn type;
+        item.column = down_cast<NullableColumn*>(chunk->get_column_by_slot_id(_slot_descs[i]->id()).get());
+        item.is_op = _slot_descs[i]->col_name() == "__op";
+    }
+}
+
 Status JsonReader::_construct_row_with_jsonpath(simdjson::ondemand::object* row, Chunk* chunk) {
     size_t slot_size = _slot_descs.size();
     size_t jsonpath_size = _scanner->_json_paths.size();
+    DCHECK_EQ(slot_size, _jsonpath_column_plan.size());
     for (size_t i = 0; i < slot_size; i++) {
         if (_slot_descs[i] == nullptr) {
             continue;
         }
-        const char* column_name = _slot_descs[i]->col_name().c_str();
-
-        // The columns in JsonReader's chunk are all in NullableColumn type;
-        auto column = down_cast<NullableColumn*>(chunk->get_column_by_slot_id(_slot_descs[i]->id()).get());
+        auto* column = _jsonpath_column_plan[i].column;
+        const bool is_op = _jsonpath_column_plan[i].is_op;
         if (i >= jsonpath_size) {
-            if (strcmp(column_name, "__op") == 0) {
+            if (is_op) {
                 // special treatment for __op column, fill default value '0' rather than null
                 if (column->is_binary()) {
                     column->append_strings(std::vector{Slice{"0"}});
@@ -654,7 +669,7 @@ Status JsonReader::_construct_row_with_jsonpath(simdjson::ondemand::object* row,
             if (st.ok()) {
                 RETURN_IF_ERROR(_construct_column(val, column, _slot_descs[i]->type(), _slot_descs[i]->col_name()));
             } else if (st.is_not_found()) {
-                if (strcmp(column_name, "__op") == 0) {
+                if (is_op) {
                     // special treatment for __op column, fill default value '0' rather than null
                     if (column->is_binary()) {
                         column->append_strings(std::vector{Slice{"0"}});
@@ -796,24 +811,26 @@ Status JsonReader::_read_and_parse_json() {
         if (_scanner->_strip_outer_array) {
             // Expand outer array automatically according to _is_ndjson.
             if (_is_ndjson) {
-                _parser = std::make_unique<ExpandedJsonDocumentStreamParserWithRoot>(&_simdjson_parser,
+                _parser = std::make_unique<ExpandedJsonDocumentStreamParserWithRoot>(&_scanner->_simdjson_parser,
                                                                                      _scanner->_root_paths);
             } else {
-                _parser = std::make_unique<ExpandedJsonArrayParserWithRoot>(&_simdjson_parser, _scanner->_root_paths);
+                _parser = std::make_unique<ExpandedJsonArrayParserWithRoot>(&_scanner->_simdjson_parser,
+                                                                            _scanner->_root_paths);
             }
         } else {
             if (_is_ndjson) {
-                _parser = std::make_unique<JsonDocumentStreamParserWithRoot>(&_simdjson_parser, _scanner->_root_paths);
+                _parser = std::make_unique<JsonDocumentStreamParserWithRoot>(&_scanner->_simdjson_parser,
+                                                                             _scanner->_root_paths);
             } else {
-                _parser = std::make_unique<JsonArrayParserWithRoot>(&_simdjson_parser, _scanner->_root_paths);
+                _parser = std::make_unique<JsonArrayParserWithRoot>(&_scanner->_simdjson_parser, _scanner->_root_paths);
             }
         }
     } else {
         // Without json root set, the strip_outer_array determines whether to expand outer array.
         if (_scanner->_strip_outer_array) {
-            _parser = std::make_unique<JsonArrayParser>(&_simdjson_parser);
+            _parser = std::make_unique<JsonArrayParser>(&_scanner->_simdjson_parser);
         } else {
-            _parser = std::make_unique<JsonDocumentStreamParser>(&_simdjson_parser);
+            _parser = std::make_unique<JsonDocumentStreamParser>(&_scanner->_simdjson_parser);
         }
     }
 
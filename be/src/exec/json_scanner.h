@@ -60,6 +60,12 @@ private:
     int _next_range;
     const uint64_t _max_chunk_size;
 
+    // For performance reason, the simdjson parser is owned by the scanner and reused
+    // over all files of the scan range instead of being re-created per JsonReader.
+    // https://github.com/simdjson/simdjson/blob/master/doc/performance.md
+    // NOTE: declared before _cur_file_reader so it outlives the reader using it.
+    simdjson::ondemand::parser _simdjson_parser;
+
     // used to hold current StreamLoadPipe
     std::unique_ptr<JsonReader> _cur_file_reader;
     bool _cur_file_eof; // indicate the current file is eof
@@ -111,6 +117,8 @@ private:
     Status _read_file_broker();
     Status _parse_payload();
 
+    void _build_jsonpath_column_plan(Chunk* chunk);
+
     Status _construct_row(simdjson::ondemand::object* row, Chunk* chunk);
 
     Status _construct_row_without_jsonpath(simdjson::ondemand::object* row, Chunk* chunk);
@@ -134,14 +142,19 @@ private:
     // so the lifecycle of _slot_descs should be longer than _slot_desc_dict;
     std::unordered_map<std::string_view, SlotDescriptor*> _slot_desc_dict;
 
-    // For performance reason, the simdjson parser should be reused over several files.
-    //https://github.com/simdjson/simdjson/blob/master/doc/performance.md
-    simdjson::ondemand::parser _simdjson_parser;
     bool _is_ndjson = false;
 
     std::unique_ptr<JsonParser> _parser;
     bool _empty_parser = true;
 
+    // Destination columns for the jsonpath mode, resolved once per chunk in
+    // read_chunk so each row skips the per-slot column lookups in the chunk.
+    struct JsonPathColumnPlanItem {
+        NullableColumn* column = nullptr;
+        bool is_op = false;
+    };
+    std::vector<JsonPathColumnPlanItem> _jsonpath_column_plan;
+
     // record the chunk column position for previous parsed json object
     std::vector<PreviousParsedItem> _prev_parsed_position;
     // record the parsed column index for current json object
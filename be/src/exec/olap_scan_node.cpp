@@ -470,15 +470,20 @@ StatusOr<bool> OlapScanNode::_could_tablet_internal_parallel(
         return false;
     }
     bool force_split = tablet_internal_parallel_mode == TTabletInternalParallelMode::type::FORCE_SPLIT;
-    // The enough number of tablets shouldn't use tablet internal parallel.
-    if (!force_split && num_total_scan_ranges >= pipeline_dop) {
-        return false;
-    }
 
     int64_t num_table_rows = 0;
+    int64_t max_tablet_rows = 0;
     for (const auto& tablet_scan_range : scan_ranges) {
         ASSIGN_OR_RETURN(TabletSharedPtr tablet, get_tablet(&(tablet_scan_range.scan_range.internal_scan_range)));
         num_table_rows += static_cast<int64_t>(tablet->num_rows());
+        max_tablet_rows = std::max(max_tablet_rows, static_cast<int64_t>(tablet->num_rows()));
+    }
+
+    // The enough number of tablets shouldn't use tablet internal parallel,
+    // unless one tablet holds most of the rows: then the tablet count doesn't help,
+    // a single morsel bounds the scan tail, and splitting is still worthwhile.
+    if (!force_split && num_total_scan_ranges >= pipeline_dop && max_tablet_rows * 2 <= num_table_rows) {
+        return false;
     }
 
     // splitted_scan_rows is restricted in the range [min_splitted_scan_rows, max_splitted_scan_rows].
@@ -701,6 +706,7 @@ Status OlapScanNode::_start_scan_thread(RuntimeState* state) {
             scanner_params.skip_aggregation = _olap_scan_node.is_preaggregation;
             scanner_params.need_agg_finalize = true;
             scanner_params.unused_output_columns = &_unused_output_columns;
+            scanner_params.column_access_paths = &_column_access_paths;
             // one scan range has multi tablet_scanners, so only the first scanner need to update scan range
             if (i == 0) {
                 scanner_params.update_num_scan_range = true;
@@ -768,11 +774,11 @@ Status OlapScanNode::_capture_tablet_rowsets() {
         ASSIGN_OR_RETURN(TabletSharedPtr tablet, get_tablet(scan_range.get()));
 
         // Capture row sets of this version tablet.
-        {
+        if (!tablet->try_capture_consistent_rowsets(Version(0, version), &_tablet_rowsets[i])) {
             std::shared_lock l(tablet->get_header_lock());
             RETURN_IF_ERROR(tablet->capture_consistent_rowsets(Version(0, version), &_tablet_rowsets[i]));
-            Rowset::acquire_readers(_tablet_rowsets[i]);
         }
+        Rowset::acquire_readers(_tablet_rowsets[i]);
     }
 
     return Status::OK();
@@ -156,7 +156,9 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(c
  * (3) otherwise or the ADJUST state sustains continuous_limit times, shifting to SELECTIVE_PREAGG state.
  *
  * PASS_THROUGH state sustains continuous_limit times, it will force doing preaggregation if the hash table's size <
- * MaxHtSize, otherwise it will go to ADJUST state. Doing FORCE_PREAGG aims freshening the hash table with new coming
+ * MaxHtSize, otherwise it will go to ADJUST state. When a hash table larger than MaxHtSize was accumulated before the
+ * reduction collapsed, PASS_THROUGH streams the accumulated states downstream and releases the table
+ * (streaming_agg_release_ht_on_pass_through), so the memory is not pinned for the rest of the query. Doing FORCE_PREAGG aims freshening the hash table with new coming
  * rows, helping to aggregating new coming chunks with limiting the size of hash table.
  *
  * FORCE_PREAGG/PREAGG state aggregates AggrAutoContext::PreaggLimit chunks, then going to ADJUST state. PreaggLimit
@@ -248,6 +250,16 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
     case AggrAutoState::PASS_THROUGH: {
         RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
         _auto_context.pass_through_count++;
+        if (config::streaming_agg_release_ht_on_pass_through && allocated_bytes >= AggrAutoContext::MaxHtSize &&
+            _aggregator->hash_map_variant().size() > 0) {
+            // The reduction collapsed mid-stream while a large hash table had already been
+            // built. Flush the accumulated states downstream and release the table instead
+            // of pinning it for the rest of the query; FORCE_PREAGG rebuilds it with fresh
+            // rows once the reduction recovers.
+            _aggregator->set_streaming_all_states(true);
+            VLOG_ROW << "auto agg: " << _auto_context.get_auto_state_string(_auto_state)
+                     << " releases the hash table of " << allocated_bytes << " bytes";
+        }
         if (_auto_context.pass_through_count > continuous_limit) {
             _auto_state =
                     allocated_bytes < AggrAutoContext::MaxHtSize ? AggrAutoState::FORCE_PREAGG : AggrAutoState::ADJUST;
@@ -14,16 +14,23 @@
 
 #include "exec/pipeline/aggregate/sorted_aggregate_streaming_sink_operator.h"
 
+#include "column/chunk.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/sorted_streaming_aggregator.h"
+#include "exec/sorting/merge.h"
+#include "gutil/casts.h"
+#include "runtime/chunk_cursor.h"
 #include "runtime/current_thread.h"
 
 namespace starrocks::pipeline {
 SortedAggregateStreamingSinkOperator::SortedAggregateStreamingSinkOperator(
         OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-        std::shared_ptr<SortedStreamingAggregator> aggregator)
+        std::shared_ptr<SortedStreamingAggregator> aggregator,
+        std::shared_ptr<SortedStreamingAggregator> run_aggregator)
         : Operator(factory, id, "sorted_aggregate_streaming_sink", plan_node_id, false, driver_sequence),
-          _aggregator(std::move(aggregator)) {
+          _aggregator(std::move(aggregator)),
+          _run_aggregator(std::move(run_aggregator)) {
     _aggregator->ref();
 }
 
@@ -31,10 +38,18 @@ Status SortedAggregateStreamingSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     RETURN_IF_ERROR(_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get()));
     _accumulator.set_max_size(state->chunk_size());
-    return _aggregator->open(state);
+    RETURN_IF_ERROR(_aggregator->open(state));
+    if (_run_aggregator != nullptr) {
+        RETURN_IF_ERROR(_run_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get()));
+        RETURN_IF_ERROR(_run_aggregator->open(state));
+    }
+    return Status::OK();
 }
 
 void SortedAggregateStreamingSinkOperator::close(RuntimeState* state) {
+    if (_run_aggregator != nullptr) {
+        _run_aggregator->close(state);
+    }
     _aggregator->unref(state);
     Operator::close(state);
 }
@@ -49,6 +64,9 @@ bool SortedAggregateStreamingSinkOperator::is_finished() const {
 
 Status SortedAggregateStreamingSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
+    if (_run_aggregator != nullptr) {
+        RETURN_IF_ERROR(_finish_merge_runs(state));
+    }
     ASSIGN_OR_RETURN(auto res, _aggregator->pull_eos_chunk());
     DCHECK(_accumulator.need_input());
     if (res && !res->is_empty()) {
@@ -70,10 +88,16 @@ StatusOr<ChunkPtr> SortedAggregateStreamingSinkOperator::pull_chunk(RuntimeState
 }
 
 Status SortedAggregateStreamingSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
-    size_t chunk_size = chunk->num_rows();
-    _aggregator->update_num_input_rows(chunk_size);
+    _aggregator->update_num_input_rows(chunk->num_rows());
     COUNTER_SET(_aggregator->input_row_count(), _aggregator->num_input_rows());
+    if (_run_aggregator != nullptr) {
+        return _push_run_chunk(chunk);
+    }
+    return _push_streaming_chunk(chunk);
+}
 
+Status SortedAggregateStreamingSinkOperator::_push_streaming_chunk(const ChunkPtr& chunk) {
+    size_t chunk_size = chunk->num_rows();
     RETURN_IF_ERROR(_aggregator->evaluate_groupby_exprs(chunk.get()));
     RETURN_IF_ERROR(_aggregator->evaluate_agg_fn_exprs(chunk.get()));
     ChunkPtr res;
@@ -95,10 +119,152 @@ Status SortedAggregateStreamingSinkOperator::push_chunk(RuntimeState* state, con
     return Status::OK();
 }
 
+Status SortedAggregateStreamingSinkOperator::_push_run_chunk(const ChunkPtr& chunk) {
+    size_t chunk_size = chunk->num_rows();
+    if (chunk_size == 0) {
+        return Status::OK();
+    }
+
+    RETURN_IF_ERROR(_run_aggregator->evaluate_groupby_exprs(chunk.get()));
+    const Columns& group_by_columns = _run_aggregator->group_by_columns();
+
+    if (_last_run_key.empty()) {
+        _last_run_key.resize(group_by_columns.size());
+        for (size_t i = 0; i < _last_run_key.size(); ++i) {
+            _last_run_key[i] = group_by_columns[i]->clone_empty();
+        }
+    } else {
+        // a first row sorting below the last row of the previous chunk starts a new sorted run
+        for (size_t i = 0; i < group_by_columns.size(); ++i) {
+            int cmp = group_by_columns[i]->compare_at(0, 0, *_last_run_key[i], 1);
+            if (cmp < 0) {
+                RETURN_IF_ERROR(_close_current_run());
+                break;
+            }
+            if (cmp > 0) {
+                break;
+            }
+        }
+    }
+    for (size_t i = 0; i < _last_run_key.size(); ++i) {
+        _last_run_key[i]->reset_column();
+        _last_run_key[i]->append(*group_by_columns[i], chunk_size - 1, 1);
+    }
+
+    ChunkPtr res;
+    if (!_run_aggregator->only_group_by_exprs()) {
+        RETURN_IF_ERROR(_run_aggregator->evaluate_agg_fn_exprs(chunk.get()));
+        ASSIGN_OR_RETURN(res, _run_aggregator->streaming_compute_agg_state(chunk_size));
+    } else {
+        ASSIGN_OR_RETURN(res, _run_aggregator->streaming_compute_distinct(chunk_size));
+    }
+    if (res && !res->is_empty()) {
+        _current_run.emplace_back(std::make_unique<Chunk>(std::move(*res)));
+    }
+    return Status::OK();
+}
+
+Status SortedAggregateStreamingSinkOperator::_close_current_run() {
+    ASSIGN_OR_RETURN(auto res, _run_aggregator->pull_eos_chunk());
+    if (res && !res->is_empty()) {
+        _current_run.emplace_back(std::make_unique<Chunk>(std::move(*res)));
+    }
+    if (!_current_run.empty()) {
+        _sorted_runs.emplace_back(std::move(_current_run));
+        _current_run.clear();
+    }
+    return Status::OK();
+}
+
+Status SortedAggregateStreamingSinkOperator::_consume_merged_chunk(ChunkUniquePtr chunk) {
+    if (chunk == nullptr || chunk->is_empty()) {
+        return Status::OK();
+    }
+    size_t chunk_size = chunk->num_rows();
+    ChunkPtr res;
+    RETURN_IF_ERROR(_aggregator->evaluate_groupby_exprs(chunk.get()));
+    if (!_aggregator->only_group_by_exprs()) {
+        RETURN_IF_ERROR(_aggregator->evaluate_agg_fn_exprs(chunk.get(), true));
+        ASSIGN_OR_RETURN(res, _aggregator->streaming_compute_agg_state(chunk_size, false));
+    } else {
+        ASSIGN_OR_RETURN(res, _aggregator->streaming_compute_distinct(chunk_size));
+    }
+    if (res && !res->is_empty()) {
+        _accumulator.push(std::move(res));
+    }
+    while (_accumulator.has_output()) {
+        auto accumulated = std::move(_accumulator.pull());
+        _aggregator->offer_chunk_to_buffer(accumulated);
+    }
+    return Status::OK();
+}
+
+Status SortedAggregateStreamingSinkOperator::_finish_merge_runs(RuntimeState* state) {
+    RETURN_IF_ERROR(_close_current_run());
+    if (_sorted_runs.size() <= 1) {
+        // a single sorted run needs no merge, but still the final pass to combine its
+        // intermediate states into the output form
+        if (!_sorted_runs.empty()) {
+            for (auto& chunk : _sorted_runs[0]) {
+                RETURN_IF_ERROR(_consume_merged_chunk(std::move(chunk)));
+            }
+        }
+    } else {
+        auto* factory = down_cast<SortedAggregateStreamingSinkOperatorFactory*>(_factory);
+        std::vector<std::unique_ptr<SimpleChunkSortCursor>> cursors;
+        cursors.reserve(_sorted_runs.size());
+        for (auto& run : _sorted_runs) {
+            cursors.emplace_back(std::make_unique<SimpleChunkSortCursor>(
+                    [&run, pos = size_t(0)](ChunkUniquePtr* chunk, bool* eos) mutable -> bool {
+                        if (chunk == nullptr || eos == nullptr) {
+                            return true;
+                        }
+                        if (pos >= run.size()) {
+                            *eos = true;
+                            return false;
+                        }
+                        *chunk = std::move(run[pos++]);
+                        return true;
+                    },
+                    factory->sort_exprs()));
+        }
+        RETURN_IF_ERROR(merge_sorted_cursor_cascade(
+                factory->sort_desc(), std::move(cursors),
+                [this](ChunkUniquePtr chunk) { return _consume_merged_chunk(std::move(chunk)); }));
+    }
+    _sorted_runs.clear();
+    return Status::OK();
+}
+
+Status SortedAggregateStreamingSinkOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    _merge_runs = config::enable_sorted_aggregate_merge_runs;
+    if (!_merge_runs) {
+        return Status::OK();
+    }
+
+    // the per-run pre-aggregator always produces mergeable intermediate output
+    _run_aggregator_factory = std::make_shared<StreamingAggregatorFactory>(_aggregator_factory->t_node());
+    _run_aggregator_factory->set_aggr_mode(AM_STREAMING_PRE_CACHE);
+
+    // runs are merged on the group by keys, in the ascending null first order olap scans deliver
+    const auto& group_by_expr = _aggregator_factory->aggregator_param()->grouping_exprs;
+    RETURN_IF_ERROR(_sort_exprs.init(group_by_expr, nullptr, &_pool, state));
+    _sort_desc = SortDescs::asc_null_first(group_by_expr.size());
+    RETURN_IF_ERROR(_sort_exprs.prepare(state, {}, {}));
+    RETURN_IF_ERROR(_sort_exprs.open(state));
+    return Status::OK();
+}
+
 OperatorPtr SortedAggregateStreamingSinkOperatorFactory::create(int32_t degree_of_parallelism,
                                                                 int32_t driver_sequence) {
+    std::shared_ptr<SortedStreamingAggregator> run_aggregator;
+    if (_merge_runs) {
+        run_aggregator = _run_aggregator_factory->get_or_create(driver_sequence);
+    }
     return std::make_shared<SortedAggregateStreamingSinkOperator>(this, _id, _plan_node_id, driver_sequence,
-                                                                  _aggregator_factory->get_or_create(driver_sequence));
+                                                                  _aggregator_factory->get_or_create(driver_sequence),
+                                                                  std::move(run_aggregator));
 }
 
 } // namespace starrocks::pipeline
@@ -15,9 +15,13 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
+#include "common/object_pool.h"
 #include "exec/aggregator.h"
 #include "exec/pipeline/operator.h"
+#include "exec/sort_exec_exprs.h"
+#include "exec/sorting/sorting.h"
 #include "storage/chunk_helper.h"
 
 namespace starrocks::pipeline {
@@ -26,7 +30,8 @@ class SortedAggregateStreamingSinkOperator : public Operator {
 public:
     SortedAggregateStreamingSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
                                          int32_t driver_sequence,
-                                         std::shared_ptr<SortedStreamingAggregator> aggregator);
+                                         std::shared_ptr<SortedStreamingAggregator> aggregator,
+                                         std::shared_ptr<SortedStreamingAggregator> run_aggregator);
     ~SortedAggregateStreamingSinkOperator() override = default;
 
     bool has_output() const override { return false; }
@@ -41,9 +46,28 @@ public:
     [[nodiscard]] Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
 
 private:
+    // Direct streaming: aggregate the chunk with |_aggregator| and offer the result downstream.
+    [[nodiscard]] Status _push_streaming_chunk(const ChunkPtr& chunk);
+    // Merge-run mode: pre-aggregate the chunk into the current sorted run with |_run_aggregator|.
+    [[nodiscard]] Status _push_run_chunk(const ChunkPtr& chunk);
+    // Flush the open group of |_run_aggregator| and seal the current run.
+    [[nodiscard]] Status _close_current_run();
+    // Re-aggregate one chunk of the merged intermediate stream with |_aggregator|.
+    [[nodiscard]] Status _consume_merged_chunk(ChunkUniquePtr chunk);
+    [[nodiscard]] Status _finish_merge_runs(RuntimeState* state);
+
     bool _is_finished = false;
     ChunkPipelineAccumulator _accumulator;
     std::shared_ptr<SortedStreamingAggregator> _aggregator;
+
+    // Only used when config::enable_sorted_aggregate_merge_runs is on: the per-run pre-aggregator
+    // (intermediate output), the reduced runs buffered until set_finishing, and the last group by
+    // row of the previous chunk used to detect run boundaries. The buffers hold aggregated rows,
+    // so their footprint is bounded by the distinct keys of the driver, like hash aggregation.
+    std::shared_ptr<SortedStreamingAggregator> _run_aggregator;
+    std::vector<std::vector<ChunkUniquePtr>> _sorted_runs;
+    std::vector<ChunkUniquePtr> _current_run;
+    Columns _last_run_key;
 };
 
 class SortedAggregateStreamingSinkOperatorFactory final : public OperatorFactory {
@@ -60,10 +84,23 @@ public:
 
     ~SortedAggregateStreamingSinkOperatorFactory() override = default;
 
+    [[nodiscard]] Status prepare(RuntimeState* state) override;
+
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
 
+    bool merge_runs() const { return _merge_runs; }
+    const std::vector<ExprContext*>* sort_exprs() const { return &_sort_exprs.lhs_ordering_expr_ctxs(); }
+    const SortDescs& sort_desc() const { return _sort_desc; }
+
 private:
     StreamingAggregatorFactoryPtr _aggregator_factory = nullptr;
+
+    // merge-run mode, see config::enable_sorted_aggregate_merge_runs
+    bool _merge_runs = false;
+    StreamingAggregatorFactoryPtr _run_aggregator_factory = nullptr;
+    ObjectPool _pool;
+    SortExecExprs _sort_exprs;
+    SortDescs _sort_desc;
 };
 
 } // namespace starrocks::pipeline
@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/bucket_process_operator.h"
 
+#include "common/config.h"
 #include "exec/pipeline/aggregate/spillable_aggregate_blocking_sink_operator.h"
 #include "exec/pipeline/aggregate/spillable_aggregate_distinct_blocking_operator.h"
 #include "exec/pipeline/operator.h"
@@ -38,6 +39,52 @@ Status BucketProcessContext::finish_current_sink(RuntimeState* state) {
     return Status::OK();
 }
 
+Status BucketProcessContext::flush_pending_chunks_locked(RuntimeState* state) {
+    while (!pending_chunks.empty() && !current_bucket_sink_finished && !all_input_finishing) {
+        auto chunk = pending_chunks.front();
+        pending_chunks.pop_front();
+        auto info = chunk->owner_info();
+        if (!chunk->is_empty()) {
+            RETURN_IF_ERROR(sink->push_chunk(state, chunk));
+        }
+        // short-circuit case. such as group by limit
+        if (sink->is_finished()) {
+            all_input_finishing = true;
+            pending_chunks.clear();
+            return Status::OK();
+        }
+        if (info.is_last_chunk()) {
+            RETURN_IF_ERROR(finish_current_sink(state));
+        }
+    }
+    return Status::OK();
+}
+
+Status BucketProcessContext::finish_all_input_locked(RuntimeState* state) {
+    auto defer = DeferOp([&]() {
+        if (spill_channel != nullptr) {
+            spill_channel->set_finishing();
+        }
+    });
+    all_input_finishing = true;
+    DCHECK(reset_version <= sink_complete_version);
+    // acquire finish token and never release
+    bool token_acquired = token;
+    if (!token_acquired && token.compare_exchange_strong(token_acquired, true)) {
+        // In this condition, if reset_version == ctx->sink_version. indicates that the
+        // Possibility 1: The BucketSourceOperator got the token first and executed it.
+        //
+        // Possibility 2: BucketSink did not receive the EOS chunk, possibly short-circuited.
+        //
+        // At this point we need to re-execute set_finishing on the sub operator to ensure that is_finished() returns true.
+        if (reset_version == sink_complete_version) {
+            RETURN_IF_ERROR(finish_current_sink(state));
+        }
+        current_bucket_sink_finished = true;
+    }
+    return Status::OK();
+}
+
 Status BucketProcessSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     RETURN_IF_ERROR(_ctx->sink->prepare(state));
@@ -50,7 +97,15 @@ void BucketProcessSinkOperator::close(RuntimeState* state) {
 
 bool BucketProcessSinkOperator::need_input() const {
     if (_ctx->current_bucket_sink_finished) {
-        return false;
+        // The current bucket is draining on the source side. Keep accepting a bounded
+        // number of chunks for the next bucket so the upstream scan runs through the
+        // bucket boundary instead of idling until the drain and reset finish.
+        if (_ctx->all_input_finishing || config::pipeline_bucket_process_max_buffered_chunks <= 0) {
+            return false;
+        }
+        std::lock_guard guard(_ctx->pending_chunk_mutex);
+        return _ctx->pending_chunks.size() <
+               static_cast<size_t>(config::pipeline_bucket_process_max_buffered_chunks);
     }
     return _ctx->sink->need_input();
 }
@@ -60,44 +115,21 @@ bool BucketProcessSinkOperator::is_finished() const {
 }
 
 Status BucketProcessSinkOperator::set_finishing(RuntimeState* state) {
-    auto defer = DeferOp([&]() {
-        if (_ctx->spill_channel != nullptr) {
-            _ctx->spill_channel->set_finishing();
-        }
-    });
-    _ctx->all_input_finishing = true;
-    DCHECK(_ctx->reset_version <= _ctx->sink_complete_version);
-    // acquire finish token and never release
-    bool token = _ctx->token;
-    if (!token && _ctx->token.compare_exchange_strong(token, true)) {
-        // In this condition, if reset_version == ctx->sink_version. indicates that the
-        // Possibility 1: The BucketSourceOperator got the token first and executed it.
-        //
-        // Possibility 2: BucketSink did not receive the EOS chunk, possibly short-circuited.
-        //
-        // At this point we need to re-execute set_finishing on the sub operator to ensure that is_finished() returns true.
-        if (_ctx->reset_version == _ctx->sink_complete_version) {
-            RETURN_IF_ERROR(_ctx->finish_current_sink(state));
-        }
-        _ctx->current_bucket_sink_finished = true;
+    std::lock_guard guard(_ctx->pending_chunk_mutex);
+    _ctx->upstream_eos = true;
+    RETURN_IF_ERROR(_ctx->flush_pending_chunks_locked(state));
+    if (!_ctx->pending_chunks.empty()) {
+        // Chunks of later buckets are still buffered behind a draining bucket. The
+        // source-side reset replays them and completes the finishing sequence.
+        return Status::OK();
     }
-    return Status::OK();
+    return _ctx->finish_all_input_locked(state);
 }
 
 Status BucketProcessSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
-    auto info = chunk->owner_info();
-    if (!chunk->is_empty()) {
-        RETURN_IF_ERROR(_ctx->sink->push_chunk(state, chunk));
-    }
-    // short-circuit case. such as group by limit
-    if (_ctx->sink->is_finished()) {
-        _ctx->all_input_finishing = true;
-        return Status::OK();
-    }
-    if (info.is_last_chunk()) {
-        RETURN_IF_ERROR(_ctx->finish_current_sink(state));
-    }
-    return Status::OK();
+    std::lock_guard guard(_ctx->pending_chunk_mutex);
+    _ctx->pending_chunks.push_back(chunk);
+    return _ctx->flush_pending_chunks_locked(state);
 }
 
 Status BucketProcessSourceOperator::prepare(RuntimeState* state) {
@@ -141,6 +173,23 @@ StatusOr<ChunkPtr> BucketProcessSourceOperator::pull_chunk(RuntimeState* state)
                 DCHECK_EQ(_ctx->sink_complete_version, _ctx->reset_version + 1);
             } else {
                 _ctx->current_bucket_sink_finished = false;
+                // replay chunks of the next bucket buffered while this bucket drained,
+                // and complete the finishing sequence if EOS arrived while they waited
+                std::lock_guard guard(_ctx->pending_chunk_mutex);
+                RETURN_IF_ERROR(_ctx->flush_pending_chunks_locked(state));
+                if (_ctx->upstream_eos && _ctx->pending_chunks.empty() &&
+                    _ctx->reset_version == _ctx->sink_complete_version) {
+                    // EOS already arrived and the replay did not close the sink with a
+                    // last-chunk marker. This thread holds the token, so complete the
+                    // finishing sequence the sink side deferred.
+                    auto defer = DeferOp([&]() {
+                        if (_ctx->spill_channel != nullptr) {
+                            _ctx->spill_channel->set_finishing();
+                        }
+                    });
+                    _ctx->all_input_finishing = true;
+                    RETURN_IF_ERROR(_ctx->finish_current_sink(state));
+                }
             }
             _ctx->token = false;
         }
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "exec/pipeline/operator.h"
@@ -40,13 +42,34 @@ struct BucketProcessContext {
     // This value is incremented every time operator->set_finishing is executed.
     std::atomic_int sink_complete_version{};
 
+    // Upstream delivered EOS while chunks were still buffered; the finishing sequence
+    // is completed by whichever side drains the buffer.
+    std::atomic_bool upstream_eos{};
+
     OperatorPtr source;
     OperatorPtr sink;
     SpillProcessChannelPtr spill_channel;
 
+    // Chunks of the next bucket accepted while the current bucket is still draining on
+    // the source side, so the upstream scan keeps running through bucket boundaries
+    // instead of stalling until the drain and reset complete. Guarded by
+    // pending_chunk_mutex, replayed in arrival order, and bounded by
+    // config::pipeline_bucket_process_max_buffered_chunks.
+    mutable std::mutex pending_chunk_mutex;
+    std::deque<ChunkPtr> pending_chunks;
+
     Status reset_operator_state(RuntimeState* state);
 
     Status finish_current_sink(RuntimeState* state);
+
+    // Push buffered chunks into the sink until the sink closes the current bucket
+    // again or the buffer runs dry. Callers must hold pending_chunk_mutex.
+    Status flush_pending_chunks_locked(RuntimeState* state);
+
+    // Mark all input finished and make sure the sink reaches its finished state: the
+    // tail of the finishing sequence, possibly deferred past set_finishing when
+    // chunks were still buffered at that point. Callers must hold pending_chunk_mutex.
+    Status finish_all_input_locked(RuntimeState* state);
 };
 using BucketProcessContextPtr = std::shared_ptr<BucketProcessContext>;
 
@@ -76,11 +76,11 @@ public:
                                             const butil::IOBuf& attachment, int64_t attachment_physical_bytes);
 
     // Used when doing shuffle.
-    // This function will copy selective rows in chunks to batch.
-    // indexes contains row index of chunk and this function will copy from input
-    // 'from' and copy 'size' rows
-    Status add_rows_selective(Chunk* chunk, int32_t driver_sequence, const uint32_t* row_indexes, uint32_t from,
-                              uint32_t size, RuntimeState* state);
+    // Returns the batching chunk of |driver_sequence| that can hold |size| more rows, flushing
+    // it first when it would overflow and creating it lazily from |chunk| on first use. The
+    // caller appends the selected rows itself, so all channels of one input chunk can be
+    // filled in a single pass with Chunk::scatter_selective().
+    StatusOr<Chunk*> get_chunk_for_append(Chunk* chunk, int32_t driver_sequence, uint32_t size, RuntimeState* state);
 
     // Flush buffered rows and close channel. This function don't wait the response
     // of close operation, client should call close_wait() to finish channel's close.
@@ -126,6 +126,8 @@ private:
     // always be 1
     std::vector<std::unique_ptr<Chunk>> _chunks;
     PTransmitChunkParamsPtr _chunk_request;
+    butil::IOBuf _attachment;
+    int64_t _attachment_physical_bytes = 0;
     size_t _current_request_bytes = 0;
 
     bool _is_inited = false;
@@ -188,8 +190,8 @@ Status ExchangeSinkOperator::Channel::init(RuntimeState* state) {
     return Status::OK();
 }
 
-Status ExchangeSinkOperator::Channel::add_rows_selective(Chunk* chunk, int32_t driver_sequence, const uint32_t* indexes,
-                                                         uint32_t from, uint32_t size, RuntimeState* state) {
+StatusOr<Chunk*> ExchangeSinkOperator::Channel::get_chunk_for_append(Chunk* chunk, int32_t driver_sequence,
+                                                                     uint32_t size, RuntimeState* state) {
     if (UNLIKELY(_chunks[driver_sequence] == nullptr)) {
         _chunks[driver_sequence] = chunk->clone_empty_with_slot(size);
     }
@@ -200,12 +202,7 @@ Status ExchangeSinkOperator::Channel::add_rows_selective(Chunk* chunk, int32_t d
         _chunks[driver_sequence]->set_num_rows(0);
     }
 
-    {
-        SCOPED_TIMER(_parent->_shuffle_chunk_append_timer);
-        _chunks[driver_sequence]->append_selective(*chunk, indexes, from, size);
-        COUNTER_UPDATE(_parent->_shuffle_chunk_append_counter, 1);
-    }
-    return Status::OK();
+    return _chunks[driver_sequence].get();
 }
 
 Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const Chunk* chunk, int32_t driver_sequence,
@@ -248,8 +245,9 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
             auto pchunk = _chunk_request->add_chunks();
-            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
-            _current_request_bytes += pchunk->data().size();
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(
+                    _parent->serialize_chunk(chunk, pchunk, &_is_first_chunk, _attachment, _attachment_physical_bytes)));
+            _current_request_bytes += pchunk->data_size();
         }
     }
 
@@ -258,13 +256,13 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
     if (_current_request_bytes > config::max_transmit_batched_bytes || eos) {
         _chunk_request->set_eos(eos);
         _chunk_request->set_use_pass_through(_use_pass_through);
-        butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = _parent->construct_brpc_attachment(_chunk_request, attachment);
-        TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub,     std::move(_chunk_request), attachment,
-                                  attachment_physical_bytes,   _brpc_dest_addr};
+        TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub,      std::move(_chunk_request),
+                                  _attachment,                 _attachment_physical_bytes, _brpc_dest_addr};
         RETURN_IF_ERROR(_parent->_buffer->add_request(info));
         _current_request_bytes = 0;
         _chunk_request.reset();
+        _attachment.clear();
+        _attachment_physical_bytes = 0;
         *is_real_sent = true;
     }
 
@@ -519,22 +517,22 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
             // 1. create a new chunk PB to serialize
             ChunkPB* pchunk = _chunk_request->add_chunks();
             // 2. serialize input chunk to pchunk
-            TRY_CATCH_BAD_ALLOC(
-                    RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size())));
-            _current_request_bytes += pchunk->data().size();
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _attachment,
+                                                                _attachment_physical_bytes, _channels.size())));
+            _current_request_bytes += pchunk->data_size();
             // 3. if request bytes exceede the threshold, send current request
             if (_current_request_bytes > config::max_transmit_batched_bytes) {
-                butil::IOBuf attachment;
-                int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
                 for (auto idx : _channel_indices) {
                     if (!_channels[idx]->use_pass_through()) {
                         PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
-                        RETURN_IF_ERROR(
-                                _channels[idx]->send_chunk_request(state, copy, attachment, attachment_physical_bytes));
+                        RETURN_IF_ERROR(_channels[idx]->send_chunk_request(state, copy, _attachment,
+                                                                           _attachment_physical_bytes));
                     }
                 }
                 _current_request_bytes = 0;
                 _chunk_request.reset();
+                _attachment.clear();
+                _attachment_physical_bytes = 0;
             }
         }
     } else if (_part_type == TPartitionType::RANDOM) {
@@ -602,6 +600,13 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
             }
         }
 
+        std::vector<Chunk*> dest_chunks;
+        std::vector<uint32_t> froms;
+        std::vector<uint32_t> sizes;
+        dest_chunks.reserve(_num_shuffles);
+        froms.reserve(_num_shuffles);
+        sizes.reserve(_num_shuffles);
+
         for (int32_t channel_id : _channel_indices) {
             if (_channels[channel_id]->get_fragment_instance_id().lo == -1) {
                 // dest bucket is no used, continue
@@ -619,10 +624,21 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
                     continue;
                 }
 
-                RETURN_IF_ERROR(_channels[channel_id]->add_rows_selective(send_chunk, driver_sequence,
-                                                                          _row_indexes.data(), from, size, state));
+                ASSIGN_OR_RETURN(Chunk * dest_chunk, _channels[channel_id]->get_chunk_for_append(
+                                                             send_chunk, driver_sequence, size, state));
+                dest_chunks.emplace_back(dest_chunk);
+                froms.emplace_back(from);
+                sizes.emplace_back(size);
             }
         }
+
+        if (!dest_chunks.empty()) {
+            // Copy the selected rows of all channels in one interleaved pass over the source
+            // chunk instead of gathering it once per channel.
+            SCOPED_TIMER(_shuffle_chunk_append_timer);
+            send_chunk->scatter_selective(dest_chunks, _row_indexes.data(), froms, sizes);
+            COUNTER_UPDATE(_shuffle_chunk_append_counter, dest_chunks.size());
+        }
     }
     return Status::OK();
 }
@@ -637,14 +653,14 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
 
     if (_chunk_request != nullptr) {
-        butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
         for (const auto& [_, channel] : _instance_id2channel) {
             PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
-            RETURN_IF_ERROR(channel->send_chunk_request(state, copy, attachment, attachment_physical_bytes));
+            RETURN_IF_ERROR(channel->send_chunk_request(state, copy, _attachment, _attachment_physical_bytes));
         }
         _current_request_bytes = 0;
         _chunk_request.reset();
+        _attachment.clear();
+        _attachment_physical_bytes = 0;
     }
     Status status = Status::OK();
     for (auto& [_, channel] : _instance_id2channel) {
@@ -665,23 +681,27 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     Operator::close(state);
 }
 
-Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers) {
+Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk,
+                                             butil::IOBuf& attachment, int64_t& attachment_physical_bytes,
+                                             int num_receivers) {
     VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
     auto send_input_bytes = serde::ProtobufChunkSerde::max_serialized_size(*src, nullptr);
     COUNTER_UPDATE(_sender_input_bytes_counter, send_input_bytes * num_receivers);
+    serde::DetachedChunkPayload payload;
     {
         SCOPED_TIMER(_serialize_chunk_timer);
         // We only serialize chunk meta for first chunk
         if (*is_first_chunk) {
             _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(src->columns().size(), _encode_level);
             StatusOr<ChunkPB> res = Status::OK();
-            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize(*src, _encode_context));
+            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize(*src, _encode_context, &payload));
             RETURN_IF_ERROR(res);
             res->Swap(dst);
             *is_first_chunk = false;
         } else {
             StatusOr<ChunkPB> res = Status::OK();
-            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize_without_meta(*src, _encode_context));
+            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize_without_meta(*src, _encode_context,
+                                                                                        &payload));
             RETURN_IF_ERROR(res);
             res->Swap(dst);
         }
@@ -690,7 +710,7 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
         _encode_context->set_encode_levels_in_pb(dst);
     }
     DCHECK(dst->has_uncompressed_size());
-    DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
+    DCHECK_EQ(dst->uncompressed_size(), payload.size);
     const size_t serialized_size = dst->uncompressed_size();
     COUNTER_UPDATE(_serialized_bytes_counter, serialized_size * num_receivers);
 
@@ -699,13 +719,14 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
                                                          _compress_codec->max_input_size()));
     }
 
-    // try compress the ChunkPB data
+    // try compress the chunk payload
+    bool use_compressed = false;
     if (_compress_codec != nullptr && serialized_size > 0) {
         SCOPED_TIMER(_compress_timer);
 
+        Slice input(payload.data.get(), payload.size);
         if (use_compression_pool(_compress_codec->type())) {
             Slice compressed_slice;
-            Slice input(dst->data());
             RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
                                                       &_compression_scratch));
         } else {
@@ -717,7 +738,6 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
 
             Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
 
-            Slice input(dst->data());
             RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice));
             _compression_scratch.resize(compressed_slice.size);
         }
@@ -726,32 +746,29 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
             dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
             dst->set_compress_type(_compress_type);
+            use_compressed = true;
         }
         COUNTER_UPDATE(_compressed_bytes_counter, _compression_scratch.size() * num_receivers);
         VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << _compression_scratch.size();
     }
-    return Status::OK();
-}
-
-int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkParamsPtr& chunk_request,
-                                                        butil::IOBuf& attachment) {
-    int64_t attachment_physical_bytes = 0;
-    for (int i = 0; i < chunk_request->chunks().size(); ++i) {
-        auto chunk = chunk_request->mutable_chunks(i);
-        chunk->set_data_size(chunk->data().size());
 
+    // Hand the payload over to the attachment right away instead of keeping it in ChunkPB.data
+    // and copying it into an iobuf when the request is flushed. The uncompressed payload is
+    // attached zero-copy: the iobuf owns the buffer and frees it once the last rpc referencing
+    // the attachment has finished.
+    if (use_compressed) {
+        dst->set_data_size(dst->data().size());
         int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
-        attachment.append(chunk->data());
+        attachment.append(dst->data());
         attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
-
-        chunk->clear_data();
-        // If the request is too big, free the memory in order to avoid OOM
-        if (_is_large_chunk(chunk->data_size())) {
-            chunk->mutable_data()->shrink_to_fit();
-        }
+        dst->clear_data();
+    } else {
+        dst->set_data_size(payload.size);
+        attachment_physical_bytes += payload.size;
+        attachment.append_user_data(payload.data.release(), payload.size,
+                                    [](void* data) { delete[] static_cast<uint8_t*>(data); });
     }
-
-    return attachment_physical_bytes;
+    return Status::OK();
 }
 
 ExchangeSinkOperatorFactory::ExchangeSinkOperatorFactory(
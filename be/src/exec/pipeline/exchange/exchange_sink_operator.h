@@ -79,16 +79,11 @@ public:
 
     // For the first chunk , serialize the chunk data and meta to ChunkPB both.
     // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
-
-    // Return the physical bytes of attachment.
-    int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment);
-
-private:
-    bool _is_large_chunk(size_t sz) const {
-        // ref olap_scan_node.cpp release_large_columns
-        return sz > runtime_state()->chunk_size() * 512;
-    }
+    // The payload is handed over to |attachment| instead of being kept in ChunkPB.data:
+    // uncompressed payloads are attached zero-copy, compressed ones are appended. The physical
+    // bytes the attachment holds are added to |attachment_physical_bytes|.
+    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, butil::IOBuf& attachment,
+                           int64_t& attachment_physical_bytes, int num_receivers = 1);
 
 private:
     class Channel;
@@ -159,6 +154,8 @@ private:
 
     // Only used when broadcast
     PTransmitChunkParamsPtr _chunk_request;
+    butil::IOBuf _attachment;
+    int64_t _attachment_physical_bytes = 0;
     size_t _current_request_bytes = 0;
 
     bool _is_first_chunk = true;
@@ -53,6 +53,7 @@ Status Partitioner::partition_chunk(const ChunkPtr& chunk, int32_t num_partition
 Status Partitioner::send_chunk(const ChunkPtr& chunk,
                                const std::shared_ptr<std::vector<uint32_t>>& partition_row_indexes) {
     size_t num_partitions = _source->get_sources().size();
+    size_t num_rows = chunk->num_rows();
     for (size_t i = 0; i < num_partitions; ++i) {
         size_t from = partition_begin_offset(i);
         size_t size = partition_end_offset(i) - from;
@@ -61,6 +62,13 @@ Status Partitioner::send_chunk(const ChunkPtr& chunk,
             continue;
         }
 
+        if (size == num_rows) {
+            // All rows fall into one partition, so hand over the whole chunk to it
+            // without rematerializing every row through append_selective.
+            _source->get_sources()[i]->add_chunk(chunk);
+            return Status::OK();
+        }
+
         RETURN_IF_ERROR(_source->get_sources()[i]->add_chunk(chunk, partition_row_indexes, from, size,
                                                              partition_memory_usage(i)));
     }
@@ -14,6 +14,9 @@
 
 #include "exec/pipeline/exchange/multi_cast_local_exchange.h"
 
+#include "common/config.h"
+#include "serde/column_array_serde.h"
+#include "util/compression/block_compression.h"
 #include "util/logging.h"
 
 namespace starrocks::pipeline {
@@ -86,6 +89,7 @@ Status MultiCastLocalExchanger::push_chunk(const ChunkPtr& chunk, int32_t sink_d
         _peak_memory_usage_counter->set(_current_memory_usage);
         _peak_buffer_row_size_counter->set(_current_row_size);
         sink_operator->update_counter(_current_memory_usage, _current_row_size);
+        _compress_cells();
     }
 
     return Status::OK();
@@ -115,6 +119,9 @@ StatusOr<ChunkPtr> MultiCastLocalExchanger::pull_chunk(RuntimeState* state, int3
         return Status::InternalError("unreachable in multicast local exchanger");
     }
     cell = cell->next;
+    if (cell->compressed) {
+        RETURN_IF_ERROR(_decompress_cell(cell));
+    }
     VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
               << ", row = " << cell->chunk->debug_row(0) << ", size = " << cell->chunk->num_rows();
 
@@ -186,6 +193,82 @@ void MultiCastLocalExchanger::_update_progress(Cell* fast) {
     }
 }
 
+void MultiCastLocalExchanger::_compress_cells() {
+    const int64_t threshold = config::multi_cast_local_exchange_compress_threshold_bytes;
+    if (threshold <= 0 || _current_memory_usage <= static_cast<size_t>(threshold)) return;
+    for (Cell* cell = _head; cell != nullptr && _current_memory_usage > static_cast<size_t>(threshold);
+         cell = cell->next) {
+        // cells beyond the fastest consumer are about to be pulled, compressing them
+        // would only burn cpu. the list is ordered, so stop at the first one.
+        if (cell->accumulated_row_size > _fast_accumulated_row_size) break;
+        if (cell->chunk == nullptr || cell->compress_attempted ||
+            cell->used_count == static_cast<int32_t>(_consumer_number)) {
+            continue;
+        }
+        _compress_cell(cell);
+    }
+}
+
+void MultiCastLocalExchanger::_compress_cell(Cell* cell) {
+    // compression is best effort: on any failure the cell just stays uncompressed, and
+    // the attempt is not repeated on the next push.
+    cell->compress_attempted = true;
+    const ChunkPtr& chunk = cell->chunk;
+    if (chunk->has_extra_data()) return;
+
+    int64_t max_serialized_size = 0;
+    for (const auto& column : chunk->columns()) {
+        max_serialized_size += serde::ColumnArraySerde::max_serialized_size(*column);
+    }
+    std::vector<uint8_t> serialize_buffer(max_serialized_size);
+    uint8_t* buff = serialize_buffer.data();
+    for (const auto& column : chunk->columns()) {
+        buff = serde::ColumnArraySerde::serialize(*column, buff);
+        if (UNLIKELY(buff == nullptr)) return;
+    }
+    const size_t serialized_size = buff - serialize_buffer.data();
+
+    const BlockCompressionCodec* codec = nullptr;
+    if (!get_block_compression_codec(CompressionTypePB::LZ4, &codec).ok()) return;
+    std::vector<uint8_t> compressed_data(codec->max_compressed_len(serialized_size));
+    Slice compressed_slice(compressed_data.data(), compressed_data.size());
+    if (!codec->compress(Slice(serialize_buffer.data(), serialized_size), &compressed_slice).ok()) return;
+    if (compressed_slice.size >= cell->memory_usage) return;
+    compressed_data.resize(compressed_slice.size);
+    compressed_data.shrink_to_fit();
+
+    ChunkPtr skeleton = chunk->clone_empty(0);
+    cell->chunk = std::move(skeleton);
+    cell->compressed_data = std::move(compressed_data);
+    cell->serialized_size = serialized_size;
+    cell->compressed = true;
+    _current_memory_usage -= cell->memory_usage;
+    cell->memory_usage = cell->compressed_data.size();
+    _current_memory_usage += cell->memory_usage;
+}
+
+Status MultiCastLocalExchanger::_decompress_cell(Cell* cell) {
+    const BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(CompressionTypePB::LZ4, &codec));
+    std::vector<uint8_t> serialize_buffer(cell->serialized_size);
+    Slice decompressed_slice(serialize_buffer.data(), serialize_buffer.size());
+    RETURN_IF_ERROR(
+            codec->decompress(Slice(cell->compressed_data.data(), cell->compressed_data.size()), &decompressed_slice));
+    const uint8_t* read_cursor = serialize_buffer.data();
+    for (const auto& column : cell->chunk->columns()) {
+        read_cursor = serde::ColumnArraySerde::deserialize(read_cursor, column.get());
+        if (UNLIKELY(read_cursor == nullptr)) {
+            return Status::InternalError("unsupported column occurs in mcast local exchange decompress phase");
+        }
+    }
+    std::vector<uint8_t>().swap(cell->compressed_data);
+    cell->compressed = false;
+    _current_memory_usage -= cell->memory_usage;
+    cell->memory_usage = cell->chunk->memory_usage();
+    _current_memory_usage += cell->memory_usage;
+    return Status::OK();
+}
+
 // ===== source op =====
 Status MultiCastLocalExchangeSourceOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(SourceOperator::prepare(state));
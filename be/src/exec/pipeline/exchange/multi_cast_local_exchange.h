@@ -65,8 +65,21 @@ private:
         size_t accumulated_row_size = 0;
         // how many consumers have used this chunk
         int32_t used_count = 0;
+        // filled by _compress_cell(): the LZ4 block holding the serialized columns, while
+        // `chunk` is shrunk to an empty skeleton used to rebuild them on the next pull.
+        std::vector<uint8_t> compressed_data;
+        size_t serialized_size = 0;
+        bool compressed = false;
+        // a cell is compressed at most once, so a cell rebuilt for one slow consumer does
+        // not oscillate between the two forms while the other slow consumers catch up.
+        bool compress_attempted = false;
     };
     void _update_progress(Cell* fast = nullptr);
+    // compress cells the fastest consumer is already past, oldest first, until the
+    // buffered bytes drop below the configured threshold again.
+    void _compress_cells();
+    void _compress_cell(Cell* cell);
+    Status _decompress_cell(Cell* cell);
     void _closer_consumer(int32_t mcast_consumer_index);
     RuntimeState* _runtime_state;
     mutable std::mutex _mutex;
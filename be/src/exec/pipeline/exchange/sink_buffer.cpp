@@ -87,8 +87,8 @@ Status SinkBuffer::add_request(TransmitChunkInfo& request) {
         return Status::OK();
     }
     if (!request.attachment.empty()) {
-        _bytes_enqueued += request.attachment.size();
-        _request_enqueued++;
+        _bytes_enqueued.update(request.attachment.size());
+        _request_enqueued.update(1);
     }
     {
         // set stats every _sent_audit_stats_frequency, so FE can get approximate stats even missing eos chunks.
@@ -105,12 +105,48 @@ Status SinkBuffer::add_request(TransmitChunkInfo& request) {
         }
 
         auto& instance_id = request.fragment_instance_id;
-        RETURN_IF_ERROR(_try_to_send_rpc(instance_id, [&]() { _buffers[instance_id.lo].push(request); }));
+        RETURN_IF_ERROR(_try_to_send_rpc(instance_id, [&]() {
+            auto& buffer = _buffers[instance_id.lo];
+            if (!_try_to_merge_request(buffer, request)) {
+                buffer.push(request);
+            }
+        }));
     }
 
     return Status::OK();
 }
 
+bool SinkBuffer::_try_to_merge_request(std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>>& buffer,
+                                       TransmitChunkInfo& request) {
+    if (_is_dest_merge || buffer.empty()) {
+        return false;
+    }
+    // eos must stay the last standalone packet, pass-through requests carry no serialized
+    // chunks to merge, and query statistics are attached to specific requests.
+    if (request.params->eos() || request.params->use_pass_through() || request.params->has_query_statistics()) {
+        return false;
+    }
+    auto& back = buffer.back();
+    if (back.params->eos() || back.params->use_pass_through()) {
+        return false;
+    }
+    if (back.attachment.size() + request.attachment.size() > config::max_transmit_batched_bytes) {
+        return false;
+    }
+    DCHECK_EQ(back.params->is_pipeline_level_shuffle(), request.params->is_pipeline_level_shuffle());
+
+    for (auto& pchunk : *request.params->mutable_chunks()) {
+        back.params->add_chunks()->Swap(&pchunk);
+    }
+    for (auto driver_sequence : request.params->driver_sequences()) {
+        back.params->add_driver_sequences(driver_sequence);
+    }
+    // IOBuf append only takes references on the payload blocks, no copy happens here.
+    back.attachment.append(request.attachment);
+    back.attachment_physical_bytes += request.attachment_physical_bytes;
+    return true;
+}
+
 bool SinkBuffer::is_full() const {
     // std::queue' read is concurrent safe without mutex
     // Judgement may not that accurate because we do not known in advance which
@@ -157,8 +193,9 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* wait_timer = ADD_TIMER(profile, "WaitTime");
     auto* overall_timer = ADD_TIMER(profile, "OverallTime");
 
-    COUNTER_SET(rpc_count, _rpc_count);
-    COUNTER_SET(rpc_avg_timer, _rpc_cumulative_time / std::max(_rpc_count.load(), static_cast<int64_t>(1)));
+    const int64_t rpc_count_value = _rpc_count.value();
+    COUNTER_SET(rpc_count, rpc_count_value);
+    COUNTER_SET(rpc_avg_timer, _rpc_cumulative_time.value() / std::max(rpc_count_value, static_cast<int64_t>(1)));
 
     COUNTER_SET(network_timer, _network_time());
     COUNTER_SET(overall_timer, _last_receive_time - _first_send_time);
@@ -171,13 +208,13 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
 
     auto* bytes_sent_counter = ADD_COUNTER(profile, "BytesSent", TUnit::BYTES);
     auto* request_sent_counter = ADD_COUNTER(profile, "RequestSent", TUnit::UNIT);
-    COUNTER_SET(bytes_sent_counter, _bytes_sent);
-    COUNTER_SET(request_sent_counter, _request_sent);
+    COUNTER_SET(bytes_sent_counter, _bytes_sent.value());
+    COUNTER_SET(request_sent_counter, _request_sent.value());
 
     auto* bytes_unsent_counter = ADD_COUNTER(profile, "BytesUnsent", TUnit::BYTES);
     auto* request_unsent_counter = ADD_COUNTER(profile, "RequestUnsent", TUnit::UNIT);
-    COUNTER_SET(bytes_unsent_counter, _bytes_enqueued - _bytes_sent);
-    COUNTER_SET(request_unsent_counter, _request_enqueued - _request_sent);
+    COUNTER_SET(bytes_unsent_counter, _bytes_enqueued.value() - _bytes_sent.value());
+    COUNTER_SET(request_unsent_counter, _request_enqueued.value() - _request_sent.value());
 
     profile->add_derived_counter(
             "NetworkBandwidth", TUnit::BYTES_PER_SECOND,
@@ -253,8 +290,8 @@ void SinkBuffer::_update_network_time(const TUniqueId& instance_id, const int64_
     int32_t concurrency = _num_in_flight_rpcs[instance_id.lo];
     int64_t time_usage = get_response_timestamp - send_timestamp - receiver_post_process_time;
     _network_times[instance_id.lo].update(time_usage, concurrency);
-    _rpc_cumulative_time += time_usage;
-    _rpc_count++;
+    _rpc_cumulative_time.update(time_usage);
+    _rpc_count.update(1);
 }
 
 void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_t sequence) {
@@ -361,8 +398,8 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
         request.params->set_sequence(++_request_seqs[instance_id.lo]);
 
         if (!request.attachment.empty()) {
-            _bytes_sent += request.attachment.size();
-            _request_sent++;
+            _bytes_sent.update(request.attachment.size());
+            _request_sent.update(1);
         }
 
         auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
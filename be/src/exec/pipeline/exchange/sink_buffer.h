@@ -34,6 +34,7 @@
 #include "util/defer_op.h"
 #include "util/disposable_closure.h"
 #include "util/phmap/phmap.h"
+#include "util/runtime_profile.h"
 
 namespace starrocks::pipeline {
 
@@ -113,6 +114,13 @@ private:
     // And we need to put this function and other extra works(pre_works) together as an atomic operation
     [[nodiscard]] Status _try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works);
 
+    // Fold the new request into the tail request queued for the same destination, so requests
+    // that pile up behind a busy channel go out as one brpc call instead of one rpc per chunk batch.
+    // Must be called with the instance mutex held. Returns false if the request cannot be merged
+    // and should be enqueued as-is.
+    bool _try_to_merge_request(std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>>& buffer,
+                               TransmitChunkInfo& request);
+
     // send by rpc or http
     Status _send_rpc(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure, const TransmitChunkInfo& req);
 
@@ -171,14 +179,18 @@ private:
     std::atomic<bool> _is_finishing = false;
     std::atomic<int32_t> _num_sending_rpc = 0;
 
-    std::atomic<int64_t> _rpc_count = 0;
-    std::atomic<int64_t> _rpc_cumulative_time = 0;
+    // The following stats are updated by every driver thread sharing this SinkBuffer and
+    // by the brpc callback threads, so they are kept core-local instead of shared atomics,
+    // which bounce their cache line on many-core machines. They are only read once, when
+    // the profile is updated.
+    RuntimeProfile::CoreLocalCounter _rpc_count{TUnit::UNIT};
+    RuntimeProfile::CoreLocalCounter _rpc_cumulative_time{TUnit::TIME_NS};
 
     // RuntimeProfile counters
-    std::atomic<int64_t> _bytes_enqueued = 0;
-    std::atomic<int64_t> _request_enqueued = 0;
-    std::atomic<int64_t> _bytes_sent = 0;
-    std::atomic<int64_t> _request_sent = 0;
+    RuntimeProfile::CoreLocalCounter _bytes_enqueued{TUnit::BYTES};
+    RuntimeProfile::CoreLocalCounter _request_enqueued{TUnit::UNIT};
+    RuntimeProfile::CoreLocalCounter _bytes_sent{TUnit::BYTES};
+    RuntimeProfile::CoreLocalCounter _request_sent{TUnit::UNIT};
 
     int64_t _pending_timestamp = -1;
     mutable std::atomic<int64_t> _last_full_timestamp = -1;
@@ -35,6 +35,7 @@
 #include "exec/workgroup/work_group.h"
 #include "gutil/casts.h"
 #include "gutil/map_util.h"
+#include "runtime/current_thread.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/data_stream_sender.h"
 #include "runtime/descriptors.h"
@@ -746,11 +747,110 @@ Status FragmentExecutor::execute(ExecEnv* exec_env) {
 
     DCHECK(_fragment_ctx->enable_resource_group());
     auto* executor = exec_env->wg_driver_executor();
+    if (config::enable_inline_fragment_execution && _try_execute_inline(executor)) {
+        return Status::OK();
+    }
     RETURN_IF_ERROR(_fragment_ctx->submit_active_drivers(executor));
 
     return Status::OK();
 }
 
+bool FragmentExecutor::_try_execute_inline(DriverExecutor* executor) {
+    if (_fragment_ctx->is_stream_pipeline() || _fragment_ctx->enable_group_execution() ||
+        _fragment_ctx->enable_adaptive_dop()) {
+        return false;
+    }
+    std::vector<DriverRawPtr> drivers;
+    _fragment_ctx->iterate_drivers([&](const DriverPtr& driver) { drivers.emplace_back(driver.get()); });
+    if (drivers.size() != 1) {
+        return false;
+    }
+    auto* driver = drivers[0];
+    if (driver->is_precondition_block()) {
+        return false;
+    }
+    driver->start_timers();
+    driver->submit_operators();
+    if (!driver->source_operator()->is_finished() && !driver->source_operator()->has_output()) {
+        // nothing to consume yet, e.g. the source waits for an exchange. Take the normal path,
+        // the two calls above are repeated safely by DriverExecutor::submit.
+        return false;
+    }
+
+    // TODO(trueeyu): This writing is to ensure that MemTracker will not be destructed before the thread ends.
+    //  This writing method is a bit tricky, and when there is a better way, replace it
+    auto runtime_state_ptr = _fragment_ctx->runtime_state_ptr();
+    auto* runtime_state = runtime_state_ptr.get();
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(runtime_state->instance_mem_tracker());
+
+    const int64_t deadline_ns = MonotonicNanos() + config::inline_fragment_execution_budget_ms * 1000 * 1000;
+    int64_t schedule_count = 0;
+    int64_t execution_ns = 0;
+    while (true) {
+        if (_fragment_ctx->is_canceled()) {
+            driver->cancel_operators(runtime_state);
+            if (driver->is_still_pending_finish()) {
+                driver->set_driver_state(DriverState::PENDING_FINISH);
+                executor->submit(driver);
+            } else {
+                driver->finalize(runtime_state, DriverState::CANCELED, schedule_count, execution_ns);
+            }
+            return true;
+        }
+
+        driver->increment_schedule_times();
+        ++schedule_count;
+        StatusOr<DriverState> maybe_state;
+        int64_t start_time = driver->get_active_time();
+#ifdef NDEBUG
+        TRY_CATCH_ALL(maybe_state, driver->process(runtime_state, 0));
+#else
+        maybe_state = driver->process(runtime_state, 0);
+#endif
+        execution_ns += driver->get_active_time() - start_time;
+
+        Status status = maybe_state.status();
+        if (!status.ok()) {
+            LOG(WARNING) << "[Driver] Inline process error, query_id=" << print_id(_query_ctx->query_id())
+                         << ", instance_id=" << print_id(_fragment_ctx->fragment_instance_id())
+                         << ", status=" << status;
+            driver->runtime_profile()->add_info_string("ErrorMsg", std::string(status.message()));
+            _query_ctx->cancel(status);
+            driver->cancel_operators(runtime_state);
+            if (driver->is_still_pending_finish()) {
+                driver->set_driver_state(DriverState::PENDING_FINISH);
+                executor->submit(driver);
+            } else {
+                driver->finalize(runtime_state, DriverState::INTERNAL_ERROR, schedule_count, execution_ns);
+            }
+            return true;
+        }
+
+        driver->report_exec_state_if_necessary();
+
+        auto driver_state = maybe_state.value();
+        switch (driver_state) {
+        case READY:
+        case RUNNING:
+            if (MonotonicNanos() >= deadline_ns) {
+                // budget used up, escape to the driver executor
+                executor->submit(driver);
+                return true;
+            }
+            break;
+        case FINISH:
+        case CANCELED:
+        case INTERNAL_ERROR:
+            driver->finalize(runtime_state, driver_state, schedule_count, execution_ns);
+            return true;
+        default:
+            // blocked on input, output or pending finish, the executor's poller takes over
+            executor->submit(driver);
+            return true;
+        }
+    }
+}
+
 void FragmentExecutor::_fail_cleanup(bool fragment_has_registed) {
     if (_query_ctx) {
         if (_fragment_ctx) {
@@ -121,6 +121,11 @@ private:
     Status _prepare_pipeline_driver(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request);
     Status _prepare_stream_load_pipe(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request);
 
+    // Run the only driver of a tiny fragment synchronously on the calling thread within
+    // inline_fragment_execution_budget_ms, handing it to |executor| once it blocks or the
+    // budget is used up. Returns true if the fragment needs no submission anymore.
+    bool _try_execute_inline(DriverExecutor* executor);
+
     int64_t _fragment_start_time = 0;
     QueryContext* _query_ctx = nullptr;
     FragmentContextPtr _fragment_ctx = nullptr;
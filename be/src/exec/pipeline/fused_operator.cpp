@@ -0,0 +1,192 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/fused_operator.h"
+
+#include "column/chunk.h"
+#include "exec/pipeline/chunk_accumulate_operator.h"
+#include "exec/pipeline/project_operator.h"
+#include "exec/pipeline/select_operator.h"
+#include "exprs/runtime_filter_bank.h"
+
+namespace starrocks::pipeline {
+
+FusedOperator::FusedOperator(OperatorFactory* factory, int32_t driver_sequence, Operators operators)
+        : Operator(factory, factory->id(), factory->get_raw_name(), factory->plan_node_id(), false, driver_sequence),
+          _operators(std::move(operators)) {
+    DCHECK_GE(_operators.size(), 2);
+}
+
+Status FusedOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(Operator::prepare(state));
+    for (auto& op : _operators) {
+        RETURN_IF_ERROR(op->prepare(state));
+    }
+    return Status::OK();
+}
+
+void FusedOperator::close(RuntimeState* state) {
+    for (auto it = _operators.rbegin(); it != _operators.rend(); ++it) {
+        (*it)->close(state);
+    }
+    Operator::close(state);
+}
+
+bool FusedOperator::is_finished() const {
+    if (!_output_chunks.empty()) {
+        return false;
+    }
+    for (const auto& op : _operators) {
+        if (op->has_output()) {
+            return false;
+        }
+    }
+    return _operators.back()->is_finished();
+}
+
+Status FusedOperator::set_finishing(RuntimeState* state) {
+    // finish the children front to back, draining each one into its successor so no
+    // buffered rows are left behind
+    for (auto& op : _operators) {
+        RETURN_IF_ERROR(op->set_finishing(state));
+        RETURN_IF_ERROR(_propagate(state));
+    }
+    return Status::OK();
+}
+
+Status FusedOperator::set_finished(RuntimeState* state) {
+    Status status;
+    for (auto& op : _operators) {
+        status.update(op->set_finished(state));
+    }
+    return status;
+}
+
+Status FusedOperator::set_cancelled(RuntimeState* state) {
+    Status status;
+    for (auto& op : _operators) {
+        status.update(op->set_cancelled(state));
+    }
+    return status;
+}
+
+void FusedOperator::set_precondition_ready(RuntimeState* state) {
+    for (auto& op : _operators) {
+        op->set_precondition_ready(state);
+    }
+}
+
+StatusOr<ChunkPtr> FusedOperator::pull_chunk(RuntimeState* state) {
+    auto chunk = std::move(_output_chunks.front());
+    _output_chunks.pop_front();
+    return chunk;
+}
+
+Status FusedOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    RETURN_IF_ERROR(_operators.front()->push_chunk(state, chunk));
+    return _propagate(state);
+}
+
+Status FusedOperator::_propagate(RuntimeState* state) {
+    bool moved = true;
+    while (moved) {
+        moved = false;
+        // stage outputs of the last child first, so its predecessors can move forward
+        while (_operators.back()->has_output()) {
+            ASSIGN_OR_RETURN(auto chunk, _operators.back()->pull_chunk(state));
+            moved = true;
+            if (chunk != nullptr && (!chunk->is_empty() || chunk->owner_info().is_last_chunk())) {
+                _output_chunks.emplace_back(std::move(chunk));
+            }
+        }
+        for (size_t i = 0; i + 1 < _operators.size(); ++i) {
+            auto& curr_op = _operators[i];
+            auto& next_op = _operators[i + 1];
+            while (curr_op->has_output() && next_op->need_input()) {
+                ASSIGN_OR_RETURN(auto chunk, curr_op->pull_chunk(state));
+                moved = true;
+                if (chunk == nullptr) {
+                    continue;
+                }
+                if (chunk->is_empty() &&
+                    !(chunk->owner_info().is_last_chunk() && !next_op->ignore_empty_eos())) {
+                    continue;
+                }
+                RETURN_IF_ERROR(next_op->push_chunk(state, chunk));
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status FusedOperator::reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) {
+    _output_chunks.clear();
+    RETURN_IF_ERROR(_operators.front()->reset_state(state, refill_chunks));
+    for (size_t i = 1; i < _operators.size(); ++i) {
+        RETURN_IF_ERROR(_operators[i]->reset_state(state, {}));
+    }
+    return Status::OK();
+}
+
+void FusedOperator::for_each_child_operator(const std::function<void(Operator*)>& apply) {
+    for (auto& op : _operators) {
+        apply(op.get());
+    }
+}
+
+FusedOperatorFactory::FusedOperatorFactory(int32_t id, OpFactories op_factories)
+        : OperatorFactory(id, "fused", op_factories.back()->plan_node_id()), _op_factories(std::move(op_factories)) {
+    for (const auto& op_factory : _op_factories) {
+        const auto& rf_set = op_factory->rf_waiting_set();
+        _rf_waiting_set.insert(rf_set.begin(), rf_set.end());
+    }
+}
+
+OperatorPtr FusedOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
+    Operators operators;
+    operators.reserve(_op_factories.size());
+    for (auto& op_factory : _op_factories) {
+        operators.emplace_back(op_factory->create(degree_of_parallelism, driver_sequence));
+    }
+    return std::make_shared<FusedOperator>(this, driver_sequence, std::move(operators));
+}
+
+Status FusedOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    for (auto& op_factory : _op_factories) {
+        RETURN_IF_ERROR(op_factory->prepare(state));
+    }
+    return Status::OK();
+}
+
+void FusedOperatorFactory::close(RuntimeState* state) {
+    for (auto it = _op_factories.rbegin(); it != _op_factories.rend(); ++it) {
+        (*it)->close(state);
+    }
+    OperatorFactory::close(state);
+}
+
+bool FusedOperatorFactory::is_fusable(const OpFactoryPtr& op_factory) {
+    auto* raw_factory = op_factory.get();
+    bool stateless = dynamic_cast<SelectOperatorFactory*>(raw_factory) != nullptr ||
+                     dynamic_cast<ProjectOperatorFactory*>(raw_factory) != nullptr ||
+                     dynamic_cast<ChunkAccumulateOperatorFactory*>(raw_factory) != nullptr;
+    if (!stateless) {
+        return false;
+    }
+    const auto* rf_collector = op_factory->get_runtime_bloom_filters();
+    return op_factory->rf_waiting_set().empty() && (rf_collector == nullptr || rf_collector->empty());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,99 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <deque>
+
+#include "exec/pipeline/operator.h"
+
+namespace starrocks::pipeline {
+
+// Fuses a run of adjacent stateless operators (select, project, chunk_accumulate) into one
+// operator, so a chunk of a scan->filter->project segment is processed in a single pass:
+// the filter is evaluated first and only the surviving rows are projected, without bouncing
+// each intermediate chunk through the driver loop between operators.
+//
+// The fused children keep their own factories, expression contexts and runtime profiles;
+// this operator only drives them in a tight loop. Outputs of the last child are staged in
+// _output_chunks, which stays small because each child buffers at most one chunk and
+// need_input() refuses new input while outputs are pending.
+class FusedOperator final : public Operator {
+public:
+    FusedOperator(OperatorFactory* factory, int32_t driver_sequence, Operators operators);
+
+    ~FusedOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+
+    void close(RuntimeState* state) override;
+
+    bool has_output() const override { return !_output_chunks.empty(); }
+
+    bool need_input() const override { return _output_chunks.empty() && _operators.front()->need_input(); }
+
+    bool is_finished() const override;
+
+    bool ignore_empty_eos() const override { return _operators.front()->ignore_empty_eos(); }
+
+    Status set_finishing(RuntimeState* state) override;
+
+    Status set_finished(RuntimeState* state) override;
+
+    Status set_cancelled(RuntimeState* state) override;
+
+    void set_precondition_ready(RuntimeState* state) override;
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
+
+    Status reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) override;
+
+    bool is_combinatorial_operator() const override { return true; }
+
+    void for_each_child_operator(const std::function<void(Operator*)>& apply) override;
+
+private:
+    // Move chunks forward through the chain until nothing can move any more, staging the
+    // outputs of the last child in _output_chunks. Mirrors the driver loop's handling of
+    // empty chunks: they are dropped unless they carry the last-chunk owner info and the
+    // next child doesn't ignore empty eos chunks.
+    Status _propagate(RuntimeState* state);
+
+    Operators _operators;
+    std::deque<ChunkPtr> _output_chunks;
+};
+
+class FusedOperatorFactory final : public OperatorFactory {
+public:
+    FusedOperatorFactory(int32_t id, OpFactories op_factories);
+
+    ~FusedOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+    // Whether op_factory creates a stateless per-chunk operator this factory knows how to
+    // fuse. Operators waiting for or holding runtime filters are kept unfused, because the
+    // driver registers runtime filter dependencies per driver-visible operator.
+    static bool is_fusable(const OpFactoryPtr& op_factory);
+
+private:
+    OpFactories _op_factories;
+};
+
+} // namespace starrocks::pipeline
@@ -27,6 +27,12 @@ using HashJoinerMap = std::unordered_map<int32_t, HashJoinerPtr>;
 class HashJoinerFactory;
 using HashJoinerFactoryPtr = std::shared_ptr<HashJoinerFactory>;
 
+// HashJoinerFactory creates the joiners of one hash join node and decides how the hash
+// table is shared between them. Broadcast joins build with a single driver, so the one
+// builder owns the only copy of the table and every probe driver references it read-only
+// through HashJoiner::reference_hash_table (the table items are held by shared_ptr, a
+// prober only gets its own probe scratch state). Shuffle joins build one private table
+// per build driver and route each prober to its builder by driver sequence.
 class HashJoinerFactory {
 public:
     HashJoinerFactory(starrocks::HashJoinerParam& param) : _param(param) {}
@@ -283,6 +283,16 @@ Status SpillableHashJoinProbeOperator::_load_partition_build_side(workgroup::Yie
 
 Status SpillableHashJoinProbeOperator::_load_all_partition_build_side(RuntimeState* state) {
     auto spill_readers = _join_builder->spiller()->get_partition_spill_readers(_processing_partitions);
+    // take over the readers prefetched while the previous round was probing, their streams
+    // already buffered the leading blocks of these partitions. Mispredicted readers are
+    // dropped here together with their buffers.
+    for (size_t i = 0; i < _processing_partitions.size(); ++i) {
+        auto iter = _prefetched_build_readers.find(_processing_partitions[i]->partition_id);
+        if (iter != _prefetched_build_readers.end()) {
+            spill_readers[i] = std::move(iter->second);
+        }
+    }
+    _prefetched_build_readers.clear();
     _latch.reset(_processing_partitions.size());
     int32_t driver_id = CurrentThread::current().get_driver_id();
     auto query_ctx = state->query_ctx()->weak_from_this();
@@ -348,6 +358,69 @@ void SpillableHashJoinProbeOperator::_check_partitions() {
     }
 }
 
+void SpillableHashJoinProbeOperator::_prefetch_next_build_partitions() {
+    if (!config::enable_spill_hash_join_build_prefetch) {
+        return;
+    }
+    if (_build_partitions.empty() || _processing_partitions.empty()) {
+        return;
+    }
+    auto* state = runtime_state();
+    if (!_prefetched_build_readers.empty()) {
+        // keep the buffers of the already prefetched readers topped up
+        for (auto& [pid, reader] : _prefetched_build_readers) {
+            if (!reader->has_restore_task()) {
+                _update_status(
+                        reader->trigger_restore(state, RESOURCE_TLS_MEMTRACER_GUARD(state, std::weak_ptr(reader))));
+            }
+        }
+        return;
+    }
+    if (_prefetch_started) {
+        return;
+    }
+    _prefetch_started = true;
+
+    // predict the next round with the same smallest-first packing as
+    // _acquire_next_partitions, treating the current round as processed
+    std::vector<const SpillPartitionInfo*> candidates;
+    for (const auto* partition : _build_partitions) {
+        if (partition->in_mem || _processed_partitions.count(partition->partition_id)) {
+            continue;
+        }
+        if (std::any_of(
+                    _processing_partitions.begin(), _processing_partitions.end(),
+                    [&](const SpillPartitionInfo* info) { return info->partition_id == partition->partition_id; })) {
+            continue;
+        }
+        candidates.emplace_back(partition);
+    }
+    if (candidates.empty()) {
+        return;
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const SpillPartitionInfo* left, const SpillPartitionInfo* right) {
+                         return left->bytes < right->bytes;
+                     });
+    size_t avaliable_bytes = _mem_resource_manager.operator_avaliable_memory_bytes();
+    std::vector<const SpillPartitionInfo*> picked;
+    size_t bytes_usage = 0;
+    for (const auto* partition : candidates) {
+        if (partition->bytes + bytes_usage < avaliable_bytes || picked.empty()) {
+            picked.emplace_back(partition);
+            bytes_usage += partition->bytes;
+        }
+    }
+
+    auto readers = _join_builder->spiller()->get_partition_spill_readers(picked);
+    for (size_t i = 0; i < picked.size(); ++i) {
+        std::shared_ptr<spill::SpillerReader> reader = std::move(readers[i]);
+        // the stream's chunk buffer bounds how much each reader prefetches
+        _update_status(reader->trigger_restore(state, RESOURCE_TLS_MEMTRACER_GUARD(state, std::weak_ptr(reader))));
+        _prefetched_build_readers.emplace(picked[i]->partition_id, std::move(reader));
+    }
+}
+
 Status SpillableHashJoinProbeOperator::_restore_probe_partition(RuntimeState* state) {
     for (size_t i = 0; i < _probers.size(); ++i) {
         // probe partition has been processed
@@ -379,6 +452,9 @@ StatusOr<ChunkPtr> SpillableHashJoinProbeOperator::pull_chunk(RuntimeState* stat
 
     _check_partitions();
 
+    // pipeline the next round's restore IO behind this round's probe CPU
+    _prefetch_next_build_partitions();
+
     auto all_probe_partition_is_empty = [this]() {
         for (auto& _prober : _probers) {
             if (!_prober->probe_chunk_empty()) {
@@ -444,6 +520,7 @@ StatusOr<ChunkPtr> SpillableHashJoinProbeOperator::pull_chunk(RuntimeState* stat
         _current_reader.clear();
         _has_probe_remain = false;
         _builders.clear();
+        _prefetch_started = false;
         COUNTER_SET(metrics.build_partition_peak_memory_usage, 0);
     }
 
@@ -477,15 +554,24 @@ void SpillableHashJoinProbeOperator::_acquire_next_partitions() {
     size_t avaliable_bytes = _mem_resource_manager.operator_avaliable_memory_bytes();
     // process the partition could be hold in memory
     if (_processing_partitions.empty()) {
+        // pack the smallest partitions first, so a skewed partition that cannot fit in
+        // memory anyway is restored alone in the last round instead of being picked as
+        // the fallback while small partitions were still available
+        std::vector<const SpillPartitionInfo*> candidate_partitions;
         for (const auto* partition : _build_partitions) {
             if (!partition->in_mem && !_processed_partitions.count(partition->partition_id)) {
-                if ((partition->bytes + bytes_usage < avaliable_bytes || _processing_partitions.empty()) &&
-                    std::find(_processing_partitions.begin(), _processing_partitions.end(), partition) ==
-                            _processing_partitions.end()) {
-                    _processing_partitions.emplace_back(partition);
-                    bytes_usage += partition->bytes;
-                    _pid_to_process_id.emplace(partition->partition_id, _processing_partitions.size() - 1);
-                }
+                candidate_partitions.emplace_back(partition);
+            }
+        }
+        std::stable_sort(candidate_partitions.begin(), candidate_partitions.end(),
+                         [](const SpillPartitionInfo* left, const SpillPartitionInfo* right) {
+                             return left->bytes < right->bytes;
+                         });
+        for (const auto* partition : candidate_partitions) {
+            if (partition->bytes + bytes_usage < avaliable_bytes || _processing_partitions.empty()) {
+                _processing_partitions.emplace_back(partition);
+                bytes_usage += partition->bytes;
+                _pid_to_process_id.emplace(partition->partition_id, _processing_partitions.size() - 1);
             }
         }
     }
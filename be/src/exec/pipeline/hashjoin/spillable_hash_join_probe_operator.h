@@ -104,6 +104,11 @@ private:
 
     Status _restore_probe_partition(RuntimeState* state);
 
+    // While the current round is probing, start restore IO for the build partitions the
+    // next round is predicted to pick, so their input streams buffer spill blocks in the
+    // background and the next hash table build reads from memory instead of cold disk.
+    void _prefetch_next_build_partitions();
+
     // some DCHECK for hash table/partition num_rows
     void _check_partitions();
 
@@ -115,6 +120,12 @@ private:
     std::vector<const SpillPartitionInfo*> _processing_partitions;
     std::unordered_set<int32_t> _processed_partitions;
 
+    // build-side readers prefetched for the predicted next round, keyed by partition id.
+    // _load_all_partition_build_side consumes matching readers; mispredicted ones are
+    // dropped there together with their buffered chunks.
+    std::unordered_map<int32_t, std::shared_ptr<spill::SpillerReader>> _prefetched_build_readers;
+    bool _prefetch_started = false;
+
     std::vector<std::shared_ptr<spill::SpillerReader>> _current_reader;
     std::vector<bool> _probe_read_eofs;
     std::vector<bool> _probe_post_eofs;
@@ -26,6 +26,7 @@
 #include "exec/pipeline/exchange/local_exchange_source_operator.h"
 #include "exec/pipeline/group_execution/execution_group.h"
 #include "exec/pipeline/group_execution/execution_group_fwd.h"
+#include "exec/pipeline/fused_operator.h"
 #include "exec/pipeline/group_execution/group_operator.h"
 #include "exec/pipeline/noop_sink_operator.h"
 #include "exec/pipeline/pipeline_fwd.h"
@@ -513,6 +514,36 @@ void PipelineBuilderContext::pop_dependent_pipeline() {
     _dependent_pipelines.pop_back();
 }
 
+OpFactories PipelineBuilderContext::_maybe_fuse_stateless_operators(const OpFactories& operators) {
+    // A fused run needs at least two operators between the source and the sink.
+    // TODO: ChunkAccumulateOperator is disabled in stream pipelines, for now disable fusion there too.
+    if (!config::enable_pipeline_stateless_operator_fusion || _is_stream_pipeline || operators.size() < 4) {
+        return operators;
+    }
+
+    OpFactories result;
+    result.reserve(operators.size());
+    size_t i = 0;
+    while (i < operators.size()) {
+        size_t run_end = i;
+        // the driver relies on the identities of the source and sink operators, never fuse them
+        if (i > 0) {
+            while (run_end + 1 < operators.size() && FusedOperatorFactory::is_fusable(operators[run_end])) {
+                ++run_end;
+            }
+        }
+        if (run_end - i >= 2) {
+            result.emplace_back(std::make_shared<FusedOperatorFactory>(
+                    next_operator_id(), OpFactories(operators.begin() + i, operators.begin() + run_end)));
+            i = run_end;
+        } else {
+            result.emplace_back(operators[i]);
+            ++i;
+        }
+    }
+    return result;
+}
+
 void PipelineBuilderContext::_subscribe_pipeline_event(Pipeline* pipeline) {
     bool enable_wait_event = _fragment_context->runtime_state()->enable_wait_dependent_event();
     enable_wait_event &= !_current_execution_group->is_colocate_exec_group();
@@ -52,7 +52,8 @@ public:
 
     void add_pipeline(const OpFactories& operators, ExecutionGroupRawPtr execution_group) {
         // TODO: refactor Pipelines to PipelineRawPtrs
-        _pipelines.emplace_back(std::make_shared<Pipeline>(next_pipe_id(), operators, execution_group));
+        _pipelines.emplace_back(
+                std::make_shared<Pipeline>(next_pipe_id(), _maybe_fuse_stateless_operators(operators), execution_group));
         execution_group->add_pipeline(_pipelines.back());
         _subscribe_pipeline_event(_pipelines.back().get());
     }
@@ -171,6 +172,11 @@ public:
 private:
     void _subscribe_pipeline_event(Pipeline* pipeline);
 
+    // Collapse runs of adjacent stateless operators (select, project, chunk_accumulate) into
+    // one FusedOperator processing a chunk in a single pass, gated by
+    // config::enable_pipeline_stateless_operator_fusion.
+    OpFactories _maybe_fuse_stateless_operators(const OpFactories& operators);
+
     OpFactories _maybe_interpolate_local_passthrough_exchange(RuntimeState* state, int32_t plan_node_id,
                                                               OpFactories& pred_operators, int num_receivers,
                                                               bool force,
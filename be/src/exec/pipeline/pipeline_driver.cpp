@@ -18,6 +18,7 @@
 #include <sstream>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/event.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
@@ -231,12 +232,22 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
     size_t total_chunks_moved = 0;
     size_t total_rows_moved = 0;
     int64_t time_spent = 0;
+    int64_t pull_chunk_time_ns = 0;
+    int64_t push_chunk_time_ns = 0;
     Status return_status = Status::OK();
     DeferOp defer([&]() {
         if (ScanOperator* scan = source_scan_operator()) {
             scan->end_driver_process(this);
         }
 
+        // accumulated once per schedule, so the hot loop stays free of shared-counter writes
+        if (pull_chunk_time_ns > 0) {
+            StarRocksMetrics::instance()->pipe_driver_pull_chunk_time.increment(pull_chunk_time_ns);
+        }
+        if (push_chunk_time_ns > 0) {
+            StarRocksMetrics::instance()->pipe_driver_push_chunk_time.increment(push_chunk_time_ns);
+        }
+
         _update_statistics(runtime_state, total_chunks_moved, total_rows_moved, time_spent);
     });
 
@@ -302,6 +313,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 {
                     SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(curr_op);
                     SCOPED_TIMER(curr_op->_pull_timer);
+                    SCOPED_RAW_TIMER(&pull_chunk_time_ns);
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
@@ -333,6 +345,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                         {
                             SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(next_op);
                             SCOPED_TIMER(next_op->_push_timer);
+                            SCOPED_RAW_TIMER(&push_chunk_time_ns);
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
                             _adjust_memory_usage(runtime_state, query_mem_tracker.get(), next_op, maybe_chunk.value());
                             RELEASE_RESERVED_GUARD();
@@ -585,6 +598,22 @@ void PipelineDriver::_adjust_memory_usage(RuntimeState* state, MemTracker* track
     // try to release buffer if memusage > mid level threhold
     _try_to_release_buffer(state, op);
 
+    // under process-level memory pressure, revoke operators holding a meaningful amount
+    // of revocable memory even if their own query is still below its spill threshold,
+    // so that the pressure is relieved by spilling instead of by failing queries
+    if (config::spill_process_mem_limit_threshold > 0 &&
+        op->revocable_mem_bytes() > state->spill_operator_min_bytes()) {
+        auto* process_tracker = GlobalEnv::GetInstance()->process_mem_tracker();
+        int64_t process_limit = process_tracker->limit();
+        if (process_limit > 0 &&
+            process_tracker->consumption() >= process_limit * config::spill_process_mem_limit_threshold) {
+            TRACE_SPILL_LOG << "convert to low memory mode due to process mem pressure, consumption: "
+                            << process_tracker->consumption() << ", process mem limit: " << process_limit;
+            mem_resource_mgr.to_low_memory_mode();
+            return;
+        }
+    }
+
     // force mark operator to low memory mode
     if (state->spill_revocable_max_bytes() > 0 && op->revocable_mem_bytes() > state->spill_revocable_max_bytes()) {
         mem_resource_mgr.to_low_memory_mode();
@@ -694,6 +723,25 @@ void PipelineDriver::_update_driver_level_timer() {
     }
 }
 
+std::string DriverStateHistory::to_string() const {
+    std::stringstream ss;
+    size_t count = std::min(_next_index, kCapacity);
+    size_t begin = _next_index - count;
+    int64_t base_ns = 0;
+    ss << "[";
+    for (size_t i = 0; i < count; i++) {
+        const Entry& entry = _entries[(begin + i) & (kCapacity - 1)];
+        if (i == 0) {
+            base_ns = entry.timestamp_ns;
+        } else {
+            ss << " ";
+        }
+        ss << ds_to_string(entry.state) << "@+" << (entry.timestamp_ns - base_ns) / 1000000 << "ms";
+    }
+    ss << "]";
+    return ss.str();
+}
+
 std::string PipelineDriver::to_readable_string() const {
     std::stringstream ss;
     std::string block_reasons = "";
@@ -704,7 +752,7 @@ std::string PipelineDriver::to_readable_string() const {
        << " fragment_id="
        << (this->_fragment_ctx == nullptr ? "None" : print_id(this->fragment_ctx()->fragment_instance_id()))
        << " driver=" << _driver_name << ", status=" << ds_to_string(this->driver_state()) << block_reasons
-       << ", operator-chain: [";
+       << ", state-history=" << _state_history.to_string() << ", operator-chain: [";
     for (size_t i = 0; i < _operators.size(); ++i) {
         if (i == 0) {
             ss << _operators[i]->get_name();
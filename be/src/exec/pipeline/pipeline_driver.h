@@ -176,6 +176,37 @@ private:
     int64_t accumulated_rows_moved{0};
 };
 
+// Always-on flight recorder of a driver's most recent state transitions. Recording costs
+// two plain stores per transition, so it stays enabled in production builds, unlike the
+// query trace which needs a dedicated build. The history is appended to
+// to_readable_string(), which the cancel logging and the pipeline_blocking_drivers http
+// endpoint already surface, so a slow or cancelled query can be diagnosed after the fact
+// without re-running it under a profiler.
+class DriverStateHistory {
+public:
+    void record(DriverState state) {
+        Entry& entry = _entries[_next_index & (kCapacity - 1)];
+        entry.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count();
+        entry.state = state;
+        ++_next_index;
+    }
+
+    // the oldest retained transition first, timestamps relative to it in milliseconds
+    std::string to_string() const;
+
+private:
+    // must be a power of two
+    static constexpr size_t kCapacity = 32;
+    struct Entry {
+        int64_t timestamp_ns = 0;
+        DriverState state = DriverState::NOT_READY;
+    };
+    Entry _entries[kCapacity];
+    size_t _next_index = 0;
+};
+
 // OperatorExecState is used to guarantee that some hooks of operator
 // is called exactly one time during whole operator
 enum OperatorStage {
@@ -279,6 +310,7 @@ public:
             break;
         }
 
+        _state_history.record(state);
         _state = state;
     }
 
@@ -510,6 +542,7 @@ protected:
     MorselQueue* _morsel_queue = nullptr;
     // _state must be set by set_driver_state() to record state timer.
     DriverState _state{DriverState::NOT_READY};
+    DriverStateHistory _state_history;
     std::shared_ptr<RuntimeProfile> _runtime_profile = nullptr;
 
     phmap::flat_hash_map<int32_t, OperatorStage> _operator_stages;
@@ -20,6 +20,7 @@
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
@@ -31,8 +32,11 @@ namespace starrocks::pipeline {
 GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_ptr<ThreadPool> thread_pool,
                                            bool enable_resource_group)
         : Base(name),
-          _driver_queue(enable_resource_group ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
-                                              : std::make_unique<QuerySharedDriverQueue>()),
+          _driver_queue(enable_resource_group
+                                ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
+                                : config::enable_numa_aware_pipeline_driver_queue && CpuInfo::max_num_numa_nodes() > 1
+                                        ? std::unique_ptr<DriverQueue>(std::make_unique<NumaAwareDriverQueue>())
+                                        : std::make_unique<QuerySharedDriverQueue>()),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()),
@@ -322,7 +326,9 @@ void GlobalDriverExecutor::report_exec_state(QueryContext* query_ctx, FragmentCo
     auto exec_env = fragment_ctx->runtime_state()->exec_env();
     auto fragment_id = fragment_ctx->fragment_instance_id();
 
-    auto report_task = [=]() {
+    // move params into the closure, a profile-carrying report can be several MB
+    // and copying it again here showed up in perf on queries with many drivers
+    auto report_task = [params = std::move(params), exec_env, fe_addr, fragment_id]() {
         int retry_times = 0;
         while (retry_times++ < 3) {
             auto status = ExecStateReporter::report_exec_status(params, exec_env, fe_addr);
@@ -17,6 +17,7 @@
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/cpu_info.h"
 
 namespace starrocks::pipeline {
 
@@ -154,13 +155,26 @@ void QuerySharedDriverQueue::update_statistics(const DriverRawPtr driver) {
 
 int QuerySharedDriverQueue::_compute_driver_level(const DriverRawPtr driver) const {
     int time_spent = driver->driver_acct().get_accumulated_time_spent();
+    int level = QUEUE_SIZE - 1;
     for (int i = driver->get_driver_queue_level(); i < QUEUE_SIZE; ++i) {
         if (time_spent < _level_time_slices[i]) {
-            return i;
+            level = i;
+            break;
         }
     }
 
-    return QUEUE_SIZE - 1;
+    // Demote the drivers of a query whose CPU time within the current scheduling epoch
+    // exceeds the per-query quota, one level per exhausted quota. The per-driver time
+    // slices above cannot see this: a query with many fresh drivers would keep every
+    // driver at a high level, starving the drivers of the other queries.
+    const int64_t quota_ns = config::pipeline_driver_queue_query_cpu_quota_ns_per_epoch;
+    if (quota_ns > 0 && driver->query_ctx() != nullptr) {
+        const int64_t epoch_cost_ns =
+                driver->query_ctx()->cpu_cost_in_sched_epoch(config::pipeline_driver_queue_epoch_ns);
+        level += std::min<int64_t>(epoch_cost_ns / quota_ns, QUEUE_SIZE - 1);
+    }
+
+    return std::min<int>(level, QUEUE_SIZE - 1);
 }
 
 void SubQuerySharedDriverQueue::put(const DriverRawPtr driver) {
@@ -204,6 +218,94 @@ DriverRawPtr SubQuerySharedDriverQueue::take(const bool block) {
     return nullptr;
 }
 
+/// NumaAwareDriverQueue.
+NumaAwareDriverQueue::NumaAwareDriverQueue() : _num_nodes(std::max(1, CpuInfo::max_num_numa_nodes())) {
+    _node_queues.reserve(_num_nodes);
+    for (int i = 0; i < _num_nodes; ++i) {
+        _node_queues.emplace_back(std::make_unique<QuerySharedDriverQueue>());
+    }
+}
+
+void NumaAwareDriverQueue::close() {
+    _is_closed = true;
+    for (auto& queue : _node_queues) {
+        queue->close();
+    }
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    _cv.notify_all();
+}
+
+void NumaAwareDriverQueue::put_back(const DriverRawPtr driver) {
+    _node_queues[_route_node(driver)]->put_back(driver);
+    ++_num_drivers;
+    _cv.notify_one();
+}
+
+void NumaAwareDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    for (const auto driver : drivers) {
+        put_back(driver);
+    }
+}
+
+void NumaAwareDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    // Keep the deterministic routing of put_back, so that the drivers of a fragment
+    // instance always live in the same node-local queue.
+    put_back(driver);
+}
+
+StatusOr<DriverRawPtr> NumaAwareDriverQueue::take(const bool block) {
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        // Prefer the queue of the node that this thread is currently running on,
+        // and fall back to stealing from the remote nodes in order.
+        const int local_node = CpuInfo::get_current_numa_node() % _num_nodes;
+        for (int i = 0; i < _num_nodes; ++i) {
+            const int node = (local_node + i) % _num_nodes;
+            ASSIGN_OR_RETURN(auto* driver, _node_queues[node]->take(false));
+            if (driver != nullptr) {
+                --_num_drivers;
+                return driver;
+            }
+        }
+
+        if (!block) {
+            return nullptr;
+        }
+
+        // The wait must be timed: a driver put back to a remote node-local queue only
+        // notifies the waiters of this queue, which this thread may need to steal from.
+        std::unique_lock<std::mutex> lock(_global_mutex);
+        if (_num_drivers.load() == 0 && !_is_closed) {
+            _cv.wait_for(lock, std::chrono::microseconds(TAKE_POLL_INTERVAL_US));
+        }
+    }
+}
+
+void NumaAwareDriverQueue::cancel(DriverRawPtr driver) {
+    _node_queues[_route_node(driver)]->cancel(driver);
+}
+
+void NumaAwareDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _node_queues[_route_node(driver)]->update_statistics(driver);
+}
+
+size_t NumaAwareDriverQueue::size() const {
+    size_t num_drivers = 0;
+    for (const auto& queue : _node_queues) {
+        num_drivers += queue->size();
+    }
+    return num_drivers;
+}
+
+int NumaAwareDriverQueue::_route_node(const DriverRawPtr driver) const {
+    // Route by the fragment instance, so that all the drivers of a fragment instance,
+    // together with the morsels and chunks they touch, stay on one socket.
+    return std::hash<void*>()(driver->fragment_ctx()) % _num_nodes;
+}
+
 /// WorkGroupDriverQueue.
 bool WorkGroupDriverQueue::WorkGroupDriverSchedEntityComparator::operator()(
         const WorkGroupDriverSchedEntityPtr& lhs_ptr, const WorkGroupDriverSchedEntityPtr& rhs_ptr) const {
@@ -143,6 +143,54 @@ private:
     bool _is_closed = false;
 };
 
+// NumaAwareDriverQueue partitions the ready drivers into one QuerySharedDriverQueue per NUMA node,
+// so that the chunks flowing through a driver tend to stay in the memory of one socket.
+// 1. put_back routes a driver to a node-local queue deterministically by its fragment instance,
+//    so all the drivers of a fragment instance share one node and cancel/update_statistics
+//    can find the owner queue without extra bookkeeping.
+// 2. take prefers the queue of the node that the executor thread is currently running on,
+//    and only steals from the queues of the remote nodes when the local queue is empty.
+class NumaAwareDriverQueue : public FactoryMethod<DriverQueue, NumaAwareDriverQueue> {
+    friend class FactoryMethod<DriverQueue, NumaAwareDriverQueue>;
+
+public:
+    NumaAwareDriverQueue();
+    ~NumaAwareDriverQueue() override = default;
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take(const bool block) override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    size_t size() const override;
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override { return false; }
+
+private:
+    // The interval to recheck the queues of all the nodes, when a blocking take finds them all empty.
+    // The wait is timed, because a driver put back to a remote node-local queue only notifies
+    // the waiters of that queue.
+    static constexpr int64_t TAKE_POLL_INTERVAL_US = 500;
+
+    int _route_node(const DriverRawPtr driver) const;
+
+    const int _num_nodes;
+    std::vector<std::unique_ptr<QuerySharedDriverQueue>> _node_queues;
+
+    std::atomic<size_t> _num_drivers = 0;
+
+    mutable std::mutex _global_mutex;
+    std::condition_variable _cv;
+    std::atomic<bool> _is_closed = false;
+};
+
 // WorkGroupDriverQueue contains two levels of queues.
 // The first level is the work group queue, and the second level is the driver queue in a work group.
 class WorkGroupDriverQueue : public FactoryMethod<DriverQueue, WorkGroupDriverQueue> {
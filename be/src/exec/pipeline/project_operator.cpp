@@ -14,26 +14,69 @@
 
 #include "exec/pipeline/project_operator.h"
 
+#include <atomic>
+#include <mutex>
+
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
+#include "util/priority_thread_pool.hpp"
 
 namespace starrocks::pipeline {
+
+static bool contains_java_udf(const Expr* expr) {
+    if (expr->fn().binary_type == TFunctionBinaryType::SRJAR) {
+        return true;
+    }
+    for (const auto* child : expr->children()) {
+        if (contains_java_udf(child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 Status ProjectOperator::prepare(RuntimeState* state) {
     _expr_compute_timer = ADD_TIMER(_unique_metrics, "ExprComputeTime");
     _common_sub_expr_compute_timer = ADD_TIMER(_unique_metrics, "CommonSubExprComputeTime");
+    if (config::enable_async_java_udf_project) {
+        for (const auto* ctx : _common_sub_expr_ctxs) {
+            _has_java_udf |= contains_java_udf(ctx->root());
+        }
+        for (const auto* ctx : _expr_ctxs) {
+            _has_java_udf |= contains_java_udf(ctx->root());
+        }
+    }
+    // Expression count stands in for a cost estimate here: the BE has no per-expression
+    // cost model, and a SELECT list wide enough to be worth splitting is wide by count.
+    // Java UDF projections stay on the dedicated udf pool.
+    if (!_has_java_udf && config::pipeline_parallel_project_min_exprs > 0 &&
+        _expr_ctxs.size() >= static_cast<size_t>(config::pipeline_parallel_project_min_exprs)) {
+        _parallel_eval_task_num =
+                std::min<size_t>(std::max(config::pipeline_parallel_project_task_num, 1), _expr_ctxs.size());
+    }
     return Operator::prepare(state);
 }
 
 void ProjectOperator::close(RuntimeState* state) {
+    if (_async_future.valid()) {
+        // the pending evaluation references |this|, wait for it before tearing down
+        _async_future.wait();
+    }
     _cur_chunk.reset();
     Operator::close(state);
 }
 
 StatusOr<ChunkPtr> ProjectOperator::pull_chunk(RuntimeState* state) {
+    if (_async_future.valid()) {
+        RETURN_IF_ERROR(_async_future.get());
+    }
     return std::move(_cur_chunk);
 }
 
@@ -43,44 +86,140 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
         _cur_chunk = chunk;
         return Status::OK();
     }
-    TRY_CATCH_ALLOC_SCOPE_START();
-    {
-        SCOPED_TIMER(_common_sub_expr_compute_timer);
-        for (size_t i = 0; i < _common_sub_column_ids.size(); ++i) {
-            ASSIGN_OR_RETURN(auto col, _common_sub_expr_ctxs[i]->evaluate(chunk.get()));
-            chunk->append_column(std::move(col), _common_sub_column_ids[i]);
-            RETURN_IF_HAS_ERROR(_common_sub_expr_ctxs);
-        }
+    if (_has_java_udf) {
+        // Run the JNI round trip on the udf thread pool. The driver observes neither output
+        // nor demand for input until the promise is fulfilled, so it yields to the blocked
+        // driver poller instead of stalling a driver thread inside the JVM.
+        _async_promise = std::promise<Status>();
+        _async_future = _async_promise.get_future();
+        state->exec_env()->udf_call_pool()->offer([this, state, chunk]() {
+            MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(state->instance_mem_tracker());
+            SCOPED_SET_TRACE_INFO({}, state->query_id(), state->fragment_instance_id());
+            DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+            _async_promise.set_value(_evaluate(state, chunk));
+        });
+        return Status::OK();
     }
+    if (_parallel_eval_task_num > 1) {
+        return _evaluate_parallel(state, chunk);
+    }
+    return _evaluate(state, chunk);
+}
 
+Status ProjectOperator::_evaluate(RuntimeState* state, const ChunkPtr& chunk) {
+    RETURN_IF_ERROR(_evaluate_common_sub_exprs(chunk));
     Columns result_columns(_column_ids.size());
-    {
-        SCOPED_TIMER(_expr_compute_timer);
-        for (size_t i = 0; i < _column_ids.size(); ++i) {
-            ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate(chunk.get()));
-
-            if (result_columns[i]->only_null()) {
-                result_columns[i] = ColumnHelper::create_column(_expr_ctxs[i]->root()->type(), true);
-                result_columns[i]->append_nulls(chunk->num_rows());
-            } else if (result_columns[i]->is_constant()) {
-                // Note: we must create a new column every time here,
-                // because result_columns[i] is shared_ptr
-                ColumnPtr new_column = ColumnHelper::create_column(_expr_ctxs[i]->root()->type(), false);
-                auto* const_column = down_cast<ConstColumn*>(result_columns[i].get());
-                new_column->append(*const_column->data_column(), 0, 1);
-                new_column->assign(chunk->num_rows(), 0);
-                result_columns[i] = std::move(new_column);
-            }
+    RETURN_IF_ERROR(_evaluate_exprs(chunk, result_columns, 0, 1));
+    return _make_output_chunk(chunk, result_columns);
+}
+
+namespace {
+// state shared between the tasks of one _evaluate_parallel() round
+struct ParallelEvalState {
+    Columns result_columns;
+    std::atomic<int> pending_tasks{0};
+    std::mutex status_mutex;
+    Status status;
+};
+} // namespace
+
+Status ProjectOperator::_evaluate_parallel(RuntimeState* state, const ChunkPtr& chunk) {
+    // common sub expressions feed the parallel expressions through the input chunk, so
+    // they must be appended before the tasks fork
+    RETURN_IF_ERROR(_evaluate_common_sub_exprs(chunk));
 
-            // follow SlotDescriptor is_null flag
-            if (_type_is_nullable[i] && !result_columns[i]->is_nullable()) {
-                result_columns[i] =
-                        NullableColumn::create(result_columns[i], NullColumn::create(result_columns[i]->size(), 0));
+    const size_t task_num = _parallel_eval_task_num;
+    auto eval_state = std::make_shared<ParallelEvalState>();
+    eval_state->result_columns.resize(_column_ids.size());
+    eval_state->pending_tasks = static_cast<int>(task_num);
+
+    _async_promise = std::promise<Status>();
+    _async_future = _async_promise.get_future();
+
+    auto task = [this, state, chunk, eval_state, task_num](size_t task_id) {
+        MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(state->instance_mem_tracker());
+        SCOPED_SET_TRACE_INFO({}, state->query_id(), state->fragment_instance_id());
+        DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+        Status status = _evaluate_exprs(chunk, eval_state->result_columns, task_id, task_num);
+        if (!status.ok()) {
+            std::lock_guard<std::mutex> guard(eval_state->status_mutex);
+            if (eval_state->status.ok()) {
+                eval_state->status = std::move(status);
             }
         }
-        RETURN_IF_HAS_ERROR(_expr_ctxs);
+        if (eval_state->pending_tasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            // the last task to finish assembles the output chunk and wakes the driver
+            Status final_status;
+            {
+                std::lock_guard<std::mutex> guard(eval_state->status_mutex);
+                final_status = eval_state->status;
+            }
+            if (final_status.ok()) {
+                final_status = _make_output_chunk(chunk, eval_state->result_columns);
+            }
+            _async_promise.set_value(std::move(final_status));
+        }
+    };
+
+    auto* pool = state->exec_env()->thread_pool();
+    for (size_t t = 1; t < task_num; ++t) {
+        if (!pool->offer([task, t]() { task(t); })) {
+            // pool saturated, take over this share on the driver thread
+            task(t);
+        }
+    }
+    // the driver thread contributes one share instead of idling until the pool catches up
+    task(0);
+    return Status::OK();
+}
+
+Status ProjectOperator::_evaluate_common_sub_exprs(const ChunkPtr& chunk) {
+    TRY_CATCH_ALLOC_SCOPE_START();
+    SCOPED_TIMER(_common_sub_expr_compute_timer);
+    for (size_t i = 0; i < _common_sub_column_ids.size(); ++i) {
+        ASSIGN_OR_RETURN(auto col, _common_sub_expr_ctxs[i]->evaluate(chunk.get()));
+        chunk->append_column(std::move(col), _common_sub_column_ids[i]);
+        RETURN_IF_HAS_ERROR(_common_sub_expr_ctxs);
+    }
+    TRY_CATCH_ALLOC_SCOPE_END()
+    return Status::OK();
+}
+
+Status ProjectOperator::_evaluate_exprs(const ChunkPtr& chunk, Columns& result_columns, size_t task_id,
+                                        size_t task_num) {
+    TRY_CATCH_ALLOC_SCOPE_START();
+    SCOPED_TIMER(_expr_compute_timer);
+    // a strided partition so that a run of expensive neighboring expressions in the
+    // SELECT list spreads across tasks instead of landing on one of them
+    for (size_t i = task_id; i < _column_ids.size(); i += task_num) {
+        ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate(chunk.get()));
+
+        if (result_columns[i]->only_null()) {
+            result_columns[i] = ColumnHelper::create_column(_expr_ctxs[i]->root()->type(), true);
+            result_columns[i]->append_nulls(chunk->num_rows());
+        } else if (result_columns[i]->is_constant()) {
+            // Note: we must create a new column every time here,
+            // because result_columns[i] is shared_ptr
+            ColumnPtr new_column = ColumnHelper::create_column(_expr_ctxs[i]->root()->type(), false);
+            auto* const_column = down_cast<ConstColumn*>(result_columns[i].get());
+            new_column->append(*const_column->data_column(), 0, 1);
+            new_column->assign(chunk->num_rows(), 0);
+            result_columns[i] = std::move(new_column);
+        }
+
+        // follow SlotDescriptor is_null flag
+        if (_type_is_nullable[i] && !result_columns[i]->is_nullable()) {
+            result_columns[i] =
+                    NullableColumn::create(result_columns[i], NullColumn::create(result_columns[i]->size(), 0));
+        }
     }
+    TRY_CATCH_ALLOC_SCOPE_END()
+    return Status::OK();
+}
 
+Status ProjectOperator::_make_output_chunk(const ChunkPtr& chunk, Columns& result_columns) {
+    TRY_CATCH_ALLOC_SCOPE_START();
+    RETURN_IF_HAS_ERROR(_expr_ctxs);
     _cur_chunk = std::make_shared<Chunk>();
     for (size_t i = 0; i < result_columns.size(); ++i) {
         _cur_chunk->append_column(result_columns[i], _column_ids[i]);
@@ -91,6 +230,9 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
 }
 
 Status ProjectOperator::reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) {
+    if (_async_future.valid()) {
+        (void)_async_future.get();
+    }
     _is_finished = false;
     _cur_chunk = nullptr;
 
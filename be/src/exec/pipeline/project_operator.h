@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <chrono>
+#include <future>
+
 #include "exec/pipeline/operator.h"
 #include "runtime/global_dict/parser.h"
 
@@ -39,11 +42,16 @@ public:
 
     void close(RuntimeState* state) override;
 
-    bool has_output() const override { return _cur_chunk != nullptr; }
+    bool has_output() const override {
+        if (_async_future.valid()) {
+            return _async_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+        return _cur_chunk != nullptr;
+    }
 
-    bool need_input() const override { return !_is_finished && _cur_chunk == nullptr; }
+    bool need_input() const override { return !_is_finished && _cur_chunk == nullptr && !_async_future.valid(); }
 
-    bool is_finished() const override { return _is_finished && _cur_chunk == nullptr; }
+    bool is_finished() const override { return _is_finished && _cur_chunk == nullptr && !_async_future.valid(); }
 
     bool ignore_empty_eos() const override { return false; }
 
@@ -59,6 +67,16 @@ public:
     Status reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) override;
 
 private:
+    Status _evaluate(RuntimeState* state, const ChunkPtr& chunk);
+    // Split _expr_ctxs across _parallel_eval_task_num tasks on the general thread pool,
+    // the driver thread evaluating one share itself. The last task to finish assembles
+    // the output chunk and fulfills _async_promise, so the join never blocks a thread.
+    Status _evaluate_parallel(RuntimeState* state, const ChunkPtr& chunk);
+    Status _evaluate_common_sub_exprs(const ChunkPtr& chunk);
+    // evaluate _expr_ctxs[i] into result_columns[i] for i = task_id, task_id + task_num, ...
+    Status _evaluate_exprs(const ChunkPtr& chunk, Columns& result_columns, size_t task_id, size_t task_num);
+    Status _make_output_chunk(const ChunkPtr& chunk, Columns& result_columns);
+
     const std::vector<int32_t>& _column_ids;
     const std::vector<ExprContext*>& _expr_ctxs;
     const std::vector<bool>& _type_is_nullable;
@@ -69,6 +87,17 @@ private:
     bool _is_finished = false;
     ChunkPtr _cur_chunk = nullptr;
 
+    // Whether the projection contains java UDF calls. Such projections are evaluated on the
+    // udf thread pool and the driver yields until the result is ready, instead of stalling
+    // the driver thread for the whole JNI round trip.
+    bool _has_java_udf = false;
+    // Number of tasks one chunk's expressions are evaluated with. 1 keeps the serial
+    // path; projections at least config::pipeline_parallel_project_min_exprs wide get
+    // config::pipeline_parallel_project_task_num tasks, fixed at prepare() time.
+    size_t _parallel_eval_task_num = 1;
+    std::promise<Status> _async_promise;
+    std::future<Status> _async_future;
+
     RuntimeProfile::Counter* _expr_compute_timer = nullptr;
     RuntimeProfile::Counter* _common_sub_expr_compute_timer = nullptr;
 };
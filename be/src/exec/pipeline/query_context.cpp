@@ -304,8 +304,23 @@ void QueryContextManager::_clean_query_contexts() {
     for (auto i = 0; i < _num_slots; ++i) {
         auto& mutex = _mutexes[i];
         std::vector<QueryContextPtr> del_list;
+        std::vector<QueryContextPtr> cancel_list;
         std::unique_lock write_lock(mutex);
         _clean_slot_unlocked(i, del_list);
+        // Deployed fragments of a partially delivered query would otherwise wait on their
+        // missing peers forever while holding memory; cancel them outside the slot lock.
+        for (auto& [_, ctx] : _context_maps[i]) {
+            if (ctx->is_partially_delivered() && ctx->mark_delivery_timeout_cancelled()) {
+                cancel_list.emplace_back(ctx);
+            }
+        }
+        write_lock.unlock();
+        for (auto& ctx : cancel_list) {
+            LOG(WARNING) << "cancel partially delivered query: " << print_id(ctx->query_id())
+                         << ", active fragments: " << ctx->num_active_fragments()
+                         << ", expected fragments: " << ctx->total_fragments();
+            ctx->cancel(Status::TimedOut("query fragments are not fully delivered before the delivery deadline"));
+        }
     }
 }
 
@@ -81,6 +81,12 @@ public:
     }
 
     bool is_dead() const { return _num_active_fragments == 0 && _num_fragments == _total_fragments; }
+    // The delivery deadline passed before all fragments the coordinator announced for this
+    // backend arrived. The deployed fragments hold their memory while blocked on exchanges
+    // to the missing peers, so the query can never make progress.
+    bool is_partially_delivered() const { return _num_fragments < _total_fragments && is_delivery_expired(); }
+    // returns true only for the caller that flips the flag, so the query is cancelled once
+    bool mark_delivery_timeout_cancelled() { return !_delivery_timeout_cancelled.exchange(true); }
     // add expired seconds to deadline
     void extend_delivery_lifetime() {
         _delivery_deadline =
@@ -177,6 +183,7 @@ public:
     void incr_cpu_cost(int64_t cost) {
         _total_cpu_cost_ns += cost;
         _delta_cpu_cost_ns += cost;
+        _sched_epoch_cpu_cost_ns += cost;
     }
     void incr_cur_scan_rows_num(int64_t rows_num) {
         _total_scan_rows_num += rows_num;
@@ -190,6 +197,17 @@ public:
     void update_scan_stats(int64_t table_id, int64_t scan_rows_num, int64_t scan_bytes);
 
     int64_t cpu_cost() const { return _total_cpu_cost_ns; }
+    // CPU time consumed by all the drivers of this query within the current scheduling epoch
+    // of the driver queue. The epoch is rolled over lazily: the first caller after the epoch
+    // expires resets the usage, so no periodic timer is needed.
+    int64_t cpu_cost_in_sched_epoch(int64_t epoch_ns) {
+        int64_t now = MonotonicNanos();
+        int64_t end_ns = _sched_epoch_end_ns.load(std::memory_order_relaxed);
+        if (end_ns <= now && _sched_epoch_end_ns.compare_exchange_strong(end_ns, now + epoch_ns)) {
+            _sched_epoch_cpu_cost_ns = 0;
+        }
+        return _sched_epoch_cpu_cost_ns;
+    }
     int64_t cur_scan_rows_num() const { return _total_scan_rows_num; }
     int64_t get_scan_bytes() const { return _total_scan_bytes; }
     std::atomic_int64_t* mutable_total_spill_bytes() { return &_total_spill_bytes; }
@@ -263,6 +281,7 @@ private:
     std::once_flag _query_trace_init_flag;
     std::shared_ptr<starrocks::debug::QueryTrace> _query_trace;
     std::atomic_bool _is_prepared = false;
+    std::atomic_bool _delivery_timeout_cancelled = false;
 
     std::once_flag _init_query_once;
     int64_t _query_begin_time = 0;
@@ -272,6 +291,9 @@ private:
     std::atomic<int64_t> _total_scan_bytes = 0;
     std::atomic<int64_t> _total_spill_bytes = 0;
     std::atomic<int64_t> _delta_cpu_cost_ns = 0;
+    // CPU usage within the current scheduling epoch of the driver queue.
+    std::atomic<int64_t> _sched_epoch_cpu_cost_ns = 0;
+    std::atomic<int64_t> _sched_epoch_end_ns = 0;
     std::atomic<int64_t> _delta_scan_rows_num = 0;
     std::atomic<int64_t> _delta_scan_bytes = 0;
 
@@ -83,11 +83,16 @@ bool BalancedChunkBuffer::put(int buffer_index, ChunkPtr chunk, ChunkBufferToken
     if (_strategy == BalanceStrategy::kDirect) {
         ret = _get_sub_buffer(buffer_index)->put(std::make_pair(std::move(chunk), std::move(chunk_token)));
     } else if (_strategy == BalanceStrategy::kRoundRobin) {
-        // TODO: try to balance data according to number of rows
-        // But the hard part is, that may needs to maintain a min-heap to account the rows of each
-        // output operator, which would introduce some extra overhead
-        int target_index = _output_index.fetch_add(1);
-        target_index %= _output_operators;
+        // Balance by queue depth between two round-robin candidates (power-of-two-choices).
+        // This keeps one slow consumer from backing up its queue while the others sit idle,
+        // without maintaining a min-heap over all output operators.
+        int target_index = _output_index.fetch_add(1) % _output_operators;
+        if (_output_operators > 1) {
+            int next_index = (target_index + 1) % _output_operators;
+            if (_get_sub_buffer(next_index)->get_size() < _get_sub_buffer(target_index)->get_size()) {
+                target_index = next_index;
+            }
+        }
         ret = _get_sub_buffer(target_index)->put(std::make_pair(std::move(chunk), std::move(chunk_token)));
     } else {
         CHECK(false) << "unreachable";
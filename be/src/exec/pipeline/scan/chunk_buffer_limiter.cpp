@@ -24,6 +24,13 @@ void DynamicChunkBufferLimiter::update_avg_row_bytes(size_t added_sum_row_bytes,
 
     _sum_row_bytes += added_sum_row_bytes;
     _num_rows += added_num_rows;
+    // Age the statistics so the average follows the data actually flowing now. Without decay,
+    // a burst of oversized rows (e.g. multi-MB string payloads) would depress the buffer
+    // capacity for the remainder of the scan even after the wide rows have passed.
+    if (_num_rows > kStatsDecayRows) {
+        _sum_row_bytes /= 2;
+        _num_rows /= 2;
+    }
     size_t avg_row_bytes = 0;
     if (_num_rows > 0) {
         avg_row_bytes = _sum_row_bytes / _num_rows;
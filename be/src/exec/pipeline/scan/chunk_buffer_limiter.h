@@ -135,6 +135,10 @@ private:
     void _unpin(int num_chunks);
 
 private:
+    // Halve the accumulated row statistics once this many rows have been sampled, so the
+    // average row width tracks recent data instead of the whole scan history.
+    static constexpr size_t kStatsDecayRows = 1UL << 22;
+
     std::mutex _mutex;
     size_t _sum_row_bytes = 0;
     size_t _num_rows = 0;
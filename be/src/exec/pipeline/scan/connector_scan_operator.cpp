@@ -651,6 +651,9 @@ ConnectorChunkSource::ConnectorChunkSource(ScanOperator* op, RuntimeProfile* run
     _data_source->set_split_context(split_context);
 
     _data_source->set_morsel(scan_morsel);
+    if (auto* queue = op->morsel_queue(); queue != nullptr) {
+        _data_source->set_morsel_queue_hint(queue->approx_queued_morsels(), op->degree_of_parallelism());
+    }
     _data_source->set_predicates(_conjunct_ctxs);
     _data_source->set_runtime_filters(_runtime_bloom_filters);
     _data_source->set_read_limit(_limit);
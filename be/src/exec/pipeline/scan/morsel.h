@@ -337,6 +337,10 @@ public:
 
     virtual size_t num_original_morsels() const { return _num_morsels; }
     virtual size_t max_degree_of_parallelism() const { return _num_morsels; }
+    // An approximation of how many morsels are still queued. Connector scans use it to
+    // decide whether a big file should be re-split more finely at the scan tail; queues
+    // that do not track consumption report "plenty" so the tail mode never triggers.
+    virtual size_t approx_queued_morsels() const { return SIZE_MAX; }
     virtual bool empty() const = 0;
     virtual StatusOr<MorselPtr> try_get() = 0;
     virtual void unget(MorselPtr&& morsel);
@@ -561,6 +565,9 @@ public:
     }
     ~DynamicMorselQueue() override = default;
     bool empty() const override { return _size.load(std::memory_order_relaxed) == 0; }
+    size_t approx_queued_morsels() const override {
+        return std::max<int64_t>(_size.load(std::memory_order_relaxed), 0);
+    }
     StatusOr<MorselPtr> try_get() override;
     void unget(MorselPtr&& morsel) override;
     std::string name() const override { return "dynamic_morsel_queue"; }
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 
+#include "column/column_pool.h"
 #include "exec/olap_scan_node.h"
 #include "exec/olap_scan_prepare.h"
 #include "exec/pipeline/scan/olap_scan_context.h"
@@ -31,6 +32,7 @@
 #include "storage/chunk_helper.h"
 #include "storage/column_predicate_rewriter.h"
 #include "storage/olap_runtime_range_pruner.hpp"
+#include "storage/page_cache.h"
 #include "storage/predicate_parser.h"
 #include "storage/projection_iterator.h"
 #include "storage/storage_engine.h"
@@ -63,6 +65,8 @@ void OlapChunkSource::close(RuntimeState* state) {
         _reader.reset();
     }
     _predicate_free_pool.clear();
+    // Reduce the memory usage if the the average string size is greater than 512.
+    release_large_columns<BinaryColumn>(state->chunk_size() * 512);
 }
 
 Status OlapChunkSource::prepare(RuntimeState* state) {
@@ -200,6 +204,10 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     _params.profile = _runtime_profile;
     _params.runtime_state = _runtime_state;
     _params.use_page_cache = _runtime_state->use_page_cache();
+    if (_scan_op->workgroup() != nullptr) {
+        // attribute this scan's page cache traffic to its resource group
+        _params.page_cache_group_stats = _scan_op->workgroup()->page_cache_stats().get();
+    }
     _params.use_pk_index = thrift_olap_scan_node.use_pk_index;
     if (thrift_olap_scan_node.__isset.sorted_by_keys_per_tablet) {
         _params.sorted_by_keys_per_tablet = thrift_olap_scan_node.sorted_by_keys_per_tablet;
@@ -210,6 +218,16 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     std::vector<PredicatePtr> preds;
     RETURN_IF_ERROR(_scan_ctx->conjuncts_manager().get_column_predicates(parser, &preds));
     _decide_chunk_size(!preds.empty());
+    // A big one-shot scan (e.g. a full-table export) would evict the whole working set
+    // if it populated the page cache, so predicate-free scans of tablets larger than a
+    // fraction of the cache still probe the cache but do not insert into it.
+    if (_params.use_page_cache && preds.empty() && config::page_cache_scan_bypass_ratio > 0) {
+        size_t cache_capacity = StoragePageCache::instance()->get_capacity();
+        if (cache_capacity > 0 &&
+            _tablet->tablet_footprint() > cache_capacity * config::page_cache_scan_bypass_ratio) {
+            _params.fill_page_cache = false;
+        }
+    }
     for (auto& p : preds) {
         if (parser->can_pushdown(p.get())) {
             _params.predicates.push_back(p.get());
@@ -90,11 +90,11 @@ Status OlapScanContext::capture_tablet_rowsets(const std::vector<TInternalScanRa
         ASSIGN_OR_RETURN(TabletSharedPtr tablet, OlapScanNode::get_tablet(scan_range));
 
         // Capture row sets of this version tablet.
-        {
+        if (!tablet->try_capture_consistent_rowsets(Version(0, version), &_tablet_rowsets[i])) {
             std::shared_lock l(tablet->get_header_lock());
             RETURN_IF_ERROR(tablet->capture_consistent_rowsets(Version(0, version), &_tablet_rowsets[i]));
-            Rowset::acquire_readers(_tablet_rowsets[i]);
         }
+        Rowset::acquire_readers(_tablet_rowsets[i]);
 
         _tablets[i] = std::move(tablet);
     }
@@ -634,6 +634,19 @@ pipeline::OpFactories decompose_scan_node_to_pipeline(std::shared_ptr<ScanOperat
     scan_operator->set_degree_of_parallelism(morsel_queue_factory->size());
     scan_operator->set_could_local_shuffle(morsel_queue_factory->could_local_shuffle());
 
+    // Seed the initial MultiLevelFeedScanTaskQueue level from the morsel count of the scan node,
+    // so the tasks of a large scan start below point queries instead of sharing the top level
+    // with them until enough runtime has accrued. The level can only age downward from the seed.
+    if (int64_t morsels_per_level = config::pipeline_scan_queue_init_level_morsel_num; morsels_per_level > 0) {
+        int level = 0;
+        for (auto num_morsels = static_cast<int64_t>(morsel_queue_factory->num_original_morsels());
+             num_morsels >= morsels_per_level && level < workgroup::MultiLevelFeedScanTaskQueue::NUM_QUEUES - 1;
+             num_morsels /= 2) {
+            ++level;
+        }
+        scan_operator->scan_task_group()->sub_queue_level = level;
+    }
+
     ops.emplace_back(std::move(scan_operator));
 
     size_t limit = scan_node->limit();
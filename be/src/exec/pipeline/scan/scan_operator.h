@@ -61,6 +61,7 @@ public:
     void set_scan_executor(workgroup::ScanExecutor* scan_executor) { _scan_executor = scan_executor; }
 
     void set_workgroup(workgroup::WorkGroupPtr wg) { _workgroup = std::move(wg); }
+    const workgroup::WorkGroupPtr& workgroup() const { return _workgroup; }
 
     int64_t global_rf_wait_timeout_ns() const override;
 
@@ -81,6 +82,7 @@ public:
     virtual int available_pickup_morsel_count() { return _io_tasks_per_scan_operator; }
     virtual void begin_pickup_morsels() {}
     bool output_chunk_by_bucket() const { return _output_chunk_by_bucket; }
+    int32_t degree_of_parallelism() const { return _dop; }
     void begin_pull_chunk(const ChunkPtr& res) {
         _op_pull_chunks += 1;
         _op_pull_rows += res->num_rows();
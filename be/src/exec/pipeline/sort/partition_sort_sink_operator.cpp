@@ -114,6 +114,7 @@ Status PartitionSortSinkOperatorFactory::prepare(RuntimeState* state) {
 
 OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver_sequence) {
     std::shared_ptr<ChunksSorter> chunks_sorter;
+    ChunksSorterTopn* topn_sorter = nullptr;
     if (_limit >= 0) {
         if (_topn_type == TTopNType::ROW_NUMBER && _limit <= ChunksSorter::USE_HEAP_SORTER_LIMIT_SZ) {
             chunks_sorter = std::make_unique<ChunksSorterHeapSort>(
@@ -121,9 +122,11 @@ OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver
                     _sort_keys, 0, _limit + _offset);
         } else {
             size_t max_buffered_chunks = ChunksSorterTopn::tunning_buffered_chunks(_limit);
-            chunks_sorter = std::make_unique<ChunksSorterTopn>(
+            auto topn = std::make_unique<ChunksSorterTopn>(
                     runtime_state(), &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order, &_is_null_first,
                     _sort_keys, 0, _limit + _offset, _topn_type, max_buffered_chunks);
+            topn_sorter = topn.get();
+            chunks_sorter = std::move(topn);
         }
     } else {
         chunks_sorter = std::make_unique<ChunksSorterFullSort>(
@@ -132,6 +135,10 @@ OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver
     }
 
     auto sort_context = _sort_context_factory->create(driver_sequence);
+    if (topn_sorter != nullptr) {
+        // let the topn sorters of this context prune by the tightest Kth row any of them found
+        topn_sorter->set_shared_topn_boundary(sort_context->shared_topn_boundary());
+    }
     sort_context->add_partition_chunks_sorter(chunks_sorter);
     auto ope = std::make_shared<PartitionSortSinkOperator>(this, _id, _plan_node_id, driver_sequence, chunks_sorter,
                                                            _sort_exec_exprs, _order_by_types, _materialized_tuple_desc,
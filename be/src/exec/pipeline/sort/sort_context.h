@@ -23,6 +23,7 @@
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "exec/chunks_sorter.h"
+#include "exec/chunks_sorter_topn.h"
 #include "exec/pipeline/context_with_dependency.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/sorting/merge.h"
@@ -58,6 +59,9 @@ public:
         return _chunks_sorter_partitions[driver_sequence].get();
     }
     TTopNType::type topn_type() const { return _topn_type; }
+    // The tightest top-n boundary found by any partition sorter of this context, shared so
+    // all the sinkers can prune their input by the best-known Kth row.
+    SharedTopnBoundary* shared_topn_boundary() { return &_shared_topn_boundary; }
     int64_t offset() const { return _offset; }
     int64_t limit() const { return _limit; }
     const std::vector<ExprContext*>& sort_exprs() const { return _sort_exprs; }
@@ -88,6 +92,8 @@ private:
     std::atomic<int64_t> _total_rows = 0; // size of all chunks from all partitions.
     std::atomic<int32_t> _num_partition_finished = 0;
 
+    SharedTopnBoundary _shared_topn_boundary;
+
     std::vector<std::shared_ptr<ChunksSorter>> _chunks_sorter_partitions; // Partial sorters
     std::vector<std::unique_ptr<SimpleChunkSortCursor>> _partial_cursors;
     MergeCursorsCascade _merger;
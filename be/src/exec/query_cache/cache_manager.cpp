@@ -24,9 +24,23 @@ static void delete_cache_entry(const CacheKey& key, void* value) {
 }
 
 void CacheManager::populate(const std::string& key, const CacheValue& value) {
+    // Identical queries (e.g. periodically refreshed dashboards) may compute the same
+    // key concurrently and each of them tries to populate the cache when it finishes.
+    // Keep the entry with the freshest version and drop duplicate or stale inserts
+    // instead of churning the LRU list with equivalent copies.
+    auto* handle = _cache.lookup(key);
+    if (handle != nullptr) {
+        auto* cached = reinterpret_cast<CacheValue*>(_cache.value(handle));
+        bool fresher = cached->version >= value.version;
+        _cache.release(handle);
+        if (fresher) {
+            return;
+        }
+    }
     auto* cache_value = new CacheValue(value);
-    auto* handle = _cache.insert(key, cache_value, cache_value->size(), &delete_cache_entry, CachePriority::NORMAL);
-    _cache.release(handle);
+    auto* inserted_handle =
+            _cache.insert(key, cache_value, cache_value->size(), &delete_cache_entry, CachePriority::NORMAL);
+    _cache.release(inserted_handle);
 }
 
 StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
@@ -24,6 +24,11 @@
 #include "util/lru_cache.h"
 #include "util/slice.h"
 
+// The query cache reuses deterministic per-tablet computation results (scan plus the
+// operators below the cache point, e.g. projections and partial aggregations) across
+// queries, keyed by the FE-computed plan digest and the tablet version. This is the
+// finest reuse granularity the engine supports: execution chunks do not carry
+// segment/row provenance, so results cannot be cached or invalidated per segment.
 namespace starrocks::query_cache {
 class CacheManager;
 using CacheManagerRawPtr = CacheManager*;
@@ -51,6 +51,16 @@ SelectNode::~SelectNode() {
     }
 }
 
+Status SelectNode::init(const TPlanNode& tnode, RuntimeState* state) {
+    RETURN_IF_ERROR(ExecNode::init(tnode, state));
+    // The filter node evaluates its conjuncts as expressions instead of rewriting them into
+    // storage predicates, so they can take the JIT path the same way ProjectNode's expressions
+    // do. Scan nodes must keep interpreted conjuncts because their pushdown analysis inspects
+    // the expression tree shape, which wrapping in JITExpr would hide.
+    RETURN_IF_ERROR(Expr::create_expr_trees(_pool, tnode.conjuncts, &_conjunct_ctxs, state, true));
+    return Status::OK();
+}
+
 Status SelectNode::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(ExecNode::prepare(state));
     _conjunct_evaluate_timer = ADD_TIMER(_runtime_profile, "ConjunctEvaluateTime");
@@ -28,6 +28,7 @@
 #include "exprs/expr_context.h"
 #include "glog/logging.h"
 #include "runtime/mem_pool.h"
+#include "simd/simd.h"
 
 namespace starrocks {
 
@@ -414,7 +415,11 @@ Status SortedStreamingAggregator::_compute_group_by(size_t chunk_size) {
     for (size_t i = 0; i < _group_by_columns.size(); ++i) {
         ColumnSelfComparator cmp(_last_columns[i], _cmp_vector, dummy);
         RETURN_IF_ERROR(_group_by_columns[i]->accept(&cmp));
-        // TODO short-circuit
+        // once all adjacent rows already differ on a prefix of the group by keys,
+        // the remaining key columns can not flip any bit back to equal
+        if (i + 1 < _group_by_columns.size() && SIMD::count_zero(_cmp_vector.data(), chunk_size) == 0) {
+            break;
+        }
     }
     return Status::OK();
 }
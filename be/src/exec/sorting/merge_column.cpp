@@ -42,13 +42,15 @@ struct EqualRange {
 // MergeTwoColumn incremental merge two columns
 class MergeTwoColumn final : public ColumnVisitorAdapter<MergeTwoColumn> {
 public:
-    MergeTwoColumn(SortDesc desc, const Column* left_col, const Column* right_col, std::vector<EqualRange>* equal_range,
-                   Permutation* perm)
+    MergeTwoColumn(SortDesc desc, const Column* left_col, const Column* right_col, size_t left_base, size_t right_base,
+                   std::vector<EqualRange>* equal_range, Permutation* perm)
             : ColumnVisitorAdapter(this),
               _sort_order(desc.sort_order),
               _null_first(desc.null_first),
               _left_col(left_col),
               _right_col(right_col),
+              _left_base(left_base),
+              _right_base(right_base),
               _equal_ranges(equal_range),
               _perm(perm) {}
 
@@ -63,7 +65,10 @@ public:
             size_t rhs = equal_range.right_range.first;
             size_t lhs_end = equal_range.left_range.second;
             size_t rhs_end = equal_range.right_range.second;
-            size_t output_index = lhs + rhs;
+            // The runs may be views starting at a nonzero offset of their chunk, so the
+            // output slot is indexed relative to the run starts while index_in_chunk
+            // stays absolute.
+            size_t output_index = (lhs - _left_base) + (rhs - _right_base);
 
             // Merge rows in the equal-range
             auto left_range = fetch_equal(lhs, lhs_end, equal_left);
@@ -182,7 +187,8 @@ public:
             DCHECK(_left_col->is_nullable() && _right_col->is_nullable());
             const auto* lhs_data = down_cast<const NullableColumn*>(_left_col)->data_column().get();
             const auto* rhs_data = down_cast<const NullableColumn*>(_right_col)->data_column().get();
-            MergeTwoColumn merge2({_sort_order, _null_first}, lhs_data, rhs_data, _equal_ranges, _perm);
+            MergeTwoColumn merge2({_sort_order, _null_first}, lhs_data, rhs_data, _left_base, _right_base,
+                                  _equal_ranges, _perm);
             return lhs_data->accept(&merge2);
         }
 
@@ -198,6 +204,8 @@ private:
     const int _null_first;
     const Column* _left_col;
     const Column* _right_col;
+    const size_t _left_base;
+    const size_t _right_base;
     std::vector<EqualRange>* _equal_ranges;
     Permutation* _perm;
 };
@@ -259,7 +267,7 @@ public:
             } else {
                 std::vector<EqualRange> equal_ranges;
                 equal_ranges.emplace_back(left_run.range, right_run.range);
-                size_t count = left_run.range.second + right_run.range.second;
+                size_t count = left_run.num_rows() + right_run.num_rows();
                 DCHECK_LT(count, Column::MAX_CAPACITY_LIMIT);
                 output->resize(count);
                 equal_ranges.reserve(std::max((size_t)1, count / 4));
@@ -267,7 +275,8 @@ public:
                 for (int col = 0; col < sort_desc.num_columns(); col++) {
                     const Column* left_col = left_run.get_column(col);
                     const Column* right_col = right_run.get_column(col);
-                    MergeTwoColumn merge2(sort_desc.get_column_desc(col), left_col, right_col, &equal_ranges, output);
+                    MergeTwoColumn merge2(sort_desc.get_column_desc(col), left_col, right_col, left_run.range.first,
+                                          right_run.range.first, &equal_ranges, output);
                     Status st = left_col->accept(&merge2);
                     CHECK(st.ok());
                     if (equal_ranges.size() == 0) {
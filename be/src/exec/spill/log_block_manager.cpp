@@ -30,6 +30,7 @@
 #include "runtime/exec_env.h"
 #include "storage/options.h"
 #include "util/defer_op.h"
+#include "util/raw_container.h"
 #include "util/uid_util.h"
 
 namespace starrocks::spill {
@@ -171,9 +172,20 @@ public:
     const Block* block() const override { return _block; }
 
 private:
+    Status _read_fully_buffered(void* data, int64_t count, int64_t readahead_bytes);
+
     std::unique_ptr<io::InputStreamWrapper> _readable;
     size_t _offset = 0;
     size_t _length = 0;
+
+    // Data is fetched ahead of the restore cursor in readahead-sized batches and served
+    // from here, so restoring a chunk costs one large read instead of one read per
+    // header/attachment. Readahead never crosses the end of this block.
+    std::string _buffer;
+    size_t _buffer_pos = 0;
+    size_t _buffer_limit = 0;
+    // bytes already fetched from the underlying stream, may run ahead of _offset
+    size_t _fetched_offset = 0;
 };
 
 class LogBlock : public Block {
@@ -229,6 +241,10 @@ Status LogBlockReader::read_fully(void* data, int64_t count) {
         return Status::EndOfFile("no more data in this block");
     }
 
+    if (config::spill_local_block_readahead_bytes > 0) {
+        return _read_fully_buffered(data, count, config::spill_local_block_readahead_bytes);
+    }
+
     ASSIGN_OR_RETURN(auto read_len, _readable->read(data, count));
     RETURN_IF(read_len == 0, Status::EndOfFile("no more data in this block"));
     RETURN_IF(read_len != count, Status::InternalError(fmt::format(
@@ -236,6 +252,30 @@ Status LogBlockReader::read_fully(void* data, int64_t count) {
     _offset += count;
     return Status::OK();
 }
+
+Status LogBlockReader::_read_fully_buffered(void* data, int64_t count, int64_t readahead_bytes) {
+    auto* out = static_cast<uint8_t*>(data);
+    int64_t remain = count;
+    while (remain > 0) {
+        if (_buffer_pos == _buffer_limit) {
+            size_t to_read = std::min<size_t>(_length - _fetched_offset, std::max<int64_t>(readahead_bytes, remain));
+            RETURN_IF(to_read == 0, Status::EndOfFile("no more data in this block"));
+            raw::stl_string_resize_uninitialized(&_buffer, to_read);
+            ASSIGN_OR_RETURN(auto read_len, _readable->read(_buffer.data(), to_read));
+            RETURN_IF(read_len == 0, Status::EndOfFile("no more data in this block"));
+            _buffer_pos = 0;
+            _buffer_limit = read_len;
+            _fetched_offset += read_len;
+        }
+        size_t copy_size = std::min<size_t>(remain, _buffer_limit - _buffer_pos);
+        memcpy(out, _buffer.data() + _buffer_pos, copy_size);
+        _buffer_pos += copy_size;
+        out += copy_size;
+        remain -= copy_size;
+    }
+    _offset += count;
+    return Status::OK();
+}
 LogBlockManager::LogBlockManager(TUniqueId query_id, DirManager* dir_mgr)
         : _query_id(std::move(query_id)), _dir_mgr(dir_mgr) {
     _max_container_bytes = config::spill_max_log_block_container_bytes > 0 ? config::spill_max_log_block_container_bytes
@@ -21,6 +21,7 @@
 #include "column/chunk.h"
 #include "column/vectorized_fwd.h"
 #include "exec/chunks_sorter.h"
+#include "exec/sorting/sort_helper.h"
 #include "exec/spill/executor.h"
 #include "exec/spill/input_stream.h"
 #include "exec/spill/serde.h"
@@ -85,6 +86,19 @@ Status UnorderedMemTable::finalize(workgroup::YieldContext& yield_ctx, const Spi
             }
             SCOPED_RAW_TIMER(&yield_ctx.time_spent_ns);
             auto chunk = _chunks[_processed_index++];
+            // Merge runs of small chunks into one batch before serializing: spilling
+            // many tiny chunks degrades into many small writes on the data disk.
+            const size_t target_rows = _runtime_state->chunk_size();
+            if (chunk->num_rows() <= target_rows / 2 && _processed_index < _chunks.size() &&
+                chunk->num_rows() + _chunks[_processed_index]->num_rows() <= target_rows) {
+                ChunkPtr merged = chunk->clone_empty();
+                merged->append(*chunk);
+                while (_processed_index < _chunks.size() &&
+                       merged->num_rows() + _chunks[_processed_index]->num_rows() <= target_rows) {
+                    merged->append(*_chunks[_processed_index++]);
+                }
+                chunk = std::move(merged);
+            }
             RETURN_IF_ERROR(serde->serialize(_runtime_state, serde_ctx, chunk, output, need_aligned));
             RETURN_OK_IF_NEED_YIELD(yield_ctx.wg, &yield_ctx.need_yield, yield_ctx.time_spent_ns);
         }
@@ -191,6 +205,13 @@ StatusOr<ChunkPtr> OrderedMemTable::_do_sort(const ChunkPtr& chunk) {
     _permutation.resize(0);
 
     auto& order_bys = segment.order_by_columns;
+    // Already sorted input (e.g. spilling sort input that came from a sorted scan)
+    // only needs to be detected, not sorted: one pass of adjacent-row comparisons
+    // is much cheaper than sort + materialize.
+    if (_is_sorted(order_bys)) {
+        TRACE_SPILL_LOG << fmt::format("skip sorting already sorted mem table, rows[{}]", chunk->num_rows());
+        return chunk;
+    }
     {
         SCOPED_TIMER(_spiller->metrics().sort_chunk_timer);
         RETURN_IF_ERROR(sort_and_tie_columns(_runtime_state->cancelled_ref(), order_bys, _sort_desc, &_permutation));
@@ -203,4 +224,17 @@ StatusOr<ChunkPtr> OrderedMemTable::_do_sort(const ChunkPtr& chunk) {
     }
     return sorted_chunk;
 }
+
+bool OrderedMemTable::_is_sorted(const Columns& order_by_columns) const {
+    if (order_by_columns.empty()) {
+        return true;
+    }
+    const size_t num_rows = order_by_columns[0]->size();
+    for (size_t i = 1; i < num_rows; i++) {
+        if (compare_chunk_row(_sort_desc, order_by_columns, order_by_columns, i - 1, i) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
 } // namespace starrocks::spill
\ No newline at end of file
@@ -141,6 +141,7 @@ public:
 
 private:
     StatusOr<ChunkPtr> _do_sort(const ChunkPtr& chunk);
+    bool _is_sorted(const Columns& order_by_columns) const;
 
     const std::vector<ExprContext*>* _sort_exprs;
     const SortDescs _sort_desc;
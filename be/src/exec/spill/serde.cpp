@@ -16,6 +16,7 @@
 
 #include <cstring>
 
+#include "common/config.h"
 #include "exec/spill/options.h"
 #include "exec/spill/spiller.h"
 #include "gen_cpp/types.pb.h"
@@ -23,6 +24,7 @@
 #include "runtime/runtime_state.h"
 #include "serde/column_array_serde.h"
 #include "serde/encode_context.h"
+#include "util/compression/block_compression.h"
 #include "util/raw_container.h"
 
 namespace starrocks::spill {
@@ -40,6 +42,10 @@ public:
             auto encode_level = _parent->options().encode_level;
             _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(column_number, encode_level);
         }
+        if (_compress_codec == nullptr) {
+            // returns a nullptr codec for NO_COMPRESSION, which keeps blocks uncompressed
+            RETURN_IF_ERROR(get_block_compression_codec(_parent->options().compress_type, &_compress_codec));
+        }
         return Status::OK();
     }
 
@@ -49,12 +55,15 @@ public:
 
 private:
     // data format
-    // header|encode levels|attachment...
+    // header|attachment(encode levels|column data, maybe compressed)...
     // header:
-    // i32 sequence_id|i64 attachment size
+    // i32 sequence_id|i64 attachment size|i32 compress type|i64 compressed size|i64 uncompressed size
     static constexpr int32_t SEQUENCE_OFFSET = 0;
     static constexpr int32_t ATTACHMENT_SIZE_OFFSET = SEQUENCE_OFFSET + sizeof(int32_t);
-    static constexpr int32_t HEADER_SIZE = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t COMPRESS_TYPE_OFFSET = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t COMPRESSED_SIZE_OFFSET = COMPRESS_TYPE_OFFSET + sizeof(int32_t);
+    static constexpr int32_t UNCOMPRESSED_SIZE_OFFSET = COMPRESSED_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t HEADER_SIZE = UNCOMPRESSED_SIZE_OFFSET + sizeof(int64_t);
 
     size_t _max_serialized_size(const ChunkPtr& chunk) const;
 
@@ -74,6 +83,8 @@ private:
     }
 
     ChunkBuilder _chunk_builder;
+    // codec used to compress the serialized payload, nullptr means no compression
+    const BlockCompressionCodec* _compress_codec = nullptr;
     // assuming that the chunks processed by the same Spiller are similar,
     // so we maintain a context for each ColumnarSerde, which may be accessed by multiple threads.
     // here a std::shared_mutex is used to ensure concurrency safety.
@@ -149,9 +160,35 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
         _update_encode_stats(column_stats);
         // total serialized size
         size_t content_length = buf - head;
-        auto align_size = ALIGN_UP(content_length + padding_size, ALIGNED_SIZE);
+        size_t payload_size = content_length - HEADER_SIZE + padding_size;
+
+        // try to compress the payload, fall back to the raw payload when the data
+        // does not compress well enough to pay for the decompression on restore
+        int32_t compress_type = CompressionTypePB::NO_COMPRESSION;
+        size_t stored_size = payload_size;
+        if (_compress_codec != nullptr && payload_size > 0 && !_compress_codec->exceed_max_input_size(payload_size)) {
+            raw::RawString& compress_buffer = ctx.compress_buffer;
+            size_t max_compressed_size = _compress_codec->max_compressed_len(payload_size);
+            if (compress_buffer.size() < HEADER_SIZE + max_compressed_size) {
+                compress_buffer.resize(HEADER_SIZE + max_compressed_size);
+            }
+            Slice compressed_slice(compress_buffer.data() + HEADER_SIZE, compress_buffer.size() - HEADER_SIZE);
+            Slice input(serialize_buffer.data() + HEADER_SIZE, payload_size);
+            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice));
+            double compress_ratio = static_cast<double>(payload_size) / compressed_slice.size;
+            if (LIKELY(compress_ratio > config::spill_compress_ratio_threshold)) {
+                compress_type = _compress_codec->type();
+                stored_size = compressed_slice.size;
+                serialize_buffer.swap(compress_buffer);
+            }
+        }
+
+        auto align_size = ALIGN_UP(HEADER_SIZE + stored_size, ALIGNED_SIZE);
         serialize_buffer.resize(align_size);
         UNALIGNED_STORE64(header_buffer + ATTACHMENT_SIZE_OFFSET, align_size - HEADER_SIZE);
+        UNALIGNED_STORE32(header_buffer + COMPRESS_TYPE_OFFSET, compress_type);
+        UNALIGNED_STORE64(header_buffer + COMPRESSED_SIZE_OFFSET, stored_size);
+        UNALIGNED_STORE64(header_buffer + UNCOMPRESSED_SIZE_OFFSET, payload_size);
         memcpy(serialize_buffer.data(), header_buffer, HEADER_SIZE);
     }
     size_t written_bytes = serialize_buffer.size();
@@ -172,7 +209,10 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     }
 
     int32_t sequence_id = UNALIGNED_LOAD32(header_buffer + SEQUENCE_OFFSET);
-    int32_t attachment_size = UNALIGNED_LOAD32(header_buffer + ATTACHMENT_SIZE_OFFSET);
+    int64_t attachment_size = UNALIGNED_LOAD64(header_buffer + ATTACHMENT_SIZE_OFFSET);
+    int32_t compress_type = UNALIGNED_LOAD32(header_buffer + COMPRESS_TYPE_OFFSET);
+    int64_t compressed_size = UNALIGNED_LOAD64(header_buffer + COMPRESSED_SIZE_OFFSET);
+    int64_t uncompressed_size = UNALIGNED_LOAD64(header_buffer + UNCOMPRESSED_SIZE_OFFSET);
     int32_t next_sequence_id = reader->next_sequence_id();
     if (sequence_id != next_sequence_id) {
         return Status::InternalError(fmt::format("sequence id mismatch {} vs {}", sequence_id, next_sequence_id));
@@ -193,12 +233,20 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
         RETURN_IF_ERROR(st);
     }
 
-    const uint32_t* encode_levels = nullptr;
+    SCOPED_TIMER(_parent->metrics().deserialize_timer);
     const uint8_t* read_cursor = buf;
-    encode_levels = reinterpret_cast<uint32_t*>(serialize_buffer.data());
+    if (compress_type != CompressionTypePB::NO_COMPRESSION) {
+        const BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(static_cast<CompressionTypePB>(compress_type), &codec));
+        auto& compress_buffer = ctx.compress_buffer;
+        compress_buffer.resize(uncompressed_size);
+        Slice decompressed_slice(compress_buffer.data(), uncompressed_size);
+        RETURN_IF_ERROR(codec->decompress(Slice(buf, compressed_size), &decompressed_slice));
+        read_cursor = reinterpret_cast<uint8_t*>(compress_buffer.data());
+    }
 
+    const uint32_t* encode_levels = reinterpret_cast<const uint32_t*>(read_cursor);
     read_cursor += columns.size() * sizeof(uint32_t);
-    SCOPED_TIMER(_parent->metrics().deserialize_timer);
     for (size_t i = 0; i < columns.size(); i++) {
         read_cursor = serde::ColumnArraySerde::deserialize(read_cursor, columns[i].get(), false, encode_levels[i]);
     }
@@ -86,6 +86,8 @@ private:
 
 struct SerdeContext {
     raw::RawString serialize_buffer;
+    // scratch buffer for compressing/decompressing the serialized payload
+    raw::RawString compress_buffer;
 };
 class Spiller;
 // Serde is used to serialize and deserialize spilled data.
@@ -532,73 +532,71 @@ Status OlapTablePartitionParam::find_tablets(Chunk* chunk, std::vector<OlapTable
         row.columns = &partition_columns;
         row.index = 0;
         bool is_list_partition = _t_param.partitions[0].__isset.in_keys;
+        // Loads are often clustered by the partition columns, so consecutive rows mostly fall
+        // into the same map entry. Keep the result of the last map search and reuse it while
+        // the partition key stays the same, only searching the map again when the run ends.
+        auto same_key_as_row = [&](size_t i, size_t j) {
+            for (auto& column : partition_columns) {
+                if (column->compare_at(i, j, *column, -1) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        const std::vector<int64_t>* cached_part_ids = nullptr;
+        size_t cached_row = 0;
+        bool has_cached_row = false;
         for (size_t i = 0; i < num_rows; ++i) {
             OlapTablePartition* part = nullptr;
             if ((*selection)[i]) {
                 row.index = i;
-                if (is_list_partition) {
-                    // list partition
-                    auto it = _partitions_map.find(&row);
-                    if (it != _partitions_map.end() &&
-                        (part = _partitions[it->second[(*indexes)[i] % it->second.size()]]) != nullptr &&
-                        _part_contains(part, &row)) {
-                        (*partitions)[i] = part;
-                        (*indexes)[i] = (*indexes)[i] % part->num_buckets;
+                const std::vector<int64_t>* part_ids = nullptr;
+                if (has_cached_row && same_key_as_row(i, cached_row)) {
+                    part_ids = cached_part_ids;
+                } else {
+                    if (is_list_partition) {
+                        auto it = _partitions_map.find(&row);
+                        if (it != _partitions_map.end()) {
+                            part_ids = &it->second;
+                        }
                     } else {
-                        if (partition_not_exist_row_values) {
-                            auto partition_value_items = std::make_unique<std::vector<std::string>>();
-                            for (auto& column : *row.columns) {
-                                VLOG(3) << "partition not exist chunk row:" << chunk->debug_row(i) << " partition row "
-                                        << row.debug_string();
-                                partition_value_items->emplace_back(column->raw_item_value(i));
-                            }
-                            auto r = partition_columns_set.insert(*partition_value_items);
-                            if (r.second) {
-                                (*partition_not_exist_row_values).emplace_back(*partition_value_items);
-                            }
-                        } else {
-                            VLOG(3) << "partition not exist chunk row:" << chunk->debug_row(i) << " partition row "
-                                    << row.debug_string();
-                            (*partitions)[i] = nullptr;
-                            (*selection)[i] = 0;
-                            if (invalid_row_indexs != nullptr) {
-                                invalid_row_indexs->emplace_back(i);
-                            }
+                        auto it = _partitions_map.upper_bound(&row);
+                        if (it != _partitions_map.end()) {
+                            part_ids = &it->second;
                         }
                     }
+                    cached_part_ids = part_ids;
+                    cached_row = i;
+                    has_cached_row = true;
+                }
+                if (part_ids != nullptr &&
+                    (part = _partitions[(*part_ids)[(*indexes)[i] % part_ids->size()]]) != nullptr &&
+                    _part_contains(part, &row)) {
+                    (*partitions)[i] = part;
+                    (*indexes)[i] = (*indexes)[i] % part->num_buckets;
                 } else {
-                    // range partition
-                    auto it = _partitions_map.upper_bound(&row);
-                    if (it != _partitions_map.end() &&
-                        (part = _partitions[it->second[(*indexes)[i] % it->second.size()]]) != nullptr &&
-                        _part_contains(part, &row)) {
-                        (*partitions)[i] = part;
-                        (*indexes)[i] = (*indexes)[i] % part->num_buckets;
-                    } else {
-                        if (partition_not_exist_row_values) {
-                            // only support single column partition for range partition now
-                            if (partition_columns.size() != 1) {
-                                return Status::InternalError(
-                                        "automatic partition only support single column partition.");
-                            }
-                            auto partition_value_items = std::make_unique<std::vector<std::string>>();
-                            for (auto& column : *row.columns) {
-                                VLOG(3) << "partition not exist chunk row:" << chunk->debug_row(i) << " partition row "
-                                        << row.debug_string();
-                                partition_value_items->emplace_back(column->raw_item_value(i));
-                            }
-                            auto r = partition_columns_set.insert(*partition_value_items);
-                            if (r.second) {
-                                (*partition_not_exist_row_values).emplace_back(*partition_value_items);
-                            }
-                        } else {
+                    if (partition_not_exist_row_values) {
+                        // only support single column partition for range partition now
+                        if (!is_list_partition && partition_columns.size() != 1) {
+                            return Status::InternalError("automatic partition only support single column partition.");
+                        }
+                        auto partition_value_items = std::make_unique<std::vector<std::string>>();
+                        for (auto& column : *row.columns) {
                             VLOG(3) << "partition not exist chunk row:" << chunk->debug_row(i) << " partition row "
                                     << row.debug_string();
-                            (*partitions)[i] = nullptr;
-                            (*selection)[i] = 0;
-                            if (invalid_row_indexs != nullptr) {
-                                invalid_row_indexs->emplace_back(i);
-                            }
+                            partition_value_items->emplace_back(column->raw_item_value(i));
+                        }
+                        auto r = partition_columns_set.insert(*partition_value_items);
+                        if (r.second) {
+                            (*partition_not_exist_row_values).emplace_back(*partition_value_items);
+                        }
+                    } else {
+                        VLOG(3) << "partition not exist chunk row:" << chunk->debug_row(i) << " partition row "
+                                << row.debug_string();
+                        (*partitions)[i] = nullptr;
+                        (*selection)[i] = 0;
+                        if (invalid_row_indexs != nullptr) {
+                            invalid_row_indexs->emplace_back(i);
                         }
                     }
                 }
@@ -67,6 +67,9 @@ Status TabletScanner::init(RuntimeState* runtime_state, const TabletScannerParam
     RETURN_IF_ERROR(_init_global_dicts());
     RETURN_IF_ERROR(_init_reader_params(params.key_ranges));
     Schema child_schema = ChunkHelper::convert_schema(_tablet_schema, _reader_columns);
+    if (params.column_access_paths != nullptr && !params.column_access_paths->empty()) {
+        RETURN_IF_ERROR(_init_column_access_paths(&child_schema, *params.column_access_paths));
+    }
     _reader = std::make_shared<TabletReader>(_tablet, Version(0, _version), std::move(child_schema));
     if (_reader_columns.size() == _scanner_columns.size()) {
         _prj_iter = _reader;
@@ -249,6 +252,32 @@ Status TabletScanner::_init_unused_output_columns(const std::vector<std::string>
     return Status::OK();
 }
 
+Status TabletScanner::_init_column_access_paths(Schema* schema, const std::vector<ColumnAccessPathPtr>& paths) {
+    int64_t leaf_size = 0;
+    for (const auto& path : paths) {
+        auto& root = path->path();
+        int32_t index = _tablet_schema->field_index(root);
+        auto field = schema->get_field_by_name(root);
+        if (index >= 0 && field != nullptr) {
+            auto res = path->convert_by_index(field.get(), index);
+            // read whole data, doesn't effect query
+            if (LIKELY(res.ok())) {
+                _column_access_paths.emplace_back(std::move(res.value()));
+                leaf_size += path->leaf_size();
+            } else {
+                LOG(WARNING) << "failed to convert column access path: " << res.status();
+            }
+        } else {
+            LOG(WARNING) << "failed to find column in schema: " << root;
+        }
+    }
+    _params.column_access_paths = &_column_access_paths;
+
+    // update counter
+    COUNTER_SET(_parent->_pushdown_access_paths_counter, leaf_size);
+    return Status::OK();
+}
+
 // mapping a slot-column-id to schema-columnid
 Status TabletScanner::_init_global_dicts() {
     const auto& global_dict_map = _runtime_state->get_query_global_dict_map();
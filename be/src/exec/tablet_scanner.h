@@ -78,6 +78,7 @@ private:
     Status _init_return_columns();
     Status _init_global_dicts();
     Status _init_unused_output_columns(const std::vector<std::string>& unused_output_columns);
+    Status _init_column_access_paths(Schema* schema, const std::vector<ColumnAccessPathPtr>& paths);
     void _update_realtime_counter(Chunk* chunk);
     void update_counter();
 
@@ -115,6 +116,9 @@ private:
     // unused ouput columns
     std::unordered_set<uint32_t> _unused_output_column_ids;
 
+    // projected subfields of struct/map columns, converted to the tablet schema
+    std::vector<ColumnAccessPathPtr> _column_access_paths;
+
     // projection iterator, doing the job of choosing |_scanner_columns| from |_reader_columns|.
     std::shared_ptr<ChunkIterator> _prj_iter;
     // slot descriptors for each one of |_scanner_columns|.
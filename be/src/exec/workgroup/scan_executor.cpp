@@ -76,6 +76,7 @@ void ScanExecutor::worker_thread() {
         if (current_thread != nullptr) {
             current_thread->inc_finished_tasks();
         }
+        _finished_tasks.fetch_add(1, std::memory_order_relaxed);
         _task_queue->update_statistics(task, time_spent_ns);
 
         // task
@@ -85,6 +86,10 @@ void ScanExecutor::worker_thread() {
     }
 }
 
+size_t ScanExecutor::queue_size() const {
+    return _task_queue->size();
+}
+
 bool ScanExecutor::submit(ScanTask task) {
     return _task_queue->try_offer(std::move(task));
 }
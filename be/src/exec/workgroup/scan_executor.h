@@ -39,10 +39,19 @@ public:
 
     void force_submit(ScanTask task);
 
+    int32_t num_threads() const { return _num_threads_setter.expect_num(); }
+
+    // total number of tasks finished by all workers since start, used by ScanExecutorTuner
+    // to measure throughput.
+    int64_t finished_tasks() const { return _finished_tasks.load(std::memory_order_relaxed); }
+
+    size_t queue_size() const;
+
 private:
     void worker_thread();
 
     LimitSetter _num_threads_setter;
+    std::atomic<int64_t> _finished_tasks{0};
     std::unique_ptr<ScanTaskQueue> _task_queue;
     // _thread_pool must be placed after _task_queue, because worker threads in _thread_pool use _task_queue.
     std::unique_ptr<ThreadPool> _thread_pool;
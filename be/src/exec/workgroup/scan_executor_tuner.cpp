@@ -0,0 +1,118 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/workgroup/scan_executor_tuner.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "exec/workgroup/scan_executor.h"
+#include "util/thread.h"
+
+namespace starrocks::workgroup {
+
+// Relative throughput change below which two intervals are considered a plateau.
+static const double kThroughputEpsilon = 0.05;
+
+ScanExecutorTuner::ScanExecutorTuner(std::string name, ScanExecutor* executor, int32_t max_threads)
+        : _name(std::move(name)), _executor(executor), _max_threads(max_threads), _current_threads(max_threads) {}
+
+ScanExecutorTuner::~ScanExecutorTuner() {
+    stop();
+}
+
+void ScanExecutorTuner::start() {
+    _thread = std::thread([this]() { _tune_loop(); });
+    Thread::set_thread_name(_thread, _name);
+}
+
+void ScanExecutorTuner::stop() {
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_stopped.exchange(true)) {
+            return;
+        }
+    }
+    _cv.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void ScanExecutorTuner::_tune_loop() {
+    while (true) {
+        int64_t interval_s = std::max(1, static_cast<int>(config::scan_executor_auto_tune_interval_seconds));
+        {
+            std::unique_lock<std::mutex> l(_mutex);
+            _cv.wait_for(l, std::chrono::seconds(interval_s), [this]() { return _stopped.load(); });
+        }
+        if (_stopped.load()) {
+            break;
+        }
+
+        if (!config::enable_scan_executor_auto_tune) {
+            // restore the configured worker count and restart the measurement from scratch,
+            // so that re-enabling the tuner does not act on stale throughput samples.
+            if (_current_threads.load(std::memory_order_relaxed) != _max_threads) {
+                _executor->change_num_threads(_max_threads);
+                _current_threads.store(_max_threads, std::memory_order_relaxed);
+            }
+            _last_finished_tasks = _executor->finished_tasks();
+            _last_throughput = 0;
+            _direction = 1;
+            continue;
+        }
+
+        _adjust_once(interval_s * 1000);
+    }
+}
+
+void ScanExecutorTuner::_adjust_once(int64_t interval_ms) {
+    int64_t finished = _executor->finished_tasks();
+    double throughput = (finished - _last_finished_tasks) * 1000.0 / interval_ms;
+    _last_finished_tasks = finished;
+    size_t queued = _executor->queue_size();
+
+    int32_t cur = _current_threads.load(std::memory_order_relaxed);
+    int32_t min_threads =
+            std::clamp(static_cast<int>(config::scan_executor_auto_tune_min_threads), 1, _max_threads);
+
+    int32_t next = cur;
+    if (queued == 0) {
+        // no backlog: extra workers cannot raise throughput, so drift back down and
+        // be ready to climb again once a backlog shows up.
+        next = cur - 1;
+        _direction = 1;
+    } else if (_last_throughput <= 0 || throughput > _last_throughput * (1 + kThroughputEpsilon)) {
+        // first sample under load, or the last step paid off: keep moving.
+        next = cur + _direction;
+    } else if (throughput < _last_throughput * (1 - kThroughputEpsilon)) {
+        // the last step hurt: back off in the other direction.
+        _direction = -_direction;
+        next = cur + _direction;
+    }
+    // otherwise we are on a plateau: hold the current worker count.
+    _last_throughput = throughput;
+
+    next = std::clamp(next, min_threads, _max_threads);
+    if (next != cur) {
+        VLOG(2) << "scan executor tuner [" << _name << "] adjusts workers from " << cur << " to " << next
+                << ", throughput=" << throughput << " tasks/s, queued=" << queued;
+        _executor->change_num_threads(next);
+        _current_threads.store(next, std::memory_order_relaxed);
+    }
+}
+
+} // namespace starrocks::workgroup
@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace starrocks::workgroup {
+
+class ScanExecutor;
+
+// Adjusts the worker count of a ScanExecutor online by hill climbing on measured throughput,
+// so the scan thread number does not need to be hand-tuned per workload.
+//
+// Every tuning interval the tuner samples the number of finished tasks and the queue length:
+// - with an empty queue, extra workers cannot help, so the worker count drifts down;
+// - with a backlog, the tuner keeps stepping in its current direction while throughput
+//   improves and reverses the direction when throughput degrades, similar to how congestion
+//   control probes for the available bandwidth.
+// The worker count always stays within [scan_executor_auto_tune_min_threads, max_threads],
+// where max_threads is the size the executor was initialized with. Tuning is gated by
+// config::enable_scan_executor_auto_tune and falls back to max_threads when disabled.
+class ScanExecutorTuner {
+public:
+    ScanExecutorTuner(std::string name, ScanExecutor* executor, int32_t max_threads);
+    ~ScanExecutorTuner();
+
+    void start();
+    void stop();
+
+    // the worker count decided by the last adjustment, exposed as a metric.
+    int32_t current_threads() const { return _current_threads.load(std::memory_order_relaxed); }
+
+private:
+    void _tune_loop();
+    void _adjust_once(int64_t interval_ms);
+
+    const std::string _name;
+    ScanExecutor* _executor;
+    const int32_t _max_threads;
+
+    std::atomic<int32_t> _current_threads;
+    int64_t _last_finished_tasks = 0;
+    double _last_throughput = 0;
+    int32_t _direction = 1;
+
+    std::atomic<bool> _stopped{false};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::thread _thread;
+};
+
+} // namespace starrocks::workgroup
@@ -20,6 +20,7 @@
 #include "exec/workgroup/work_group_fwd.h"
 #include "glog/logging.h"
 #include "runtime/exec_env.h"
+#include "storage/page_cache.h"
 #include "util/cpu_info.h"
 #include "util/metrics.h"
 #include "util/starrocks_metrics.h"
@@ -42,6 +43,12 @@ struct WorkGroupMetrics {
     std::unique_ptr<starrocks::IntGauge> concurrency_overflow_count = nullptr;
     std::unique_ptr<starrocks::IntGauge> bigquery_count = nullptr;
 
+    std::unique_ptr<starrocks::IntGauge> cpu_cost_ns = nullptr;
+
+    std::unique_ptr<starrocks::IntGauge> page_cache_lookup_count = nullptr;
+    std::unique_ptr<starrocks::IntGauge> page_cache_hit_count = nullptr;
+    std::unique_ptr<starrocks::DoubleGauge> page_cache_hit_ratio = nullptr;
+
     std::unique_ptr<starrocks::DoubleGauge> inuse_cpu_cores = nullptr;
     int64_t timestamp_ns = 0;
     int64_t cpu_runtime_ns = 0;
@@ -89,7 +96,9 @@ WorkGroup::WorkGroup(std::string name, int64_t id, int64_t version, size_t cpu_l
           _spill_mem_limit_threshold(spill_mem_limit_threshold),
           _driver_sched_entity(this),
           _scan_sched_entity(this),
-          _connector_scan_sched_entity(this) {}
+          _connector_scan_sched_entity(this) {
+    _page_cache_stats = std::make_shared<PageCacheGroupStats>();
+}
 
 WorkGroup::WorkGroup(const TWorkGroup& twg)
         : _name(twg.name),
@@ -97,6 +106,7 @@ WorkGroup::WorkGroup(const TWorkGroup& twg)
           _driver_sched_entity(this),
           _scan_sched_entity(this),
           _connector_scan_sched_entity(this) {
+    _page_cache_stats = std::make_shared<PageCacheGroupStats>();
     if (twg.__isset.cpu_core_limit) {
         _cpu_limit = twg.cpu_core_limit;
     } else {
@@ -251,6 +261,20 @@ Status WorkGroup::check_big_query(const QueryContext& query_context) {
     return Status::OK();
 }
 
+void WorkGroup::update_page_cache_quota() {
+    // Each group may fill up to its memory-limit share of the page cache. The quota is
+    // re-derived from the current capacity on every update, so cache resizing is picked
+    // up automatically. Halving the recent-insert estimate makes the quota soft: a group
+    // that stops inserting regains its fill permission after a few update cycles.
+    int64_t quota_bytes = 0;
+    if (config::enable_page_cache_group_quota && _memory_limit > 0 && StoragePageCache::instance() != nullptr) {
+        quota_bytes = static_cast<int64_t>(StoragePageCache::instance()->get_capacity() * _memory_limit);
+    }
+    _page_cache_stats->quota_bytes.store(quota_bytes, std::memory_order_relaxed);
+    _page_cache_stats->inserted_bytes.store(_page_cache_stats->inserted_bytes.load(std::memory_order_relaxed) / 2,
+                                            std::memory_order_relaxed);
+}
+
 void WorkGroup::copy_metrics(const WorkGroup& rhs) {
     _num_total_queries = rhs.num_total_queries();
     _concurrency_overflow_count = rhs.concurrency_overflow_count();
@@ -349,6 +373,26 @@ void WorkGroupManager::add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockTy
                 "resource_group_bigquery_count", MetricLabels().add("name", wg->name()),
                 resource_group_bigquery_count.get());
 
+        // cumulative cpu cost, from which the monitoring system can derive the cpu usage
+        // of a group over any time window.
+        auto resource_group_cpu_cost_ns = std::make_unique<IntGauge>(MetricUnit::NANOSECONDS);
+        bool cpu_cost_registered = StarRocksMetrics::instance()->metrics()->register_metric(
+                "resource_group_cpu_cost_ns", MetricLabels().add("name", wg->name()), resource_group_cpu_cost_ns.get());
+
+        // page cache lookups, hits and hit ratio per group.
+        auto resource_group_page_cache_lookup_count = std::make_unique<IntGauge>(MetricUnit::OPERATIONS);
+        bool page_cache_lookup_registered = StarRocksMetrics::instance()->metrics()->register_metric(
+                "resource_group_page_cache_lookup_count", MetricLabels().add("name", wg->name()),
+                resource_group_page_cache_lookup_count.get());
+        auto resource_group_page_cache_hit_count = std::make_unique<IntGauge>(MetricUnit::OPERATIONS);
+        bool page_cache_hit_registered = StarRocksMetrics::instance()->metrics()->register_metric(
+                "resource_group_page_cache_hit_count", MetricLabels().add("name", wg->name()),
+                resource_group_page_cache_hit_count.get());
+        auto resource_group_page_cache_hit_ratio = std::make_unique<DoubleGauge>(MetricUnit::PERCENT);
+        bool page_cache_hit_ratio_registered = StarRocksMetrics::instance()->metrics()->register_metric(
+                "resource_group_page_cache_hit_ratio", MetricLabels().add("name", wg->name()),
+                resource_group_page_cache_hit_ratio.get());
+
         unique_lock.lock();
         auto it = _wg_metrics.find(wg->name());
         if (it == _wg_metrics.end()) {
@@ -372,6 +416,12 @@ void WorkGroupManager::add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockTy
         if (concurrency_registered)
             wg_metrics->concurrency_overflow_count = std::move(resource_group_concurrency_overflow);
         if (bigquery_registered) wg_metrics->bigquery_count = std::move(resource_group_bigquery_count);
+        if (cpu_cost_registered) wg_metrics->cpu_cost_ns = std::move(resource_group_cpu_cost_ns);
+        if (page_cache_lookup_registered)
+            wg_metrics->page_cache_lookup_count = std::move(resource_group_page_cache_lookup_count);
+        if (page_cache_hit_registered) wg_metrics->page_cache_hit_count = std::move(resource_group_page_cache_hit_count);
+        if (page_cache_hit_ratio_registered)
+            wg_metrics->page_cache_hit_ratio = std::move(resource_group_page_cache_hit_ratio);
     }
     _wg_metrics[wg->name()]->group_unique_id = wg->unique_id();
 }
@@ -391,6 +441,7 @@ void WorkGroupManager::update_metrics_unlocked() {
         wg->driver_sched_entity()->mark_curr_runtime_ns();
         wg->scan_sched_entity()->mark_curr_runtime_ns();
         wg->connector_scan_sched_entity()->mark_curr_runtime_ns();
+        wg->update_page_cache_quota();
 
         sum_cpu_runtime_ns += wg->driver_sched_entity()->growth_runtime_ns();
         sum_scan_runtime_ns += wg->scan_sched_entity()->growth_runtime_ns();
@@ -426,6 +477,14 @@ void WorkGroupManager::update_metrics_unlocked() {
             wg_metrics->total_queries->set_value(wg->num_total_queries());
             wg_metrics->concurrency_overflow_count->set_value(wg->concurrency_overflow_count());
             wg_metrics->bigquery_count->set_value(wg->bigquery_count());
+            wg_metrics->cpu_cost_ns->set_value(wg->cpu_runtime_ns());
+
+            const auto& cache_stats = wg->page_cache_stats();
+            int64_t cache_lookups = cache_stats->lookup_count.load(std::memory_order_relaxed);
+            int64_t cache_hits = cache_stats->hit_count.load(std::memory_order_relaxed);
+            wg_metrics->page_cache_lookup_count->set_value(cache_lookups);
+            wg_metrics->page_cache_hit_count->set_value(cache_hits);
+            wg_metrics->page_cache_hit_ratio->set_value(_calculate_ratio(cache_hits, cache_lookups));
 
             int64_t new_timestamp_ns = MonotonicNanos();
             int64_t new_cpu_runtime_ns = wg->cpu_runtime_ns();
@@ -448,7 +507,11 @@ void WorkGroupManager::update_metrics_unlocked() {
             wg_metrics->total_queries->set_value(0);
             wg_metrics->concurrency_overflow_count->set_value(0);
             wg_metrics->bigquery_count->set_value(0);
+            wg_metrics->cpu_cost_ns->set_value(0);
             wg_metrics->inuse_cpu_cores->set_value(0);
+            wg_metrics->page_cache_lookup_count->set_value(0);
+            wg_metrics->page_cache_hit_count->set_value(0);
+            wg_metrics->page_cache_hit_ratio->set_value(0);
         }
     }
 }
@@ -32,6 +32,7 @@
 namespace starrocks {
 
 class TWorkGroup;
+struct PageCacheGroupStats;
 
 namespace workgroup {
 
@@ -132,6 +133,10 @@ public:
     // Copy metrics from the other work group
     void copy_metrics(const WorkGroup& rhs);
 
+    // Refresh the soft page cache quota of this group from the current cache capacity
+    // and decay the recent-insert estimate. Called on every metrics update.
+    void update_page_cache_quota();
+
     MemTracker* mem_tracker() { return _mem_tracker.get(); }
     const MemTracker* mem_tracker() const { return _mem_tracker.get(); }
 
@@ -146,6 +151,10 @@ public:
 
     int64_t mem_consumption_bytes() const { return _mem_tracker == nullptr ? 0L : _mem_tracker->consumption(); }
 
+    // Per-group page cache accounting, threaded into the storage read path by the scan
+    // operators of this group. The soft cache quota is refreshed on every metrics update.
+    const std::shared_ptr<PageCacheGroupStats>& page_cache_stats() const { return _page_cache_stats; }
+
     bool is_sq_wg() const { return _type == WorkGroupType::WG_SHORT_QUERY; }
 
     WorkGroupDriverSchedEntity* driver_sched_entity() { return &_driver_sched_entity; }
@@ -239,6 +248,8 @@ private:
     std::shared_ptr<starrocks::MemTracker> _mem_tracker = nullptr;
     std::shared_ptr<starrocks::MemTracker> _connector_scan_mem_tracker = nullptr;
 
+    std::shared_ptr<PageCacheGroupStats> _page_cache_stats;
+
     WorkGroupDriverSchedEntity _driver_sched_entity;
     WorkGroupScanSchedEntity _scan_sched_entity;
     WorkGroupScanSchedEntity _connector_scan_sched_entity;
@@ -113,6 +113,11 @@ public:
     virtual size_t size() const = 0;
     virtual size_t alignof_size() const = 0;
     virtual bool is_pod_state() const { return false; }
+    // Whether a state freshly constructed by create() consists of all-zero bytes. When
+    // every function of an aggregation has a zeroed state (count/sum style), the whole
+    // state block of a new group is initialized with one memset instead of one virtual
+    // create() call per function.
+    virtual bool is_zero_initialized_state() const { return false; }
     virtual void create(FunctionContext* ctx, AggDataPtr __restrict ptr) const = 0;
     virtual void destroy(FunctionContext* ctx, AggDataPtr __restrict ptr) const = 0;
 
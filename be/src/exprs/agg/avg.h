@@ -114,11 +114,44 @@ public:
         }
     }
 
+    // Convert an input value to the addend accumulated in the immediate sum, mirroring do_update.
+    static auto to_addend(const T& value) {
+        if constexpr (lt_is_datetime<LT>) {
+            return value.to_unix_second();
+        } else if constexpr (lt_is_date<LT>) {
+            return value.julian();
+        } else {
+            return value;
+        }
+    }
+
     void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
                 size_t row_num) const override {
         do_update<true>(ctx, columns, state, row_num);
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        const auto* column = down_cast<const InputColumnType*>(columns[0]);
+        const auto* data = column->get_data().data();
+        for (size_t i = 0; i < chunk_size; ++i) {
+            auto& agg_data = this->data(states[i] + state_offset);
+            agg_data.sum += to_addend(data[i]);
+            agg_data.count++;
+        }
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const auto* column = down_cast<const InputColumnType*>(columns[0]);
+        const auto* data = column->get_data().data();
+        auto& agg_data = this->data(state);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            agg_data.sum += to_addend(data[i]);
+        }
+        agg_data.count += chunk_size;
+    }
+
     AggStateTableKind agg_state_table_kind(bool is_append_only) const override {
         return AggStateTableKind::INTERMEDIATE;
     }
@@ -39,6 +39,19 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        // union the whole batch in one multi-way pass instead of folding the accumulated
+        // bitmap once per row, which re-walks its containers for every input
+        const auto* col = down_cast<const BitmapColumn*>(columns[0]);
+        std::vector<const BitmapValue*> values;
+        values.reserve(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            values.emplace_back(col->get_object(i));
+        }
+        this->data(state) |= BitmapValue::fastunion(values);
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
@@ -144,6 +144,9 @@ public:
     }
 
     std::string get_name() const override { return "count"; }
+
+    // the state is a zeroed counter (and a false flag for the window variant)
+    bool is_zero_initialized_state() const override { return true; }
 };
 
 // count null_able column
@@ -350,6 +353,8 @@ public:
 
     std::string get_name() const override { return "count_nullable"; }
 
+    bool is_zero_initialized_state() const override { return true; }
+
     AggStateTableKind agg_state_table_kind(bool is_append_only) const override { return AggStateTableKind::RESULT; }
 
     void retract(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
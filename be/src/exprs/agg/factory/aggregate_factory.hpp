@@ -139,6 +139,9 @@ public:
     template <LogicalType LT>
     static auto MakeMaxAggregateFunction();
 
+    template <LogicalType LT>
+    static auto MakeMaxWindowFunction();
+
     template <LogicalType LT>
     static auto MakeMaxByAggregateFunction();
 
@@ -148,6 +151,9 @@ public:
     template <LogicalType LT>
     static auto MakeMinAggregateFunction();
 
+    template <LogicalType LT>
+    static auto MakeMinWindowFunction();
+
     template <LogicalType LT>
     static AggregateFunctionPtr MakeAnyValueAggregateFunction();
 
@@ -326,6 +332,12 @@ auto AggregateFactory::MakeMaxAggregateFunction() {
     return std::make_shared<MaxMinAggregateFunction<LT, MaxAggregateData<LT>, MaxElement<LT, MaxAggregateData<LT>>>>();
 }
 
+template <LogicalType LT>
+auto AggregateFactory::MakeMaxWindowFunction() {
+    using State = MaxMinSlidingWindowData<LT, MaxAggregateData<LT>>;
+    return std::make_shared<MaxMinWindowFunction<LT, State, MaxElement<LT, State>>>();
+}
+
 template <LogicalType LT>
 auto AggregateFactory::MakeMaxByAggregateFunction() {
     return std::make_shared<
@@ -343,6 +355,12 @@ auto AggregateFactory::MakeMinAggregateFunction() {
     return std::make_shared<MaxMinAggregateFunction<LT, MinAggregateData<LT>, MinElement<LT, MinAggregateData<LT>>>>();
 }
 
+template <LogicalType LT>
+auto AggregateFactory::MakeMinWindowFunction() {
+    using State = MaxMinSlidingWindowData<LT, MinAggregateData<LT>>;
+    return std::make_shared<MaxMinWindowFunction<LT, State, MinElement<LT, State>>>();
+}
+
 template <LogicalType LT>
 AggregateFunctionPtr AggregateFactory::MakeAnyValueAggregateFunction() {
     return std::make_shared<
@@ -143,6 +143,23 @@ public:
         }
     }
 
+    // Register a dedicated implementation for the window version, so that it can carry extra
+    // state (e.g. sliding-window candidates) without bloating the hash aggregation state.
+    template <LogicalType ArgType, LogicalType RetType, class StateType, class WindowStateType,
+              typename SpecificAggFunctionPtr = AggregateFunctionPtr,
+              typename SpecificWindowFunctionPtr = AggregateFunctionPtr, bool IgnoreNull = true>
+    void add_aggregate_mapping_with_window(const std::string& name, SpecificAggFunctionPtr fun,
+                                           SpecificWindowFunctionPtr window_fun) {
+        _infos_mapping.emplace(std::make_tuple(name, ArgType, RetType, false, false), fun);
+        auto nullable_agg = AggregateFactory::MakeNullableAggregateFunctionUnary<StateType, false, IgnoreNull>(fun);
+        _infos_mapping.emplace(std::make_tuple(name, ArgType, RetType, false, true), nullable_agg);
+
+        _infos_mapping.emplace(std::make_tuple(name, ArgType, RetType, true, false), window_fun);
+        auto nullable_window =
+                AggregateFactory::MakeNullableAggregateFunctionUnary<WindowStateType, true, IgnoreNull>(window_fun);
+        _infos_mapping.emplace(std::make_tuple(name, ArgType, RetType, true, true), nullable_window);
+    }
+
     template <LogicalType ArgType, LogicalType RetType, class StateType,
               typename SpecificAggFunctionPtr = AggregateFunctionPtr>
     void add_aggregate_mapping_variadic(const std::string& name, bool is_window, SpecificAggFunctionPtr fun) {
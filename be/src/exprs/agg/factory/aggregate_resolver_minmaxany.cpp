@@ -58,10 +58,23 @@ struct MinMaxAnyDispatcher {
     template <LogicalType lt>
     void operator()(AggregateFuncResolver* resolver) {
         if constexpr (lt_is_aggregate<lt> || lt_is_json<lt>) {
-            resolver->add_aggregate_mapping<lt, lt, MinAggregateData<lt>>(
-                    "min", true, AggregateFactory::MakeMinAggregateFunction<lt>());
-            resolver->add_aggregate_mapping<lt, lt, MaxAggregateData<lt>>(
-                    "max", true, AggregateFactory::MakeMaxAggregateFunction<lt>());
+            if constexpr (lt_is_aggregate<lt> && !lt_is_string<lt>) {
+                // Fixed-length comparable types get a dedicated window implementation that can
+                // advance a bounded ROWS frame incrementally.
+                resolver->add_aggregate_mapping_with_window<lt, lt, MinAggregateData<lt>,
+                                                            MaxMinSlidingWindowData<lt, MinAggregateData<lt>>>(
+                        "min", AggregateFactory::MakeMinAggregateFunction<lt>(),
+                        AggregateFactory::MakeMinWindowFunction<lt>());
+                resolver->add_aggregate_mapping_with_window<lt, lt, MaxAggregateData<lt>,
+                                                            MaxMinSlidingWindowData<lt, MaxAggregateData<lt>>>(
+                        "max", AggregateFactory::MakeMaxAggregateFunction<lt>(),
+                        AggregateFactory::MakeMaxWindowFunction<lt>());
+            } else {
+                resolver->add_aggregate_mapping<lt, lt, MinAggregateData<lt>>(
+                        "min", true, AggregateFactory::MakeMinAggregateFunction<lt>());
+                resolver->add_aggregate_mapping<lt, lt, MaxAggregateData<lt>>(
+                        "max", true, AggregateFactory::MakeMaxAggregateFunction<lt>());
+            }
             resolver->add_aggregate_mapping<lt, lt, AnyValueAggregateData<lt>>(
                     "any_value", true, AggregateFactory::MakeAnyValueAggregateFunction<lt>());
         }
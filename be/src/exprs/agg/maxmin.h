@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <deque>
 #include <limits>
 #include <type_traits>
+#include <utility>
 
 #include "column/fixed_length_column.h"
 #include "column/type_traits.h"
@@ -79,6 +81,20 @@ struct MinAggregateData<LT, StringLTGuard<LT>> {
     }
 };
 
+// State for the sliding-window variants of max/min. Besides the current extremum it keeps a
+// monotonic deque of (position, value) candidates of the current frame, so that retiring the
+// row falling out of the frame is amortized O(1) instead of a full-frame rescan.
+template <LogicalType LT, typename BaseData>
+struct MaxMinSlidingWindowData : BaseData {
+    using T = AggDataValueType<LT>;
+    std::deque<std::pair<int64_t, T>> candidates;
+
+    void reset() {
+        BaseData::reset();
+        candidates.clear();
+    }
+};
+
 template <LogicalType LT, typename State, typename = guard::Guard>
 struct MaxElement {
     using T = RunTimeCppType<LT>;
@@ -151,11 +167,33 @@ public:
         OP()(this->data(state), value);
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        const auto* column = down_cast<const InputColumnType*>(columns[0]);
+        const auto* data = column->get_data().data();
+        for (size_t i = 0; i < chunk_size; ++i) {
+            OP()(this->data(states[i] + state_offset), data[i]);
+        }
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const auto* column = down_cast<const InputColumnType*>(columns[0]);
+        const auto* data = column->get_data().data();
+        auto& agg_data = this->data(state);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            OP()(agg_data, data[i]);
+        }
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
+        const auto* column = down_cast<const InputColumnType*>(columns[0]);
+        const auto* data = column->get_data().data();
+        auto& agg_data = this->data(state);
         for (size_t i = frame_start; i < frame_end; ++i) {
-            update(ctx, columns, state, i);
+            OP()(agg_data, data[i]);
         }
     }
 
@@ -251,4 +289,112 @@ public:
     std::string get_name() const override { return "maxmin"; }
 };
 
+// Sliding-window variant of max/min for fixed-length comparable types. Each updated row is
+// recorded as a candidate in State::candidates, and update_state_removable_cumulatively retires
+// the candidate whose row left the frame, so the analytic node can advance a bounded ROWS frame
+// in amortized O(1) per row instead of re-evaluating the whole frame.
+template <LogicalType LT, typename State, class OP, typename T = RunTimeCppType<LT>>
+class MaxMinWindowFunction final
+        : public AggregateFunctionBatchHelper<State, MaxMinWindowFunction<LT, State, OP, T>> {
+    static constexpr bool is_max = std::is_same_v<OP, MaxElement<LT, State>>;
+
+    // A candidate is dominated once a not-worse value enters the frame after it.
+    static bool is_dominated(const T& candidate, const T& value) {
+        if constexpr (is_max) {
+            return candidate <= value;
+        } else {
+            return candidate >= value;
+        }
+    }
+
+    void _add_candidate(State& data, int64_t position, const T& value) const {
+        auto& candidates = data.candidates;
+        while (!candidates.empty() && is_dominated(candidates.back().second, value)) {
+            candidates.pop_back();
+        }
+        candidates.emplace_back(position, value);
+        data.result = candidates.front().second;
+    }
+
+public:
+    using InputColumnType = RunTimeColumnType<LT>;
+
+    void reset(FunctionContext* ctx, const Columns& args, AggDataPtr state) const override {
+        this->data(state).reset();
+    }
+
+    void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
+                size_t row_num) const override {
+        DCHECK(!columns[0]->is_nullable() && !columns[0]->is_binary());
+        const auto& column = down_cast<const InputColumnType&>(*columns[0]);
+        _add_candidate(this->data(state), row_num, column.get_data()[row_num]);
+    }
+
+    void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                              int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
+                                              int64_t frame_end) const override {
+        for (size_t i = frame_start; i < frame_end; ++i) {
+            update(ctx, columns, state, i);
+        }
+    }
+
+    void update_state_removable_cumulatively(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                             int64_t current_row_position, int64_t partition_start,
+                                             int64_t partition_end, int64_t rows_start_offset, int64_t rows_end_offset,
+                                             bool ignore_subtraction, bool ignore_addition) const override {
+        auto& data = this->data(state);
+        const int64_t previous_frame_first_position = current_row_position - 1 + rows_start_offset;
+        if (!ignore_subtraction && previous_frame_first_position >= partition_start &&
+            previous_frame_first_position < partition_end) {
+            while (!data.candidates.empty() && data.candidates.front().first <= previous_frame_first_position) {
+                data.candidates.pop_front();
+            }
+        }
+        const int64_t current_frame_last_position = current_row_position + rows_end_offset;
+        if (!ignore_addition && current_frame_last_position >= partition_start &&
+            current_frame_last_position < partition_end) {
+            const auto& column = down_cast<const InputColumnType&>(*columns[0]);
+            _add_candidate(data, current_frame_last_position, column.get_data()[current_frame_last_position]);
+        } else if (data.candidates.empty()) {
+            // The frame became empty, fall back to the identity value.
+            data.reset();
+        } else {
+            data.result = data.candidates.front().second;
+        }
+    }
+
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        DCHECK(!column->is_nullable() && !column->is_binary());
+        const auto* input_column = down_cast<const InputColumnType*>(column);
+        T value = input_column->get_data()[row_num];
+        OP()(this->data(state), value);
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        DCHECK(!to->is_nullable() && !to->is_binary());
+        AggDataTypeTraits<LT>::append_value(down_cast<InputColumnType*>(to), this->data(state).result);
+    }
+
+    void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
+                                     ColumnPtr* dst) const override {
+        *dst = src[0];
+    }
+
+    void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        DCHECK(!to->is_nullable() && !to->is_binary());
+        AggDataTypeTraits<LT>::append_value(down_cast<InputColumnType*>(to), this->data(state).result);
+    }
+
+    void get_values(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* dst, size_t start,
+                    size_t end) const override {
+        DCHECK_GT(end, start);
+        auto* column = down_cast<InputColumnType*>(dst);
+        for (size_t i = start; i < end; ++i) {
+            AggDataTypeTraits<LT>::assign_value(column, i, this->data(state).result);
+        }
+    }
+
+    std::string get_name() const override { return "maxmin_window"; }
+};
+
 } // namespace starrocks
@@ -71,6 +71,15 @@ public:
         this->data(state).sum -= column.get_data()[row_num];
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        const auto* column = down_cast<const InputColumnType*>(columns[0]);
+        const auto* data = column->get_data().data();
+        for (size_t i = 0; i < chunk_size; ++i) {
+            this->data(states[i] + state_offset).sum += data[i];
+        }
+    }
+
     void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                    AggDataPtr __restrict state) const override {
         const auto* column = down_cast<const InputColumnType*>(columns[0]);
@@ -173,6 +182,9 @@ public:
     }
 
     std::string get_name() const override { return "sum"; }
+
+    // the state is a value-initialized accumulator, all-zero for every supported ResultType
+    bool is_zero_initialized_state() const override { return true; }
 };
 
 template <LogicalType LT, typename = DecimalLTGuard<LT>>
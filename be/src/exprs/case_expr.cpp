@@ -553,7 +553,7 @@ private:
             }
             ColumnBuilder<ResultType> builder(size, this->type().precision, this->type().scale);
             // max case size in use SIMD CASE WHEN implements
-            constexpr int max_simd_case_when_size = 8;
+            constexpr int max_simd_case_when_size = 16;
 
             // optimization for no-nullable Arithmetic Type
             if constexpr (isArithmeticLT<ResultType>) {
@@ -20,6 +20,7 @@
 #include "column/column_helper.h"
 #include "column/const_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/anyval_util.h"
 #include "exprs/builtin_functions.h"
 #include "exprs/expr_context.h"
@@ -174,6 +175,24 @@ StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::Expr
     }
 #endif
 
+    const size_t num_rows = ptr != nullptr ? ptr->num_rows() : 0;
+    const bool fold_single_run = _should_fold_single_run(args, num_rows);
+    if (fold_single_run) {
+        // Every argument holds one single run of a value, so evaluate the function on
+        // one row only and expand the result to the whole chunk afterwards.
+        for (auto& arg : args) {
+            if (arg->is_constant()) {
+                auto one_row = arg->clone();
+                one_row->resize(1);
+                arg = std::move(one_row);
+            } else {
+                auto one_row = arg->clone_empty();
+                one_row->append(*arg, 0, 1);
+                arg = std::move(one_row);
+            }
+        }
+    }
+
     StatusOr<ColumnPtr> result;
     if (_fn_desc->exception_safe) {
         result = _fn_desc->scalar_function(fn_ctx, args);
@@ -190,6 +209,10 @@ StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::Expr
         }
     }
 
+    if (fold_single_run) {
+        result.value()->assign(num_rows, 0);
+    }
+
     // For no args function call (pi, e)
     if (result.value()->is_constant() && ptr != nullptr) {
         result.value()->resize(ptr->num_rows());
@@ -198,6 +221,21 @@ StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::Expr
     return result;
 }
 
+bool VectorizedFunctionCallExpr::_should_fold_single_run(const Columns& args, size_t num_rows) const {
+    if (!config::enable_expr_run_folding || _is_returning_random_value || num_rows <= 1 || args.empty()) {
+        return false;
+    }
+    for (const auto& arg : args) {
+        if (arg->is_constant()) {
+            continue;
+        }
+        if (!ColumnHelper::is_single_value_run(*arg)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool VectorizedFunctionCallExpr::ngram_bloom_filter(ExprContext* context, const BloomFilter* bf,
                                                     const NgramBloomFilterReaderOptions& reader_options) const {
     FunctionContext* fn_ctx = context->fn_context(_fn_context_index);
@@ -49,6 +49,10 @@ protected:
     [[nodiscard]] StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override;
 
 private:
+    // Whether all arguments hold one single run of a value, so the function can be
+    // evaluated on one row and the result expanded to the whole chunk.
+    bool _should_fold_single_run(const Columns& args, size_t num_rows) const;
+
     bool split_normal_string_to_ngram(FunctionContext* fn_ctx, const NgramBloomFilterReaderOptions& reader_options,
                                       NgramBloomFilterState* ngram_state, const std::string& func_name) const;
 
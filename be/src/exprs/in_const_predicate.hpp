@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+
 #include "column/chunk.h"
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -83,6 +86,18 @@ public:
                Type == TYPE_BIGINT;
     }
 
+    // Fixed-width types with a total order. Float types are excluded because NaN breaks
+    // the strict ordering the binary search below relies on.
+    static constexpr bool can_use_sorted_array() {
+        return (isArithmeticLT<Type> && !std::is_floating_point_v<RunTimeCppType<Type>>) || Type == TYPE_DATE ||
+               Type == TYPE_DATETIME;
+    }
+
+    // Above this list size the probes of a hash set are dominated by cache misses over
+    // its sparse buckets, while a binary search touches a small contiguous array whose
+    // hot upper levels stay cached across rows.
+    constexpr static size_t kMinSortedArraySize = 1024;
+
     [[nodiscard]] Status prepare([[maybe_unused]] RuntimeState* state) {
         if (_is_prepare) {
             return Status::OK();
@@ -98,6 +113,8 @@ public:
             const auto& hash_set = that->hash_set();
             _hash_set.insert(hash_set.begin(), hash_set.end());
             _null_in_set = _null_in_set || that->null_in_set();
+            // the sorted snapshot no longer covers the merged values
+            _sorted_values.clear();
             return Status::OK();
         } else {
             return Status::NotSupported(strings::Substitute("$0 cannot be merged with VectorizedInConstPredicate",
@@ -173,6 +190,16 @@ public:
                     _hash_set.emplace(viewer.value(0));
                 }
             }
+
+            // Large literal lists are re-shaped into a sorted array probed by binary
+            // search. Predicates fed through insert()/merge() after open, e.g. runtime
+            // filters, keep using the hash set.
+            if constexpr (can_use_sorted_array()) {
+                if (!use_array && _children.size() > 1 && _hash_set.size() >= kMinSortedArraySize) {
+                    _sorted_values.assign(_hash_set.begin(), _hash_set.end());
+                    std::sort(_sorted_values.begin(), _sorted_values.end());
+                }
+            }
         }
         return Status::OK();
     }
@@ -340,6 +367,9 @@ public:
     uint8_t check_value_existence(const ValueType& value) const {
         if constexpr (use_array && can_use_array()) {
             return _get_array_index(value);
+        } else if constexpr (can_use_sorted_array()) {
+            return _sorted_values.empty() ? static_cast<uint8_t>(_hash_set.contains(value))
+                                          : _sorted_contains(value);
         } else {
             return static_cast<uint8_t>(_hash_set.contains(value));
         }
@@ -369,6 +399,20 @@ private:
     // Since the bitmap size is quite small, we can use trade memory usage for performance
     // According to experiments, there is 20% performance gain.
 
+    // Branchless lower bound over the sorted list: each halving step compiles to a
+    // conditional move, so the probe loop takes no branch misses and its upper levels
+    // stay in cache across the rows of a chunk. Callers guarantee the list is non-empty.
+    uint8_t _sorted_contains(const ValueType& value) const {
+        const ValueType* base = _sorted_values.data();
+        size_t n = _sorted_values.size();
+        while (n > 1) {
+            size_t half = n / 2;
+            base = (base[half - 1] < value) ? base + half : base;
+            n -= half;
+        }
+        return static_cast<uint8_t>(*base == value);
+    }
+
     void _set_array_index(int64_t index) { _array_buffer[index] = 1; }
     uint8_t _get_array_index(int64_t index) const { return _array_buffer[index]; }
 
@@ -389,6 +433,9 @@ private:
     std::vector<uint8_t> _array_buffer;
 
     in_const_pred_detail::LHashSetType<Type> _hash_set;
+    // Sorted copy of _hash_set, built in open() for large literal lists of fixed-width
+    // types; empty means probe the hash set.
+    std::vector<ValueType> _sorted_values;
     // Ensure the string memory don't early free
     std::vector<ColumnPtr> _string_values;
 };
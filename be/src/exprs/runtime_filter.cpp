@@ -121,6 +121,13 @@ void SimdBlockFilter::merge(const SimdBlockFilter& bf) {
         const __m256i b = _mm256_load_si256(dst);
         const __m256i c = _mm256_or_si256(a, b);
         _mm256_store_si256(dst, c);
+#elif defined(__ARM_NEON)
+        uint32x4_t dst_1 = vld1q_u32(&_directory[i][0]);
+        uint32x4_t dst_2 = vld1q_u32(&_directory[i][4]);
+        uint32x4_t src_1 = vld1q_u32(&bf._directory[i][0]);
+        uint32x4_t src_2 = vld1q_u32(&bf._directory[i][4]);
+        vst1q_u32(&_directory[i][0], vorrq_u32(dst_1, src_1));
+        vst1q_u32(&_directory[i][4], vorrq_u32(dst_2, src_2));
 #else
         for (int j = 0; j < BITS_SET_PER_BLOCK; j++) {
             _directory[i][j] |= bf._directory[i][j];
@@ -15,6 +15,7 @@
 #include "exprs/time_functions.h"
 
 #include <algorithm>
+#include <cstring>
 #include <string_view>
 #include <unordered_map>
 
@@ -2128,12 +2129,33 @@ DEFINE_STRING_UNARY_FN_WITH_IMPL(yyyy_MM_dd_Impl, v) {
     return format_for_yyyy_MM_dd_Impl((DateValue)d);
 }
 
-std::string format_for_yyyyMMddHHmmssImpl(const TimestampValue& date_value) {
-    return date_value.to_string();
+// Formats "%Y-%m-%d %H:%i:%s[.ffffff]" into |buf| and returns the written length.
+// The result is longer than the small-string optimization threshold, so the hot
+// fixed-pattern path appends a slice straight into the column bytes instead of
+// materializing one heap-allocated std::string per row.
+int format_for_yyyyMMddHHmmss_buf(const TimestampValue& date_value, char* buf, size_t n) {
+    return timestamp::to_string<false>(date_value.timestamp(), buf, n);
 }
 
-DEFINE_STRING_UNARY_FN_WITH_IMPL(yyyyMMddHHmmssImpl, v) {
-    return format_for_yyyyMMddHHmmssImpl((TimestampValue)v);
+template <LogicalType Type>
+ColumnPtr date_format_datetime_func(const Columns& cols) {
+    ColumnViewer<Type> viewer(cols[0]);
+
+    size_t num_rows = viewer.size();
+    ColumnBuilder<TYPE_VARCHAR> builder(num_rows);
+    builder.data_column()->reserve(num_rows, num_rows * 19);
+
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (viewer.is_null(i)) {
+            builder.append_null();
+            continue;
+        }
+        char buf[26];
+        int len = format_for_yyyyMMddHHmmss_buf((TimestampValue)viewer.value(i), buf, sizeof(buf));
+        builder.append(Slice(buf, len));
+    }
+
+    return builder.build(ColumnHelper::is_all_const(cols));
 }
 
 std::string format_for_yyyy_MMImpl(const DateValue& date_value) {
@@ -2227,7 +2249,7 @@ StatusOr<ColumnPtr> standard_format(const std::string& fmt, int len, const starr
         } else {
             auto ts = (TimestampValue)ts_viewer.value(i);
             bool b = standard_format_one_row(ts, buf, fmt);
-            result.append(Slice(std::string(buf)), !b);
+            result.append(Slice(buf, b ? strlen(buf) : 0), !b);
         }
     }
     return result.build(ColumnHelper::is_all_const(columns));
@@ -2240,7 +2262,7 @@ StatusOr<ColumnPtr> do_format(const TimeFunctions::FormatCtx* ctx, const Columns
     } else if (ctx->fmt_type == TimeFunctions::yyyy_MM_dd) {
         return date_format_func<yyyy_MM_dd_Impl, Type>(cols, 10);
     } else if (ctx->fmt_type == TimeFunctions::yyyy_MM_dd_HH_mm_ss) {
-        return date_format_func<yyyyMMddHHmmssImpl, Type>(cols, 28);
+        return date_format_datetime_func<Type>(cols);
     } else if (ctx->fmt_type == TimeFunctions::yyyy_MM) {
         return date_format_func<yyyy_MMImpl, Type>(cols, 7);
     } else if (ctx->fmt_type == TimeFunctions::yyyyMM) {
@@ -2266,7 +2288,9 @@ void common_format_process(ColumnViewer<Type>* viewer_date, ColumnViewer<TYPE_VA
     } else if (format == "%Y-%m-%d" || format == "yyyy-MM-dd") {
         builder->append(format_for_yyyy_MM_dd_Impl(viewer_date->value(i)));
     } else if (format == "%Y-%m-%d %H:%i:%s" || format == "yyyy-MM-dd HH:mm:ss") {
-        builder->append(format_for_yyyyMMddHHmmssImpl(viewer_date->value(i)));
+        char buf[26];
+        int len = format_for_yyyyMMddHHmmss_buf(viewer_date->value(i), buf, sizeof(buf));
+        builder->append(Slice(buf, len));
     } else if (format == "%Y-%m") {
         builder->append(format_for_yyyy_MMImpl(viewer_date->value(i)));
     } else if (format == "%Y%m") {
@@ -2277,7 +2301,7 @@ void common_format_process(ColumnViewer<Type>* viewer_date, ColumnViewer<TYPE_VA
         char buf[128];
         auto ts = (TimestampValue)viewer_date->value(i);
         bool b = standard_format_one_row(ts, buf, viewer_format->value(i).to_string());
-        builder->append(Slice(std::string(buf)), !b);
+        builder->append(Slice(buf, b ? strlen(buf) : 0), !b);
     }
 }
 
@@ -2420,7 +2444,7 @@ StatusOr<ColumnPtr> joda_standard_format(const std::string& fmt, int len, const
         } else {
             auto ts = (TimestampValue)ts_viewer.value(i);
             bool b = joda_standard_format_one_row(ts, buf, fmt);
-            result.append(Slice(std::string(buf)), !b);
+            result.append(Slice(buf, b ? strlen(buf) : 0), !b);
         }
     }
     return result.build(ColumnHelper::is_all_const(columns));
@@ -2433,7 +2457,7 @@ StatusOr<ColumnPtr> joda_format(const TimeFunctions::FormatCtx* ctx, const Colum
     } else if (ctx->fmt_type == TimeFunctions::yyyy_MM_dd) {
         return date_format_func<yyyy_MM_dd_Impl, Type>(cols, 10);
     } else if (ctx->fmt_type == TimeFunctions::yyyy_MM_dd_HH_mm_ss) {
-        return date_format_func<yyyyMMddHHmmssImpl, Type>(cols, 28);
+        return date_format_datetime_func<Type>(cols);
     } else if (ctx->fmt_type == TimeFunctions::yyyy_MM) {
         return date_format_func<yyyy_MMImpl, Type>(cols, 7);
     } else if (ctx->fmt_type == TimeFunctions::yyyyMM) {
@@ -2459,7 +2483,9 @@ void common_joda_format_process(ColumnViewer<Type>* viewer_date, ColumnViewer<TY
     } else if (format == "yyyy-MM-dd") {
         builder->append(format_for_yyyy_MM_dd_Impl(viewer_date->value(i)));
     } else if (format == "yyyy-MM-dd HH:mm:ss") {
-        builder->append(format_for_yyyyMMddHHmmssImpl(viewer_date->value(i)));
+        char buf[26];
+        int len = format_for_yyyyMMddHHmmss_buf(viewer_date->value(i), buf, sizeof(buf));
+        builder->append(Slice(buf, len));
     } else if (format == "yyyy-MM") {
         builder->append(format_for_yyyy_MMImpl(viewer_date->value(i)));
     } else if (format == "yyyyMM") {
@@ -2470,7 +2496,7 @@ void common_joda_format_process(ColumnViewer<Type>* viewer_date, ColumnViewer<TY
         char buf[128];
         auto ts = (TimestampValue)viewer_date->value(i);
         bool b = joda_standard_format_one_row(ts, buf, viewer_format->value(i).to_string());
-        builder->append(Slice(std::string(buf)), !b);
+        builder->append(Slice(buf, b ? strlen(buf) : 0), !b);
     }
 }
 
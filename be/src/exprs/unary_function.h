@@ -183,6 +183,14 @@ public:
         if (v1->is_nullable()) {
             auto col = ColumnHelper::as_raw_column<NullableColumn>(v1);
 
+            if (!col->has_null()) {
+                // the null bitmap is all-zero, so the result's nullability is decided by FN
+                // alone and no null columns need to be copied or merged. Returning the data
+                // result directly mirrors UnionNullableColumnBinaryFunction.
+                return FN::template evaluate<Type, ResultType, Args...>(col->data_column(),
+                                                                        std::forward<Args>(args)...);
+            }
+
             if (v1->size() == ColumnHelper::count_nulls(v1)) {
                 auto data = RunTimeColumnType<ResultType>::create();
                 data->resize(v1->size());
@@ -555,17 +555,20 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        // memchr scans with SIMD instructions, much faster than the byte-by-byte loop
+        // for the common case of wide rows with few delimiters.
+        const char delimiter = _parse_options.column_delimiter[0];
+        const char* const end = record.data + size;
+        while ((ptr = static_cast<const char*>(memchr(value, delimiter, end - value))) != nullptr) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, ptr - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, ptr - value);
             }
+            value = ptr + 1;
         }
+        ptr = end;
     } else {
         const auto* const base = ptr;
 
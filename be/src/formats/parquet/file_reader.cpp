@@ -639,6 +639,29 @@ Status FileReader::_init_group_readers() {
         RETURN_IF_ERROR(_sb_stream->set_io_ranges(ranges));
     }
 
+    // collect page io ranges of all row groups at once, so that coalesced reads can span
+    // row-group boundaries: the read that fetches the tail pages of one group also brings in
+    // the head pages of the next while the current group is still being decoded. close() of
+    // each group still releases its buffers, so peak memory stays bounded.
+    if (config::parquet_cross_row_group_coalesce_enable && config::parquet_coalesce_read_enable &&
+        _sb_stream != nullptr && _row_group_size > 1) {
+        std::vector<io::SharedBufferedInputStream::IORange> ranges;
+        for (auto& r : _row_group_readers) {
+            int64_t end_offset = 0;
+            r->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
+            r->set_end_offset(end_offset);
+        }
+        int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
+        if (counter >= 0 || !config::io_coalesce_adaptive_lazy_active) {
+            _scanner_ctx->stats->group_active_lazy_coalesce_together += _row_group_size;
+        } else {
+            _scanner_ctx->stats->group_active_lazy_coalesce_seperately += _row_group_size;
+        }
+        RETURN_IF_ERROR(_sb_stream->set_io_ranges(ranges, counter >= 0));
+        _group_reader_param.sb_stream = _sb_stream;
+        _all_row_group_page_ranges_set = true;
+    }
+
     if (!_row_group_readers.empty()) {
         // prepare first row group
         RETURN_IF_ERROR(_prepare_cur_row_group());
@@ -656,7 +679,7 @@ Status FileReader::_prepare_cur_row_group() {
     // 1. allocate shared buffered input stream and
     // 2. collect io ranges of every row group reader.
     // 3. set io ranges to the stream.
-    if (config::parquet_coalesce_read_enable && _sb_stream != nullptr) {
+    if (config::parquet_coalesce_read_enable && _sb_stream != nullptr && !_all_row_group_page_ranges_set) {
         std::vector<io::SharedBufferedInputStream::IORange> ranges;
         int64_t end_offset = 0;
         r->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
@@ -133,6 +133,9 @@ private:
     bool _is_file_filtered = false;
     HdfsScannerContext* _scanner_ctx = nullptr;
     io::SharedBufferedInputStream* _sb_stream = nullptr;
+    // page io ranges of all row groups were registered at init, so _prepare_cur_row_group
+    // must not register them again.
+    bool _all_row_group_page_ranges_set = false;
     GroupReaderParam _group_reader_param;
     std::shared_ptr<MetaHelper> _meta_helper = nullptr;
     const std::set<int64_t>* _need_skip_rowids;
@@ -220,16 +220,13 @@ Status LevelBuilder::_write_decimal128_column_chunk(const LevelBuilderContext& c
     auto values = new unsigned __int128[col->size()];
     DeferOp defer([&] { delete[] values; });
 
-    for (size_t i = 0; i < col->size(); i++) {
-        // unscaled number must be encoded as two's complement using big-endian byte order (the most significant byte
-        // is the zeroth element). See https://github.com/apache/parquet-format/blob/master/LogicalTypes.md#decimal
-        values[i] = BigEndian::FromHost128(data_col[i]);
-    }
-
     auto flba_values = new ::parquet::FixedLenByteArray[col->size()];
     DeferOp flba_defer([&] { delete[] flba_values; });
 
     for (size_t i = 0; i < col->size(); i++) {
+        // unscaled number must be encoded as two's complement using big-endian byte order (the most significant byte
+        // is the zeroth element). See https://github.com/apache/parquet-format/blob/master/LogicalTypes.md#decimal
+        values[i] = BigEndian::FromHost128(data_col[i]);
         flba_values[i].ptr = reinterpret_cast<const uint8_t*>(values + i);
     }
 
@@ -559,7 +556,17 @@ std::shared_ptr<std::vector<uint8_t>> LevelBuilder::_make_null_bitset(const Leve
         }
 
         auto bitset = std::make_shared<std::vector<uint8_t>>((col_size + 7) / 8);
-        for (size_t i = 0; i < col_size; i++) {
+        size_t i = 0;
+        // Pack eight 0/1 null bytes per iteration: gather the LSB of every not-null byte
+        // into one output byte with a multiply. Every (input byte, multiplier bit) pair
+        // lands on a distinct bit of the product, so no carry can corrupt the result.
+        for (; i + 8 <= col_size; i += 8) {
+            uint64_t word;
+            memcpy(&word, nulls + i, sizeof(word));
+            uint64_t not_nulls = ~word & 0x0101010101010101ULL;
+            (*bitset)[i >> 3] = static_cast<uint8_t>((not_nulls * 0x0102040810204080ULL) >> 56);
+        }
+        for (; i < col_size; i++) {
             (*bitset)[i >> 3] |= (1 - nulls[i]) << (i & 0b111);
         }
         return bitset;
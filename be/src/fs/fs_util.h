@@ -14,11 +14,15 @@
 
 #pragma once
 
+#include <unistd.h>
+
+#include <cerrno>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "common/config.h"
+#include "common/logging.h"
 #include "fs/fs.h"
 #include "testutil/sync_point.h"
 
@@ -167,6 +171,19 @@ inline Status copy_file(const std::string& src_path, const std::string& dst_path
     return Status::OK();
 }
 
+// Hard-link src to dst, falling back to a full copy when they live on different filesystems.
+// Only use it for immutable files: a write through either path would be visible through both.
+inline Status link_or_copy_file(const std::string& src_path, const std::string& dst_path) {
+    if (::link(src_path.c_str(), dst_path.c_str()) == 0) {
+        return Status::OK();
+    }
+    if (errno != EXDEV) {
+        // cross-device is the expected reason to fall back; keep the other failures visible.
+        PLOG(WARNING) << "Fail to link " << src_path << " to " << dst_path << ", fall back to copy";
+    }
+    return copy_file(src_path, dst_path);
+}
+
 // copy the file range [offset, offset + size] from src path to dest path, it will overwrite the existing files
 inline Status copy_file_by_range(const std::string& src_path, const std::string& dst_path, int64_t offset,
                                  int64_t size) {
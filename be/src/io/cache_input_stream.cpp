@@ -18,6 +18,7 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "util/hash_util.hpp"
 #include "util/runtime_profile.h"
@@ -215,6 +216,12 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
     for (int64_t write_offset_cursor = offset; write_offset_cursor < write_end_offset;) {
         DCHECK(write_offset_cursor % _block_size == 0);
         WriteCacheOptions options{};
+        if (_populate_ttl_seconds > 0) {
+            options.ttl_seconds = _populate_ttl_seconds;
+            // keep already cached copies (and their lifetime) untouched, a scan-class
+            // stream must not demote blocks the hot working set already admitted.
+            options.overwrite = false;
+        }
         const int64_t write_size = std::min(_block_size, write_end_offset - write_offset_cursor);
         Status r = _cache->write_buffer(_cache_key, write_offset_cursor, write_size, src_cursor, &options);
 
@@ -307,7 +314,11 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
     }
     DCHECK(p == pe);
 
+    const bool enable_readahead = config::block_cache_readahead_enable && _enable_populate_cache;
     if (need_read_from_remote.size() == 0) {
+        if (enable_readahead) {
+            _update_readahead(origin_offset, end_offset, false);
+        }
         return Status::OK();
     }
 
@@ -347,6 +358,52 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
         RETURN_IF_ERROR(_read_blocks_from_remote(io_range.offset, io_range.size, io_range.write_pointer));
     }
 
+    // Read ahead only after the demand ranges have been served, so that the prefetch
+    // never delays the data the caller is waiting for.
+    if (enable_readahead) {
+        _update_readahead(origin_offset, end_offset, true);
+    }
+
+    return Status::OK();
+}
+
+void CacheInputStream::_update_readahead(int64_t offset, int64_t end_offset, bool has_remote_miss) {
+    const bool sequential = (offset == _next_sequential_offset);
+    _next_sequential_offset = end_offset;
+    if (!sequential) {
+        _readahead_blocks = 0;
+        return;
+    }
+    if (!has_remote_miss) {
+        // The scan keeps hitting the cache, so the window shrinks until the hit rate drops.
+        _readahead_blocks /= 2;
+        return;
+    }
+
+    const int64_t max_blocks = std::min(config::block_cache_readahead_max_blocks, _buffer_size / _block_size);
+    _readahead_blocks = std::min(std::max<int64_t>(_readahead_blocks * 2, 1), max_blocks);
+
+    // The readahead is best-effort: a failure only loses the warm-up of the cache.
+    Status st = _readahead_from_remote(end_offset);
+    if (!st.ok()) {
+        LOG(WARNING) << "block cache readahead failed, errmsg: " << st.message();
+    }
+}
+
+Status CacheInputStream::_readahead_from_remote(int64_t offset) {
+    // The block containing the last demand byte has already been loaded as a whole,
+    // so the prefetch starts at the next block boundary.
+    const int64_t begin = (offset + _block_size - 1) / _block_size * _block_size;
+    const int64_t end = std::min(begin + _readahead_blocks * _block_size, _size);
+    if (begin >= end) {
+        return Status::OK();
+    }
+
+    const int64_t size = end - begin;
+    RETURN_IF_ERROR(_sb_stream->read_at_fully(begin, _buffer.data(), size));
+    RETURN_IF_ERROR(_populate_to_cache(begin, size, _buffer.data()));
+    _stats.readahead_count += 1;
+    _stats.readahead_bytes += size;
     return Status::OK();
 }
 
@@ -394,6 +451,7 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
         SCOPED_RAW_TIMER(&_stats.write_cache_ns);
         WriteCacheOptions options;
         options.overwrite = false;
+        options.ttl_seconds = _populate_ttl_seconds;
         Status r = cache->write_buffer(_cache_key, offset, size, buf, &options);
         if (r.ok()) {
             _stats.write_cache_count += 1;
@@ -44,6 +44,8 @@ public:
         int64_t write_cache_fail_bytes = 0;
         int64_t read_block_buffer_bytes = 0;
         int64_t read_block_buffer_count = 0;
+        int64_t readahead_count = 0;
+        int64_t readahead_bytes = 0;
     };
 
     explicit CacheInputStream(const std::shared_ptr<SharedBufferedInputStream>& stream, const std::string& filename,
@@ -67,6 +69,11 @@ public:
 
     void set_enable_block_buffer(bool v) { _enable_block_buffer = v; }
 
+    // Attach a TTL to every block this stream populates. Used to demote scan-class
+    // streams (large one-off scans), so their blocks age out of the cache quickly
+    // instead of evicting the hot working set. 0 (default) means no TTL.
+    void set_populate_ttl_seconds(uint64_t v) { _populate_ttl_seconds = v; }
+
     int64_t get_align_size() const;
 
     StatusOr<std::string_view> peek(int64_t count) override;
@@ -89,6 +96,10 @@ private:
     Status _populate_to_cache(const int64_t offset, const int64_t size, char* src);
     void _populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count);
     void _deduplicate_shared_buffer(SharedBufferedInputStream::SharedBuffer* sb);
+    // Adjusts the readahead window after a read of [offset, end_offset) and prefetches
+    // the blocks behind end_offset into the cache, when the access pattern is sequential.
+    void _update_readahead(int64_t offset, int64_t end_offset, bool has_remote_miss);
+    Status _readahead_from_remote(int64_t offset);
 
     std::string _cache_key;
     std::string _filename;
@@ -100,9 +111,15 @@ private:
     int64_t _size;
     bool _enable_populate_cache = false;
     bool _enable_block_buffer = false;
+    uint64_t _populate_ttl_seconds = 0;
     BlockCache* _cache = nullptr;
     int64_t _block_size = 0;
     std::unordered_map<int64_t, BlockBuffer> _block_map;
+
+    // Readahead state. The window is counted in blocks, it doubles on every sequential
+    // read that misses the cache and halves while the reads keep hitting it.
+    int64_t _next_sequential_offset = 0;
+    int64_t _readahead_blocks = 0;
 };
 
 } // namespace starrocks::io
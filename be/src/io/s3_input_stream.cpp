@@ -20,6 +20,13 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include <chrono>
+#include <future>
+#include <vector>
+
+#include "common/config.h"
+#include "util/time.h"
+
 #ifdef USE_STAROS
 #include "fslib/metric_key.h"
 #include "metrics/metrics.h"
@@ -33,6 +40,76 @@ inline Status make_error_status(const Aws::S3::S3Error& error) {
             static_cast<int>(error.GetResponseCode()), static_cast<int>(error.GetErrorType()), error.GetMessage()));
 }
 
+struct S3InputStream::PrefetchState {
+    std::future<Aws::S3::Model::GetObjectOutcome> outcome;
+    int64_t offset{-1};
+    int64_t count{0};
+};
+
+// hedge once a GET runs this many times longer than the stream's recent average
+static constexpr int64_t kHedgeLatencyMultiple = 3;
+
+static void update_latency_ewma(int64_t* ewma_us, int64_t sample_us) {
+    *ewma_us = (*ewma_us == 0) ? sample_us : (3 * (*ewma_us) + sample_us) / 4;
+}
+
+// Issue the GET, racing a duplicate request against the primary one when the primary runs
+// far beyond the stream's recent latency, and take whichever response arrives first. The
+// losing request is abandoned, its future releases the shared state once the SDK completes.
+static Aws::S3::Model::GetObjectOutcome get_object_maybe_hedged(Aws::S3::S3Client* client,
+                                                                const Aws::S3::Model::GetObjectRequest& request,
+                                                                int64_t* latency_ewma_us, int64_t* hedged_requests) {
+    if (!config::enable_s3_hedged_read || *hedged_requests >= config::s3_hedged_read_max_requests) {
+        int64_t start_us = MonotonicMicros();
+        auto outcome = client->GetObject(request);
+        update_latency_ewma(latency_ewma_us, MonotonicMicros() - start_us);
+        return outcome;
+    }
+    int64_t threshold_us = std::max<int64_t>(config::s3_hedged_read_min_threshold_ms * 1000,
+                                             kHedgeLatencyMultiple * (*latency_ewma_us));
+    int64_t start_us = MonotonicMicros();
+    auto primary = client->GetObjectCallable(request);
+    if (primary.wait_for(std::chrono::microseconds(threshold_us)) == std::future_status::ready) {
+        update_latency_ewma(latency_ewma_us, MonotonicMicros() - start_us);
+        return primary.get();
+    }
+    ++(*hedged_requests);
+    auto hedged = client->GetObjectCallable(request);
+    while (true) {
+        if (primary.wait_for(std::chrono::milliseconds(1)) == std::future_status::ready) {
+            update_latency_ewma(latency_ewma_us, MonotonicMicros() - start_us);
+            return primary.get();
+        }
+        if (hedged.wait_for(std::chrono::milliseconds(1)) == std::future_status::ready) {
+            // do not feed the straggler's latency back into the average
+            return hedged.get();
+        }
+    }
+}
+
+S3InputStream::~S3InputStream() {
+    if (_prefetch != nullptr && _prefetch->outcome.valid()) {
+        // make sure the in-flight request does not outlive this stream
+        _prefetch->outcome.wait();
+    }
+}
+
+void S3InputStream::_issue_prefetch(int64_t count) {
+    if (!config::enable_s3_stream_prefetch || count <= 0 || _offset >= _size) {
+        return;
+    }
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(_bucket);
+    request.SetKey(_object);
+    request.SetRange(fmt::format("bytes={}-{}", _offset, std::min<int64_t>(_offset + count, _size)));
+    if (_prefetch == nullptr) {
+        _prefetch = std::make_unique<PrefetchState>();
+    }
+    _prefetch->outcome = _s3client->GetObjectCallable(request);
+    _prefetch->offset = _offset;
+    _prefetch->count = count;
+}
+
 StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     if (UNLIKELY(_size == -1)) {
         ASSIGN_OR_RETURN(_size, S3InputStream::get_size());
@@ -41,23 +118,91 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
         return 0;
     }
 
+    if (_prefetch != nullptr && _prefetch->outcome.valid()) {
+        const bool match = _prefetch->offset == _offset && _prefetch->count == count;
+        Aws::S3::Model::GetObjectOutcome outcome = _prefetch->outcome.get();
+        if (match) {
+            if (!outcome.IsSuccess()) {
+                return make_error_status(outcome.GetError());
+            }
+            Aws::IOStream& body = outcome.GetResult().GetBody();
+            body.read(static_cast<char*>(out), count);
+            int64_t nread = body.gcount();
+            _offset += nread;
+            _issue_prefetch(count);
+            return nread;
+        }
+        // the caller seeked in between, drop the readahead and fall through
+    }
+
+    if (config::s3_parallel_read_min_bytes > 0 && count >= config::s3_parallel_read_min_bytes &&
+        _size - _offset > config::s3_parallel_read_part_bytes) {
+        return _parallel_read(out, count);
+    }
+
     auto range = fmt::format("bytes={}-{}", _offset, std::min<int64_t>(_offset + count, _size));
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(_bucket);
     request.SetKey(_object);
     request.SetRange(std::move(range));
 
-    Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+    Aws::S3::Model::GetObjectOutcome outcome =
+            get_object_maybe_hedged(_s3client.get(), request, &_latency_ewma_us, &_hedged_requests);
     if (outcome.IsSuccess()) {
         Aws::IOStream& body = outcome.GetResult().GetBody();
         body.read(static_cast<char*>(out), count);
-        _offset += body.gcount();
-        return body.gcount();
+        int64_t nread = body.gcount();
+        _offset += nread;
+        _issue_prefetch(count);
+        return nread;
     } else {
         return make_error_status(outcome.GetError());
     }
 }
 
+StatusOr<int64_t> S3InputStream::_parallel_read(void* out, int64_t count) {
+    const int64_t total = std::min(count, _size - _offset);
+    const int64_t part_size = std::max<int64_t>(1, config::s3_parallel_read_part_bytes);
+    std::vector<std::future<Aws::S3::Model::GetObjectOutcome>> parts;
+    parts.reserve((total + part_size - 1) / part_size);
+    for (int64_t pos = 0; pos < total; pos += part_size) {
+        Aws::S3::Model::GetObjectRequest request;
+        request.SetBucket(_bucket);
+        request.SetKey(_object);
+        request.SetRange(
+                fmt::format("bytes={}-{}", _offset + pos, std::min<int64_t>(_offset + pos + part_size, _size)));
+        parts.emplace_back(_s3client->GetObjectCallable(request));
+    }
+    int64_t nread = 0;
+    Status error = Status::OK();
+    for (size_t i = 0; i < parts.size(); ++i) {
+        // drain every part even after an error, so no request outlives this call
+        Aws::S3::Model::GetObjectOutcome outcome = parts[i].get();
+        if (!error.ok()) {
+            continue;
+        }
+        if (!outcome.IsSuccess()) {
+            error = make_error_status(outcome.GetError());
+            continue;
+        }
+        const int64_t pos = static_cast<int64_t>(i) * part_size;
+        const int64_t expected = std::min(part_size, total - pos);
+        Aws::IOStream& body = outcome.GetResult().GetBody();
+        body.read(static_cast<char*>(out) + pos, expected);
+        if (body.gcount() != expected) {
+            error = Status::IOError(
+                    fmt::format("short read of S3 sub-range, expect={} real={}", expected, body.gcount()));
+            continue;
+        }
+        nread += expected;
+    }
+    if (!error.ok()) {
+        return error;
+    }
+    _offset += nread;
+    return nread;
+}
+
 Status S3InputStream::seek(int64_t offset) {
     if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
     _offset = offset;
@@ -30,7 +30,7 @@ public:
     explicit S3InputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object)
             : _s3client(std::move(client)), _bucket(std::move(bucket)), _object(std::move(object)) {}
 
-    ~S3InputStream() override = default;
+    ~S3InputStream() override;
 
     // Disallow copy and assignment
     S3InputStream(const S3InputStream&) = delete;
@@ -53,11 +53,27 @@ public:
     StatusOr<std::string> read_all() override;
 
 private:
+    // holds the outcome future of an in-flight readahead issued via the SDK async executor,
+    // kept behind a pointer so this header does not drag in the AWS model headers
+    struct PrefetchState;
+
+    // submit an async range-GET for the next sequential range of |count| bytes, so the
+    // round trip overlaps with the caller processing the bytes it just read
+    void _issue_prefetch(int64_t count);
+
+    // serve a large read with concurrent sub-range GETs instead of one request
+    StatusOr<int64_t> _parallel_read(void* data, int64_t count);
+
     std::shared_ptr<Aws::S3::S3Client> _s3client;
     std::string _bucket;
     std::string _object;
     int64_t _offset{0};
     int64_t _size{-1};
+    std::unique_ptr<PrefetchState> _prefetch;
+    // moving average of recent GET latency of this stream, drives the hedge threshold
+    int64_t _latency_ewma_us{0};
+    // duplicate GETs issued so far, capped by s3_hedged_read_max_requests
+    int64_t _hedged_requests{0};
 };
 
 } // namespace starrocks::io
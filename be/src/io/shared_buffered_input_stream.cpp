@@ -221,7 +221,13 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
             _shared_align_io_bytes += sb.size - sb.raw_size;
         }
         sb.buffer.reserve(sb.size);
-        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        Status st = _stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size);
+        if (!st.ok()) {
+            // a populated buffer is recognized by its capacity, so shed the reservation,
+            // otherwise a retry would serve the partially read bytes as valid data
+            std::vector<uint8_t>().swap(sb.buffer);
+            return st;
+        }
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
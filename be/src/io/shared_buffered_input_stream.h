@@ -23,6 +23,13 @@
 
 namespace starrocks::io {
 
+// Coalesces the column ranges a reader announces through set_io_ranges() into shared
+// buffers. No IO is issued up front: a buffer is read in one piece the first time a
+// driver actually asks for bytes inside it, so a blocked driver never waits behind
+// speculative reads. Prioritization between eagerly needed and prefetch-like data
+// happens at coalescing time instead: with io_coalesce_adaptive_lazy_active, ranges of
+// active (predicate) columns and lazy (late-materialized) columns are merged into
+// separate buffers, so touching an active column does not drag in lazy column bytes.
 class SharedBufferedInputStream : public SeekableInputStream {
 public:
     struct IORange {
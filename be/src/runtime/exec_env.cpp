@@ -49,6 +49,7 @@
 #include "exec/pipeline/query_context.h"
 #include "exec/spill/dir_manager.h"
 #include "exec/workgroup/scan_executor.h"
+#include "exec/workgroup/scan_executor_tuner.h"
 #include "exec/workgroup/work_group.h"
 #include "exprs/jit/jit_engine.h"
 #include "fs/fs_s3.h"
@@ -373,6 +374,13 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
     }
     _query_rpc_pool = new PriorityThreadPool("query_rpc", query_rpc_threads, std::numeric_limits<uint32_t>::max());
 
+    int chunk_deserialize_threads = config::chunk_deserialize_thread_num;
+    if (chunk_deserialize_threads <= 0) {
+        chunk_deserialize_threads = CpuInfo::num_cores();
+    }
+    _chunk_deserialize_pool = new PriorityThreadPool("chunk_deser", chunk_deserialize_threads,
+                                                     std::numeric_limits<uint32_t>::max());
+
     // The _load_rpc_pool now handles routine load RPC and table function RPC.
     RETURN_IF_ERROR(ThreadPoolBuilder("load_rpc") // thread pool for load rpc
                             .set_min_threads(10)
@@ -434,6 +442,11 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                                         std::make_unique<workgroup::WorkGroupScanTaskQueue>(
                                                 workgroup::WorkGroupScanTaskQueue::SchedEntityType::CONNECTOR));
     _connector_scan_executor->initialize(connector_num_io_threads);
+    _connector_scan_executor_tuner =
+            new workgroup::ScanExecutorTuner("con_scan_tuner", _connector_scan_executor, connector_num_io_threads);
+    _connector_scan_executor_tuner->start();
+    REGISTER_GAUGE_STARROCKS_METRIC(pipe_connector_scan_executor_threads,
+                                    [this]() { return _connector_scan_executor_tuner->current_threads(); })
 
     workgroup::DefaultWorkGroupInitialization default_workgroup_init;
 
@@ -503,6 +516,10 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                                                  std::make_unique<workgroup::WorkGroupScanTaskQueue>(
                                                          workgroup::WorkGroupScanTaskQueue::SchedEntityType::OLAP));
     _scan_executor->initialize(num_io_threads);
+    _scan_executor_tuner = new workgroup::ScanExecutorTuner("scan_tuner", _scan_executor, num_io_threads);
+    _scan_executor_tuner->start();
+    REGISTER_GAUGE_STARROCKS_METRIC(pipe_scan_executor_threads,
+                                    [this]() { return _scan_executor_tuner->current_threads(); })
     // it means acting as compute node while store_path is empty. some threads are not needed for that case.
     Status status = _load_path_mgr->init();
     if (!status.ok()) {
@@ -619,10 +636,22 @@ void ExecEnv::stop() {
         _query_rpc_pool->shutdown();
     }
 
+    if (_chunk_deserialize_pool) {
+        _chunk_deserialize_pool->shutdown();
+    }
+
     if (_load_rpc_pool) {
         _load_rpc_pool->shutdown();
     }
 
+    if (_scan_executor_tuner) {
+        _scan_executor_tuner->stop();
+    }
+
+    if (_connector_scan_executor_tuner) {
+        _connector_scan_executor_tuner->stop();
+    }
+
     if (_scan_executor) {
         _scan_executor->close();
     }
@@ -682,7 +711,10 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_pipeline_prepare_pool);
     SAFE_DELETE(_pipeline_sink_io_pool);
     SAFE_DELETE(_query_rpc_pool);
+    SAFE_DELETE(_chunk_deserialize_pool);
     _load_rpc_pool.reset();
+    SAFE_DELETE(_scan_executor_tuner);
+    SAFE_DELETE(_connector_scan_executor_tuner);
     SAFE_DELETE(_scan_executor);
     SAFE_DELETE(_connector_scan_executor);
     SAFE_DELETE(_thread_pool);
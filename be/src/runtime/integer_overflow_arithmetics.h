@@ -17,6 +17,8 @@
 #include <runtime/int128_arithmetics_x86_64.h>
 #include <util/decimal_types.h>
 
+#include "types/int256.h"
+
 namespace starrocks {
 typedef __int128 int128_t;
 template <typename T>
@@ -143,4 +145,19 @@ inline bool mul_overflow(int128_t a, int128_t b, int128_t* c) {
 #endif
 }
 
+template <>
+inline bool add_overflow(int256_t a, int256_t b, int256_t* c) {
+    return int256_add_overflow(a, b, c);
+}
+
+template <>
+inline bool sub_overflow(int256_t a, int256_t b, int256_t* c) {
+    return int256_sub_overflow(a, b, c);
+}
+
+template <>
+inline bool mul_overflow(int256_t a, int256_t b, int256_t* c) {
+    return int256_mul_overflow(a, b, c);
+}
+
 } // namespace starrocks
@@ -16,8 +16,10 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <numeric>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -25,6 +27,8 @@
 #include "column/chunk.h"
 #include "common/closure_guard.h"
 #include "common/statusor.h"
+#include "exec/sorting/sort_permute.h"
+#include "exec/sorting/sorting.h"
 #include "exec/tablet_info.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "gutil/ref_counted.h"
@@ -266,6 +270,7 @@ void LocalTabletsChannel::add_chunk(Chunk* chunk, const PTabletWriterAddChunkReq
         req.chunk = chunk;
         req.indexes = row_indexes + from;
         req.indexes_size = size;
+        req.presorted = context->_presorted;
         req.commit_after_write = false;
 
         // The reference count of context is increased in the constructor of WriteCallback
@@ -689,6 +694,30 @@ Status LocalTabletsChannel::_open_all_writers(const PTabletWriterOpenRequest& pa
     for (size_t i = 0; i < tablet_ids.size(); ++i) {
         _tablet_id_to_sorted_indexes.emplace(tablet_ids[i], i);
     }
+    if (config::enable_load_channel_presort && !_delta_writers.empty()) {
+        // Sort every incoming chunk once by the sort key before splitting it into per-tablet
+        // slices, instead of letting each memtable sort its own small buffer. Only duplicate-key
+        // tables profit: their memtables keep the insertion order, so the presorted slices stay
+        // sorted runs that finalize merges instead of re-sorting (see MemTable::insert).
+        const Tablet* any_tablet = _delta_writers.begin()->second->tablet();
+        if (any_tablet != nullptr && any_tablet->keys_type() == KeysType::DUP_KEYS) {
+            const auto& tablet_schema = any_tablet->tablet_schema();
+            std::vector<ColumnId> sort_key_idxes = tablet_schema->sort_key_idxes();
+            if (sort_key_idxes.empty()) {
+                sort_key_idxes.resize(tablet_schema->num_key_columns());
+                std::iota(sort_key_idxes.begin(), sort_key_idxes.end(), 0);
+            }
+            // The i-th slot feeds the i-th column of the memtable schema, skip the presort if
+            // some sort key column is not filled by this load (e.g. schema change).
+            bool mappable = std::all_of(sort_key_idxes.begin(), sort_key_idxes.end(),
+                                        [&](ColumnId idx) { return idx < index_slots->size(); });
+            if (mappable) {
+                for (auto idx : sort_key_idxes) {
+                    _presort_slots.push_back((*index_slots)[idx]);
+                }
+            }
+        }
+    }
     if (_is_replicated_storage) {
         std::stringstream ss;
         ss << "LocalTabletsChannel txn_id: " << _txn_id << " load_id: " << print_id(params.id()) << " open "
@@ -774,6 +803,22 @@ StatusOr<std::shared_ptr<LocalTabletsChannel::WriteContext>> LocalTabletsChannel
     context->_row_indexes = std::make_unique<uint32_t[]>(chunk->num_rows());
     context->_channel_row_idx_start_points = std::make_unique<uint32_t[]>(channel_size + 1);
 
+    // One shared sort by the sort key for all tablets: the tablet split below is a stable
+    // counting sort, so walking the rows in key order leaves every per-tablet slice in
+    // (tablet, key) order.
+    SmallPermutation sort_perm;
+    if (!_presort_slots.empty() && chunk->num_rows() > 0) {
+        Columns orderby;
+        orderby.reserve(_presort_slots.size());
+        for (auto* slot : _presort_slots) {
+            orderby.push_back(chunk->get_column_by_slot_id(slot->id()));
+        }
+        sort_perm = create_small_permutation(chunk->num_rows());
+        RETURN_IF_ERROR(
+                stable_sort_and_tie_columns(false, orderby, SortDescs::asc_null_first(orderby.size()), &sort_perm));
+        context->_presorted = true;
+    }
+
     auto& row_indexes = context->_row_indexes;
     auto& channel_row_idx_start_points = context->_channel_row_idx_start_points;
 
@@ -791,13 +836,14 @@ StatusOr<std::shared_ptr<LocalTabletsChannel::WriteContext>> LocalTabletsChannel
     auto tablet_ids = request.tablet_ids().data();
     auto tablet_ids_size = request.tablet_ids_size();
     for (int i = tablet_ids_size - 1; i >= 0; --i) {
-        const auto& tablet_id = tablet_ids[i];
+        uint32_t row = context->_presorted ? sort_perm[i].index_in_chunk : static_cast<uint32_t>(i);
+        const auto& tablet_id = tablet_ids[row];
         auto it = _tablet_id_to_sorted_indexes.find(tablet_id);
         if (UNLIKELY(it == _tablet_id_to_sorted_indexes.end())) {
             return Status::InternalError("invalid tablet id");
         }
         uint32_t channel_index = it->second;
-        row_indexes[channel_row_idx_start_points[channel_index] - 1] = i;
+        row_indexes[channel_row_idx_start_points[channel_index] - 1] = row;
         channel_row_idx_start_points[channel_index]--;
     }
     return std::move(context);
@@ -143,6 +143,8 @@ private:
         Chunk _chunk;
         std::unique_ptr<uint32_t[]> _row_indexes;
         std::unique_ptr<uint32_t[]> _channel_row_idx_start_points;
+        // true iff every per-tablet slice of _row_indexes is in sort-key order.
+        bool _presorted = false;
         std::unordered_map<int64_t, std::vector<int64_t>>* _node_id_to_abort_tablets;
     };
 
@@ -206,6 +208,11 @@ private:
     // tablet_id -> TabletChannel
     std::unordered_map<int64_t, std::unique_ptr<AsyncDeltaWriter>> _delta_writers;
 
+    // Slots of the sort key columns, in sort-key order. Non-empty iff incoming chunks are
+    // sorted once by the channel before they are split into per-tablet slices, so every
+    // memtable receives sorted runs (see config::enable_load_channel_presort).
+    std::vector<SlotDescriptor*> _presort_slots;
+
     GlobalDictByNameMaps _global_dicts;
     std::unique_ptr<MemPool> _mem_pool;
 
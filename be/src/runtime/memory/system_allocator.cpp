@@ -41,6 +41,7 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "runtime/mem_tracker.h"
+#include "util/hugepage.h"
 
 namespace starrocks {
 
@@ -85,6 +86,7 @@ uint8_t* SystemAllocator::allocate_via_mmap(MemTracker* mem_tracker, size_t leng
         PLOG(ERROR) << "fail to allocate memory via mmap";
         return nullptr;
     }
+    advise_huge_pages(ptr, length);
     if (mem_tracker != nullptr) {
         mem_tracker->consume(length);
     }
@@ -805,21 +805,26 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
             *done = nullptr;
         }
 
+        // Account for the whole batch up front so the enqueue loop below only touches
+        // the per-driver-sequence lock-free queues. Updating these receiver-wide atomics
+        // once per chunk made brpc threads of high-fanin exchanges ping-pong the same
+        // cache lines. short_circuit() may drain some of the chunks right after they are
+        // enqueued, and it decrements the counters per drained item, so counting the
+        // batch before the loop keeps the accounting consistent.
+        _total_chunks += chunks.size();
+        _recvr->_num_buffered_bytes += total_chunk_bytes;
+        COUNTER_ADD(metrics.peak_buffer_mem_bytes, total_chunk_bytes);
         for (auto& chunk : chunks) {
             int index = _is_pipeline_level_shuffle ? chunk.driver_sequence : 0;
-            size_t chunk_bytes = chunk.chunk_bytes;
             auto* closure = chunk.closure;
             _chunk_queues[index].enqueue(std::move(chunk));
             _chunk_queue_states[index].blocked_closure_num += closure != nullptr;
-            _total_chunks++;
             // Double check here for short circuit compatibility without introducing a critical section
             if (_chunk_queue_states[index].is_short_circuited.load(std::memory_order_relaxed)) {
                 short_circuit(index);
                 // We cannot early-return for short circuit, it may occur for parts of parallelism,
                 // and the other parallelism may need to proceed.
             }
-            _recvr->_num_buffered_bytes += chunk_bytes;
-            COUNTER_ADD(metrics.peak_buffer_mem_bytes, chunk_bytes);
         }
     }
 
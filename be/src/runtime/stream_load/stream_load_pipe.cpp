@@ -80,6 +80,41 @@ Status StreamLoadPipe::append(const char* data, size_t size) {
     return Status::OK();
 }
 
+Status StreamLoadPipe::skip(size_t count) {
+    while (count > 0) {
+        if (_read_buf == nullptr || !_read_buf->has_remaining()) {
+            std::unique_lock<std::mutex> l(_lock);
+            if (_non_blocking_read) {
+                _get_cond.wait_for(l, std::chrono::milliseconds(100),
+                                   [&]() { return _cancelled || _finished || !_buf_queue.empty(); });
+            } else {
+                _get_cond.wait(l, [&]() { return _cancelled || _finished || !_buf_queue.empty(); });
+            }
+            // cancelled
+            if (_cancelled) {
+                return _err_st;
+            }
+            if (_buf_queue.empty()) {
+                if (_finished) {
+                    return Status::OK();
+                }
+                return Status::TimedOut("stream load pipe time out");
+            }
+            _read_buf = _buf_queue.front();
+            _buf_queue.pop_front();
+        }
+
+        size_t skip_size = std::min(count, _read_buf->remaining());
+        _read_buf->pos += skip_size;
+        count -= skip_size;
+        if (!_read_buf->has_remaining()) {
+            _buffered_bytes -= _read_buf->limit;
+            _put_cond.notify_one();
+        }
+    }
+    return Status::OK();
+}
+
 StatusOr<ByteBufferPtr> StreamLoadPipe::read() {
     if (_non_blocking_read) {
         return no_block_read();
@@ -294,15 +329,7 @@ StatusOr<int64_t> StreamLoadPipeInputStream::read(void* data, int64_t size) {
 }
 
 Status StreamLoadPipeInputStream::skip(int64_t n) {
-    std::unique_ptr<char[]> buf(new char[n]);
-    do {
-        ASSIGN_OR_RETURN(auto r, read(buf.get(), n));
-        if (r == 0) {
-            break;
-        }
-        n -= r;
-    } while (n > 0);
-    return Status::OK();
+    return _pipe->skip(n);
 }
 
 } // namespace starrocks
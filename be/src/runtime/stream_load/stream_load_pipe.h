@@ -70,6 +70,10 @@ public:
 
     Status no_block_read(uint8_t* data, size_t* data_size, bool* eof);
 
+    // Drop the next |count| bytes without copying them out. Returns OK when the pipe
+    // finishes before |count| bytes are consumed.
+    Status skip(size_t count);
+
     // called when consumer finished
     void close() { cancel(Status::OK()); }
 
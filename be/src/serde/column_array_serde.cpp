@@ -20,6 +20,8 @@
 #include <streamvbyte.h>
 #include <streamvbytedelta.h>
 
+#include <string_view>
+
 #include "column/array_column.h"
 #include "column/binary_column.h"
 #include "column/column_visitor_adapter.h"
@@ -37,6 +39,7 @@
 #include "types/hll.h"
 #include "util/coding.h"
 #include "util/json.h"
+#include "util/phmap/phmap.h"
 #include "util/percentile_value.h"
 
 namespace starrocks::serde {
@@ -130,6 +133,53 @@ uint8_t* encode_string_lz4(const void* data, size_t size, uint8_t* buff, int enc
     return buff + encode_size;
 }
 
+// tags for the string payload when dictionary encoding is enabled, so the decoder knows
+// whether the chunk actually got a dictionary or fell back to lz4
+constexpr uint8_t kStringEncodeLz4 = 0;
+constexpr uint8_t kStringEncodeDict = 1;
+
+// dictionary-encode the string payload of a low-cardinality chunk: ship the distinct
+// values once plus a streamvbyte-packed code per row instead of the full byte blob.
+// Bail out to lz4 when the chunk does not look low-cardinality.
+template <typename T>
+uint8_t* encode_string_dict(const BinaryColumnBase<T>& column, uint8_t* buff, int encode_level) {
+    const auto& bytes = column.get_bytes();
+    const size_t num_rows = column.size();
+    // a dictionary only pays off when values repeat a lot, cap its size accordingly
+    const size_t max_dict_size = std::min<size_t>(num_rows / 4 + 1, 65535);
+    phmap::flat_hash_map<std::string_view, uint32_t> dict;
+    std::vector<uint32_t> codes(num_rows);
+    bool low_cardinality = true;
+    for (size_t i = 0; i < num_rows; ++i) {
+        auto slice = column.get_slice(i);
+        auto [iter, inserted] = dict.try_emplace(std::string_view(slice.data, slice.size), dict.size());
+        if (inserted && dict.size() > max_dict_size) {
+            low_cardinality = false;
+            break;
+        }
+        codes[i] = iter->second;
+    }
+    if (!low_cardinality) {
+        *buff++ = kStringEncodeLz4;
+        return encode_string_lz4(bytes.data(), bytes.size(), buff, encode_level);
+    }
+    *buff++ = kStringEncodeDict;
+    std::vector<std::string_view> entries(dict.size());
+    for (const auto& [value, code] : dict) {
+        entries[code] = value;
+    }
+    buff = write_little_endian_32(entries.size(), buff);
+    for (const auto& entry : entries) {
+        buff = write_little_endian_32(entry.size(), buff);
+    }
+    for (const auto& entry : entries) {
+        buff = write_raw(entry.data(), entry.size(), buff);
+    }
+    buff = write_little_endian_32(num_rows, buff);
+    buff = encode_integers<false>(codes.data(), num_rows * sizeof(uint32_t), buff, encode_level);
+    return buff;
+}
+
 const uint8_t* decode_string_lz4(const uint8_t* buff, void* target, size_t size) {
     uint64_t encode_size = 0;
     buff = read_little_endian_64(buff, &encode_size);
@@ -147,6 +197,45 @@ const uint8_t* decode_string_lz4(const uint8_t* buff, void* target, size_t size)
     return buff + encode_size;
 }
 
+// rebuild the raw byte blob of a dictionary-encoded string payload. |bytes_size| is the
+// expected size of the rebuilt blob, already read from the stream header
+template <typename T>
+const uint8_t* decode_string_dict(const uint8_t* buff, BinaryColumnBase<T>* column, size_t bytes_size) {
+    uint32_t dict_nums = 0;
+    buff = read_little_endian_32(buff, &dict_nums);
+    std::vector<uint32_t> entry_sizes(dict_nums);
+    for (uint32_t i = 0; i < dict_nums; ++i) {
+        buff = read_little_endian_32(buff, &entry_sizes[i]);
+    }
+    std::vector<const uint8_t*> entry_data(dict_nums);
+    for (uint32_t i = 0; i < dict_nums; ++i) {
+        entry_data[i] = buff;
+        buff += entry_sizes[i];
+    }
+    uint32_t num_rows = 0;
+    buff = read_little_endian_32(buff, &num_rows);
+    std::vector<uint32_t> codes;
+    raw::make_room(&codes, num_rows);
+    buff = decode_integers<false>(buff, codes.data(), num_rows * sizeof(uint32_t));
+    auto* target = column->get_bytes().data();
+    size_t decode_size = 0;
+    for (uint32_t i = 0; i < num_rows; ++i) {
+        uint32_t code = codes[i];
+        if (code >= dict_nums || decode_size + entry_sizes[code] > bytes_size) {
+            throw std::runtime_error(fmt::format("invalid dictionary code {} while decoding, dict size = {}.", code,
+                                                 (uint32_t)dict_nums));
+        }
+        strings::memcpy_inlined(target + decode_size, entry_data[code], entry_sizes[code]);
+        decode_size += entry_sizes[code];
+    }
+    if (decode_size != bytes_size) {
+        throw std::runtime_error(fmt::format(
+                "dictionary encode size does not equal when decoding, expect size = {}, but decode get size = {}.",
+                bytes_size, decode_size));
+    }
+    return buff;
+}
+
 template <typename T, bool sorted>
 class FixedLengthColumnSerde {
 public:
@@ -207,7 +296,15 @@ public:
         } else {
             res += offsets_size;
         }
-        if (EncodeContext::enable_encode_string(encode_level) && bytes.size() >= ENCODE_SIZE_LIMIT) {
+        if (EncodeContext::enable_encode_string_dict(encode_level) && bytes.size() >= ENCODE_SIZE_LIMIT) {
+            size_t num_rows = column.size();
+            int64_t lz4_bound =
+                    sizeof(uint64_t) + std::max((int64_t)bytes.size(), (int64_t)LZ4_compressBound(bytes.size()));
+            int64_t dict_bound = (int64_t)(2 * sizeof(uint32_t) + (num_rows + 1) * sizeof(uint32_t) + bytes.size() +
+                                           sizeof(uint64_t) +
+                                           streamvbyte_max_compressedbytes(upper_int32(num_rows * sizeof(uint32_t))));
+            res += 1 + std::max(lz4_bound, dict_bound);
+        } else if (EncodeContext::enable_encode_string(encode_level) && bytes.size() >= ENCODE_SIZE_LIMIT) {
             res += sizeof(uint64_t) + std::max((int64_t)bytes.size(), (int64_t)LZ4_compressBound(bytes.size()));
         } else {
             res += bytes.size();
@@ -226,7 +323,9 @@ public:
         } else {
             buff = write_little_endian_64(bytes_size, buff);
         }
-        if (EncodeContext::enable_encode_string(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT) {
+        if (EncodeContext::enable_encode_string_dict(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT) {
+            buff = encode_string_dict(column, buff, encode_level);
+        } else if (EncodeContext::enable_encode_string(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT) {
             buff = encode_string_lz4(bytes.data(), bytes_size, buff, encode_level);
         } else {
             buff = write_raw(bytes.data(), bytes_size, buff);
@@ -260,7 +359,14 @@ public:
             buff = read_little_endian_64(buff, &bytes_size);
         }
         column->get_bytes().resize(bytes_size);
-        if (EncodeContext::enable_encode_string(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT) {
+        if (EncodeContext::enable_encode_string_dict(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT) {
+            uint8_t tag = *buff++;
+            if (tag == kStringEncodeDict) {
+                buff = decode_string_dict(buff, column, bytes_size);
+            } else {
+                buff = decode_string_lz4(buff, column->get_bytes().data(), bytes_size);
+            }
+        } else if (EncodeContext::enable_encode_string(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT) {
             buff = decode_string_lz4(buff, column->get_bytes().data(), bytes_size);
         } else {
             buff = read_raw(buff, column->get_bytes().data(), bytes_size);
@@ -61,9 +61,12 @@ public:
 
     static bool enable_encode_string(const int encode_level) { return encode_level & ENCODE_STRING; }
 
+    static bool enable_encode_string_dict(const int encode_level) { return encode_level & ENCODE_STRING_DICT; }
+
 private:
     static constexpr int ENCODE_INTEGER = 2;
     static constexpr int ENCODE_STRING = 4;
+    static constexpr int ENCODE_STRING_DICT = 8;
 
     // if encode ratio < EncodeRatioLimit, encode it, otherwise not.
     void _adjust(const int col_id);
@@ -18,12 +18,17 @@
 
 #include "column/chunk_extra_data.h"
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "serde/column_array_serde.h"
 #include "storage/chunk_helper.h"
 #include "util/coding.h"
+#include "util/countdown_latch.h"
+#include "util/cpu_info.h"
+#include "util/priority_thread_pool.hpp"
 #include "util/raw_container.h"
 
 namespace starrocks::serde {
@@ -43,8 +48,9 @@ int64_t ProtobufChunkSerde::max_serialized_size(const Chunk& chunk, const std::s
     return serialized_size;
 }
 
-StatusOr<ChunkPB> ProtobufChunkSerde::serialize(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context) {
-    StatusOr<ChunkPB> res = serialize_without_meta(chunk, std::move(context));
+StatusOr<ChunkPB> ProtobufChunkSerde::serialize(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context,
+                                                DetachedChunkPayload* payload) {
+    StatusOr<ChunkPB> res = serialize_without_meta(chunk, std::move(context), payload);
     if (!res.ok()) return res.status();
 
     const auto& slot_id_to_index = chunk.get_slot_id_to_index_map();
@@ -84,31 +90,26 @@ StatusOr<ChunkPB> ProtobufChunkSerde::serialize(const Chunk& chunk, const std::s
     return res;
 }
 
-StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const Chunk& chunk,
-                                                             const std::shared_ptr<EncodeContext>& context) {
-    ChunkPB chunk_pb;
-    chunk_pb.set_compress_type(CompressionTypePB::NO_COMPRESSION);
-
-    std::string* serialized_data = chunk_pb.mutable_data();
-    auto max_serialized_size = ProtobufChunkSerde::max_serialized_size(chunk, context);
-    auto* chunk_extra_data =
-            chunk.get_extra_data() ? dynamic_cast<ChunkExtraColumnsData*>(chunk.get_extra_data().get()) : nullptr;
-    if (chunk_extra_data) {
-        max_serialized_size += chunk_extra_data->max_serialized_size(0);
-    }
-    raw::stl_string_resize_uninitialized(serialized_data, max_serialized_size);
-    auto* buff = reinterpret_cast<uint8_t*>(serialized_data->data());
+namespace {
+// Write the payload of |chunk| into |buff| and fill the size fields of |chunk_pb|.
+// Returns the payload size, including the padding streamvbyte may read past the end.
+StatusOr<int64_t> serialize_chunk_payload(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context,
+                                          uint8_t* buff, ChunkExtraColumnsData* chunk_extra_data, ChunkPB* chunk_pb) {
+    const auto* head = buff;
     encode_fixed32_le(buff + 0, 1);
     encode_fixed32_le(buff + 4, chunk.num_rows());
     buff = buff + 8;
 
     int padding_size = 0; // as streamvbyte may read up to 16 extra bytes from the input.
+    chunk_pb->mutable_column_offsets()->Reserve(static_cast<int>(chunk.columns().size()));
     if (context == nullptr) {
         for (auto i = 0; i < chunk.columns().size(); ++i) {
+            chunk_pb->add_column_offsets(buff - head);
             buff = ColumnArraySerde::serialize(*chunk.columns()[i], buff);
         }
     } else {
         for (auto i = 0; i < chunk.columns().size(); ++i) {
+            chunk_pb->add_column_offsets(buff - head);
             auto buff_begin = buff;
             buff = ColumnArraySerde::serialize(*chunk.columns()[i], buff, false, context->get_encode_level(i));
             if (UNLIKELY(buff == nullptr)) return Status::InternalError("has unsupported column");
@@ -123,14 +124,41 @@ StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const Chunk& chunk,
     if (chunk_extra_data) {
         buff = chunk_extra_data->serialize(buff);
     }
-    chunk_pb.set_serialized_size(buff - reinterpret_cast<const uint8_t*>(serialized_data->data()));
-    serialized_data->resize(chunk_pb.serialized_size() + padding_size);
-    chunk_pb.set_uncompressed_size(serialized_data->size());
+    chunk_pb->set_serialized_size(buff - head);
+    chunk_pb->set_uncompressed_size(chunk_pb->serialized_size() + padding_size);
     if (context) {
         VLOG_ROW << "pb serialize data, memory bytes = " << chunk.bytes_usage()
-                 << " serialized size = " << chunk_pb.serialized_size()
-                 << " uncompressed size = " << chunk_pb.uncompressed_size()
-                 << " serialize ratio = " << chunk_pb.serialized_size() * 1.0 / chunk.bytes_usage();
+                 << " serialized size = " << chunk_pb->serialized_size()
+                 << " uncompressed size = " << chunk_pb->uncompressed_size()
+                 << " serialize ratio = " << chunk_pb->serialized_size() * 1.0 / chunk.bytes_usage();
+    }
+    return chunk_pb->serialized_size() + padding_size;
+}
+} // namespace
+
+StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const Chunk& chunk,
+                                                             const std::shared_ptr<EncodeContext>& context,
+                                                             DetachedChunkPayload* payload) {
+    ChunkPB chunk_pb;
+    chunk_pb.set_compress_type(CompressionTypePB::NO_COMPRESSION);
+
+    auto max_serialized_size = ProtobufChunkSerde::max_serialized_size(chunk, context);
+    auto* chunk_extra_data =
+            chunk.get_extra_data() ? dynamic_cast<ChunkExtraColumnsData*>(chunk.get_extra_data().get()) : nullptr;
+    if (chunk_extra_data) {
+        max_serialized_size += chunk_extra_data->max_serialized_size(0);
+    }
+    if (payload != nullptr) {
+        payload->data.reset(new uint8_t[max_serialized_size]);
+        ASSIGN_OR_RETURN(payload->size,
+                         serialize_chunk_payload(chunk, context, payload->data.get(), chunk_extra_data, &chunk_pb));
+    } else {
+        std::string* serialized_data = chunk_pb.mutable_data();
+        raw::stl_string_resize_uninitialized(serialized_data, max_serialized_size);
+        ASSIGN_OR_RETURN(int64_t payload_size,
+                         serialize_chunk_payload(chunk, context, reinterpret_cast<uint8_t*>(serialized_data->data()),
+                                                 chunk_extra_data, &chunk_pb));
+        serialized_data->resize(payload_size);
     }
     return std::move(chunk_pb);
 }
@@ -225,7 +253,13 @@ StatusOr<Chunk> ProtobufChunkDeserializer::deserialize(std::string_view buff, in
         columns[i] = ColumnHelper::create_column(_meta.types[i], _meta.is_nulls[i], _meta.is_consts[i], rows);
     }
 
-    if (_encode_level.empty()) {
+    const int64_t parallel_min_bytes = config::parallel_chunk_deserialize_min_bytes;
+    const bool parallel = parallel_min_bytes > 0 && static_cast<int64_t>(buff.size()) >= parallel_min_bytes &&
+                          columns.size() > 1 && _column_offsets.size() == columns.size() &&
+                          ExecEnv::GetInstance()->chunk_deserialize_pool() != nullptr;
+    if (parallel) {
+        ASSIGN_OR_RETURN(cur, _deserialize_columns_in_parallel(buff, columns));
+    } else if (_encode_level.empty()) {
         for (auto& column : columns) {
             cur = ColumnArraySerde::deserialize(cur, column.get());
         }
@@ -277,6 +311,95 @@ StatusOr<Chunk> ProtobufChunkDeserializer::deserialize(std::string_view buff, in
     return Chunk(std::move(columns), _meta.slot_id_to_index, std::move(chunk_extra_data));
 }
 
+// Split the columns into contiguous ranges balanced by serialized bytes and deserialize the
+// ranges on the chunk deserialize pool, the caller thread takes the first range and runs any
+// range the pool rejects. Returns the position right after the last column, where the extra
+// data (if any) begins.
+StatusOr<const uint8_t*> ProtobufChunkDeserializer::_deserialize_columns_in_parallel(std::string_view buff,
+                                                                                     std::vector<ColumnPtr>& columns) {
+    const auto* base = reinterpret_cast<const uint8_t*>(buff.data());
+    const size_t num_columns = columns.size();
+    DCHECK_EQ(num_columns, _column_offsets.size());
+
+    int64_t prev_offset = 8; // the version and row count fields.
+    for (int64_t offset : _column_offsets) {
+        if (UNLIKELY(offset < prev_offset || offset > static_cast<int64_t>(buff.size()))) {
+            return Status::Corruption(fmt::format("invalid column offset: {}", offset));
+        }
+        prev_offset = offset;
+    }
+
+    size_t max_tasks = config::chunk_deserialize_thread_num > 0 ? config::chunk_deserialize_thread_num
+                                                                : CpuInfo::num_cores();
+    max_tasks = std::min(max_tasks, num_columns);
+    const int64_t total_bytes = static_cast<int64_t>(buff.size()) - _column_offsets[0];
+    const int64_t bytes_per_task = (total_bytes + max_tasks - 1) / max_tasks;
+
+    struct ColumnRange {
+        size_t first_column;
+        size_t end_column;
+        const uint8_t* end_ptr = nullptr;
+        Status status;
+    };
+    std::vector<ColumnRange> ranges;
+    for (size_t begin = 0; begin < num_columns;) {
+        size_t end = begin + 1;
+        while (end < num_columns && _column_offsets[end] - _column_offsets[begin] < bytes_per_task) {
+            ++end;
+        }
+        ranges.push_back({begin, end});
+        begin = end;
+    }
+
+    auto deserialize_range = [&](ColumnRange& range) -> Status {
+        TRY_CATCH_ALLOC_SCOPE_START()
+        const uint8_t* p = base + _column_offsets[range.first_column];
+        for (size_t i = range.first_column; i < range.end_column; ++i) {
+            if (_encode_level.empty()) {
+                p = ColumnArraySerde::deserialize(p, columns[i].get());
+            } else {
+                p = ColumnArraySerde::deserialize(p, columns[i].get(), false, _encode_level[i]);
+            }
+            if (UNLIKELY(p == nullptr)) {
+                return Status::Corruption("has unsupported column");
+            }
+        }
+        range.end_ptr = p;
+        return Status::OK();
+        TRY_CATCH_ALLOC_SCOPE_END()
+    };
+
+    auto* pool = ExecEnv::GetInstance()->chunk_deserialize_pool();
+    auto* mem_tracker = CurrentThread::mem_tracker();
+    CountDownLatch latch(static_cast<int>(ranges.size()) - 1);
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        bool offered = pool->try_offer([&, i] {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            ranges[i].status = deserialize_range(ranges[i]);
+            latch.count_down();
+        });
+        if (!offered) {
+            ranges[i].status = deserialize_range(ranges[i]);
+            latch.count_down();
+        }
+    }
+    ranges[0].status = deserialize_range(ranges[0]);
+    latch.wait();
+
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        RETURN_IF_ERROR(ranges[i].status);
+        // Every range must stop exactly where the next one starts, otherwise the payload
+        // and the offsets disagree and the deserialized columns are garbage.
+        const uint8_t* expected_end = i + 1 < ranges.size() ? base + _column_offsets[ranges[i + 1].first_column]
+                                                            : ranges[i].end_ptr;
+        if (UNLIKELY(ranges[i].end_ptr != expected_end)) {
+            return Status::Corruption(
+                    fmt::format("column offsets mismatch the deserialized size at column {}", ranges[i].first_column));
+        }
+    }
+    return ranges.back().end_ptr;
+}
+
 StatusOr<ProtobufChunkMeta> build_protobuf_chunk_meta(const RowDescriptor& row_desc, const ChunkPB& chunk_pb) {
     ProtobufChunkMeta chunk_meta;
     if (UNLIKELY(chunk_pb.is_nulls().empty() || chunk_pb.slot_id_map().empty())) {
@@ -16,6 +16,7 @@
 
 #include <streamvbyte.h>
 
+#include <memory>
 #include <string_view>
 #include <vector>
 
@@ -33,12 +34,23 @@ namespace starrocks::serde {
 
 class ProtobufChunkDeserializer;
 
+// A serialized chunk payload held outside ChunkPB.data, so senders can hand it over to an
+// iobuf without copying it again. |data| is new[] allocated and |size| is the payload size,
+// which may be smaller than the allocated capacity.
+struct DetachedChunkPayload {
+    std::unique_ptr<uint8_t[]> data;
+    int64_t size = 0;
+};
+
 class ProtobufChunkSerde {
 public:
     static int64_t max_serialized_size(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context = nullptr);
 
-    // Write the contents of |chunk| to ChunkPB
-    static StatusOr<ChunkPB> serialize(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context = nullptr);
+    // Write the contents of |chunk| to ChunkPB.
+    // If |payload| is not null the serialized bytes are written into it instead of
+    // ChunkPB.data, which is left empty.
+    static StatusOr<ChunkPB> serialize(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context = nullptr,
+                                       DetachedChunkPayload* payload = nullptr);
 
     // Like `serialize()` but leave the following fields of ChunkPB unfilled:
     //  - slot_id_map()
@@ -46,7 +58,8 @@ public:
     //  - is_nulls()
     //  - is_consts()
     static StatusOr<ChunkPB> serialize_without_meta(const Chunk& chunk,
-                                                    const std::shared_ptr<EncodeContext>& context = nullptr);
+                                                    const std::shared_ptr<EncodeContext>& context = nullptr,
+                                                    DetachedChunkPayload* payload = nullptr);
 
     // REQUIRE: the following fields of |chunk_pb| must be non-empty:
     //  - slot_id_map()
@@ -79,13 +92,20 @@ public:
                 _encode_level.emplace_back(pb->encode_level(i));
             }
         }
+        // Old senders do not fill column_offsets, the columns are then deserialized sequentially.
+        if (pb != nullptr) {
+            _column_offsets.assign(pb->column_offsets().begin(), pb->column_offsets().end());
+        }
     }
 
     StatusOr<Chunk> deserialize(std::string_view buff, int64_t* deserialized_bytes = nullptr);
 
 private:
+    StatusOr<const uint8_t*> _deserialize_columns_in_parallel(std::string_view buff, std::vector<ColumnPtr>& columns);
+
     const ProtobufChunkMeta& _meta;
     std::vector<int> _encode_level;
+    std::vector<int64_t> _column_offsets;
 };
 
 StatusOr<Chunk> deserialize_chunk_pb_with_schema(const Schema& schema, std::string_view buff);
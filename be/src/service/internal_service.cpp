@@ -93,7 +93,23 @@ using PromiseStatus = std::promise<Status>;
 using PromiseStatusSharedPtr = std::shared_ptr<PromiseStatus>;
 
 template <typename T>
-PInternalServiceImplBase<T>::PInternalServiceImplBase(ExecEnv* exec_env) : _exec_env(exec_env) {}
+PInternalServiceImplBase<T>::PInternalServiceImplBase(ExecEnv* exec_env)
+        : _exec_env(exec_env), _query_rpc_delay_tracker(config::rpc_admission_interval_ms * 1000 * 1000) {}
+
+template <typename T>
+Status PInternalServiceImplBase<T>::_check_fragment_admission() {
+    if (!config::enable_rpc_admission_control) {
+        return Status::OK();
+    }
+    int64_t min_delay_ns = _query_rpc_delay_tracker.last_min_delay_ns(MonotonicNanos());
+    int64_t target_ns = config::rpc_admission_target_delay_ms * 1000 * 1000;
+    if (min_delay_ns <= target_ns) {
+        return Status::OK();
+    }
+    return Status::ServiceUnavailable(
+            fmt::format("fragment rejected by admission control: query rpc queue delay {}ms exceeds {}ms",
+                        min_delay_ns / 1000 / 1000, config::rpc_admission_target_delay_ms));
+}
 
 template <typename T>
 PInternalServiceImplBase<T>::~PInternalServiceImplBase() = default;
@@ -114,7 +130,12 @@ template <typename T>
 void PInternalServiceImplBase<T>::transmit_chunk(google::protobuf::RpcController* cntl_base,
                                                  const PTransmitChunkParams* request, PTransmitChunkResult* response,
                                                  google::protobuf::Closure* done) {
-    auto task = [=]() { this->_transmit_chunk(cntl_base, request, response, done); };
+    const int64_t submit_ns = MonotonicNanos();
+    auto task = [=]() {
+        const int64_t now_ns = MonotonicNanos();
+        this->_query_rpc_delay_tracker.record(now_ns, now_ns - submit_ns);
+        this->_transmit_chunk(cntl_base, request, response, done);
+    };
     if (!_exec_env->query_rpc_pool()->try_offer(std::move(task))) {
         ClosureGuard closure_guard(done);
         Status::ServiceUnavailable("submit transmit_chunk task failed").to_protobuf(response->mutable_status());
@@ -283,7 +304,19 @@ void PInternalServiceImplBase<T>::exec_plan_fragment(google::protobuf::RpcContro
                                                      const PExecPlanFragmentRequest* request,
                                                      PExecPlanFragmentResult* response,
                                                      google::protobuf::Closure* done) {
-    auto task = [=]() { this->_exec_plan_fragment(cntl_base, request, response, done); };
+    // Shed new fragment starts first when the rpc pool falls behind: rejecting at admission
+    // keeps the chunks of already running queries flowing, transmit_chunk is never rejected.
+    if (Status st = _check_fragment_admission(); !st.ok()) {
+        ClosureGuard closure_guard(done);
+        st.to_protobuf(response->mutable_status());
+        return;
+    }
+    const int64_t submit_ns = MonotonicNanos();
+    auto task = [=]() {
+        const int64_t now_ns = MonotonicNanos();
+        this->_query_rpc_delay_tracker.record(now_ns, now_ns - submit_ns);
+        this->_exec_plan_fragment(cntl_base, request, response, done);
+    };
     if (!_exec_env->query_rpc_pool()->try_offer(std::move(task))) {
         ClosureGuard closure_guard(done);
         Status::ServiceUnavailable("submit exec_plan_fragment task failed").to_protobuf(response->mutable_status());
@@ -315,6 +348,11 @@ void PInternalServiceImplBase<T>::exec_batch_plan_fragments(google::protobuf::Rp
                                                             const PExecBatchPlanFragmentsRequest* request,
                                                             PExecBatchPlanFragmentsResult* response,
                                                             google::protobuf::Closure* done) {
+    if (Status st = _check_fragment_admission(); !st.ok()) {
+        ClosureGuard closure_guard(done);
+        st.to_protobuf(response->mutable_status());
+        return;
+    }
     auto task = [=]() { this->_exec_batch_plan_fragments(cntl_base, request, response, done); };
     if (!_exec_env->pipeline_prepare_pool()->try_offer(std::move(task))) {
         ClosureGuard closure_guard(done);
@@ -329,13 +367,24 @@ void PInternalServiceImplBase<T>::_exec_batch_plan_fragments(google::protobuf::R
                                                              google::protobuf::Closure* done) {
     ClosureGuard closure_guard(done);
     auto* cntl = static_cast<brpc::Controller*>(cntl_base);
-    auto ser_request = cntl->request_attachment().to_string();
     std::shared_ptr<TExecBatchPlanFragmentsParams> t_batch_requests = std::make_shared<TExecBatchPlanFragmentsParams>();
     {
-        const auto* buf = (const uint8_t*)ser_request.data();
-        uint32_t len = ser_request.size();
-        if (Status status = deserialize_thrift_msg(buf, &len, TProtocolType::BINARY, t_batch_requests.get());
-            !status.ok()) {
+        // the serialized plan dominates prepare time for short queries, so deserialize straight
+        // from the iobuf block when it is contiguous instead of copying the attachment into a string
+        Status status;
+        const butil::IOBuf& attachment = cntl->request_attachment();
+        if (attachment.backing_block_num() == 1) {
+            auto block = attachment.backing_block(0);
+            uint32_t len = block.size();
+            status = deserialize_thrift_msg((const uint8_t*)block.data(), &len, TProtocolType::BINARY,
+                                            t_batch_requests.get());
+        } else {
+            auto ser_request = attachment.to_string();
+            const auto* buf = (const uint8_t*)ser_request.data();
+            uint32_t len = ser_request.size();
+            status = deserialize_thrift_msg(buf, &len, TProtocolType::BINARY, t_batch_requests.get());
+        }
+        if (!status.ok()) {
             status.to_protobuf(response->mutable_status());
             return;
         }
@@ -398,12 +447,22 @@ void PInternalServiceImplBase<T>::tablet_writer_cancel(google::protobuf::RpcCont
 template <typename T>
 Status PInternalServiceImplBase<T>::_exec_plan_fragment(brpc::Controller* cntl,
                                                         const PExecPlanFragmentRequest* request) {
-    auto ser_request = cntl->request_attachment().to_string();
     TExecPlanFragmentParams t_request;
     {
-        const auto* buf = (const uint8_t*)ser_request.data();
-        uint32_t len = ser_request.size();
-        RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, request->attachment_protocol(), &t_request));
+        // the serialized plan dominates prepare time for short queries, so deserialize straight
+        // from the iobuf block when it is contiguous instead of copying the attachment into a string
+        const butil::IOBuf& attachment = cntl->request_attachment();
+        if (attachment.backing_block_num() == 1) {
+            auto block = attachment.backing_block(0);
+            uint32_t len = block.size();
+            RETURN_IF_ERROR(
+                    deserialize_thrift_msg((const uint8_t*)block.data(), &len, request->attachment_protocol(), &t_request));
+        } else {
+            auto ser_request = attachment.to_string();
+            const auto* buf = (const uint8_t*)ser_request.data();
+            uint32_t len = ser_request.size();
+            RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, request->attachment_protocol(), &t_request));
+        }
     }
     if (UNLIKELY(!t_request.query_options.__isset.batch_size)) {
         return Status::InvalidArgument("batch_size is not set");
@@ -1170,12 +1229,22 @@ void PInternalServiceImplBase<T>::list_fail_point(google::protobuf::RpcControlle
 template <typename T>
 Status PInternalServiceImplBase<T>::_exec_short_circuit(brpc::Controller* cntl, const PExecShortCircuitRequest* request,
                                                         PExecShortCircuitResult* response) {
-    auto ser_request = cntl->request_attachment().to_string();
     std::shared_ptr<TExecShortCircuitParams> t_requests = std::make_shared<TExecShortCircuitParams>();
     {
-        const auto* buf = (const uint8_t*)ser_request.data();
-        uint32_t len = ser_request.size();
-        RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, request->attachment_protocol(), t_requests.get()));
+        // point queries are latency sensitive, so deserialize straight from the iobuf
+        // block when it is contiguous instead of copying the attachment into a string
+        const butil::IOBuf& attachment = cntl->request_attachment();
+        if (attachment.backing_block_num() == 1) {
+            auto block = attachment.backing_block(0);
+            uint32_t len = block.size();
+            RETURN_IF_ERROR(deserialize_thrift_msg((const uint8_t*)block.data(), &len, request->attachment_protocol(),
+                                                   t_requests.get()));
+        } else {
+            auto ser_request = attachment.to_string();
+            const auto* buf = (const uint8_t*)ser_request.data();
+            uint32_t len = ser_request.size();
+            RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, request->attachment_protocol(), t_requests.get()));
+        }
     }
     ShortCircuitExecutor executor{_exec_env};
     RETURN_IF_ERROR(executor.prepare(*t_requests));
@@ -45,6 +45,7 @@
 #include "gen_cpp/internal_service.pb.h"
 #include "util/countdown_latch.h"
 #include "util/priority_thread_pool.hpp"
+#include "util/sojourn_delay_tracker.h"
 
 namespace brpc {
 class Controller;
@@ -219,7 +220,14 @@ private:
                                PExecShortCircuitResult* response);
 
 protected:
+    // Returns a non-OK status when new fragment executions should be rejected because the
+    // query rpc pool is persistently backlogged (see config::enable_rpc_admission_control).
+    Status _check_fragment_admission();
+
     ExecEnv* _exec_env;
+
+    // queueing delay of the query rpc pool, fed by transmit_chunk/exec_plan_fragment tasks
+    SojournDelayTracker _query_rpc_delay_tracker;
 };
 
 } // namespace starrocks
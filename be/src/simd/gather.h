@@ -58,6 +58,34 @@ struct SIMDGather {
             }
             _mm256_zeroupper();
         }
+#endif
+        for (; i < num_rows; i++) {
+            *b = a[*c];
+            b++;
+            c++;
+        }
+    }
+
+    // b[i] = a[c[i]];
+    // 32-bit table entries, e.g. dictionary string offsets.
+    template <class TB, class TC>
+    static void gather(TB* b, const TB* a, const TC* c, size_t buckets, int num_rows) {
+        static_assert(sizeof(TB) == 4);
+        static_assert(std::is_integral_v<TB>);
+        static_assert(sizeof(TC) == 4);
+        static_assert(std::is_integral_v<TC>);
+        int i = 0;
+#ifdef __AVX2__
+        if (buckets < max_process_size) {
+            for (; i + 8 <= num_rows; i += 8) {
+                __m256i loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c));
+                __m256i gathered = _mm256_i32gather_epi32(reinterpret_cast<const int32_t*>(a), loaded, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(b), gathered);
+                c += 8;
+                b += 8;
+            }
+            _mm256_zeroupper();
+        }
 #endif
         for (; i < num_rows; i++) {
             *b = a[*c];
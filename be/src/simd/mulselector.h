@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include "column/type_traits.h"
 #include "glog/logging.h"
@@ -57,7 +58,11 @@ public:
         //          selected_dst = select_if(will_select, selected_dst, select_data)
         // 5. store selected_dst
 
-        if constexpr (sizeof(RunTimeCppType<TYPE>) == 1) {
+        constexpr size_t type_size = sizeof(RunTimeCppType<TYPE>);
+        if constexpr (type_size == 1 || type_size == 2 || type_size == 4 || type_size == 8) {
+            // number of rows handled by one 256-bit register
+            constexpr int batch_rows = 32 / type_size;
+
             SelectVec handle_select_vec[select_vec_size];
             // copy select vector pointer
             for (int i = 0; i < select_vec_size; ++i) {
@@ -69,6 +74,25 @@ public:
                 handle_select_data[i] = select_list[i]->data();
             }
 
+            // widen batch_rows boolean bytes into a canonical all-ones/all-zero mask
+            // matching the element width, so blendv can be used for every width.
+            auto load_mask = [](const uint8_t* select) {
+                if constexpr (type_size == 1) {
+                    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(select));
+                    return _mm256_cmpgt_epi8(v, _mm256_setzero_si256());
+                } else if constexpr (type_size == 2) {
+                    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(select));
+                    return _mm256_cmpgt_epi16(_mm256_cvtepi8_epi16(v), _mm256_setzero_si256());
+                } else if constexpr (type_size == 4) {
+                    auto v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(select));
+                    return _mm256_cmpgt_epi32(_mm256_cvtepi8_epi32(v), _mm256_setzero_si256());
+                } else {
+                    int32_t raw;
+                    memcpy(&raw, select, sizeof(raw));
+                    return _mm256_cmpgt_epi64(_mm256_cvtepi8_epi64(_mm_cvtsi32_si128(raw)), _mm256_setzero_si256());
+                }
+            };
+
             __m256i loaded_masks[select_vec_size + 1];
             loaded_masks[select_vec_size] = _mm256_set1_epi8(0xff);
 
@@ -76,14 +100,13 @@ public:
 
             const __m256i all_zero_vec = _mm256_setzero_si256();
 
-            while (processed_rows + 32 < row_sz) {
+            while (processed_rows + batch_rows < row_sz) {
                 __m256i selected_vec = all_zero_vec;
                 __m256i selected_dst = _mm256_undefined_si256();
 
                 // load select vector
                 for (int i = 0; i < select_vec_size; ++i) {
-                    loaded_masks[i] = _mm256_loadu_si256(reinterpret_cast<__m256i*>(handle_select_vec[i]));
-                    loaded_masks[i] = _mm256_cmpgt_epi8(loaded_masks[i], _mm256_setzero_si256());
+                    loaded_masks[i] = load_mask(handle_select_vec[i]);
                 }
 
                 // load select data
@@ -92,12 +115,9 @@ public:
                 }
 
                 for (int i = 0; i < select_list_size; ++i) {
-                    // get will select vector in this loop
-                    __m256i not_selected_vec = ~selected_vec;
-                    __m256i will_select = not_selected_vec & loaded_masks[i];
-                    will_select = _mm256_cmpeq_epi8(will_select, _mm256_setzero_si256());
-
-                    will_select = ~will_select;
+                    // the masks are canonical, so the rows to select in this loop are
+                    // simply the not-yet-selected lanes of the current mask.
+                    __m256i will_select = ~selected_vec & loaded_masks[i];
                     // select if
                     selected_dst = _mm256_blendv_epi8(selected_dst, loaded_datas[i], will_select);
                     // update select_vec
@@ -108,13 +128,13 @@ public:
 
                 // update handle_select_vec
                 for (int i = 0; i < select_vec_size; ++i) {
-                    handle_select_vec[i] += 32;
+                    handle_select_vec[i] += batch_rows;
                 }
 
                 for (int i = 0; i < select_list_size; ++i) {
-                    handle_select_data[i] += 32;
+                    handle_select_data[i] += batch_rows;
                 }
-                processed_rows += 32;
+                processed_rows += batch_rows;
             }
         }
 #endif
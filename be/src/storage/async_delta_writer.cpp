@@ -47,7 +47,7 @@ int AsyncDeltaWriter::_execute(void* meta, bthread::TaskIterator<AsyncDeltaWrite
             continue;
         }
         if (iter->chunk != nullptr && iter->indexes_size > 0) {
-            st = writer->write(*iter->chunk, iter->indexes, 0, iter->indexes_size);
+            st = writer->write(*iter->chunk, iter->indexes, 0, iter->indexes_size, iter->presorted);
         }
 
         if (iter->flush_after_write) {
@@ -111,7 +111,7 @@ Status AsyncDeltaWriter::_init() {
         return Status::InternalError("StorageEngine::instance() is NULL");
     }
     bthread::ExecutionQueueOptions opts;
-    opts.executor = StorageEngine::instance()->async_delta_writer_executor();
+    opts.executor = StorageEngine::instance()->async_delta_writer_executor(_writer->tablet()->tablet_id());
     if (UNLIKELY(opts.executor == nullptr)) {
         return Status::InternalError("AsyncDeltaWriterExecutor init failed");
     }
@@ -127,6 +127,7 @@ void AsyncDeltaWriter::write(const AsyncDeltaWriterRequest& req, AsyncDeltaWrite
     task.chunk = req.chunk;
     task.indexes = req.indexes;
     task.indexes_size = req.indexes_size;
+    task.presorted = req.presorted;
     task.write_cb = cb;
     task.commit_after_write = req.commit_after_write;
     int r = bthread::execution_queue_execute(_queue_id, task);
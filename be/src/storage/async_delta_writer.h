@@ -89,6 +89,8 @@ public:
 
     int64_t partition_id() const { return _writer->partition_id(); }
 
+    const Tablet* tablet() const { return _writer->tablet(); }
+
     ReplicaState replica_state() const { return _writer->replica_state(); }
 
     State get_state() const { return _writer->get_state(); }
@@ -119,6 +121,7 @@ private:
         const uint32_t* indexes = nullptr;
         AsyncDeltaWriterCallback* write_cb = nullptr;
         uint32_t indexes_size = 0;
+        bool presorted = false;
         bool commit_after_write = false;
         bool abort = false;
         bool abort_with_log = false;
@@ -157,6 +160,8 @@ public:
     const uint32_t* indexes = nullptr;
     uint32_t indexes_size = 0;
     bool commit_after_write = false;
+    // true iff |indexes| enumerates the rows in sort-key order.
+    bool presorted = false;
 };
 
 class AsyncDeltaWriterSegmentRequest {
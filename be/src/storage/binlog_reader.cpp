@@ -18,6 +18,7 @@
 
 #include "column/datum.h"
 #include "storage/chunk_helper.h"
+#include "storage/conjunctive_predicates.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/tablet.h"
@@ -144,6 +145,15 @@ Status BinlogReader::get_next(ChunkPtr* chunk, int64_t max_version_exclusive) {
     _swap_output_and_data_chunk(chunk->get());
     status = _segment_iterator->get_next(_data_chunk.get());
     int32_t num_rows = _data_chunk->num_rows();
+    bool need_filter = false;
+    if (status.ok() && _reader_params.predicates != nullptr && num_rows > 0) {
+        // evaluate on the data chunk which carries the column id mapping the predicates
+        // refer to. The output chunk is filtered only after the meta columns are appended,
+        // so binlog seq ids keep identifying the original change events
+        _selection.resize(num_rows);
+        status = _reader_params.predicates->evaluate(_data_chunk.get(), _selection.data());
+        need_filter = status.ok();
+    }
     _swap_output_and_data_chunk(chunk->get());
     // sanity check: should not meet the end of file
     if (status.is_end_of_file()) {
@@ -160,6 +170,9 @@ Status BinlogReader::get_next(ChunkPtr* chunk, int64_t max_version_exclusive) {
     }
     _append_meta_column(chunk->get(), num_rows, log_entry_info->version, log_entry_info->timestamp_in_us, _next_seq_id);
     _next_seq_id += num_rows;
+    if (need_filter) {
+        chunk->get()->filter(_selection);
+    }
     // read all change events in this log entry
     if (_next_seq_id > log_entry_info->end_seq_id) {
         bool release_rowset = false;
@@ -25,11 +25,17 @@
 
 namespace starrocks {
 
+class ConjunctivePredicates;
+
 struct BinlogReaderParams {
     // Chunk size to read from a segment at a time
     int chunk_size;
     // The schema of output from the reader
     Schema output_schema;
+    // Predicates over data columns, evaluated after each segment read so that only matching
+    // change events are emitted. Filtering does not affect binlog positions: next_version()
+    // and next_seq_id() still advance over the filtered events. Not owned.
+    const ConjunctivePredicates* predicates = nullptr;
 };
 
 // Column names for metas
@@ -145,6 +151,8 @@ private:
     ChunkIteratorPtr _segment_iterator;
     // the chunk delivered to the segment iterator for get_next()
     ChunkPtr _data_chunk;
+    // selection of the rows matching _reader_params#predicates, reused across get_next()
+    Buffer<uint8_t> _selection;
 
     bool _initialized = false;
     bool _closed = false;
@@ -14,6 +14,8 @@
 
 #include "storage/chunk_aggregator.h"
 
+#include <numeric>
+
 #include "common/config.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/casts.h"
@@ -103,10 +105,17 @@ void ChunkAggregator::update_source(ChunkPtr& chunk, std::vector<RowSourceMask>*
             ColumnPtr column = chunk->get_column_by_index(i);
             build_tie_for_column(column, &_is_eq);
 
-            if (_factor > 0 && SIMD::count_nonzero(_is_eq) < factor) {
+            size_t num_ties = SIMD::count_nonzero(_is_eq);
+            if (_factor > 0 && num_ties < factor) {
                 _do_aggregate = false;
                 return;
             }
+            // the remaining key columns can only remove ties, so once every row already
+            // differs from its predecessor their comparisons cannot change the result.
+            // For duplicate-free loads this skips most of the key comparison work.
+            if (num_ties == 0) {
+                break;
+            }
         }
 
         if (_aggregate_rows > 0 && _key_fields > 0) {
@@ -157,16 +166,28 @@ void ChunkAggregator::aggregate() {
     // 1. Calculate the key rows selective arrays
     // 2. Calculate the value rows that can be aggregated for each key row
     uint32_t row = _source_row;
-    for (; row < _source_size; ++row) {
-        if (_is_eq[row] == 0) {
-            if (_aggregate_rows >= _max_aggregate_rows) {
-                break;
+    const size_t remaining = _source_size - _source_row;
+    if (_aggregate_rows + remaining <= _max_aggregate_rows &&
+        SIMD::count_nonzero(_is_eq.data() + _source_row, remaining) == 0) {
+        // no source row merges with its predecessor, so every row is selected with an
+        // aggregate loop of one. This is the common case for duplicate-free loads.
+        _selective_index.resize(remaining);
+        std::iota(_selective_index.begin(), _selective_index.end(), _source_row);
+        _aggregate_loops.assign(remaining, 1);
+        _aggregate_rows += remaining;
+        row = _source_size;
+    } else {
+        for (; row < _source_size; ++row) {
+            if (_is_eq[row] == 0) {
+                if (_aggregate_rows >= _max_aggregate_rows) {
+                    break;
+                }
+                ++_aggregate_rows;
+                _selective_index.emplace_back(row);
+                _aggregate_loops.emplace_back(1);
+            } else {
+                _aggregate_loops[_aggregate_loops.size() - 1] += 1;
             }
-            ++_aggregate_rows;
-            _selective_index.emplace_back(row);
-            _aggregate_loops.emplace_back(1);
-        } else {
-            _aggregate_loops[_aggregate_loops.size() - 1] += 1;
         }
     }
 
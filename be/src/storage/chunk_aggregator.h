@@ -63,6 +63,10 @@ public:
 
     size_t merged_rows() const { return _merged_rows; }
 
+    // number of aggregated rows accumulated so far, i.e. the row count of the
+    // result chunk once it is finalized.
+    uint32_t aggregate_rows() const { return _aggregate_rows; }
+
     size_t bytes_usage();
 
     void close();
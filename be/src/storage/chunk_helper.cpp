@@ -14,6 +14,8 @@
 
 #include "storage/chunk_helper.h"
 
+#include <algorithm>
+
 #include "column/array_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
@@ -22,6 +24,7 @@
 #include "column/schema.h"
 #include "column/struct_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -538,26 +541,43 @@ void ChunkAccumulator::finalize() {
     _accumulate_count = 0;
 }
 
+size_t ChunkPipelineAccumulator::_adaptive_max_size() const {
+    int64_t target_bytes = config::chunk_accumulate_target_bytes;
+    if (target_bytes <= 0 || _in_chunk == nullptr || _in_chunk->num_rows() == 0) {
+        return _max_size;
+    }
+    size_t row_bytes = std::max<size_t>(1, _min_chunk_row_bytes);
+    return std::clamp<size_t>(target_bytes / row_bytes, MIN_ADAPTIVE_SIZE, _max_size);
+}
+
 void ChunkPipelineAccumulator::push(const ChunkPtr& chunk) {
     chunk->check_or_die();
     DCHECK(_out_chunk == nullptr);
+    size_t chunk_bytes = chunk->bytes_usage();
+    size_t chunk_row_bytes = chunk->num_rows() > 0 ? chunk_bytes / chunk->num_rows() : 0;
     if (_in_chunk == nullptr) {
         _in_chunk = chunk;
-        _mem_usage = chunk->bytes_usage();
-    } else if (_in_chunk->num_rows() + chunk->num_rows() > _max_size ||
+        _mem_usage = chunk_bytes;
+        _min_chunk_row_bytes = chunk_row_bytes;
+    } else if (_in_chunk->num_rows() + chunk->num_rows() > _adaptive_max_size() ||
                _in_chunk->owner_info() != chunk->owner_info()) {
         _out_chunk = std::move(_in_chunk);
         _in_chunk = chunk;
-        _mem_usage = chunk->bytes_usage();
+        _mem_usage = chunk_bytes;
+        _min_chunk_row_bytes = chunk_row_bytes;
     } else {
         _in_chunk->append(*chunk);
-        _mem_usage += chunk->bytes_usage();
+        _mem_usage += chunk_bytes;
+        if (chunk_row_bytes > 0 && (_min_chunk_row_bytes == 0 || chunk_row_bytes < _min_chunk_row_bytes)) {
+            _min_chunk_row_bytes = chunk_row_bytes;
+        }
     }
 
-    if (_out_chunk == nullptr && (_in_chunk->num_rows() >= _max_size * LOW_WATERMARK_ROWS_RATE ||
+    if (_out_chunk == nullptr && (_in_chunk->num_rows() >= _adaptive_max_size() * LOW_WATERMARK_ROWS_RATE ||
                                   _mem_usage >= LOW_WATERMARK_BYTES || _in_chunk->owner_info().is_last_chunk())) {
         _out_chunk = std::move(_in_chunk);
         _mem_usage = 0;
+        _min_chunk_row_bytes = 0;
     }
 }
 
@@ -565,6 +585,7 @@ void ChunkPipelineAccumulator::reset() {
     _in_chunk.reset();
     _out_chunk.reset();
     _mem_usage = 0;
+    _min_chunk_row_bytes = 0;
 }
 
 void ChunkPipelineAccumulator::finalize() {
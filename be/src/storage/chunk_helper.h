@@ -129,7 +129,18 @@ public:
     bool is_finished() const;
 
 private:
+    // Scale _max_size down to config::chunk_accumulate_target_bytes worth of rows based on
+    // the row width of the accumulating chunk, so wide rows are emitted in
+    // cache-resident batches instead of always growing to _max_size rows.
+    // The width estimate is the minimum per-chunk average seen since the last output, so
+    // a single oversized cell (e.g. a multi-MB string) inflates only the chunk carrying it
+    // and does not shrink every downstream batch.
+    size_t _adaptive_max_size() const;
+
     static constexpr double LOW_WATERMARK_ROWS_RATE = 0.75; // 0.75 * chunk_size
+    // the adaptive max size never drops below this, batches smaller than a few hundred rows
+    // lose more to per-chunk overhead than they gain from cache residency.
+    static constexpr size_t MIN_ADAPTIVE_SIZE = 256;
 #ifdef BE_TEST
     static constexpr size_t LOW_WATERMARK_BYTES = 64 * 1024; // 64KB.
 #else
@@ -141,6 +152,8 @@ private:
     // For bitmap columns, the cost of calculating mem_usage is relatively high,
     // so incremental calculation is used to avoid becoming a performance bottleneck.
     size_t _mem_usage = 0;
+    // minimum average row width among the chunks accumulated since the last output, 0 = unset
+    size_t _min_chunk_row_bytes = 0;
     bool _finalized = false;
 };
 
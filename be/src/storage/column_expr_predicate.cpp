@@ -260,6 +260,72 @@ Status ColumnExprPredicate::try_to_rewrite_for_zone_map_filter(starrocks::Object
             exprs_after_rewrite.emplace_back(le);
             exprs_after_rewrite.emplace_back(ge);
         }
+    } else if (root->op() == TExprOpcode::FILTER_IN && root->get_num_children() >= 2 &&
+               root->get_child(0)->is_monotonic()) {
+        // `f(x) IN (v1..vn)` evaluated only at a zone's min/max misses elements that fall
+        // strictly inside [f(min), f(max)]. When every element is a constant of the same
+        // type, rewrite it to `f(x) >= min(vi)` and `f(x) <= max(vi)`, both of which are
+        // safe to evaluate at the endpoints. Null elements never match, so they can not
+        // enlarge the range and are simply skipped.
+        bool all_constant = true;
+        for (int i = 1; i < root->get_num_children(); i++) {
+            Expr* child = root->get_child(i);
+            if (!child->is_constant() || child->type().type != root->get_child(1)->type().type) {
+                all_constant = false;
+                break;
+            }
+        }
+        int min_child_idx = -1;
+        int max_child_idx = -1;
+        if (all_constant) {
+            ColumnPtr values = ColumnHelper::create_column(root->get_child(1)->type(), true);
+            std::vector<int> child_idx_of_row;
+            for (int i = 1; i < root->get_num_children(); i++) {
+                ASSIGN_OR_RETURN(ColumnPtr value, pred_from_planner->evaluate(root->get_child(i), nullptr));
+                if (value == nullptr || value->empty() || value->is_null(0)) {
+                    continue;
+                }
+                values->append_datum(ColumnHelper::unpack_and_duplicate_const_column(1, value)->get(0));
+                child_idx_of_row.emplace_back(i);
+            }
+            if (!child_idx_of_row.empty()) {
+                size_t min_row = 0;
+                size_t max_row = 0;
+                for (size_t row = 1; row < child_idx_of_row.size(); row++) {
+                    if (values->compare_at(row, min_row, *values, -1) < 0) {
+                        min_row = row;
+                    }
+                    if (values->compare_at(row, max_row, *values, -1) > 0) {
+                        max_row = row;
+                    }
+                }
+                min_child_idx = child_idx_of_row[min_row];
+                max_child_idx = child_idx_of_row[max_row];
+            }
+        }
+        if (min_child_idx > 0 && max_child_idx > 0) {
+            auto build_binary_predicate_func = [pool, root](TExprOpcode::type new_op, int value_idx) {
+                TExprNode node;
+                node.node_type = TExprNodeType::BINARY_PRED;
+                node.type = root->type().to_thrift();
+                node.child_type = to_thrift(root->get_child(0)->type().type);
+                node.__set_opcode(new_op);
+
+                Expr* new_root = VectorizedBinaryPredicateFactory::from_thrift(node);
+                DCHECK(new_root != nullptr);
+                new_root->add_child(Expr::copy(pool, root->get_child(0)));
+                new_root->add_child(Expr::copy(pool, root->get_child(value_idx)));
+                new_root->set_monotonic(true);
+                return new_root;
+            };
+
+            Expr* le = build_binary_predicate_func(TExprOpcode::LE, max_child_idx);
+            Expr* ge = build_binary_predicate_func(TExprOpcode::GE, min_child_idx);
+            pool->add(le);
+            pool->add(ge);
+            exprs_after_rewrite.emplace_back(le);
+            exprs_after_rewrite.emplace_back(ge);
+        }
     }
 
     if (exprs_after_rewrite.empty()) {
@@ -303,10 +369,22 @@ Status ColumnExprPredicate::seek_inverted_index(const std::string& column_name,
         LOG(WARNING) << ss.str();
         return Status::NotSupported(ss.str());
     }
+    // A wildcard query matches against whole terms. Under a tokenizing analyser the like
+    // pattern may cross token boundaries, and the index would miss matching rows, so only
+    // an untokenized index can answer a like predicate exactly.
+    if (iterator->get_inverted_index_analyser_type() != InvertedIndexParserType::PARSER_NONE) {
+        return Status::NotSupported("like predicate can only use an untokenized inverted index");
+    }
     auto* like_target = dynamic_cast<VectorizedLiteral*>(vectorized_function_call->get_child(1));
     RETURN_IF(!like_target, Status::NotSupported("Not supported like predicate parameters"));
     ASSIGN_OR_RETURN(auto literal_col, like_target->evaluate_checked(_expr_ctxs[0], nullptr));
     Slice padded_value(literal_col->get(0).get_slice());
+    // `%` and `_` are translated to the clucene wildcards `*` and `?`. A pattern carrying
+    // clucene's own wildcard characters or a like escape can not be expressed in a
+    // wildcard query, fall back to evaluating the expression.
+    if (padded_value.to_string().find_first_of("*?\\") != std::string::npos) {
+        return Status::NotSupported("Not supported wildcard characters in like pattern");
+    }
     InvertedIndexQueryType query_type = InvertedIndexQueryType::MATCH_ANY_QUERY;
     roaring::Roaring roaring;
     RETURN_IF_ERROR(iterator->read_from_inverted_index(column_name, &padded_value, query_type, &roaring));
@@ -32,7 +32,18 @@ class ColumnInPredicate : public ColumnPredicate {
 
 public:
     ColumnInPredicate(const TypeInfoPtr& type_info, ColumnId id, ItemSet values)
-            : ColumnPredicate(type_info, id), _values(std::move(values)) {}
+            : ColumnPredicate(type_info, id), _values(std::move(values)) {
+        bool first = true;
+        for (const ValueType& v : _values) {
+            if (first || this->type_info()->cmp(Datum(v), Datum(_min_value)) < 0) {
+                _min_value = v;
+            }
+            if (first || this->type_info()->cmp(Datum(v), Datum(_max_value)) > 0) {
+                _max_value = v;
+            }
+            first = false;
+        }
+    }
 
     ~ColumnInPredicate() override = default;
 
@@ -92,6 +103,13 @@ public:
         const auto& min = detail.min_or_null_value();
         const auto& max = detail.max_value();
         const auto type_info = this->type_info();
+        // A page is far more often entirely outside the list's range than overlapping
+        // it, so compare the precomputed list min/max against the page bounds before
+        // walking every value. Large IN lists make the per-value loop expensive.
+        if (!_values.empty() &&
+            (type_info->cmp(Datum(_max_value), min) < 0 || type_info->cmp(Datum(_min_value), max) > 0)) {
+            return false;
+        }
         for (const ValueType& v : _values) {
             if (type_info->cmp(Datum(v), min) >= 0 && type_info->cmp(Datum(v), max) <= 0) {
                 return true;
@@ -186,6 +204,10 @@ public:
 
 private:
     ItemSet _values;
+    // bounds of _values, so zone_map_filter can reject a disjoint page without
+    // iterating the whole list
+    ValueType _min_value{};
+    ValueType _max_value{};
 };
 
 // Template specialization for binary column
@@ -346,6 +368,20 @@ public:
         return Status::OK();
     }
 
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId=" << _column_id << ",In(";
+        int i = 0;
+        for (const std::string& s : _zero_padded_strs) {
+            if (i++ != 0) {
+                ss << ",";
+            }
+            ss << s;
+        }
+        ss << ")";
+        return ss.str();
+    }
+
     bool padding_zeros(size_t len) override {
         _slices.clear();
         for (auto& str : _zero_padded_strs) {
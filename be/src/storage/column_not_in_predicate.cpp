@@ -155,6 +155,20 @@ public:
         return Status::OK();
     }
 
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId=" << _column_id << ",NotIn(";
+        int i = 0;
+        for (auto& item : _values) {
+            if (i++ != 0) {
+                ss << ",";
+            }
+            ss << this->type_info()->to_string(&item);
+        }
+        ss << ")";
+        return ss.str();
+    }
+
 private:
     ItemHashSet<ValueType> _values;
 };
@@ -297,6 +311,20 @@ public:
         return true;
     }
 
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId=" << _column_id << ",NotIn(";
+        int i = 0;
+        for (const std::string& s : _zero_padded_strs) {
+            if (i++ != 0) {
+                ss << ",";
+            }
+            ss << s;
+        }
+        ss << ")";
+        return ss.str();
+    }
+
 private:
     std::vector<std::string> _zero_padded_strs;
     ItemHashSet<Slice> _slices;
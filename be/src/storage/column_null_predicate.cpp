@@ -97,6 +97,12 @@ public:
         *output = this;
         return Status::OK();
     }
+
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId=" << _column_id << ",IsNull)";
+        return ss.str();
+    }
 };
 
 class ColumnNotNullPredicate : public ColumnPredicate {
@@ -168,6 +174,12 @@ public:
         *output = this;
         return Status::OK();
     }
+
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId=" << _column_id << ",NotNull)";
+        return ss.str();
+    }
 };
 
 ColumnPredicate* new_column_null_predicate(const TypeInfoPtr& type_info, ColumnId id, bool is_null) {
@@ -59,6 +59,20 @@ public:
     Status convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
                       ObjectPool* obj_pool) const override;
 
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId=" << _column_id << ",Or(";
+        int i = 0;
+        for (const auto* child : _child) {
+            if (i++ != 0) {
+                ss << ",";
+            }
+            ss << child->debug_string();
+        }
+        ss << "))";
+        return ss.str();
+    }
+
 private:
     Status _evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const;
 
@@ -243,6 +243,10 @@ ColumnPredicate* new_column_gt_predicate(const TypeInfoPtr& type, ColumnId id, c
 ColumnPredicate* new_column_ge_predicate(const TypeInfoPtr& type, ColumnId id, const Slice& operand);
 ColumnPredicate* new_column_cmp_predicate(PredicateType predicate, const TypeInfoPtr& type, ColumnId id,
                                           const Slice& operand);
+// Create a fused predicate evaluating `lower <= v AND v < upper` in a single pass.
+// Returns nullptr if the type does not support fusion.
+ColumnPredicate* new_column_range_predicate(const TypeInfoPtr& type, ColumnId id, const Datum& lower,
+                                            const Datum& upper);
 
 ColumnPredicate* new_column_in_predicate(const TypeInfoPtr& type, ColumnId id,
                                          const std::vector<std::string>& operands);
@@ -515,6 +515,90 @@ public:
     }
 };
 
+// Fused `lower <= v AND v < upper` predicate. Created by ColumnPredicateRewriter
+// when both bounds of a range are pushed down on the same column, so that the
+// common paired-range case needs a single pass over the data instead of two.
+template <LogicalType field_type>
+class ColumnRangePredicate : public ColumnPredicate {
+    using ValueType = typename CppTypeTraits<field_type>::CppType;
+
+public:
+    ColumnRangePredicate(const TypeInfoPtr& type_info, ColumnId id, ValueType lower, ValueType upper)
+            : ColumnPredicate(type_info, id), _lower(lower), _upper(upper) {}
+
+    ~ColumnRangePredicate() override = default;
+
+    template <typename Op>
+    inline void t_evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const {
+        auto* v = reinterpret_cast<const ValueType*>(column->raw_data());
+        auto* sel = selection;
+        auto ge = GeEval<field_type>();
+        auto lt = LtEval<field_type>();
+        if (!column->has_null()) {
+            for (size_t i = from; i < to; i++) {
+                sel[i] = Op::apply(sel[i], (uint8_t)(ge(v[i], _lower) & lt(v[i], _upper)));
+            }
+        } else {
+            /* must use const uint8_t* to make vectorized effect, vector<uint8_t> not work */
+            const uint8_t* is_null = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (size_t i = from; i < to; i++) {
+                sel[i] = Op::apply(sel[i], (uint8_t)((!is_null[i]) & ge(v[i], _lower) & lt(v[i], _upper)));
+            }
+        }
+    }
+
+    Status evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateAssignOp>(column, selection, from, to);
+        return Status::OK();
+    }
+
+    Status evaluate_and(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateAndOp>(column, selection, from, to);
+        return Status::OK();
+    }
+
+    Status evaluate_or(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateOrOp>(column, selection, from, to);
+        return Status::OK();
+    }
+
+    PredicateType type() const override { return PredicateType::kAnd; }
+
+    std::vector<Datum> values() const override { return std::vector<Datum>{Datum(_lower), Datum(_upper)}; }
+
+    bool can_vectorized() const override { return true; }
+
+    // conjunction of the `>=` and `<` zone map filters.
+    bool zone_map_filter(const ZoneMapDetail& detail) const override {
+        const auto& min = detail.min_or_null_value();
+        const auto& max = detail.max_value();
+        return (this->type_info()->cmp(Datum(_lower), max) <= 0) &
+               ((this->type_info()->cmp(Datum(_upper), min) > 0) & !max.is_null());
+    }
+
+    Status convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
+                      ObjectPool* obj_pool) const override {
+        if (target_type_info->type() == field_type) {
+            *output = this;
+            return Status::OK();
+        }
+        // Fused predicates are created after the per-segment type conversion,
+        // so a further conversion is never requested.
+        return Status::NotSupported("fused range predicate does not support type conversion");
+    }
+
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId(" << _column_id << ")range[" << this->type_info()->to_string(&_lower) << ","
+           << this->type_info()->to_string(&_upper) << "))";
+        return ss.str();
+    }
+
+private:
+    ValueType _lower;
+    ValueType _upper;
+};
+
 // Base class for binary column predicate
 template <LogicalType field_type, class Eval>
 class BinaryColumnPredicateCmpBase : public ColumnPredicate {
@@ -901,6 +985,56 @@ ColumnPredicate* new_column_ge_predicate(const TypeInfoPtr& type_info, ColumnId
     return new_column_predicate<ColumnGePredicate, BinaryColumnGePredicate>(type_info, id, operand);
 }
 
+template <LogicalType field_type>
+static ColumnPredicate* new_range_predicate(const TypeInfoPtr& type_info, ColumnId id, const Datum& lower,
+                                            const Datum& upper) {
+    using ValueType = typename CppTypeTraits<field_type>::CppType;
+    return new ColumnRangePredicate<field_type>(type_info, id, lower.get<ValueType>(), upper.get<ValueType>());
+}
+
+ColumnPredicate* new_column_range_predicate(const TypeInfoPtr& type_info, ColumnId id, const Datum& lower,
+                                            const Datum& upper) {
+    switch (type_info->type()) {
+    case TYPE_BOOLEAN:
+        return new_range_predicate<TYPE_BOOLEAN>(type_info, id, lower, upper);
+    case TYPE_TINYINT:
+        return new_range_predicate<TYPE_TINYINT>(type_info, id, lower, upper);
+    case TYPE_SMALLINT:
+        return new_range_predicate<TYPE_SMALLINT>(type_info, id, lower, upper);
+    case TYPE_INT:
+        return new_range_predicate<TYPE_INT>(type_info, id, lower, upper);
+    case TYPE_BIGINT:
+        return new_range_predicate<TYPE_BIGINT>(type_info, id, lower, upper);
+    case TYPE_LARGEINT:
+        return new_range_predicate<TYPE_LARGEINT>(type_info, id, lower, upper);
+    case TYPE_FLOAT:
+        return new_range_predicate<TYPE_FLOAT>(type_info, id, lower, upper);
+    case TYPE_DOUBLE:
+        return new_range_predicate<TYPE_DOUBLE>(type_info, id, lower, upper);
+    case TYPE_DECIMAL:
+        return new_range_predicate<TYPE_DECIMAL>(type_info, id, lower, upper);
+    case TYPE_DECIMALV2:
+        return new_range_predicate<TYPE_DECIMALV2>(type_info, id, lower, upper);
+    case TYPE_DECIMAL32:
+        return new_range_predicate<TYPE_DECIMAL32>(type_info, id, lower, upper);
+    case TYPE_DECIMAL64:
+        return new_range_predicate<TYPE_DECIMAL64>(type_info, id, lower, upper);
+    case TYPE_DECIMAL128:
+        return new_range_predicate<TYPE_DECIMAL128>(type_info, id, lower, upper);
+    case TYPE_DATE_V1:
+        return new_range_predicate<TYPE_DATE_V1>(type_info, id, lower, upper);
+    case TYPE_DATE:
+        return new_range_predicate<TYPE_DATE>(type_info, id, lower, upper);
+    case TYPE_DATETIME_V1:
+        return new_range_predicate<TYPE_DATETIME_V1>(type_info, id, lower, upper);
+    case TYPE_DATETIME:
+        return new_range_predicate<TYPE_DATETIME>(type_info, id, lower, upper);
+    default:
+        // binary and complex types keep their separate predicates.
+        return nullptr;
+    }
+}
+
 ColumnPredicate* new_column_cmp_predicate(PredicateType predicate, const TypeInfoPtr& type, ColumnId id,
                                           const Slice& operand) {
     switch (predicate) {
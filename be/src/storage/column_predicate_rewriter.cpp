@@ -53,9 +53,57 @@ Status ColumnPredicateRewriter::rewrite_predicate(ObjectPool* pool) {
             RETURN_IF_ERROR(_rewrite_predicate(pool, field));
         }
     }
+    _fuse_range_predicates(pool);
     return Status::OK();
 }
 
+// Fuse a `>=` and a `<` predicate on the same column into a single range predicate
+// evaluated in one pass over the data. An accompanying `IS NOT NULL` predicate is
+// absorbed as well, since the fused predicate never selects null rows.
+void ColumnPredicateRewriter::_fuse_range_predicates(ObjectPool* pool) {
+    for (size_t i = 0; i < _column_size; i++) {
+        const FieldPtr& field = _schema.field(i);
+        const ColumnId cid = field->id();
+        auto iter = _predicates.find(cid);
+        if (iter == _predicates.end()) {
+            continue;
+        }
+        PredicateList& preds = iter->second;
+        if (preds.size() < 2) {
+            continue;
+        }
+        const LogicalType field_type = field->type()->type();
+        const ColumnPredicate* ge = nullptr;
+        const ColumnPredicate* lt = nullptr;
+        const ColumnPredicate* not_null = nullptr;
+        for (const ColumnPredicate* pred : preds) {
+            // index-only predicates don't participate in chunk evaluation.
+            if (pred->is_index_filter_only() || pred->type_info()->type() != field_type) {
+                continue;
+            }
+            if (PredicateType::kGE == pred->type() && ge == nullptr) {
+                ge = pred;
+            } else if (PredicateType::kLT == pred->type() && lt == nullptr) {
+                lt = pred;
+            } else if (PredicateType::kNotNull == pred->type() && not_null == nullptr) {
+                not_null = pred;
+            }
+        }
+        if (ge == nullptr || lt == nullptr) {
+            continue;
+        }
+        ColumnPredicate* fused = new_column_range_predicate(field->type(), cid, ge->value(), lt->value());
+        if (fused == nullptr) {
+            // the type does not support fusion, e.g. binary columns.
+            continue;
+        }
+        preds.erase(std::remove_if(preds.begin(), preds.end(),
+                                   [&](const ColumnPredicate* p) { return p == ge || p == lt || p == not_null; }),
+                    preds.end());
+        preds.emplace_back(pool->add(fused));
+    }
+}
+
 StatusOr<bool> ColumnPredicateRewriter::_rewrite_predicate(ObjectPool* pool, const FieldPtr& field) {
     auto cid = field->id();
     DCHECK(_column_iterators[cid]->all_page_dict_encoded());
@@ -52,6 +52,7 @@ public:
 
 private:
     StatusOr<bool> _rewrite_predicate(ObjectPool* pool, const FieldPtr& field);
+    void _fuse_range_predicates(ObjectPool* pool);
     StatusOr<bool> _rewrite_expr_predicate(ObjectPool* pool, const ColumnPredicate*, const ColumnPtr& dict_column,
                                            const ColumnPtr& code_column, bool field_nullable, ColumnPredicate** ptr);
     Status _get_segment_dict(std::vector<std::pair<std::string, int>>* dicts, ColumnIterator* iter);
@@ -18,6 +18,7 @@
 #include <thread>
 
 #include "storage/data_dir.h"
+#include "util/cpu_info.h"
 #include "util/starrocks_metrics.h"
 #include "util/thread.h"
 
@@ -35,6 +36,7 @@ void CompactionManager::stop() {
     if (_compaction_pool) {
         _compaction_pool->shutdown();
     }
+    _dispatch_cv.notify_all();
     if (_dispatch_update_candidate_thread.joinable()) {
         _dispatch_update_candidate_thread.join();
     }
@@ -69,6 +71,7 @@ void CompactionManager::_schedule() {
     LOG(INFO) << "start compaction scheduler";
     while (!_stop.load(std::memory_order_consume)) {
         ++_round;
+        _adjust_max_task_num();
         _wait_to_run();
         CompactionCandidate compaction_candidate;
 
@@ -136,6 +139,43 @@ std::shared_ptr<CompactionTask> CompactionManager::_try_get_next_compaction_task
 
 void CompactionManager::init_max_task_num(int32_t num) {
     _max_task_num = num;
+    _base_max_task_num = num;
+}
+
+// Let compaction borrow the cpu the load/query side leaves idle: while the process cpu usage
+// stays below the low watermark, grow the task limit and the pool one step at a time toward the
+// number of cores, and fall back to the configured concurrency as soon as usage crosses the high
+// watermark. Running tasks are never interrupted, the limit only caps what gets submitted next.
+void CompactionManager::_adjust_max_task_num() {
+    if (!config::enable_adaptive_compaction_concurrency) {
+        if (_base_max_task_num > 0 && _max_task_num != _base_max_task_num) {
+            _max_task_num = _base_max_task_num;
+            (void)_compaction_pool->update_max_threads(std::max(1, _max_task_num));
+        }
+        return;
+    }
+    if (_base_max_task_num <= 0) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now < _next_adjust_time) {
+        return;
+    }
+    _next_adjust_time = now + 10s;
+    _cpu_usage_recorder.update_interval();
+    int used_permille = _cpu_usage_recorder.cpu_used_permille();
+    int32_t new_limit = _max_task_num;
+    if (used_permille < config::adaptive_compaction_cpu_low_water_permille) {
+        new_limit = std::min(static_cast<int32_t>(CpuInfo::num_cores()), _max_task_num + 1);
+    } else if (used_permille > config::adaptive_compaction_cpu_high_water_permille) {
+        new_limit = _base_max_task_num;
+    }
+    if (new_limit != _max_task_num) {
+        LOG(INFO) << "adjust max compaction task num from " << _max_task_num << " to " << new_limit
+                  << ", cpu usage permille:" << used_permille;
+        _max_task_num = new_limit;
+        (void)_compaction_pool->update_max_threads(std::max(1, new_limit));
+    }
 }
 
 void CompactionManager::update_candidates(std::vector<CompactionCandidate> candidates) {
@@ -308,28 +348,39 @@ void CompactionManager::_dispatch_worker() {
                 }
                 _dispatch_map.clear();
             }
+            // the burst watermark only describes the batch that was just dispatched
+            _max_dispatch_count = 0;
         }
-        int32_t left_seconds = 10;
-        do {
-            sleep(1);
-            --left_seconds;
-        } while (!_stop.load(std::memory_order_consume) && left_seconds > 0 &&
-                 _max_dispatch_count < config::min_cumulative_compaction_num_singleton_deltas &&
-                 _dispatch_map.size() < 10240);
+        std::unique_lock lock(_dispatch_mutex);
+        _dispatch_cv.wait_for(lock, std::chrono::seconds(10), [this] {
+            return _stop.load(std::memory_order_consume) ||
+                   _max_dispatch_count >= config::min_cumulative_compaction_num_singleton_deltas ||
+                   _dispatch_map.size() >= 10240;
+        });
     }
 }
 
 void CompactionManager::update_tablet_async(const TabletSharedPtr& tablet) {
-    std::lock_guard lock(_dispatch_mutex);
-    auto iter = _dispatch_map.find(tablet->tablet_id());
-    if (iter != _dispatch_map.end()) {
-        iter->second.first = tablet;
-        iter->second.second++;
-        if (iter->second.second > _max_dispatch_count) {
-            _max_dispatch_count = iter->second.second;
+    bool notify = false;
+    {
+        std::lock_guard lock(_dispatch_mutex);
+        auto iter = _dispatch_map.find(tablet->tablet_id());
+        if (iter != _dispatch_map.end()) {
+            iter->second.first = tablet;
+            iter->second.second++;
+            if (iter->second.second > _max_dispatch_count) {
+                _max_dispatch_count = iter->second.second;
+            }
+        } else {
+            _dispatch_map.emplace(tablet->tablet_id(), std::make_pair(tablet, 0));
         }
-    } else {
-        _dispatch_map.emplace(tablet->tablet_id(), std::make_pair(tablet, 0));
+        // wake the dispatch worker once a tablet accumulates a burst of small rowsets or
+        // the pending set grows large, instead of leaving the batch to the periodic flush
+        notify = _max_dispatch_count >= config::min_cumulative_compaction_num_singleton_deltas ||
+                 _dispatch_map.size() >= 10240;
+    }
+    if (notify) {
+        _dispatch_cv.notify_one();
     }
 }
 
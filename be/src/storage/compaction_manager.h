@@ -15,6 +15,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -28,6 +29,7 @@
 #include "storage/rowset/rowset.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
+#include "util/cpu_usage_info.h"
 #include "util/threadpool.h"
 
 namespace starrocks {
@@ -142,6 +144,7 @@ private:
     void _wait_to_run();
     bool _can_schedule_next();
     std::shared_ptr<CompactionTask> _try_get_next_compaction_task();
+    void _adjust_max_task_num();
 
     std::mutex _candidates_mutex;
     // protect by _mutex
@@ -155,12 +158,20 @@ private:
     std::unordered_map<CompactionType, uint16_t> _type_to_task_num_map;
     std::unique_ptr<ThreadPool> _update_candidate_pool;
     std::mutex _dispatch_mutex;
+    // wakes the dispatch worker early when a tablet receives a burst of rowsets
+    std::condition_variable _dispatch_cv;
     std::thread _dispatch_update_candidate_thread;
     std::map<int64_t, std::pair<TabletSharedPtr, int32_t>> _dispatch_map;
     std::atomic<bool> _stop = false;
     int32_t _max_dispatch_count = 0;
 
     int32_t _max_task_num = 0;
+    // the configured task limit, _max_task_num falls back to it when adaptive concurrency is off
+    // or the machine gets busy again
+    int32_t _base_max_task_num = 0;
+    // only touched by the scheduler thread
+    CpuUsageRecorder _cpu_usage_recorder;
+    std::chrono::steady_clock::time_point _next_adjust_time{};
     int64_t _base_compaction_concurrency = 0;
     int64_t _cumulative_compaction_concurrency = 0;
     double _last_score = 0;
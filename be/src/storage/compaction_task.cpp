@@ -16,6 +16,7 @@
 
 #include <sstream>
 
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "storage/compaction_manager.h"
@@ -198,19 +199,22 @@ Status CompactionTask::_shortcut_compact(Statistics* statistics) {
     // shortcut compact means hard link old rowset to new rowset directly
     // no need to read and write data
     std::vector<RowsetSharedPtr> data_rowsets;
+    int64_t max_delete_version = -1;
     for (const auto& rowset : _input_rowsets) {
         if (rowset->num_rows() > 0) {
             // if rowset has data, we should compact it
             data_rowsets.emplace_back(rowset);
         } else if (rowset->rowset_meta()->has_delete_predicate()) {
-            // if rowset has delete predicate, can not do shortcut compaction
-            data_rowsets.clear();
-            break;
+            max_delete_version = std::max(max_delete_version, rowset->version().first);
         }
     }
 
-    if (data_rowsets.size() == 1 && !data_rowsets.back()->rowset_meta()->is_segments_overlapping() &&
-        _tablet->enable_shortcut_compaction()) {
+    // A delete predicate at version v only filters rows of rowsets whose end version is not
+    // above v, so a data rowset sitting above every delete version in the input is untouched
+    // by them and its segments can still be linked. Otherwise the data must be rewritten to
+    // apply the predicates.
+    if (data_rowsets.size() == 1 && max_delete_version < data_rowsets.back()->end_version() &&
+        !data_rowsets.back()->rowset_meta()->is_segments_overlapping() && _tablet->enable_shortcut_compaction()) {
         TRACE("[Compaction] start shortcut comapction data");
         int64_t max_rows_per_segment = CompactionUtils::get_segment_max_rows(
                 config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
@@ -252,4 +256,15 @@ Status CompactionTask::_shortcut_compact(Statistics* statistics) {
     return Status::OK();
 }
 
+void CompactionTask::_throttle_io(int64_t bytes) {
+    int64_t rate = config::compaction_max_bytes_per_disk_per_sec;
+    if (rate <= 0) {
+        return;
+    }
+    int64_t wait_us = _tablet->data_dir()->compaction_throttle()->acquire(bytes, rate);
+    if (wait_us > 0) {
+        StarRocksMetrics::instance()->compaction_throttled_time_us_total.increment(wait_us);
+    }
+}
+
 } // namespace starrocks
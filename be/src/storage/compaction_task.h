@@ -250,12 +250,14 @@ protected:
         return Status::OK();
     }
 
-    Status _commit_compaction() {
+    Status _commit_compaction() { return _commit_compaction(_input_rowsets, _output_rowset); }
+
+    Status _commit_compaction(const std::vector<RowsetSharedPtr>& input_rowsets, const RowsetSharedPtr& output_rowset) {
         std::stringstream input_stream_info;
         {
             std::unique_lock wrlock(_tablet->get_header_lock());
             // check input_rowsets exist. If not, tablet_meta maybe modify by some other thread, cancel this task
-            for (auto& rowset : _input_rowsets) {
+            for (const auto& rowset : input_rowsets) {
                 if (_tablet->get_rowset_by_version(rowset->version()) == nullptr) {
                     input_stream_info << "rowset:" << rowset->version()
                                       << " is not exist in tablet:" << _tablet->tablet_id()
@@ -269,23 +271,23 @@ protected:
             // so we can enable shortcut compaction.
             _tablet->tablet_meta()->set_enable_shortcut_compaction(true);
 
-            for (int i = 0; i < 5 && i < _input_rowsets.size(); ++i) {
-                input_stream_info << _input_rowsets[i]->version() << ";";
+            for (int i = 0; i < 5 && i < input_rowsets.size(); ++i) {
+                input_stream_info << input_rowsets[i]->version() << ";";
             }
-            if (_input_rowsets.size() > 5) {
-                input_stream_info << ".." << (*_input_rowsets.rbegin())->version();
+            if (input_rowsets.size() > 5) {
+                input_stream_info << ".." << (*input_rowsets.rbegin())->version();
             }
             std::vector<RowsetSharedPtr> to_replace;
-            _tablet->modify_rowsets({_output_rowset}, _input_rowsets, &to_replace);
+            _tablet->modify_rowsets({output_rowset}, input_rowsets, &to_replace);
             _tablet->save_meta();
-            Rowset::close_rowsets(_input_rowsets);
+            Rowset::close_rowsets(input_rowsets);
             for (auto& rs : to_replace) {
                 StorageEngine::instance()->add_unused_rowset(rs);
             }
         }
         VLOG(1) << "commit compaction. output version:" << _task_info.output_version
-                << ", output rowset version:" << _output_rowset->version()
-                << ", input rowsets:" << input_stream_info.str() << ", input rowsets size:" << _input_rowsets.size()
+                << ", output rowset version:" << output_rowset->version()
+                << ", input rowsets:" << input_stream_info.str() << ", input rowsets size:" << input_rowsets.size()
                 << ", max_version:" << _tablet->max_continuous_version();
 
         return Status::OK();
@@ -297,6 +299,13 @@ protected:
 
     Status _shortcut_compact(Statistics* statistics);
 
+    // Draw |bytes| of IO budget from the per-DataDir compaction token bucket and
+    // block while the per-disk rate (compaction_max_bytes_per_disk_per_sec) is
+    // exhausted, so compaction leaves the rest of the disk bandwidth to queries.
+    // |bytes| is the in-memory size of one merged chunk, a proxy for the read and
+    // write IO it causes.
+    void _throttle_io(int64_t bytes);
+
 protected:
     CompactionTaskInfo _task_info;
     RuntimeProfile _runtime_profile;
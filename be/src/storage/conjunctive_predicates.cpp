@@ -15,6 +15,7 @@
 #include "storage/conjunctive_predicates.h"
 
 #include "column/chunk.h"
+#include "simd/simd.h"
 #include "util/failpoint/fail_point.h"
 
 namespace starrocks {
@@ -39,15 +40,50 @@ Status ConjunctivePredicates::evaluate(const Chunk* chunk, uint8_t* selection, u
         const ColumnPredicate* pred = _vec_preds[0];
         const Column* col = chunk->get_column_by_id(pred->column_id()).get();
         RETURN_IF_ERROR(pred->evaluate(col, selection, from, to));
-        for (size_t i = 1; i < _vec_preds.size(); i++) {
-            pred = _vec_preds[i];
-            col = chunk->get_column_by_id(pred->column_id()).get();
-            RETURN_IF_ERROR(pred->evaluate_and(col, selection, from, to));
+        if (_vec_preds.size() > 1) {
+            if (to - from > SHORT_CIRCUIT_BLOCK_SIZE) {
+                RETURN_IF_ERROR(_evaluate_vec_and_short_circuit(chunk, selection, from, to));
+            } else {
+                for (size_t i = 1; i < _vec_preds.size(); i++) {
+                    pred = _vec_preds[i];
+                    col = chunk->get_column_by_id(pred->column_id()).get();
+                    RETURN_IF_ERROR(pred->evaluate_and(col, selection, from, to));
+                }
+            }
         }
     }
     return _evaluate_non_vec(chunk, selection, from, to);
 }
 
+Status ConjunctivePredicates::_evaluate_vec_and_short_circuit(const Chunk* chunk, uint8_t* selection, uint16_t from,
+                                                              uint16_t to) const {
+    for (size_t i = 1; i < _vec_preds.size(); i++) {
+        const ColumnPredicate* pred = _vec_preds[i];
+        const Column* col = chunk->get_column_by_id(pred->column_id()).get();
+        // Merge the consecutive blocks that still contain selected rows into one run,
+        // to amortize the per-call overhead of evaluate_and, and skip the fully
+        // filtered blocks. Skipping is safe because evaluate_and never sets a zeroed slot.
+        uint16_t run_from = from;
+        bool in_run = false;
+        for (uint16_t block_from = from; block_from < to;) {
+            const uint16_t block_to = std::min<uint16_t>(block_from + SHORT_CIRCUIT_BLOCK_SIZE, to);
+            const bool alive = SIMD::count_nonzero(selection + block_from, block_to - block_from) > 0;
+            if (alive && !in_run) {
+                run_from = block_from;
+                in_run = true;
+            } else if (!alive && in_run) {
+                RETURN_IF_ERROR(pred->evaluate_and(col, selection, run_from, block_from));
+                in_run = false;
+            }
+            block_from = block_to;
+        }
+        if (in_run) {
+            RETURN_IF_ERROR(pred->evaluate_and(col, selection, run_from, to));
+        }
+    }
+    return Status::OK();
+}
+
 Status ConjunctivePredicates::evaluate_or(const Chunk* chunk, uint8_t* selection, uint16_t from, uint16_t to) const {
     DCHECK_LE(to, chunk->num_rows());
     std::unique_ptr<uint8_t[]> buff(new uint8_t[chunk->num_rows()]);
@@ -90,8 +90,16 @@ public:
     std::vector<const ColumnPredicate*>& non_vec_preds() { return _non_vec_preds; }
 
 private:
+    // The selectivity of the selection vector is tracked per block of this many rows,
+    // so that the remaining predicates can skip the blocks that are already fully filtered.
+    static constexpr uint16_t SHORT_CIRCUIT_BLOCK_SIZE = 64;
+
     Status _evaluate_and(const Chunk* chunk, uint8_t* selection, uint16_t from, uint16_t to) const;
 
+    // Applies _vec_preds[1..] conjunctively to |selection|, skipping the 64-row blocks
+    // that a previous predicate has already zeroed.
+    Status _evaluate_vec_and_short_circuit(const Chunk* chunk, uint8_t* selection, uint16_t from, uint16_t to) const;
+
     Status _evaluate_non_vec(const Chunk* chunk, uint8_t* selection, uint16_t from, uint16_t to) const;
 
     std::vector<const ColumnPredicate*> _vec_preds;
@@ -35,6 +35,7 @@
 #include "storage/data_dir.h"
 
 #include <filesystem>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <utility>
@@ -58,6 +59,7 @@
 #include "util/defer_op.h"
 #include "util/errno.h"
 #include "util/monotime.h"
+#include "util/threadpool.h"
 #include "util/string_util.h"
 
 using strings::Substitute;
@@ -278,10 +280,21 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta " << _path;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
+    std::mutex load_tablet_mutex;
+    // The rocksdb walk stays a single sequential reader, but tablet meta deserialization and
+    // Tablet::init dominate load time, so they are fanned out to a small pool. This is safe
+    // because load_tablet_from_meta locks the tablet shard of each tablet id itself.
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    int load_tablet_threads = std::max<int>(1, config::load_tablet_thread_num);
+    RETURN_IF_ERROR(ThreadPoolBuilder("tablet_meta_load")
+                            .set_min_threads(load_tablet_threads)
+                            .set_max_threads(load_tablet_threads)
+                            .build(&load_tablet_pool));
+    auto do_load_tablet = [this, &tablet_ids, &failed_tablet_ids, &load_tablet_mutex](
+                                  int64_t tablet_id, int32_t schema_hash, const std::string& value) {
         Status st =
                 _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(load_tablet_mutex);
         if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
             // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
             // This may happen when the tablet was just deleted before the BE restarted,
@@ -295,10 +308,21 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) -> bool {
+        // the walk callback only borrows |value|, so copy it into the task.
+        Status submit_st = load_tablet_pool->submit_func(
+                [&do_load_tablet, tablet_id, schema_hash, value = std::string(value)]() {
+                    do_load_tablet(tablet_id, schema_hash, value);
+                });
+        if (!submit_st.ok()) {
+            do_load_tablet(tablet_id, schema_hash, std::string(value));
+        }
         return true;
     };
     Status load_tablet_status =
             TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, config::load_tablet_timeout_seconds);
+    load_tablet_pool->wait();
     if (load_tablet_status.is_time_out()) {
         LOG(WARNING) << "load tablets from rocksdb timeout, try to compact meta and retry. path: " << _path;
         Status s = _kv_store->compact();
@@ -317,7 +341,9 @@ Status DataDir::load() {
         tablet_ids.clear();
         failed_tablet_ids.clear();
         load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+        load_tablet_pool->wait();
     }
+    load_tablet_pool->shutdown();
 
     if (failed_tablet_ids.size() != 0) {
         LOG(ERROR) << "load tablets from header failed"
@@ -49,6 +49,7 @@
 #include "storage/kv_store.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset_id_generator.h"
+#include "util/token_bucket.h"
 
 namespace starrocks {
 
@@ -160,6 +161,14 @@ public:
     // for test
     size_t get_all_check_dcg_files_cnt() const { return _all_check_dcg_files.size(); }
 
+    // Token bucket all compaction tasks on this dir draw their IO budget from,
+    // see config::compaction_max_bytes_per_disk_per_sec.
+    TokenBucket* compaction_throttle() { return &_compaction_throttle; }
+
+    // Token bucket the storage migration tasks targeting this dir draw their IO budget
+    // from, see config::migration_max_bytes_per_disk_per_sec.
+    TokenBucket* migration_throttle() { return &_migration_throttle; }
+
 private:
     Status _init_data_dir();
     Status _init_tmp_dir();
@@ -198,6 +207,9 @@ private:
     KVStore* _kv_store = nullptr;
     RowsetIdGenerator* _id_generator = nullptr;
 
+    TokenBucket _compaction_throttle;
+    TokenBucket _migration_throttle;
+
     std::mutex _check_path_mutex;
     std::condition_variable _cv;
     std::set<std::string> _all_check_paths;
@@ -16,6 +16,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "util/raw_container.h"
 
@@ -31,6 +32,7 @@ void DelVector::set_empty() {
     _cardinality = 0;
     _memory_usage = 0;
     _roaring.reset();
+    _copy_source.reset();
 }
 
 void DelVector::_add_dels(const std::vector<uint32_t>& dels) {
@@ -46,12 +48,19 @@ void DelVector::add_dels_as_new_version(const std::vector<uint32_t>& dels, int64
                                         std::shared_ptr<DelVector>* pdelvec) const {
     DCHECK(this != pdelvec->get());
     DelVectorPtr tmp(new DelVector());
-    if (_roaring) {
+    if (_copy_source && config::enable_del_vector_cow) {
+        // all containers of |_copy_source| are already shared, so this copy only bumps
+        // refcounts and addMany below privatizes just the containers it touches
+        tmp->_roaring = std::make_unique<Roaring>(*_copy_source);
+    } else if (_roaring) {
         tmp->_roaring = std::make_unique<Roaring>(*_roaring);
     }
     tmp->_version = version;
     tmp->_loaded = true;
     tmp->_add_dels(dels);
+    if (config::enable_del_vector_cow) {
+        tmp->_init_copy_source();
+    }
     tmp.swap(*pdelvec);
 }
 
@@ -120,11 +129,25 @@ void DelVector::_update_stats() {
     }
 }
 
+void DelVector::_init_copy_source() {
+    // Must run before this DelVector becomes visible to readers: the COW copy rewrites the
+    // container array of |_roaring| into shared wrappers, which is only safe while private.
+    // Afterwards |_roaring| is never mutated again and reading shared containers is safe,
+    // CRoaring's shared container refcounts are atomic.
+    if (_roaring == nullptr) {
+        _copy_source.reset();
+        return;
+    }
+    _roaring->setCopyOnWrite(true);
+    _copy_source = std::make_unique<Roaring>(*_roaring);
+}
+
 void DelVector::copy_from(const DelVector& delvec) {
     _loaded = delvec._loaded;
     _version = delvec._version;
     _cardinality = delvec._cardinality;
     _memory_usage = delvec._memory_usage;
+    _copy_source.reset();
     if (delvec._roaring) {
         _roaring = std::make_unique<Roaring>(*delvec._roaring);
     } else {
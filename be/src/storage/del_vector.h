@@ -68,11 +68,19 @@ private:
 
     void _update_stats();
 
+    void _init_copy_source();
+
     bool _loaded = false;
     int64_t _version = 1;
     size_t _cardinality = 0;
     size_t _memory_usage = 0;
     std::unique_ptr<Roaring> _roaring;
+    // A copy-on-write alias of |_roaring| built while this DelVector was still private, used as
+    // the copy source when deriving the next version so unchanged containers are shared instead
+    // of deep-copied. It is only touched by the per-tablet serialized publish path and is never
+    // handed out to readers, so the container rewrites done by CRoaring's COW copy cannot race
+    // with concurrent scans over |_roaring|.
+    std::unique_ptr<Roaring> _copy_source;
 };
 
 typedef std::shared_ptr<DelVector> DelVectorPtr;
@@ -228,6 +228,28 @@ Status DeltaWriter::_init() {
             }
             writer_context.referenced_column_ids.push_back(index);
         }
+        // Resolve AUTO_MODE by cost: column mode writes delta column files carrying only the
+        // updated columns, row mode reads the missing columns and rewrites full rows. When the
+        // load touches a small fraction of the row's bytes the delta column files are much
+        // cheaper, otherwise row mode avoids the extra column merge on read and compaction.
+        if (_opt.partial_update_mode == PartialUpdateMode::AUTO_MODE) {
+            if (!_opt.merge_condition.empty() || _opt.miss_auto_increment_column) {
+                // conditional update and auto increment backfill are only handled by the row path
+                _opt.partial_update_mode = PartialUpdateMode::ROW_MODE;
+            } else {
+                size_t update_row_size = 0;
+                for (auto cid : writer_context.referenced_column_ids) {
+                    update_row_size += _tablet_schema->column(cid).estimate_field_size(16);
+                }
+                size_t full_row_size = _tablet_schema->estimate_row_size(16);
+                if (full_row_size > 0 &&
+                    update_row_size <= full_row_size * config::partial_update_auto_mode_column_ratio) {
+                    _opt.partial_update_mode = PartialUpdateMode::COLUMN_UPSERT_MODE;
+                } else {
+                    _opt.partial_update_mode = PartialUpdateMode::ROW_MODE;
+                }
+            }
+        }
         if (_opt.partial_update_mode == PartialUpdateMode::ROW_MODE) {
             // no need to control memtable row when using column mode, because we don't need to fill missing column
             int64_t average_row_size = _tablet->updates()->get_average_row_size();
@@ -359,7 +381,7 @@ Status DeltaWriter::_check_partial_update_with_sort_key(const Chunk& chunk) {
     return Status::OK();
 }
 
-Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size) {
+Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size, bool presorted) {
     SCOPED_THREAD_LOCAL_MEM_SETTER(_mem_tracker, false);
     RETURN_IF_ERROR(_check_partial_update_with_sort_key(chunk));
 
@@ -388,7 +410,7 @@ Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t
                 fmt::format("can't partial update for column with row. tablet_id: {}", _opt.tablet_id));
     }
     Status st;
-    ASSIGN_OR_RETURN(auto full, _mem_table->insert(chunk, indexes, from, size));
+    ASSIGN_OR_RETURN(auto full, _mem_table->insert(chunk, indexes, from, size, presorted));
     _last_write_ts = butil::gettimeofday_s();
     _write_buffer_size = _mem_table->write_buffer_size();
     if (_mem_tracker->limit_exceeded()) {
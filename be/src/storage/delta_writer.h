@@ -87,8 +87,10 @@ public:
 
     DISALLOW_COPY(DeltaWriter);
 
+    // |presorted| indicates that |indexes| enumerates the rows in sort-key order.
     // [NOT thread-safe]
-    [[nodiscard]] Status write(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size);
+    [[nodiscard]] Status write(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size,
+                               bool presorted = false);
 
     // [thread-safe]
     [[nodiscard]] Status write_segment(const SegmentPB& segment_pb, butil::IOBuf& data);
@@ -236,6 +236,10 @@ Status DictionaryCacheManager::commit(const PProcessDictionaryCacheRequest* requ
                 txn_id, ordered_mutable_cache->crbegin()->first));
     }
 
+    // freeze the committed cache into its read-only open-addressing layout before publishing
+    // it, so lookups probe the dense table and the build-time hash map memory is released
+    RETURN_IF_ERROR((*ordered_mutable_cache)[txn_id]->freeze());
+
     _dict_cache[dict_id] = nullptr;
     _dict_cache[dict_id].swap((*ordered_mutable_cache)[txn_id]);
     // The successful txn id will be used as the version number
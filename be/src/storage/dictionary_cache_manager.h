@@ -70,6 +70,11 @@ public:
 
     virtual inline Status lookup(Column* src, Column* dest, std::vector<uint8_t>& value_encode_flags) = 0;
 
+    // Re-lay the dictionary out as a dense read-only open-addressing table once the refresh
+    // commits. After freezing, lookups probe the flat table instead of the build-time hash
+    // map, and the hash map memory is released.
+    virtual Status freeze() = 0;
+
     virtual inline size_t memory_usage() = 0;
 
     virtual std::mutex& lock() = 0;
@@ -157,6 +162,10 @@ public:
             size_t size = src->size();
             const auto* raw_data = reinterpret_cast<const KeyCppType*>(src->raw_data());
 
+            if (_frozen.load(std::memory_order_acquire)) {
+                return _lookup_frozen(raw_data, size, dest, value_encode_flags);
+            }
+
             if (LIKELY(size >= 2 * PREFETCHN)) {
                 size_t beg_index = 0;
                 size_t loop = size / PREFETCHN;
@@ -229,11 +238,101 @@ public:
         return Status::OK();
     }
 
+    // Build the frozen open-addressing table (linear probing, load factor <= 0.5) from the
+    // build-time hash map and release the latter. Slice keys and values keep pointing into
+    // _pool, which stays owned by this cache, so only the bucket index is re-laid out.
+    // Must not run concurrently with insert() or lookup(); the manager freezes a cache
+    // under its write lock just before publishing it.
+    virtual Status freeze() override {
+        if (_frozen.load(std::memory_order_acquire)) {
+            return Status::OK();
+        }
+        size_t bucket_count = 16;
+        while (bucket_count < 2 * _dictionary.size()) {
+            bucket_count <<= 1;
+        }
+        try {
+            std::vector<FrozenEntry> buckets(bucket_count);
+            const size_t mask = bucket_count - 1;
+            for (const auto& [key, value] : _dictionary) {
+                size_t idx = DictionaryCacheHashTraits<KeyLogicalType>()(key) & mask;
+                while (buckets[idx].used) {
+                    idx = (idx + 1) & mask;
+                }
+                buckets[idx] = FrozenEntry{key, value, 1};
+            }
+            _frozen_buckets = std::move(buckets);
+        } catch (const std::bad_alloc&) {
+            return Status::MemoryAllocFailed("alloc frozen table for dictionary failed");
+        }
+        _frozen_mask = bucket_count - 1;
+        _estimated_memory_useage.fetch_add(bucket_count * sizeof(FrozenEntry));
+        _frozen.store(true, std::memory_order_release);
+        decltype(_dictionary) empty;
+        _dictionary.swap(empty);
+        return Status::OK();
+    }
+
     virtual inline size_t memory_usage() override { return _estimated_memory_useage.load(); }
 
     virtual std::mutex& lock() override { return _lock; }
 
 private:
+    struct FrozenEntry {
+        KeyCppType key;
+        ValueCppType value;
+        uint8_t used = 0;
+    };
+
+    inline const FrozenEntry* _find_frozen(const KeyCppType& key, size_t hash) const {
+        size_t idx = hash & _frozen_mask;
+        while (true) {
+            const FrozenEntry& entry = _frozen_buckets[idx];
+            if (!entry.used) {
+                return nullptr;
+            }
+            if (entry.key == key) {
+                return &entry;
+            }
+            idx = (idx + 1) & _frozen_mask;
+        }
+    }
+
+    inline Status _lookup_frozen(const KeyCppType* raw_data, size_t size, Column* dest,
+                                 std::vector<uint8_t>& value_encode_flags) {
+        size_t prefetch_hashes[PREFETCHN];
+        size_t i = 0;
+        // same interleaving idea as the hash map path: hash and prefetch N buckets, then probe
+        for (; i + PREFETCHN <= size; i += PREFETCHN) {
+            for (size_t j = 0; j < PREFETCHN; j++) {
+                prefetch_hashes[j] = DictionaryCacheHashTraits<KeyLogicalType>()(raw_data[i + j]);
+                PREFETCH_ADDR(&_frozen_buckets[prefetch_hashes[j] & _frozen_mask]);
+            }
+            for (size_t j = 0; j < PREFETCHN; j++) {
+                const FrozenEntry* entry = _find_frozen(raw_data[i + j], prefetch_hashes[j]);
+                if (entry == nullptr) {
+                    return Status::NotFound("key not found in dictionary cache");
+                }
+                dest->append_datum(Datum(entry->value));
+                if constexpr (std::is_same_v<ValueCppType, Slice>) {
+                    value_encode_flags[i + j] = *(reinterpret_cast<const uint8_t*>(entry->value.data) - 1);
+                }
+            }
+        }
+        for (; i < size; i++) {
+            const FrozenEntry* entry =
+                    _find_frozen(raw_data[i], DictionaryCacheHashTraits<KeyLogicalType>()(raw_data[i]));
+            if (entry == nullptr) {
+                return Status::NotFound("key not found in dictionary cache");
+            }
+            dest->append_datum(Datum(entry->value));
+            if constexpr (std::is_same_v<ValueCppType, Slice>) {
+                value_encode_flags[i] = *(reinterpret_cast<const uint8_t*>(entry->value.data) - 1);
+            }
+        }
+        return Status::OK();
+    }
+
     inline std::shared_ptr<Datum> _get_datum(const ValueCppType& v) {
         switch (_type) {
         case DictionaryCacheEncoderType::PK_ENCODE: {
@@ -274,6 +373,10 @@ private:
                                   phmap::priv::Allocator<phmap::priv::Pair<const KeyCppType, ValueCppType>>, 4,
                                   phmap::NullMutex, true>
             _dictionary;
+    // the frozen read-only table, populated by freeze() and probed by _lookup_frozen()
+    std::vector<FrozenEntry> _frozen_buckets;
+    size_t _frozen_mask = 0;
+    std::atomic<bool> _frozen{false};
     std::atomic<size_t> _estimated_memory_useage;
     std::mutex _lock;
     MemPool _pool;
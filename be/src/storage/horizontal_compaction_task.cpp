@@ -34,6 +34,12 @@ namespace starrocks {
 Status HorizontalCompactionTask::run_impl() {
     Statistics statistics;
     RETURN_IF_ERROR(_shortcut_compact(&statistics));
+    if (_output_rowset == nullptr) {
+        auto batches = _plan_incremental_batches();
+        if (batches.size() > 1) {
+            return _incremental_compact(batches, &statistics);
+        }
+    }
     RETURN_IF_ERROR(_horizontal_compact_data(&statistics));
 
     TRACE_COUNTER_INCREMENT("merged_rows", statistics.merged_rows);
@@ -128,6 +134,11 @@ StatusOr<size_t> HorizontalCompactionTask::_compact_data(int32_t chunk_size, Tab
     TRACE("[Compaction] start to compact data");
     auto status = Status::OK();
     size_t output_rows = 0;
+    // base values are non-zero when batches of an incremental compaction already finished,
+    // so the task progress keeps growing monotonically across batches
+    const size_t base_output_rows = _task_info.output_num_rows;
+    const size_t base_filtered_rows = _task_info.filtered_rows;
+    const size_t base_merged_rows = _task_info.merged_rows;
     auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
     auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
     while (LIKELY(!should_stop())) {
@@ -154,10 +165,11 @@ StatusOr<size_t> HorizontalCompactionTask::_compact_data(int32_t chunk_size, Tab
         ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet_schema, chunk.get());
 
         RETURN_IF_ERROR(output_rs_writer->add_chunk(*chunk));
+        _throttle_io(chunk->bytes_usage());
         output_rows += chunk->num_rows();
-        _task_info.output_num_rows = output_rows;
-        _task_info.filtered_rows = reader.stats().rows_del_filtered;
-        _task_info.merged_rows = reader.merged_rows();
+        _task_info.output_num_rows = base_output_rows + output_rows;
+        _task_info.filtered_rows = base_filtered_rows + reader.stats().rows_del_filtered;
+        _task_info.merged_rows = base_merged_rows + reader.merged_rows();
     }
     TRACE("[Compaction] data compacted");
 
@@ -169,4 +181,139 @@ StatusOr<size_t> HorizontalCompactionTask::_compact_data(int32_t chunk_size, Tab
     return output_rows;
 }
 
+std::vector<std::vector<RowsetSharedPtr>> HorizontalCompactionTask::_plan_incremental_batches() const {
+    int64_t batch_bytes = config::compaction_incremental_publish_batch_bytes;
+    if (batch_bytes <= 0 || static_cast<int64_t>(_task_info.input_rowsets_size) <= batch_bytes) {
+        return {};
+    }
+    for (const auto& rowset : _input_rowsets) {
+        // A delete predicate must be merged together with all the data it applies to.
+        // Committing it inside one batch would drop the predicate from the tablet meta
+        // before the other batches had a chance to filter their rows with it.
+        if (rowset->rowset_meta()->has_delete_predicate()) {
+            return {};
+        }
+    }
+
+    std::vector<std::vector<RowsetSharedPtr>> batches;
+    std::vector<RowsetSharedPtr> batch;
+    int64_t batch_size = 0;
+    for (const auto& rowset : _input_rowsets) {
+        batch.emplace_back(rowset);
+        batch_size += rowset->data_disk_size();
+        if (batch_size >= batch_bytes) {
+            batches.emplace_back(std::move(batch));
+            batch.clear();
+            batch_size = 0;
+        }
+    }
+    if (!batch.empty()) {
+        if (batches.empty()) {
+            batches.emplace_back(std::move(batch));
+        } else {
+            // fold the tail into the last full batch instead of publishing a tiny rowset
+            auto& last = batches.back();
+            last.insert(last.end(), batch.begin(), batch.end());
+        }
+    }
+    return batches;
+}
+
+Status HorizontalCompactionTask::_incremental_compact(const std::vector<std::vector<RowsetSharedPtr>>& batches,
+                                                      Statistics* statistics) {
+    TRACE("[Compaction] start incremental horizontal compaction, batches:$0", batches.size());
+    // Each batch replaces its input rowsets with the batch output under a version
+    // covering exactly those inputs, so every committed batch is immediately visible
+    // to queries and survives if the remaining batches never run.
+    for (const auto& batch : batches) {
+        RETURN_IF_ERROR(_compact_and_publish_batch(batch, statistics));
+    }
+
+    TRACE_COUNTER_INCREMENT("merged_rows", statistics->merged_rows);
+    TRACE_COUNTER_INCREMENT("filtered_rows", statistics->filtered_rows);
+    TRACE_COUNTER_INCREMENT("output_rows", statistics->output_rows);
+    TRACE("[Compaction] incremental horizontal compaction committed");
+    return Status::OK();
+}
+
+Status HorizontalCompactionTask::_compact_and_publish_batch(const std::vector<RowsetSharedPtr>& batch,
+                                                            Statistics* statistics) {
+    Version output_version(batch.front()->start_version(), batch.back()->end_version());
+    size_t input_rows_num = 0;
+    size_t input_rowsets_size = 0;
+    size_t segment_iterator_num = 0;
+    for (const auto& rowset : batch) {
+        input_rows_num += rowset->num_rows();
+        input_rowsets_size += rowset->data_disk_size();
+        segment_iterator_num += rowset->num_segments();
+    }
+
+    int64_t max_rows_per_segment =
+            CompactionUtils::get_segment_max_rows(config::max_segment_file_size, input_rows_num, input_rowsets_size);
+
+    std::unique_ptr<RowsetWriter> output_rs_writer;
+    RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(_tablet.get(), max_rows_per_segment,
+                                                                    _task_info.algorithm, output_version,
+                                                                    &output_rs_writer, _tablet_schema));
+
+    Schema schema = ChunkHelper::convert_schema(_tablet_schema);
+    TabletReader reader(std::static_pointer_cast<Tablet>(_tablet->shared_from_this()), output_rs_writer->version(),
+                        schema, _tablet_schema);
+    TabletReaderParams reader_params;
+    DCHECK(compaction_type() == BASE_COMPACTION || compaction_type() == CUMULATIVE_COMPACTION);
+    reader_params.reader_type =
+            compaction_type() == BASE_COMPACTION ? READER_BASE_COMPACTION : READER_CUMULATIVE_COMPACTION;
+    reader_params.profile = _runtime_profile.create_child("merge_rowsets");
+
+    int32_t chunk_size =
+            CompactionUtils::get_read_chunk_size(config::compaction_memory_limit_per_worker, config::vector_chunk_size,
+                                                 input_rows_num, input_rowsets_size, segment_iterator_num);
+    VLOG(1) << "compaction task_id:" << _task_info.task_id << ", tablet=" << _tablet->tablet_id()
+            << ", batch version=" << output_version << ", reader chunk size=" << chunk_size;
+    reader_params.chunk_size = chunk_size;
+    RETURN_IF_ERROR(reader.prepare());
+    RETURN_IF_ERROR(reader.open(reader_params));
+
+    ASSIGN_OR_RETURN(size_t output_rows, _compact_data(chunk_size, reader, schema, output_rs_writer.get()));
+    RETURN_IF_ERROR(output_rs_writer->flush());
+
+    StatusOr<RowsetSharedPtr> build_res = output_rs_writer->build();
+    if (!build_res.ok()) {
+        LOG(WARNING) << "rowset writer build failed. compaction task_id:" << _task_info.task_id
+                     << ", tablet:" << _task_info.tablet_id << " batch output_version=" << output_version;
+        return build_res.status();
+    }
+    RowsetSharedPtr batch_rowset = build_res.value();
+
+    if (config::enable_rowset_verify) {
+        RETURN_IF_ERROR(batch_rowset->verify());
+    }
+
+    // check row number per batch, same as _validate_compaction does for the whole task
+    size_t merged_rows = reader.merged_rows();
+    size_t filtered_rows = reader.stats().rows_del_filtered;
+    if (input_rows_num != batch_rowset->num_rows() + merged_rows + filtered_rows) {
+        LOG(WARNING) << "row_num does not match between batch input and output! "
+                     << "input_row_num=" << input_rows_num << ", merged_row_num=" << merged_rows
+                     << ", filtered_row_num=" << filtered_rows << ", output_row_num=" << batch_rowset->num_rows();
+        return Status::InternalError("compaction check lines error.");
+    }
+
+    RETURN_IF_ERROR(_commit_compaction(batch, batch_rowset));
+    TRACE("[Compaction] batch version [$0-$1] committed", output_version.first, output_version.second);
+
+    _task_info.output_segments_num += batch_rowset->num_segments();
+    _task_info.output_rowset_size += batch_rowset->data_disk_size();
+    TRACE_COUNTER_INCREMENT("output_rowset_data_size", batch_rowset->data_disk_size());
+    TRACE_COUNTER_INCREMENT("output_segments_num", batch_rowset->num_segments());
+    if (statistics) {
+        statistics->output_rows += output_rows;
+        statistics->merged_rows += merged_rows;
+        statistics->filtered_rows += filtered_rows;
+    }
+    // keep the last committed rowset so the success callback has something to preload
+    _output_rowset = batch_rowset;
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -37,6 +37,14 @@ private:
     Status _horizontal_compact_data(Statistics* statistics);
     StatusOr<size_t> _compact_data(int32_t chunk_size, TabletReader& reader, const Schema& schema,
                                    RowsetWriter* output_rs_writer);
+
+    // Split the input rowsets into consecutive batches of roughly
+    // config::compaction_incremental_publish_batch_bytes each, for publishing the
+    // compaction output incrementally. Returns an empty vector when the task should
+    // run as a single merge instead.
+    std::vector<std::vector<RowsetSharedPtr>> _plan_incremental_batches() const;
+    Status _incremental_compact(const std::vector<std::vector<RowsetSharedPtr>>& batches, Statistics* statistics);
+    Status _compact_and_publish_batch(const std::vector<RowsetSharedPtr>& batch, Statistics* statistics);
     void _failure_callback();
     void _success_callback();
 };
@@ -140,16 +140,36 @@ public:
         }
     }
 
+    // Convert a utf-8 value into the reusable _value_buffer. Values are
+    // overwhelmingly ASCII, where every byte widens to one TCHAR verbatim, so the
+    // per-row boost utf conversion (and its allocation) is only taken when a high
+    // bit shows up.
+    void convert_value_to_tchar(const char* s, size_t len) {
+        uint8_t high_bits = 0;
+        for (size_t i = 0; i < len; ++i) {
+            high_bits |= static_cast<uint8_t>(s[i]);
+        }
+        if ((high_bits & 0x80) == 0) {
+            _value_buffer.assign(s, s + len);
+        } else {
+            _value_buffer = boost::locale::conv::utf_to_utf<TCHAR>(s, s + len);
+        }
+    }
+
     void new_char_token_stream(const char* s, size_t len, lucene::document::Field* field) {
-        auto tchar = boost::locale::conv::utf_to_utf<TCHAR>(s, s + len);
-        _char_string_reader->init(tchar.c_str(), len, true);
+        convert_value_to_tchar(s, len);
+        // the buffer outlives the document add that consumes the stream, so the
+        // reader can reference it directly. Note the converted length is used, the
+        // utf-8 byte count overshoots it for multi-byte characters.
+        _char_string_reader->init(_value_buffer.c_str(), _value_buffer.size(), false);
         auto stream = _analyzer->reusableTokenStream(field->name(), _char_string_reader.get());
         field->setValue(stream);
     }
 
     void new_field_value(const char* s, size_t len, lucene::document::Field* field) {
-        auto field_value = boost::locale::conv::utf_to_utf<TCHAR>(s, s + len);
-        field->setValue(field_value.data(), true);
+        convert_value_to_tchar(s, len);
+        // the field duplicates the value internally
+        field->setValue(_value_buffer.data(), true);
     }
 
     void add_nulls(uint32_t count) override {
@@ -218,6 +238,7 @@ private:
     std::unique_ptr<lucene::index::IndexWriter> _index_writer{};
     std::unique_ptr<lucene::analysis::Analyzer> _analyzer{};
     std::unique_ptr<lucene::util::StringReader> _char_string_reader{};
+    std::basic_string<TCHAR> _value_buffer;
     std::string _directory;
     const TabletIndex* _index_meta;
     InvertedIndexParserType _parser_type;
@@ -44,6 +44,8 @@ Status MatchRangeOperator::_match_internal(lucene::search::HitCollector* hit_col
 
 Status MatchWildcardOperator::_match_internal(lucene::search::HitCollector* hit_collector) {
     auto wildcard_clucene_str = boost::algorithm::replace_all_copy(_wildcard, "%", "*");
+    // the sql like wildcard `_` matches exactly one character, same as clucene's `?`
+    boost::algorithm::replace_all(wildcard_clucene_str, "_", "?");
     std::wstring search_word(wildcard_clucene_str.begin(), wildcard_clucene_str.end());
     lucene::index::Term term(_field_name.c_str(), search_word.c_str());
 
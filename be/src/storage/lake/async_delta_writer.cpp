@@ -161,7 +161,7 @@ inline Status AsyncDeltaWriterImpl::do_open() {
         return Status::InternalError("StorageEngine::instance() is NULL");
     }
     bthread::ExecutionQueueOptions opts;
-    opts.executor = StorageEngine::instance()->async_delta_writer_executor();
+    opts.executor = StorageEngine::instance()->async_delta_writer_executor(tablet_id());
     if (UNLIKELY(opts.executor == nullptr)) {
         return Status::InternalError("AsyncDeltaWriterExecutor init failed");
     }
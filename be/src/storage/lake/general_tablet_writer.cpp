@@ -29,16 +29,32 @@
 
 namespace starrocks::lake {
 
+template <typename R>
+bool is_ready(std::future<R> const& f) {
+    return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
 HorizontalGeneralTabletWriter::HorizontalGeneralTabletWriter(TabletManager* tablet_mgr, int64_t tablet_id,
                                                              std::shared_ptr<const TabletSchema> schema, int64_t txn_id,
                                                              ThreadPool* flush_pool)
         : TabletWriter(tablet_mgr, tablet_id, std::move(schema), txn_id, flush_pool) {}
 
-HorizontalGeneralTabletWriter::~HorizontalGeneralTabletWriter() = default;
+HorizontalGeneralTabletWriter::~HorizontalGeneralTabletWriter() {
+    auto st = wait_futures_finish();
+    if (!st.ok()) {
+        LOG(WARNING) << "Fail to finalize segment, tablet_id: " << _tablet_id << ", txn_id: " << _txn_id
+                     << ", status:" << st;
+    }
+}
 
 // To developers: Do NOT perform any I/O in this method, because this method may be invoked
 // in a bthread.
 Status HorizontalGeneralTabletWriter::open() {
+    if (_flush_pool != nullptr) {
+        // Use CONCURRENT mode to ensure segments can finalize in parallel
+        _segment_finalize_token =
+                std::make_unique<ConcurrencyLimitedThreadPoolToken>(_flush_pool, _flush_pool->max_threads() * 2);
+    }
     return Status::OK();
 }
 
@@ -61,11 +77,17 @@ Status HorizontalGeneralTabletWriter::flush(SegmentPB* segment) {
 Status HorizontalGeneralTabletWriter::finish(SegmentPB* segment) {
     SCOPED_RAW_TIMER(&_stats.segment_write_ns);
     RETURN_IF_ERROR(flush_segment_writer(segment));
+    RETURN_IF_ERROR(wait_futures_finish());
     _finished = true;
     return Status::OK();
 }
 
 void HorizontalGeneralTabletWriter::close() {
+    // Background finalize tasks may still be writing segment files, wait for them before
+    // (possibly) deleting those files.
+    if (auto st = wait_futures_finish(); !st.ok()) {
+        VLOG(3) << "Fail to finalize segment, " << st;
+    }
     if (!_finished && !_files.empty()) {
         std::vector<std::string> full_paths_to_delete;
         full_paths_to_delete.reserve(_files.size());
@@ -89,6 +111,14 @@ Status HorizontalGeneralTabletWriter::reset_segment_writer() {
 }
 
 Status HorizontalGeneralTabletWriter::flush_segment_writer(SegmentPB* segment) {
+    if (_seg_writer == nullptr) {
+        return Status::OK();
+    }
+    // The caller needs no SegmentPB, so the segment can finalize (and upload) in the
+    // background while the next segment is being written.
+    if (_segment_finalize_token != nullptr && segment == nullptr) {
+        return submit_segment_finalize_task();
+    }
     if (_seg_writer != nullptr) {
         uint64_t segment_size = 0;
         uint64_t index_size = 0;
@@ -96,8 +126,11 @@ Status HorizontalGeneralTabletWriter::flush_segment_writer(SegmentPB* segment) {
         RETURN_IF_ERROR(_seg_writer->finalize(&segment_size, &index_size, &footer_position));
         const std::string& segment_path = _seg_writer->segment_path();
         std::string segment_name = std::string(basename(segment_path));
-        _files.emplace_back(FileInfo{segment_name, segment_size});
-        _data_size += segment_size;
+        {
+            std::lock_guard l(_files_mutex);
+            _files.emplace_back(FileInfo{segment_name, segment_size});
+            _data_size += segment_size;
+        }
         if (segment) {
             segment->set_data_size(segment_size);
             segment->set_index_size(index_size);
@@ -108,6 +141,69 @@ Status HorizontalGeneralTabletWriter::flush_segment_writer(SegmentPB* segment) {
     return Status::OK();
 }
 
+Status HorizontalGeneralTabletWriter::submit_segment_finalize_task() {
+    RETURN_IF_ERROR(check_futures());
+    std::shared_ptr<SegmentWriter> seg_writer = std::move(_seg_writer);
+    size_t file_index = 0;
+    {
+        // Record the file up front so close() can clean it up even if the task fails,
+        // the real size is filled in by the task once the segment has been finalized.
+        std::lock_guard l(_files_mutex);
+        file_index = _files.size();
+        _files.emplace_back(FileInfo{std::string(basename(seg_writer->segment_path())), 0});
+    }
+    auto mem_tracker = tls_thread_status.mem_tracker();
+    auto task = std::make_shared<std::packaged_task<Status()>>([this, seg_writer, file_index, mem_tracker]() {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        uint64_t segment_size = 0;
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        RETURN_IF_ERROR(seg_writer->finalize(&segment_size, &index_size, &footer_position));
+        std::lock_guard l(_files_mutex);
+        _files[file_index].size = segment_size;
+        _data_size += segment_size;
+        return Status::OK();
+    });
+    auto packaged_func = [task]() { (*task)(); };
+    auto timeout_deadline =
+            std::chrono::system_clock::now() + std::chrono::milliseconds(kDefaultTimeoutForAsyncWriteSegment);
+    auto st = _segment_finalize_token->submit_func(std::move(packaged_func), timeout_deadline);
+    if (!st.ok()) {
+        LOG(WARNING) << "Fail to submit segment finalizing task to thread pool, " << st;
+        return st;
+    }
+    _futures.push_back(task->get_future());
+    return Status::OK();
+}
+
+Status HorizontalGeneralTabletWriter::check_futures() {
+    for (auto it = _futures.begin(); it != _futures.end();) {
+        if (is_ready(*it)) {
+            auto st = it->get();
+            if (!st.ok()) {
+                LOG(WARNING) << "Segment finalizing task resulted in error: " << st;
+                return st;
+            }
+            it = _futures.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return Status::OK();
+}
+
+Status HorizontalGeneralTabletWriter::wait_futures_finish() {
+    Status ret = Status::OK();
+    for (auto& future : _futures) {
+        if (auto st = future.get(); !st.ok()) {
+            VLOG(3) << "Fail to finalize segment, " << st;
+            ret.update(st);
+        }
+    }
+    _futures.clear();
+    return ret;
+}
+
 VerticalGeneralTabletWriter::VerticalGeneralTabletWriter(TabletManager* tablet_mgr, int64_t tablet_id,
                                                          std::shared_ptr<const TabletSchema> schema, int64_t txn_id,
                                                          uint32_t max_rows_per_segment, ThreadPool* flush_pool)
@@ -293,11 +389,6 @@ Status VerticalGeneralTabletWriter::flush_columns(const std::shared_ptr<SegmentW
     return Status::OK();
 }
 
-template <typename R>
-bool is_ready(std::future<R> const& f) {
-    return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
-}
-
 Status VerticalGeneralTabletWriter::check_futures() {
     for (auto it = _futures.begin(); it != _futures.end();) {
         if (is_ready(*it)) {
@@ -16,6 +16,7 @@
 
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -67,8 +68,20 @@ public:
 protected:
     Status reset_segment_writer();
     virtual Status flush_segment_writer(SegmentPB* segment = nullptr);
+    Status submit_segment_finalize_task();
+    Status check_futures();
+    Status wait_futures_finish();
+
+    static constexpr int64_t kDefaultTimeoutForAsyncWriteSegment = 1 * 60 * 1000L; // 1 minutes
 
     std::unique_ptr<SegmentWriter> _seg_writer;
+    // Non-null iff a flush pool was provided. Full segments are then finalized and uploaded
+    // in the background while the next segment is being written, instead of blocking the
+    // write path on one upload at a time.
+    std::unique_ptr<ConcurrencyLimitedThreadPoolToken> _segment_finalize_token;
+    std::vector<std::future<Status>> _futures;
+    // protects _files and _data_size against concurrent updates from finalize tasks.
+    std::mutex _files_mutex;
 };
 
 class VerticalGeneralTabletWriter : public TabletWriter {
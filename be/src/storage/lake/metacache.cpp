@@ -16,6 +16,7 @@
 
 #include <bvar/bvar.h>
 
+#include "common/config.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "storage/del_vector.h"
 #include "storage/lake/tablet_manager.h"
@@ -88,8 +89,9 @@ Metacache::Metacache(int64_t cache_capacity) : _cache(new_lru_cache(cache_capaci
 
 Metacache::~Metacache() = default;
 
-void Metacache::insert(std::string_view key, CacheValue* ptr, size_t size) {
-    Cache::Handle* handle = _cache->insert(CacheKey(key), ptr, size, cache_value_deleter);
+void Metacache::insert(std::string_view key, CacheValue* ptr, size_t size, bool durable) {
+    auto priority = durable ? CachePriority::DURABLE : CachePriority::NORMAL;
+    Cache::Handle* handle = _cache->insert(CacheKey(key), ptr, size, cache_value_deleter, priority);
     _cache->release(handle);
 }
 
@@ -196,7 +198,9 @@ void Metacache::cache_segment(std::string_view key, std::shared_ptr<Segment> seg
 void Metacache::_cache_segment_no_lock(std::string_view key, std::shared_ptr<Segment> segment) {
     auto mem_cost = segment->mem_usage();
     auto value = std::make_unique<CacheValue>(std::move(segment));
-    insert(key, value.release(), mem_cost);
+    // segment footers are small and hot compared with tablet metadata and txn logs, so keep
+    // them durable: the cache evicts all normal-priority entries before touching durable ones.
+    insert(key, value.release(), mem_cost, config::lake_metacache_pin_segments);
 }
 
 std::shared_ptr<Segment> Metacache::cache_segment_if_absent(std::string_view key, std::shared_ptr<Segment> segment) {
@@ -227,6 +231,21 @@ void Metacache::cache_txn_log(std::string_view key, std::shared_ptr<const TxnLog
     insert(key, value_ptr.release(), log->SpaceUsedLong());
 }
 
+void Metacache::cache_txn_log_not_found(std::string_view key) {
+    auto value_ptr = std::make_unique<CacheValue>(TxnLogNotFound{});
+    insert(key, value_ptr.release(), sizeof(CacheValue));
+}
+
+bool Metacache::lookup_txn_log_not_found(std::string_view key) {
+    auto handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return false;
+    }
+    DeferOp defer([this, handle]() { _cache->release(handle); });
+    auto value = static_cast<CacheValue*>(_cache->value(handle));
+    return std::holds_alternative<TxnLogNotFound>(*value);
+}
+
 void Metacache::cache_tablet_schema(std::string_view key, std::shared_ptr<const TabletSchema> schema, size_t size) {
     auto cache_value = std::make_unique<CacheValue>(schema);
     insert(key, cache_value.release(), size);
@@ -34,9 +34,13 @@ namespace starrocks::lake {
 class TabletMetadataPB;
 class TxnLogPB;
 
+// Sentinel cached in place of a txn log that is known to be absent.
+struct TxnLogNotFound {};
+
 using CacheValue =
         std::variant<std::shared_ptr<const TabletMetadataPB>, std::shared_ptr<const TxnLogPB>,
-                     std::shared_ptr<const TabletSchema>, std::shared_ptr<const DelVector>, std::shared_ptr<Segment>>;
+                     std::shared_ptr<const TabletSchema>, std::shared_ptr<const DelVector>, std::shared_ptr<Segment>,
+                     TxnLogNotFound>;
 
 class Metacache {
 public:
@@ -62,6 +66,13 @@ public:
 
     void cache_txn_log(std::string_view key, std::shared_ptr<const TxnLogPB> log);
 
+    // record that the txn log file at |key| does not exist, so repeated publish retries do not
+    // re-read the object store. The entry is replaced by any later cache_txn_log() on the same key.
+    void cache_txn_log_not_found(std::string_view key);
+
+    // whether the txn log at |key| was previously recorded as absent.
+    bool lookup_txn_log_not_found(std::string_view key);
+
     void cache_segment(std::string_view key, std::shared_ptr<Segment> segment);
 
     // cache the segment if the given key not exists in the cache, returns the segment shared_ptr stored in the cache.
@@ -85,7 +96,7 @@ private:
     std::shared_ptr<Segment> _lookup_segment_no_lock(std::string_view key);
     void _cache_segment_no_lock(std::string_view key, std::shared_ptr<Segment> segment);
 
-    void insert(std::string_view key, CacheValue* ptr, size_t size);
+    void insert(std::string_view key, CacheValue* ptr, size_t size, bool durable = false);
 
     std::unique_ptr<Cache> _cache;
 
@@ -22,6 +22,7 @@
 
 #include "agent/master_info.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "fmt/format.h"
 #include "fs/fs.h"
 #include "fs/fs_util.h"
@@ -45,6 +46,8 @@
 #include "storage/rowset/segment.h"
 #include "storage/tablet_schema_map.h"
 #include "testutil/sync_point.h"
+#include "util/coding.h"
+#include "util/compression/block_compression.h"
 #include "util/raw_container.h"
 #include "util/trace.h"
 
@@ -60,6 +63,56 @@ static bvar::LatencyRecorder g_get_txn_log_latency("lake", "get_txn_log");
 static bvar::LatencyRecorder g_put_txn_log_latency("lake", "put_txn_log");
 static bvar::LatencyRecorder g_del_txn_log_latency("lake", "del_txn_log");
 
+// Compressed tablet metadata objects are laid out as: 4-byte magic, 8-byte little
+// endian uncompressed size, zstd frame. A raw TabletMetadataPB always starts with
+// the tag of its lowest-numbered field, which can never equal the magic, so readers
+// tell the two layouts apart without any out-of-band information.
+static const char kCompressedMetadataMagic[4] = {'\xff', 'Z', 'S', 'T'};
+
+static bool is_compressed_tablet_metadata(std::string_view data) {
+    return data.size() >= sizeof(kCompressedMetadataMagic) + sizeof(uint64_t) &&
+           memcmp(data.data(), kCompressedMetadataMagic, sizeof(kCompressedMetadataMagic)) == 0;
+}
+
+static Status save_compressed_tablet_metadata(const std::string& path, const TabletMetadata& metadata) {
+    std::string serialized;
+    if (!metadata.SerializeToString(&serialized)) {
+        return Status::InternalError(fmt::format("failed to serialize tablet metadata {}", path));
+    }
+    const BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(CompressionTypePB::ZSTD, &codec));
+    raw::RawString compressed;
+    compressed.resize(codec->max_compressed_len(serialized.size()));
+    Slice compressed_slice(compressed.data(), compressed.size());
+    RETURN_IF_ERROR(codec->compress(Slice(serialized), &compressed_slice));
+    uint8_t size_buf[sizeof(uint64_t)];
+    encode_fixed64_le(size_buf, serialized.size());
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(path));
+    WritableFileOptions opts{.sync_on_close = true, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
+    ASSIGN_OR_RETURN(auto file, fs->new_writable_file(opts, path));
+    RETURN_IF_ERROR(file->append(Slice(kCompressedMetadataMagic, sizeof(kCompressedMetadataMagic))));
+    RETURN_IF_ERROR(file->append(Slice(size_buf, sizeof(size_buf))));
+    RETURN_IF_ERROR(file->append(compressed_slice));
+    return file->close();
+}
+
+static Status parse_compressed_tablet_metadata(const std::string& path, std::string_view data,
+                                               TabletMetadataPB* metadata) {
+    const BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(CompressionTypePB::ZSTD, &codec));
+    data.remove_prefix(sizeof(kCompressedMetadataMagic));
+    uint64_t uncompressed_size = decode_fixed64_le(reinterpret_cast<const uint8_t*>(data.data()));
+    data.remove_prefix(sizeof(uint64_t));
+    std::string serialized;
+    raw::stl_string_resize_uninitialized(&serialized, uncompressed_size);
+    Slice output(serialized.data(), serialized.size());
+    RETURN_IF_ERROR(codec->decompress(Slice(data.data(), data.size()), &output));
+    if (!metadata->ParseFromArray(output.data, static_cast<int>(output.size))) {
+        return Status::Corruption(fmt::format("failed to parse compressed tablet metadata {}", path));
+    }
+    return Status::OK();
+}
+
 TabletManager::TabletManager(LocationProvider* location_provider, UpdateManager* update_mgr, int64_t cache_capacity)
         : _location_provider(location_provider),
           _metacache(std::make_unique<Metacache>(cache_capacity)),
@@ -201,8 +254,12 @@ Status TabletManager::put_tablet_metadata(const TabletMetadataPtr& metadata) {
     auto t0 = butil::gettimeofday_us();
     auto filepath = tablet_metadata_location(metadata->id(), metadata->version());
 
-    ProtobufFile file(filepath);
-    RETURN_IF_ERROR(file.save(*metadata));
+    if (config::lake_compress_tablet_metadata) {
+        RETURN_IF_ERROR(save_compressed_tablet_metadata(filepath, *metadata));
+    } else {
+        ProtobufFile file(filepath);
+        RETURN_IF_ERROR(file.save(*metadata));
+    }
 
     _metacache->cache_tablet_metadata(filepath, metadata);
     bool skip_cache_latest_metadata = false;
@@ -227,8 +284,15 @@ StatusOr<TabletMetadataPtr> TabletManager::load_tablet_metadata(const string& me
     TEST_ERROR_POINT("TabletManager::load_tablet_metadata");
     auto t0 = butil::gettimeofday_us();
     auto metadata = std::make_shared<TabletMetadataPB>();
-    ProtobufFile file(metadata_location);
-    RETURN_IF_ERROR(file.load(metadata.get(), fill_cache));
+    RandomAccessFileOptions opts{.skip_fill_local_cache = !fill_cache};
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(metadata_location));
+    ASSIGN_OR_RETURN(auto input_file, fs->new_random_access_file(opts, metadata_location));
+    ASSIGN_OR_RETURN(auto serialized, input_file->read_all());
+    if (is_compressed_tablet_metadata(serialized)) {
+        RETURN_IF_ERROR(parse_compressed_tablet_metadata(metadata_location, serialized, metadata.get()));
+    } else if (!metadata->ParseFromString(serialized)) {
+        return Status::Corruption(fmt::format("failed to parse tablet metadata file {}", metadata_location));
+    }
     g_get_tablet_metadata_latency << (butil::gettimeofday_us() - t0);
     return std::move(metadata);
 }
@@ -307,7 +371,18 @@ StatusOr<TxnLogPtr> TabletManager::get_txn_log(const std::string& path, bool fil
         TRACE("got cached txn log");
         return ptr;
     }
-    ASSIGN_OR_RETURN(auto ptr, load_txn_log(path, fill_cache));
+    if (config::lake_metacache_negative_txn_log && _metacache->lookup_txn_log_not_found(path)) {
+        TRACE("got cached txn log absence");
+        return Status::NotFound(fmt::format("{} not found", path));
+    }
+    auto res = load_txn_log(path, fill_cache);
+    if (!res.ok()) {
+        if (res.status().is_not_found() && fill_cache && config::lake_metacache_negative_txn_log) {
+            _metacache->cache_txn_log_not_found(path);
+        }
+        return res.status();
+    }
+    auto ptr = std::move(res).value();
     if (fill_cache) {
         _metacache->cache_txn_log(path, ptr);
     }
@@ -394,7 +394,8 @@ Status TabletReader::init_collector(const TabletReaderParams& params) {
         } else {
             _collect_iter = new_heap_merge_iterator(seg_iters);
         }
-    } else if (params.sorted_by_keys_per_tablet && (keys_type == DUP_KEYS || keys_type == PRIMARY_KEYS) &&
+    } else if (params.sorted_by_keys_per_tablet &&
+               (keys_type == DUP_KEYS || keys_type == PRIMARY_KEYS || (keys_type == UNIQUE_KEYS && skip_aggr)) &&
                seg_iters.size() > 1) {
         if (params.profile != nullptr && (params.is_pipeline || params.profile->parent() != nullptr)) {
             RuntimeProfile* p;
@@ -14,23 +14,29 @@
 
 #include "storage/memtable.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 
 #include "column/binary_column.h"
 #include "column/json_column.h"
 #include "common/logging.h"
+#include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "storage/chunk_helper.h"
+#include "storage/memtable_flush_executor.h"
 #include "storage/memtable_sink.h"
 #include "storage/primary_key_encoder.h"
+#include "storage/storage_engine.h"
 #include "storage/row_store_encoder.h"
 #include "storage/row_store_encoder_factory.h"
 #include "storage/tablet_schema.h"
 #include "types/logical_type_infra.h"
+#include "util/countdown_latch.h"
 #include "util/starrocks_metrics.h"
 #include "util/time.h"
 
@@ -161,7 +167,8 @@ bool MemTable::check_supported_column_partial_update(const Chunk& chunk) {
            chunk.num_columns() == _vectorized_schema->num_fields() - 1;
 }
 
-StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size) {
+StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size,
+                                bool presorted) {
     if (_chunk == nullptr) {
         _chunk = ChunkHelper::new_chunk(*_vectorized_schema, 0);
     }
@@ -190,6 +197,19 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
     }
 
     size_t cur_row_count = _chunk->num_rows();
+    // Grow all buffer columns to the batch's end row in one pass before appending.
+    // With a 1000+ column schema, letting every column double its capacity on its
+    // own inside append_selective scatters reallocations through the batch; one
+    // up-front reservation keeps each append writing sequentially into ready memory.
+    if (cur_row_count == 0) {
+        // the buffer was freshly created or recycled by a merge, its real capacity
+        // is unknown, so start the growth ladder over.
+        _reserved_rows = 0;
+    }
+    if (cur_row_count + size > _reserved_rows) {
+        _reserved_rows = std::max<size_t>(cur_row_count + size, _reserved_rows * 2);
+        _chunk->reserve(_reserved_rows);
+    }
     if (_slot_descs != nullptr) {
         // For schema change, FE will construct a shadow column.
         // The shadow column is not exist in _vectorized_schema
@@ -215,6 +235,16 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
         }
     }
 
+    // For duplicate-key tables the buffer is flushed as-is after one sort, so contiguous
+    // presorted slices can be remembered as sorted runs and merged at finalize. Stop
+    // recording as soon as one slice arrives unsorted, finalize then falls back to a
+    // full sort.
+    if (presorted && _keys_type == KeysType::DUP_KEYS &&
+        ((cur_row_count == 0 && _sorted_run_offsets.empty()) ||
+         (!_sorted_run_offsets.empty() && _sorted_run_offsets.back() == cur_row_count))) {
+        _sorted_run_offsets.push_back(cur_row_count + size);
+    }
+
     if (chunk.has_rows()) {
         _chunk_memory_usage += chunk.memory_usage() * size / chunk.num_rows();
         _chunk_bytes_usage += _chunk->bytes_usage(cur_row_count, size);
@@ -263,7 +293,15 @@ Status MemTable::finalize() {
                 _aggregator->aggregate_reset();
 
                 int64_t t1 = MonotonicMicros();
-                RETURN_IF_ERROR(_sort(true));
+                // The aggregator result is a concatenation of the sorted runs produced
+                // by the intermediate merges, so the final ordering can be restored by
+                // merging the runs instead of a full O(n*log(n)) re-sort.
+                if (config::enable_memtable_finalize_by_merge && _sorted_run_offsets.size() > 1 &&
+                    _sorted_run_offsets.back() == _chunk->num_rows()) {
+                    RETURN_IF_ERROR(_merge_sorted_runs());
+                } else {
+                    RETURN_IF_ERROR(_sort(true));
+                }
                 int64_t t2 = MonotonicMicros();
                 _aggregate(true);
                 int64_t t3 = MonotonicMicros();
@@ -312,7 +350,19 @@ Status MemTable::finalize() {
             _aggregator_memory_usage = 0;
             _aggregator_bytes_usage = 0;
         } else {
-            RETURN_IF_ERROR(_sort(true));
+            bool runs_cover_buffer =
+                    !_sorted_run_offsets.empty() && _sorted_run_offsets.back() == _chunk->num_rows();
+            if (runs_cover_buffer && _sorted_run_offsets.size() == 1) {
+                // a single sorted run, hand the buffer over without copying.
+                _result_chunk = _chunk;
+                _chunk.reset();
+                _chunk_memory_usage = 0;
+                _chunk_bytes_usage = 0;
+            } else if (config::enable_memtable_finalize_by_merge && runs_cover_buffer) {
+                RETURN_IF_ERROR(_merge_sorted_runs());
+            } else {
+                RETURN_IF_ERROR(_sort(true));
+            }
         }
     }
 
@@ -335,6 +385,10 @@ Status MemTable::flush(SegmentPB* seg_info) {
         SCOPED_RAW_TIMER(&duration_ns);
         if (_deletes) {
             RETURN_IF_ERROR(_sink->flush_chunk_with_deletes(*_result_chunk, *_deletes, seg_info));
+        } else if (seg_info == nullptr && config::enable_parallel_memtable_flush &&
+                   _result_chunk->num_rows() >= 2 * config::parallel_memtable_flush_rows_per_segment) {
+            // The caller needs no SegmentPB, so the flush may produce several segments.
+            RETURN_IF_ERROR(_flush_in_parallel());
         } else {
             RETURN_IF_ERROR(_sink->flush_chunk(*_result_chunk, seg_info));
         }
@@ -353,6 +407,65 @@ Status MemTable::flush(SegmentPB* seg_info) {
     return Status::OK();
 }
 
+Status MemTable::_flush_in_parallel() {
+    const size_t num_rows = _result_chunk->num_rows();
+    const size_t rows_per_segment = config::parallel_memtable_flush_rows_per_segment;
+    const size_t num_segments = std::min<size_t>((num_rows + rows_per_segment - 1) / rows_per_segment,
+                                                 config::parallel_memtable_flush_max_segments);
+    const size_t rows_per_slice = (num_rows + num_segments - 1) / num_segments;
+
+    // The result chunk is sorted, so contiguous slices keep every segment internally
+    // sorted and their key ranges disjoint and ascending.
+    auto* flush_pool = StorageEngine::instance()->memtable_flush_executor()->get_thread_pool();
+    auto* parent_mem_tracker = CurrentThread::mem_tracker();
+
+    // The subtasks run on the same pool as the parent flush task, so the calling thread
+    // must never block on work that is still queued: when every worker is occupied by a
+    // parent task, the queued subtasks would never start and all flushes would deadlock.
+    // Instead every thread claims slices from a shared counter, the calling thread
+    // drains whatever the workers do not pick up, and the latch counts completed slices,
+    // so the caller only waits for slices some thread is actually flushing. A subtask
+    // that starts after all slices are claimed touches nothing but the shared context,
+    // which it keeps alive, so it may safely outlive this call.
+    struct FlushSliceContext {
+        explicit FlushSliceContext(size_t num_slices) : statuses(num_slices), latch(static_cast<int>(num_slices)) {}
+        std::atomic<size_t> next_slice{0};
+        std::vector<Status> statuses;
+        CountDownLatch latch;
+    };
+    auto ctx = std::make_shared<FlushSliceContext>(num_segments);
+
+    auto flush_slice = [this, ctx, num_rows, rows_per_slice](size_t slice_idx) {
+        size_t from = slice_idx * rows_per_slice;
+        size_t size = std::min(rows_per_slice, num_rows - from);
+        ChunkPtr slice = _result_chunk->clone_empty_with_schema(size);
+        slice->append(*_result_chunk, from, size);
+        ctx->statuses[slice_idx] = _sink->flush_chunk(*slice, nullptr);
+        ctx->latch.count_down();
+    };
+
+    for (size_t i = 1; i < num_segments; ++i) {
+        // a failed submit needs no fallback, the calling thread claims the slice below
+        (void)flush_pool->submit_func([flush_slice, ctx, parent_mem_tracker, num_segments]() {
+            size_t idx = ctx->next_slice.fetch_add(1);
+            if (idx >= num_segments) {
+                return;
+            }
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(parent_mem_tracker);
+            flush_slice(idx);
+        });
+    }
+    for (size_t idx = ctx->next_slice.fetch_add(1); idx < num_segments; idx = ctx->next_slice.fetch_add(1)) {
+        flush_slice(idx);
+    }
+    ctx->latch.wait();
+
+    for (const auto& st : ctx->statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 Status MemTable::_merge() {
     if (_chunk == nullptr || _keys_type == KeysType::DUP_KEYS) {
         return Status::OK();
@@ -365,6 +478,12 @@ Status MemTable::_merge() {
     int64_t t3 = MonotonicMicros();
     VLOG(1) << strings::Substitute("memtable sort:$0 agg:$1 total:$2", t2 - t1, t3 - t2, t3 - t1);
     ++_merge_count;
+    // each merge appends one sorted run to the aggregator result, remember the run
+    // boundary so finalize can merge the runs instead of re-sorting everything.
+    uint32_t aggregate_rows = _aggregator->aggregate_rows();
+    if (_sorted_run_offsets.empty() || aggregate_rows > _sorted_run_offsets.back()) {
+        _sorted_run_offsets.push_back(aggregate_rows);
+    }
     return Status::OK();
 }
 
@@ -486,8 +605,7 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
     return Status::OK();
 }
 
-Status MemTable::_sort_column_inc(bool by_sort_key) {
-    Columns columns;
+Status MemTable::_build_sort_info(bool by_sort_key, std::vector<ColumnId>* column_idxes, SortDescs* sort_descs) {
     std::vector<ColumnId> sort_key_idxes;
     if (by_sort_key) {
         sort_key_idxes = _vectorized_schema->sort_key_idxes();
@@ -516,23 +634,84 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
         }
     }
 
-    for (auto sort_key_idx : sort_key_idxes) {
-        columns.push_back(_chunk->get_column_by_index(sort_key_idx));
-    }
-
-    auto sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
+    *sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
     if (!_merge_condition.empty()) {
         for (int i = 0; i < _vectorized_schema->num_fields(); ++i) {
             if (_vectorized_schema->field(i)->name() == _merge_condition) {
-                columns.push_back(_chunk->get_column_by_index(i));
-                sort_descs.descs.emplace_back(1, -1);
+                sort_key_idxes.push_back(i);
+                sort_descs->descs.emplace_back(1, -1);
                 break;
             }
         }
     }
+    *column_idxes = std::move(sort_key_idxes);
+    return Status::OK();
+}
+
+Status MemTable::_sort_column_inc(bool by_sort_key) {
+    std::vector<ColumnId> column_idxes;
+    SortDescs sort_descs;
+    RETURN_IF_ERROR(_build_sort_info(by_sort_key, &column_idxes, &sort_descs));
 
+    Columns columns;
+    for (auto column_idx : column_idxes) {
+        columns.push_back(_chunk->get_column_by_index(column_idx));
+    }
     Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
     return st;
 }
 
+Status MemTable::_merge_sorted_runs() {
+    std::vector<ColumnId> column_idxes;
+    SortDescs sort_descs;
+    RETURN_IF_ERROR(_build_sort_info(_keys_type != KeysType::PRIMARY_KEYS, &column_idxes, &sort_descs));
+
+    auto make_orderby = [&](const ChunkPtr& chunk) {
+        Columns orderby;
+        for (auto column_idx : column_idxes) {
+            orderby.push_back(chunk->get_column_by_index(column_idx));
+        }
+        return orderby;
+    };
+
+    // the runs are views into _chunk at the recorded boundaries, no copy yet.
+    SortedRun base(_chunk, make_orderby(_chunk));
+    std::vector<SortedRun> runs;
+    uint32_t prev_offset = 0;
+    for (uint32_t offset : _sorted_run_offsets) {
+        runs.emplace_back(base, prev_offset, offset);
+        prev_offset = offset;
+    }
+    base.reset();
+
+    // cascade the runs pairwise, so every row is moved O(log(num_runs)) times. On equal
+    // keys the merge emits the left (older) run first, preserving the insertion order
+    // the replace/aggregate semantics of the final aggregation pass rely on.
+    while (runs.size() > 1) {
+        std::vector<SortedRun> merged_runs;
+        for (size_t i = 0; i + 1 < runs.size(); i += 2) {
+            Permutation perm;
+            RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_descs, runs[i], runs[i + 1], &perm));
+            ChunkPtr merged = runs[i].chunk->clone_empty_with_schema(perm.size());
+            materialize_by_permutation(merged.get(), {runs[i].chunk, runs[i + 1].chunk}, perm);
+            runs[i].reset();
+            runs[i + 1].reset();
+            merged_runs.emplace_back(merged, make_orderby(merged));
+        }
+        if ((runs.size() % 2) == 1) {
+            merged_runs.emplace_back(std::move(runs.back()));
+        }
+        runs.swap(merged_runs);
+        // the remaining views keep the source buffer alive, drop our own reference so
+        // it is released as soon as the last view is materialized.
+        _chunk.reset();
+    }
+
+    // the cascade always ends with a single fully materialized run.
+    _result_chunk = runs[0].chunk;
+    _chunk_memory_usage = 0;
+    _chunk_bytes_usage = 0;
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -18,6 +18,7 @@
 
 #include "column/chunk.h"
 #include "exec/sorting/sort_permute.h"
+#include "exec/sorting/sorting.h"
 #include "gen_cpp/data.pb.h"
 #include "gen_cpp/olap_file.pb.h"
 #include "storage/chunk_aggregator.h"
@@ -53,8 +54,11 @@ public:
     size_t write_buffer_size() const;
     size_t write_buffer_rows() const;
 
+    // |presorted| indicates that |indexes| enumerates the inserted rows in sort-key order,
+    // so the appended slice forms one sorted run that finalize can merge instead of re-sort.
     // return true suggests caller should flush this memory table
-    StatusOr<bool> insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size);
+    StatusOr<bool> insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size,
+                          bool presorted = false);
 
     Status flush(SegmentPB* seg_info = nullptr);
 
@@ -74,8 +78,16 @@ public:
 private:
     Status _merge();
 
+    // Range-partitions the sorted result chunk into contiguous slices and encodes
+    // one segment per slice concurrently on the memtable flush thread pool.
+    Status _flush_in_parallel();
+
     Status _sort(bool is_final, bool by_sort_key = false);
     Status _sort_column_inc(bool by_sort_key = false);
+    Status _build_sort_info(bool by_sort_key, std::vector<ColumnId>* column_idxes, SortDescs* sort_descs);
+    // Merges the sorted runs recorded in |_sorted_run_offsets| into _result_chunk,
+    // replacing the full re-sort of the aggregator result at finalize.
+    Status _merge_sorted_runs();
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     void _init_aggregator_if_needed();
@@ -85,11 +97,20 @@ private:
 
     ChunkPtr _chunk;
     ChunkPtr _result_chunk;
+    // row capacity the buffer columns have been reserved to. insert() grows it in
+    // doubling steps and reserves every column in one pass, so very wide schemas do
+    // not leave each of their columns to reallocate independently mid-append.
+    size_t _reserved_rows = 0;
 
     // for sort by columns
     SmallPermutation _permutations;
     std::vector<uint32_t> _selective_values;
 
+    // Cumulative row counts of the aggregator result after each _merge(). Each merge
+    // appends one sorted run to the aggregator result, so these offsets delimit runs
+    // that finalize can merge instead of re-sorting the whole buffer.
+    std::vector<uint32_t> _sorted_run_offsets;
+
     int64_t _tablet_id;
 
     const Schema* _vectorized_schema;
@@ -21,7 +21,9 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/datum_convert.h"
+#include "column/object_column.h"
 #include "common/status.h"
+#include "types/hll.h"
 #include "runtime/global_dict/config.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
@@ -29,7 +31,8 @@
 
 namespace starrocks {
 
-std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"dict_merge", "max", "min", "count"};
+std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"dict_merge", "max", "min", "count",
+                                                                         "ndv_hll"};
 
 Status SegmentMetaCollecter::parse_field_and_colname(const std::string& item, std::string* field,
                                                      std::string* col_name) {
@@ -126,6 +129,11 @@ Status MetaReader::_fill_result_chunk(Chunk* chunk) {
             desc.children.emplace_back(item_desc);
             ColumnPtr column = ColumnHelper::create_column(desc, false);
             chunk->append_column(std::move(column), slot->id());
+        } else if (field == "ndv_hll") {
+            TypeDescriptor desc;
+            desc.type = TYPE_HLL;
+            ColumnPtr column = ColumnHelper::create_column(desc, _has_count_agg);
+            chunk->append_column(std::move(column), slot->id());
         } else {
             ColumnPtr column = ColumnHelper::create_column(slot->type(), _has_count_agg);
             chunk->append_column(std::move(column), slot->id());
@@ -214,6 +222,8 @@ Status SegmentMetaCollecter::_collect(const std::string& name, ColumnId cid, Col
         return _collect_min(cid, column, type);
     } else if (name == "count") {
         return _collect_count(column, type);
+    } else if (name == "ndv_hll") {
+        return _collect_ndv_hll(cid, column);
     }
     return Status::NotSupported("Not Support Collect Meta: " + name);
 }
@@ -305,6 +315,37 @@ Status SegmentMetaCollecter::__collect_max_or_min(ColumnId cid, Column* column,
     return Status::OK();
 }
 
+// collect the per-segment HyperLogLog sketch written by the segment writer, the
+// aggregation above the meta scan merges the sketches of all segments to answer an
+// approximate distinct count without touching the data pages.
+Status SegmentMetaCollecter::_collect_ndv_hll(ColumnId cid, Column* column) {
+    if (cid >= _segment->num_columns()) {
+        return Status::NotFound("");
+    }
+    const ColumnReader* col_reader = _segment->column(cid);
+    if (col_reader == nullptr || col_reader->ndv_hll() == nullptr) {
+        return Status::NotFound("segment has no ndv sketch");
+    }
+    HyperLogLog hll;
+    if (!hll.deserialize(Slice(*col_reader->ndv_hll()))) {
+        return Status::Corruption("invalid ndv sketch");
+    }
+
+    [[maybe_unused]] NullableColumn* nullable_column = nullptr;
+    HyperLogLogColumn* hll_column = nullptr;
+    if (column->is_nullable()) {
+        nullable_column = down_cast<NullableColumn*>(column);
+        hll_column = down_cast<HyperLogLogColumn*>(nullable_column->mutable_data_column());
+    } else {
+        hll_column = down_cast<HyperLogLogColumn*>(column);
+    }
+    hll_column->append(std::move(hll));
+    if (column->is_nullable()) {
+        nullable_column->null_column_data().emplace_back(0);
+    }
+    return Status::OK();
+}
+
 Status SegmentMetaCollecter::_collect_count(Column* column, LogicalType type) {
     uint32_t num_rows = _segment->num_rows();
     column->append_datum(int64_t(num_rows));
@@ -164,6 +164,13 @@ struct RuntimeColumnPredicateBuilder {
 
         auto max_value = parser.max_value();
         (void)range.add_range(max_op, static_cast<value_type>(max_value));
+
+        // A runtime filter that collapsed to a single value becomes an EQ predicate,
+        // so the scan can probe the segment's bloom filter index in addition to the
+        // zone map, instead of decoding pages inside the [min, max] interval.
+        if (filter->left_close_interval() && filter->right_close_interval() && min_value == max_value) {
+            (void)range.add_fixed_values(FILTER_IN, {static_cast<value_type>(min_value)});
+        }
     }
 };
 } // namespace detail
@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -52,6 +53,29 @@ class MemTracker;
 // Page cache min size is 256MB
 static constexpr int64_t kcacheMinSize = 268435456;
 
+// Per-resource-group page cache accounting. The stats object is owned by the
+// resource group and threaded down the read path through the reader options,
+// so the page cache itself stays unaware of resource groups.
+//
+// The quota is soft: a group that exceeds its share keeps probing the cache
+// but stops populating it, so its pages age out of the LRU first while the
+// working sets of the other groups stay put. `inserted_bytes` is a decayed
+// estimate of the bytes the group inserted recently, halved on every metrics
+// update, so a group that backs off regains its fill permission.
+struct PageCacheGroupStats {
+    std::atomic<int64_t> lookup_count{0};
+    std::atomic<int64_t> hit_count{0};
+    // decayed estimate of the bytes this group inserted recently
+    std::atomic<int64_t> inserted_bytes{0};
+    // soft quota in bytes, <= 0 means unlimited
+    std::atomic<int64_t> quota_bytes{0};
+
+    bool over_quota() const {
+        int64_t quota = quota_bytes.load(std::memory_order_relaxed);
+        return quota > 0 && inserted_bytes.load(std::memory_order_relaxed) > quota;
+    }
+};
+
 // Warpper around Cache, and used for cache page of column datas
 // in Segment.
 // TODO(zc): We should add some metric to see cache hit/miss rate.
@@ -968,7 +968,9 @@ private:
     phmap::flat_hash_map<KeyType, IndexValue, FixedKeyHash<KeySize>> _map;
 };
 
-std::tuple<size_t, size_t> MutableIndex::estimate_nshard_and_npage(const size_t total_kv_pairs_usage) {
+std::tuple<size_t, size_t> MutableIndex::estimate_nshard_and_npage(const size_t total_kv_pairs_usage,
+                                                                   const size_t max_input_shard_usage,
+                                                                   const size_t num_input_shards) {
     // if size == 0, will return { nshard:1, npage:0 }, meaning an empty shard
     size_t cap = total_kv_pairs_usage * 100 / kDefaultUsagePercent;
     size_t nshard = 1;
@@ -978,6 +980,19 @@ std::tuple<size_t, size_t> MutableIndex::estimate_nshard_and_npage(const size_t
             break;
         }
     }
+    // Adaptive shard split for skewed inputs: hash sharding keeps a shard's relative
+    // weight across compactions, so sizing shards by the average alone carries an
+    // oversized shard from one compaction to the next. Raise the shard count by the
+    // observed max/avg ratio so the hot shards are cut into smaller pieces. Shard
+    // ranges nest by powers of two, this is purely a sizing decision.
+    if (config::enable_pindex_shard_split && num_input_shards > 0 && total_kv_pairs_usage > 0) {
+        const size_t avg_input_shard_usage = std::max<size_t>(1, total_kv_pairs_usage / num_input_shards);
+        size_t skew = max_input_shard_usage / avg_input_shard_usage;
+        while (skew > 1 && nshard < kShardMax) {
+            nshard *= 2;
+            skew /= 2;
+        }
+    }
     size_t npage = npad(cap / nshard, kPageSize);
     return {nshard, npage};
 }
@@ -1020,10 +1035,12 @@ public:
     Status get(const Slice* keys, IndexValue* values, KeysInfo* not_found, size_t* num_found,
                const std::vector<size_t>& idxes) const override {
         size_t nfound = 0;
+        // reused across rows to avoid one heap allocation per key
+        std::string composite_key;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
             const auto value = values[idx];
+            composite_key.clear();
             composite_key.reserve(skey.size + kIndexValueSize);
             composite_key.append(skey.data, skey.size);
             put_fixed64_le(&composite_key, value.get_value());
@@ -1033,10 +1050,10 @@ public:
                 values[idx] = NullIndexValue;
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
             } else {
-                const auto& composite_key = *iter;
-                auto value = UNALIGNED_LOAD64(composite_key.data() + composite_key.size() - kIndexValueSize);
-                values[idx] = IndexValue(value);
-                nfound += value != NullIndexValue;
+                const auto& stored_key = *iter;
+                auto found = UNALIGNED_LOAD64(stored_key.data() + stored_key.size() - kIndexValueSize);
+                values[idx] = IndexValue(found);
+                nfound += found != NullIndexValue;
             }
         }
         *num_found = nfound;
@@ -1046,10 +1063,12 @@ public:
     Status upsert(const Slice* keys, const IndexValue* values, IndexValue* old_values, KeysInfo* not_found,
                   size_t* num_found, const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
+        // reused across rows to avoid one heap allocation per key
+        std::string composite_key;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
             const auto value = values[idx];
+            composite_key.clear();
             composite_key.reserve(skey.size + kIndexValueSize);
             composite_key.append(skey.data, skey.size);
             put_fixed64_le(&composite_key, value.get_value());
@@ -1073,10 +1092,12 @@ public:
     Status upsert(const Slice* keys, const IndexValue* values, KeysInfo* not_found, size_t* num_found,
                   const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
+        // reused across rows to avoid one heap allocation per key
+        std::string composite_key;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
             const auto value = values[idx];
+            composite_key.clear();
             composite_key.reserve(skey.size + kIndexValueSize);
             composite_key.append(skey.data, skey.size);
             put_fixed64_le(&composite_key, value.get_value());
@@ -1099,10 +1120,12 @@ public:
     }
 
     Status insert(const Slice* keys, const IndexValue* values, const std::vector<size_t>& idxes) override {
+        // reused across rows to avoid one heap allocation per key
+        std::string composite_key;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
             const auto value = values[idx];
+            composite_key.clear();
             composite_key.reserve(skey.size + kIndexValueSize);
             composite_key.append(skey.data, skey.size);
             put_fixed64_le(&composite_key, value.get_value());
@@ -1130,10 +1153,12 @@ public:
     Status erase(const Slice* keys, IndexValue* old_values, KeysInfo* not_found, size_t* num_found,
                  const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
+        // reused across rows to avoid one heap allocation per key
+        std::string composite_key;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
             const auto value = NullIndexValue;
+            composite_key.clear();
             composite_key.reserve(skey.size + kIndexValueSize);
             composite_key.append(skey.data, skey.size);
             put_fixed64_le(&composite_key, value);
@@ -1157,10 +1182,12 @@ public:
     }
 
     Status replace(const Slice* keys, const IndexValue* values, const std::vector<size_t>& idxes) override {
+        // reused across rows to avoid one heap allocation per key
+        std::string composite_key;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
             const auto value = values[idx];
+            composite_key.clear();
             composite_key.reserve(skey.size + kIndexValueSize);
             composite_key.append(skey.data, skey.size);
             put_fixed64_le(&composite_key, value.get_value());
@@ -1203,10 +1230,12 @@ public:
     }
 
     Status load_wals(size_t n, const Slice* keys, const IndexValue* values) override {
+        // reused across rows to avoid one heap allocation per key
+        std::string composite_key;
         for (size_t i = 0; i < n; i++) {
-            std::string composite_key;
             const auto& skey = keys[i];
             const auto value = values[i];
+            composite_key.clear();
             composite_key.reserve(skey.size + kIndexValueSize);
             composite_key.append(skey.data, skey.size);
             put_fixed64_le(&composite_key, value.get_value());
@@ -1275,6 +1304,8 @@ public:
             return true;
         }
         reserve(size);
+        // reused across entries to avoid one heap allocation per key
+        std::string composite_key;
         for (auto i = 0; i < size; ++i) {
             size_t compose_key_size = 0;
             if (!ar.load(&compose_key_size)) {
@@ -1284,7 +1315,6 @@ public:
             if (compose_key_size == 0) {
                 continue;
             }
-            std::string composite_key;
             raw::stl_string_resize_uninitialized(&composite_key, compose_key_size);
             if (!ar.load(composite_key.data(), composite_key.size())) {
                 LOG(ERROR) << "Failed to load composite_key";
@@ -2495,14 +2525,35 @@ Status ImmutableIndex::_get_in_shard_by_page(size_t shard_idx, size_t n, const S
                                              IOStat* stat) const {
     const auto& shard_info = _shards[shard_idx];
     std::map<size_t, IndexPage> pages;
-    for (auto [pageid, keys_info] : keys_info_by_page) {
-        IndexPage page;
-        RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset + kPageSize * pageid, page.data, kPageSize));
+    // page ids in |keys_info_by_page| are already sorted, so coalesce runs of consecutive
+    // pages into one pread instead of paying one IOP per page for a batch of point lookups
+    for (auto iter = keys_info_by_page.begin(); iter != keys_info_by_page.end();) {
+        const size_t start_pageid = iter->first;
+        size_t num_pages = 1;
+        ++iter;
+        while (iter != keys_info_by_page.end() && iter->first == start_pageid + num_pages) {
+            num_pages++;
+            ++iter;
+        }
+        if (num_pages == 1) {
+            IndexPage page;
+            RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset + kPageSize * start_pageid, page.data, kPageSize));
+            pages[start_pageid] = std::move(page);
+        } else {
+            std::string buff;
+            raw::stl_string_resize_uninitialized(&buff, num_pages * kPageSize);
+            RETURN_IF_ERROR(
+                    _file->read_at_fully(shard_info.offset + kPageSize * start_pageid, buff.data(), buff.size()));
+            for (size_t i = 0; i < num_pages; i++) {
+                IndexPage page;
+                memcpy(page.data, buff.data() + i * kPageSize, kPageSize);
+                pages[start_pageid + i] = std::move(page);
+            }
+        }
         if (stat != nullptr) {
             stat->read_iops++;
-            stat->read_io_bytes += kPageSize;
+            stat->read_io_bytes += num_pages * kPageSize;
         }
-        pages[pageid] = std::move(page);
     }
     if (shard_info.key_size != 0) {
         return _get_in_fixlen_shard_by_page(shard_idx, n, keys, values, found_keys_info, keys_info_by_page, pages);
@@ -2779,6 +2830,13 @@ Status ImmutableIndex::get(size_t n, const Slice* keys, KeysInfo& keys_info, Ind
         return Status::OK();
     }
 
+    if (config::enable_pindex_bf_reclaim && !_bf_vec.empty() &&
+        !StorageEngine::instance()->update_manager()->keep_pindex_bf()) {
+        // memory usage is too high, release the resident bloom filters instead of keeping
+        // them pinned until the whole index gets evicted from the index cache
+        release_bf();
+    }
+
     const auto [shard_off, nshard] = iter->second;
     if (nshard > 1) {
         std::vector<KeysInfo> keys_info_by_shard(nshard);
@@ -4317,7 +4375,22 @@ Status PersistentIndex::_merge_compaction_internal(ImmutableIndexWriter* writer,
             total_size = iter->second.second;
         }
         auto [l0_shard_offset, l0_shard_size] = shard_info;
-        const auto [nshard, npage_hint] = MutableIndex::estimate_nshard_and_npage(total_usage);
+        size_t max_input_shard_usage = 0;
+        size_t num_input_shards = 0;
+        for (int i = l1_start_idx; i < l1_end_idx; i++) {
+            auto shard_iter = _l1_vec[i]->_shard_info_by_length.find(key_size);
+            if (shard_iter == _l1_vec[i]->_shard_info_by_length.end()) {
+                continue;
+            }
+            const auto [input_offset, input_size] = shard_iter->second;
+            for (size_t s = 0; s < input_size; s++) {
+                max_input_shard_usage =
+                        std::max<size_t>(max_input_shard_usage, _l1_vec[i]->_shards[input_offset + s].data_size);
+            }
+            num_input_shards += input_size;
+        }
+        const auto [nshard, npage_hint] =
+                MutableIndex::estimate_nshard_and_npage(total_usage, max_input_shard_usage, num_input_shards);
         const auto nbucket = MutableIndex::estimate_nbucket(key_size, total_usage, nshard, npage_hint);
         const auto estimate_size_per_shard = total_size / nshard;
         if (_key_size > 0) {
@@ -4646,7 +4719,23 @@ StatusOr<EditVersion> PersistentIndex::_major_compaction_impl(
             total_size = iter->second.second / l2_versions.size();
         }
 
-        const auto [nshard, npage_hint] = MutableIndex::estimate_nshard_and_npage(total_usage);
+        // normalized the same way as total_usage, so the skew ratio stays comparable
+        size_t max_input_shard_usage = 0;
+        size_t num_input_shards = 0;
+        for (const auto& l2 : l2_vec) {
+            auto shard_iter = l2->_shard_info_by_length.find(key_size);
+            if (shard_iter == l2->_shard_info_by_length.end()) {
+                continue;
+            }
+            const auto [input_offset, input_size] = shard_iter->second;
+            for (size_t s = 0; s < input_size; s++) {
+                max_input_shard_usage = std::max<size_t>(max_input_shard_usage,
+                                                         l2->_shards[input_offset + s].data_size / l2_versions.size());
+            }
+            num_input_shards += input_size;
+        }
+        const auto [nshard, npage_hint] =
+                MutableIndex::estimate_nshard_and_npage(total_usage, max_input_shard_usage, num_input_shards);
         const auto nbucket = MutableIndex::estimate_nbucket(key_size, total_usage, nshard, npage_hint);
         const auto estimate_size_per_shard = total_size / nshard;
 
@@ -273,7 +273,12 @@ public:
 
     static StatusOr<std::unique_ptr<MutableIndex>> create(size_t key_size);
 
-    static std::tuple<size_t, size_t> estimate_nshard_and_npage(const size_t total_kv_pairs_usage);
+    // |max_input_shard_usage| and |num_input_shards| describe the immutable shards being
+    // compacted, if any: when the largest input shard is a multiple of the average one,
+    // the shard count is raised accordingly so the oversized shards get split.
+    static std::tuple<size_t, size_t> estimate_nshard_and_npage(const size_t total_kv_pairs_usage,
+                                                                const size_t max_input_shard_usage = 0,
+                                                                const size_t num_input_shards = 0);
 
     static size_t estimate_nbucket(size_t key_size, size_t size, size_t nshard, size_t npage);
 };
@@ -496,6 +501,11 @@ public:
 
     bool has_bf() { return !_bf_vec.empty(); }
 
+    // release bloom filters loaded by _prepare_bloom_filter, so memory pressure can reclaim
+    // them without evicting the whole index from the index cache. They will be re-read from
+    // the index file on demand once memory usage drops below the high watermark
+    void release_bf() { std::vector<std::unique_ptr<BloomFilter>>().swap(_bf_vec); }
+
     static StatusOr<std::unique_ptr<ImmutableIndex>> load(std::unique_ptr<RandomAccessFile>&& index_rb,
                                                           bool load_bf_data);
 
@@ -0,0 +1,126 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/prefetch_iterator.h"
+
+#include <condition_variable>
+#include <mutex>
+
+#include "runtime/current_thread.h"
+#include "storage/chunk_helper.h"
+#include "util/threadpool.h"
+
+namespace starrocks {
+
+namespace {
+
+class PrefetchIterator final : public ChunkIterator {
+public:
+    explicit PrefetchIterator(ChunkIteratorPtr child, ThreadPool* pool)
+            : ChunkIterator(child->schema(), child->chunk_size()), _child(std::move(child)), _pool(pool) {}
+
+    ~PrefetchIterator() override { close(); }
+
+    void close() override {
+        // make sure no in-flight fetch still references |this| before tearing down.
+        if (_buffer != nullptr) {
+            (void)_wait();
+            _buffer.reset();
+        }
+        if (_child != nullptr) {
+            _merged_rows_on_close = _child->merged_rows();
+            _child->close();
+            _child.reset();
+        }
+    }
+
+    size_t merged_rows() const override { return _child != nullptr ? _child->merged_rows() : _merged_rows_on_close; }
+
+    [[nodiscard]] Status init_encoded_schema(ColumnIdToGlobalDictMap& dict_maps) override {
+        RETURN_IF_ERROR(ChunkIterator::init_encoded_schema(dict_maps));
+        return _child->init_encoded_schema(dict_maps);
+    }
+
+    [[nodiscard]] Status init_output_schema(const std::unordered_set<uint32_t>& unused_output_column_ids) override {
+        RETURN_IF_ERROR(ChunkIterator::init_output_schema(unused_output_column_ids));
+        return _child->init_output_schema(unused_output_column_ids);
+    }
+
+protected:
+    Status do_get_next(Chunk* chunk) override {
+        if (_buffer == nullptr) {
+            _buffer = ChunkHelper::new_chunk(output_schema(), _chunk_size);
+            _schedule();
+        }
+        RETURN_IF_ERROR(_wait());
+        chunk->swap_chunk(*_buffer);
+        _schedule();
+        return Status::OK();
+    }
+
+private:
+    void _schedule() {
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            _done = false;
+        }
+        auto task = [this, tracker = CurrentThread::mem_tracker()]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(tracker);
+            auto st = _fetch();
+            std::lock_guard<std::mutex> l(_mutex);
+            _status = st;
+            _done = true;
+            _cv.notify_one();
+        };
+        // run inline if the pool rejects the task, the merge then degrades to the
+        // old on-demand behavior instead of failing.
+        if (auto st = _pool->submit_func(task); !st.ok()) {
+            task();
+        }
+    }
+
+    Status _fetch() {
+        TRY_CATCH_ALLOC_SCOPE_START()
+        _buffer->reset();
+        return _child->get_next(_buffer.get());
+        TRY_CATCH_ALLOC_SCOPE_END()
+    }
+
+    Status _wait() {
+        std::unique_lock<std::mutex> l(_mutex);
+        _cv.wait(l, [this]() { return _done; });
+        return _status;
+    }
+
+    ChunkIteratorPtr _child;
+    ThreadPool* _pool;
+    ChunkPtr _buffer;
+    size_t _merged_rows_on_close = 0;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _done = true;
+    Status _status;
+};
+
+} // namespace
+
+ChunkIteratorPtr new_prefetch_iterator(ChunkIteratorPtr child, ThreadPool* pool) {
+    if (pool == nullptr) {
+        return child;
+    }
+    return std::make_shared<PrefetchIterator>(std::move(child), pool);
+}
+
+} // namespace starrocks
@@ -0,0 +1,30 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "storage/chunk_iterator.h"
+
+namespace starrocks {
+
+class ThreadPool;
+
+// new_prefetch_iterator wraps |child| with an iterator that keeps one decoded chunk
+// ahead by running the child's get_next on |pool|, overlapping the child's IO with
+// the consumer's CPU work. It is meant for the children of a heap merge, where only
+// one child advances at a time and each advance may hit disk synchronously.
+// Returns |child| unchanged when |pool| is nullptr.
+ChunkIteratorPtr new_prefetch_iterator(ChunkIteratorPtr child, ThreadPool* pool);
+
+} // namespace starrocks
@@ -36,9 +36,13 @@
 
 #include <memory>
 
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
 #include "common/logging.h"
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h" // for Substitute
+#include "simd/gather.h"
 #include "storage/chunk_helper.h"
 #include "storage/range.h"
 #include "storage/rowset/bitshuffle_page.h"
@@ -61,6 +65,16 @@ BinaryDictPageBuilder::BinaryDictPageBuilder(const PageBuilderOptions& options)
     PageBuilderOptions dict_builder_options;
     dict_builder_options.data_page_size = _options.dict_page_size;
     _dict_builder = std::make_unique<BinaryPlainPageBuilder>(dict_builder_options);
+    if (_options.dict_seed != nullptr) {
+        // Preload the dictionary of a previous segment so shared values keep their codes.
+        for (const auto& value : *_options.dict_seed) {
+            if (!_dict_builder->add_slice(Slice(value))) {
+                // no dictionary page space left, drop the remainder of the seed
+                break;
+            }
+            _dictionary.insert_or_assign(value, static_cast<uint32_t>(_dictionary.size()));
+        }
+    }
     reset();
 }
 
@@ -175,6 +189,14 @@ bool BinaryDictPageBuilder::is_valid_global_dict(const GlobalDictMap* global_dic
     return true;
 }
 
+std::vector<std::string> BinaryDictPageBuilder::dictionary_values() const {
+    std::vector<std::string> values(_dictionary.size());
+    for (const auto& [value, code] : _dictionary) {
+        values[code] = value;
+    }
+    return values;
+}
+
 template <LogicalType Type>
 BinaryDictPageDecoder<Type>::BinaryDictPageDecoder(Slice data)
         : _data(data), _data_page_decoder(nullptr), _parsed(false), _encoding_type(UNKNOWN_ENCODING) {}
@@ -215,6 +237,21 @@ template <LogicalType Type>
 void BinaryDictPageDecoder<Type>::set_dict_decoder(PageDecoder* dict_decoder) {
     _dict_decoder = down_cast<BinaryPlainPageDecoder<Type>*>(dict_decoder);
     _max_value_legth = _dict_decoder->max_value_length();
+    // Materialize the dict word offsets once per page. The words are laid out
+    // back to back in the dict page, so the start offsets of all words plus an
+    // end sentinel fully describe them and can be gathered per batch of codes.
+    const uint32_t dict_size = _dict_decoder->dict_size();
+    _dict_offsets.resize(dict_size + 1);
+    uint32_t off = 0;
+    for (uint32_t i = 0; i < dict_size; ++i) {
+        Slice word = _dict_decoder->string_at_index(i);
+        if (i == 0) {
+            _dict_data = word.data;
+        }
+        _dict_offsets[i] = off;
+        off += word.size;
+    }
+    _dict_offsets[dict_size] = off;
 }
 
 template <LogicalType Type>
@@ -245,23 +282,65 @@ Status BinaryDictPageDecoder<Type>::next_batch(const SparseRange<>& range, Colum
     size_t nread = _vec_code_buf->size();
     using cast_type = CppTypeTraits<TYPE_INT>::CppType;
     const auto* codewords = reinterpret_cast<const cast_type*>(_vec_code_buf->raw_data());
-    std::vector<Slice> slices;
-    raw::stl_vector_resize_uninitialized(&slices, nread);
 
     if constexpr (Type == TYPE_CHAR) {
+        std::vector<Slice> slices;
+        raw::stl_vector_resize_uninitialized(&slices, nread);
         for (int i = 0; i < nread; ++i) {
             Slice element = _dict_decoder->string_at_index(codewords[i]);
             // Strip trailing '\x00'
             element.size = strnlen(element.data, element.size);
             slices[i] = element;
         }
-    } else {
-        for (int i = 0; i < nread; ++i) {
-            slices[i] = _dict_decoder->string_at_index(codewords[i]);
+        CHECK(dst->append_strings_overflow(slices, _max_value_legth));
+        return Status::OK();
+    }
+
+    // Gather the start/end offsets of all codes at once, lay out the destination
+    // with a prefix sum, then copy. Codes that reference adjacent dict words are
+    // merged into one wide memcpy.
+    raw::stl_vector_resize_uninitialized(&_batch_starts, nread);
+    raw::stl_vector_resize_uninitialized(&_batch_ends, nread);
+    SIMDGather::gather(_batch_starts.data(), _dict_offsets.data(), codewords, _dict_offsets.size(), nread);
+    SIMDGather::gather(_batch_ends.data(), _dict_offsets.data() + 1, codewords, _dict_offsets.size(), nread);
+
+    auto* data_column = down_cast<BinaryColumn*>(ColumnHelper::get_data_column(dst));
+    auto& bytes = data_column->get_bytes();
+    auto& offsets = data_column->get_offset();
+    DCHECK_GE(offsets.size(), 1);
+
+    size_t offset_sz = offsets.size();
+    uint32_t dst_offset = offsets.back();
+    raw::stl_vector_resize_uninitialized(&offsets, offset_sz + nread);
+    for (size_t i = 0; i < nread; ++i) {
+        dst_offset += _batch_ends[i] - _batch_starts[i];
+        offsets[offset_sz + i] = dst_offset;
+    }
+
+    size_t old_bytes_size = bytes.size();
+    bytes.resize(dst_offset);
+    uint8_t* out = bytes.data() + old_bytes_size;
+    for (size_t i = 0; i < nread;) {
+        uint32_t src_begin = _batch_starts[i];
+        uint32_t src_end = _batch_ends[i];
+        size_t j = i + 1;
+        while (j < nread && _batch_starts[j] == src_end) {
+            src_end = _batch_ends[j];
+            ++j;
         }
+        memcpy(out, _dict_data + src_begin, src_end - src_begin);
+        out += src_end - src_begin;
+        i = j;
+    }
+
+    if (dst->is_nullable()) {
+        auto& null_data = down_cast<NullableColumn*>(dst)->null_column_data();
+        null_data.resize(null_data.size() + nread, 0);
     }
 
-    CHECK(dst->append_strings_overflow(slices, _max_value_legth));
+#ifndef NDEBUG
+    dst->check_or_die();
+#endif
     return Status::OK();
 }
 
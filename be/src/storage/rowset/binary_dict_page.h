@@ -37,6 +37,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gen_cpp/segment.pb.h"
 #include "gutil/hash/string_hash.h"
@@ -90,6 +91,8 @@ public:
     // write, i.e, after `finish` has been called.
     bool all_dict_encoded() const override { return _encoding_type == DICT_ENCODING; }
 
+    std::vector<std::string> dictionary_values() const override;
+
 private:
     struct HashOfSlice {
         // Enable heterogeneous lookup.
@@ -154,6 +157,15 @@ private:
     std::shared_ptr<Column> _vec_code_buf;
 
     uint32_t _max_value_legth = 0;
+
+    // Start offset of every dict word inside the dict page data plus an end
+    // sentinel, materialized once in set_dict_decoder() so next_batch() can
+    // gather offsets for a whole batch of codes without per-code bounds checks.
+    std::vector<uint32_t> _dict_offsets;
+    const char* _dict_data = nullptr;
+    // scratch buffers for the gathered start/end offsets of one batch
+    std::vector<uint32_t> _batch_starts;
+    std::vector<uint32_t> _batch_ends;
 };
 
 } // namespace starrocks
@@ -123,11 +123,47 @@ Status BitmapIndexIterator::read_bitmap(rowid_t ordinal, Roaring* result) {
 Status BitmapIndexIterator::read_union_bitmap(rowid_t from, rowid_t to, Roaring* result) {
     DCHECK(0 <= from && from <= to && to <= _reader->bitmap_nums());
 
-    for (rowid_t pos = from; pos < to; pos++) {
+    if (from == to) {
+        return Status::OK();
+    }
+    if (to - from == 1) {
         Roaring bitmap;
-        RETURN_IF_ERROR(read_bitmap(pos, &bitmap));
+        RETURN_IF_ERROR(read_bitmap(from, &bitmap));
         *result |= bitmap;
+        return Status::OK();
+    }
+
+    // Range predicates resolved through the dictionary can cover many consecutive ordinals.
+    // Read the whole range with a single seek instead of one seek per bitmap, and merge the
+    // deserialized bitmaps with fastunion, which is much cheaper than folding them into the
+    // result one at a time.
+    auto column = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+    RETURN_IF_ERROR(_bitmap_column_iter->seek_to_ordinal(from));
+    size_t num_to_read = to - from;
+    size_t remaining = num_to_read;
+    while (remaining > 0) {
+        size_t num_read = remaining;
+        RETURN_IF_ERROR(_bitmap_column_iter->next_batch(&num_read, column.get()));
+        if (UNLIKELY(num_read == 0)) {
+            return Status::InternalError("failed to read bitmap index column");
+        }
+        remaining -= num_read;
+    }
+    DCHECK_EQ(num_to_read, column->size());
+
+    ColumnViewer<TYPE_VARCHAR> viewer(column);
+    std::vector<Roaring> bitmaps;
+    bitmaps.reserve(num_to_read);
+    for (size_t i = 0; i < num_to_read; i++) {
+        auto value = viewer.value(i);
+        bitmaps.emplace_back(Roaring::read(value.data, false));
+    }
+    std::vector<const Roaring*> inputs;
+    inputs.reserve(bitmaps.size());
+    for (const auto& bitmap : bitmaps) {
+        inputs.emplace_back(&bitmap);
     }
+    *result |= Roaring::fastunion(inputs.size(), inputs.data());
     return Status::OK();
 }
 
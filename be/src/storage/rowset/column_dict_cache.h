@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+// Shares column dictionaries between the segment writers of one rowset. When a segment
+// finishes a fully dict-encoded string column it publishes the dictionary here, and the
+// next segment of the rowset seeds its dictionary builder from the snapshot. Codes are
+// assigned append-only, so all segments seeded from the same snapshot agree on the codes
+// of the shared values, and enum-like columns stop rebuilding an identical dictionary for
+// every segment.
+// Snapshots are immutable and handed out by shared_ptr; concurrent segment writers only
+// synchronize on the map itself.
+class ColumnDictCache {
+public:
+    // dictionary values of one column, ordered by code
+    using DictValues = std::vector<std::string>;
+
+    std::shared_ptr<const DictValues> get(uint32_t column_unique_id) const {
+        std::lock_guard l(_lock);
+        auto iter = _dicts.find(column_unique_id);
+        return iter == _dicts.end() ? nullptr : iter->second;
+    }
+
+    // Publish the dictionary of a finished column. Oversized dictionaries are dropped: a
+    // high-cardinality dictionary would bloat the dictionary page of every later segment
+    // with values it may never contain. A snapshot never shrinks either, a smaller
+    // dictionary cannot replace a bigger one without reassigning published codes.
+    void update(uint32_t column_unique_id, DictValues values) {
+        size_t dict_bytes = 0;
+        for (const auto& value : values) {
+            dict_bytes += value.size();
+        }
+        if (dict_bytes > config::rowset_shared_dict_max_bytes) {
+            return;
+        }
+        auto dict = std::make_shared<const DictValues>(std::move(values));
+        std::lock_guard l(_lock);
+        auto& slot = _dicts[column_unique_id];
+        if (slot == nullptr || slot->size() < dict->size()) {
+            slot = std::move(dict);
+        }
+    }
+
+private:
+    mutable std::mutex _lock;
+    std::unordered_map<uint32_t, std::shared_ptr<const DictValues>> _dicts;
+};
+
+} // namespace starrocks
@@ -53,6 +53,7 @@ class ColumnPredicate;
 
 class ColumnReader;
 class RandomAccessFile;
+struct PageCacheGroupStats;
 
 struct ColumnIteratorOptions {
     //RandomAccessFile* read_file = nullptr;
@@ -61,6 +62,10 @@ struct ColumnIteratorOptions {
     // reader statistics
     OlapReaderStatistics* stats = nullptr;
     bool use_page_cache = false;
+    // whether pages missed in the page cache may be inserted into it
+    bool fill_page_cache = true;
+    // per-resource-group page cache accounting, may be null
+    PageCacheGroupStats* page_cache_group_stats = nullptr;
     LakeIOOptions lake_io_opts{.fill_data_cache = true};
 
     // check whether column pages are all dictionary encoding.
@@ -46,6 +46,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "gen_cpp/segment.pb.h"
+#include "io/shared_buffered_input_stream.h"
 #include "runtime/mem_pool.h"
 #include "storage/inverted/inverted_index_iterator.h"
 #include "storage/range.h"
@@ -129,6 +130,10 @@ public:
 
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
+    // serialized HyperLogLog sketch of this segment's values, nullptr if the segment
+    // was written without enable_segment_ndv_sketch.
+    const std::string* ndv_hll() const { return _ndv_hll.get(); }
+
     PagePointer get_dict_page_pointer() const { return _dict_page_pointer; }
     LogicalType column_type() const { return _column_type; }
     bool has_all_dict_encoded() const { return _flags & kHasAllDictEncodedMask; }
@@ -155,6 +160,15 @@ public:
 
     Status load_ordinal_index(const IndexReadOptions& opts);
 
+    // Collect the on-disk ranges of the index root pages that have not been loaded yet,
+    // including sub readers'. Callers can register them on a SharedBufferedInputStream
+    // before triggering the index loads, so that the several small index reads of one
+    // column are coalesced into fewer reads. Zone map/bloom filter/bitmap index ranges
+    // are only collected with |with_pred_index| set, since those indexes are only read
+    // when the column carries predicates.
+    void collect_index_io_ranges(bool with_pred_index,
+                                 std::vector<io::SharedBufferedInputStream::IORange>* ranges) const;
+
     Status new_inverted_index_iterator(const std::shared_ptr<TabletIndex>& index_meta, InvertedIndexIterator** iterator,
                                        const SegmentReadOptions& opts);
 
@@ -190,6 +204,9 @@ private:
     Status _zone_map_filter(const std::vector<const ColumnPredicate*>& predicates, const ColumnPredicate* del_predicate,
                             std::unordered_set<uint32_t>* del_partial_filtered_pages, std::vector<uint32_t>* pages);
 
+    // intersect |row_ranges| with the rows whose block zone map matches all |predicates|.
+    Status _block_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates, SparseRange<>* row_ranges);
+
     Status _load_inverted_index(const std::shared_ptr<TabletIndex>& index_meta, const SegmentReadOptions& opts);
 
     NgramBloomFilterReaderOptions _get_reader_options_for_ngram() const;
@@ -215,12 +232,17 @@ private:
     std::unique_ptr<BloomFilterIndexPB> _bloom_filter_index_meta;
 
     std::unique_ptr<ZoneMapIndexReader> _zonemap_index;
+    // zone maps per fixed-size row block, finer than _zonemap_index. Only present for
+    // segments written with enable_block_zone_map.
+    std::unique_ptr<ZoneMapIndexReader> _block_zonemap_index;
+    uint32_t _block_zone_map_granularity = 0;
     std::unique_ptr<OrdinalIndexReader> _ordinal_index;
     std::unique_ptr<BitmapIndexReader> _bitmap_index;
     std::unique_ptr<BloomFilterIndexReader> _bloom_filter_index;
     std::unique_ptr<InvertedReader> _inverted_index;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
+    std::unique_ptr<std::string> _ndv_hll;
 
     using SubReaderList = std::vector<std::unique_ptr<ColumnReader>>;
     std::unique_ptr<SubReaderList> _sub_readers;
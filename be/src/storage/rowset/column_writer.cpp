@@ -52,6 +52,7 @@
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/bloom_filter_index_writer.h"
+#include "storage/rowset/column_dict_cache.h"
 #include "storage/rowset/encoding_info.h"
 #include "storage/rowset/json_column_writer.h"
 #include "storage/rowset/map_column_writer.h"
@@ -61,8 +62,10 @@
 #include "storage/rowset/page_io.h"
 #include "storage/rowset/struct_column_writer.h"
 #include "storage/rowset/zone_map_index.h"
+#include "types/hll.h"
 #include "util/compression/block_compression.h"
 #include "util/faststring.h"
+#include "util/hash_util.hpp"
 #include "util/rle_encoding.h"
 
 namespace starrocks {
@@ -83,6 +86,50 @@ namespace starrocks {
 
 using strings::Substitute;
 
+// Builds a per-segment HyperLogLog sketch over the column values, stored in the column meta
+// of the segment footer (ColumnMetaPB.ndv_hll). Values are hashed over their raw storage
+// bytes, which is consistent across segments of the same column and is all the meta scanner
+// needs to merge the sketches. Nulls do not count towards the distinct values.
+class NdvSketchBuilder {
+public:
+    explicit NdvSketchBuilder(TypeInfoPtr type_info) : _type_info(std::move(type_info)) {
+        const LogicalType type = _type_info->type();
+        _is_slice = type == TYPE_CHAR || type == TYPE_VARCHAR || type == TYPE_VARBINARY;
+    }
+
+    void add_values(const void* values, size_t count) {
+        if (_is_slice) {
+            const auto* slices = reinterpret_cast<const Slice*>(values);
+            for (size_t i = 0; i < count; i++) {
+                _hll.update(HashUtil::murmur_hash64A(slices[i].data, slices[i].size, HashUtil::MURMUR_SEED));
+            }
+        } else {
+            const auto* p = static_cast<const uint8_t*>(values);
+            const size_t value_size = _type_info->size();
+            for (size_t i = 0; i < count; i++, p += value_size) {
+                _hll.update(HashUtil::murmur_hash64A(p, value_size, HashUtil::MURMUR_SEED));
+            }
+        }
+    }
+
+    void add_nulls(uint32_t count) {}
+
+    void finish(ColumnMetaPB* meta) const {
+        std::string buf;
+        buf.resize(_hll.max_serialized_size());
+        size_t size = _hll.serialize(reinterpret_cast<uint8_t*>(buf.data()));
+        buf.resize(size);
+        meta->set_ndv_hll(std::move(buf));
+    }
+
+    uint64_t size() const { return _hll.mem_usage(); }
+
+private:
+    TypeInfoPtr _type_info;
+    bool _is_slice;
+    HyperLogLog _hll;
+};
+
 class ByteIterator {
 public:
     ByteIterator(const uint8_t* bytes, size_t size) : _bytes(bytes), _size(size) {}
@@ -392,6 +439,10 @@ Status ScalarColumnWriter::init() {
     if (_opts.need_zone_map) {
         _has_index_builder = true;
         _zone_map_index_builder = ZoneMapIndexWriter::create(type_info());
+        if (_opts.need_block_zone_map && config::block_zone_map_row_granularity > 0) {
+            _block_zone_map_index_builder = ZoneMapIndexWriter::create(type_info());
+            _block_zone_map_granularity = config::block_zone_map_row_granularity;
+        }
     }
     if (_opts.need_bitmap_index) {
         _has_index_builder = true;
@@ -425,6 +476,10 @@ Status ScalarColumnWriter::init() {
         }
         RETURN_IF_ERROR(BloomFilterIndexWriter::create(bf_options, _type_info, &_bloom_filter_index_builder));
     }
+    if (_opts.need_ndv_sketch) {
+        _has_index_builder = true;
+        _ndv_sketch_builder = std::make_unique<NdvSketchBuilder>(type_info());
+    }
     if (_opts.need_inverted_index) {
         _has_index_builder = true;
         TabletIndex& inverted_tablet_index = _opts.tablet_index.at(GIN);
@@ -455,6 +510,9 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_zone_map_index_builder != nullptr) {
         size += _zone_map_index_builder->size();
     }
+    if (_block_zone_map_index_builder != nullptr) {
+        size += _block_zone_map_index_builder->size();
+    }
     if (_bitmap_index_builder != nullptr) {
         size += _bitmap_index_builder->size();
     }
@@ -464,6 +522,9 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_inverted_index_builder != nullptr) {
         size += _inverted_index_builder->size();
     }
+    if (_ndv_sketch_builder != nullptr) {
+        size += _ndv_sketch_builder->size();
+    }
     return size;
 }
 
@@ -504,6 +565,10 @@ Status ScalarColumnWriter::write_data() {
         dict_pp.to_proto(_opts.meta->mutable_dict_page());
     }
     _opts.meta->set_all_dict_encoded(_page_builder->all_dict_encoded());
+    if (_opts.dict_cache != nullptr && _page_builder->all_dict_encoded() &&
+        _encoding_info->encoding() == DICT_ENCODING) {
+        _opts.dict_cache->update(_opts.meta->unique_id(), _page_builder->dictionary_values());
+    }
 
     Page* page = _pages.head;
     while (page != nullptr) {
@@ -529,6 +594,9 @@ inline Status ScalarColumnWriter::set_encoding(const EncodingTypePB& encoding) {
     _opts.meta->set_encoding(_encoding_info->encoding());
     PageBuilderOptions opts;
     opts.data_page_size = _opts.data_page_size;
+    if (_opts.dict_cache != nullptr && encoding == DICT_ENCODING) {
+        opts.dict_seed = _opts.dict_cache->get(_opts.meta->unique_id());
+    }
     RETURN_IF_ERROR(_encoding_info->create_page_builder(opts, &page_builder));
     if (page_builder == nullptr) {
         return Status::NotSupported(strings::Substitute("Failed to create page builder for type $0 and encoding $1",
@@ -547,7 +615,20 @@ Status ScalarColumnWriter::write_ordinal_index() {
 
 Status ScalarColumnWriter::write_zone_map() {
     if (_zone_map_index_builder != nullptr) {
-        return _zone_map_index_builder->finish(_wfile, _opts.meta->add_indexes());
+        ColumnIndexMetaPB* index_meta = _opts.meta->add_indexes();
+        RETURN_IF_ERROR(_zone_map_index_builder->finish(_wfile, index_meta));
+        if (_block_zone_map_index_builder != nullptr) {
+            // finalize the trailing partial block before writing the block index
+            if (_block_zone_map_rows > 0) {
+                RETURN_IF_ERROR(_block_zone_map_index_builder->flush());
+                _block_zone_map_rows = 0;
+            }
+            RETURN_IF_ERROR(_block_zone_map_index_builder->finish_block_index(
+                    _wfile, index_meta->mutable_zone_map_index(), _block_zone_map_granularity));
+        }
+    }
+    if (_ndv_sketch_builder != nullptr) {
+        _ndv_sketch_builder->finish(_opts.meta);
     }
     return Status::OK();
 }
@@ -585,6 +666,43 @@ Status ScalarColumnWriter::_write_data_page(Page* page) {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::_block_zone_map_add_values(const void* values, size_t count) {
+    if (_block_zone_map_index_builder == nullptr) {
+        return Status::OK();
+    }
+    const auto* ptr = static_cast<const uint8_t*>(values);
+    const size_t field_size = type_info()->size();
+    while (count > 0) {
+        size_t num_add = std::min<size_t>(count, _block_zone_map_granularity - _block_zone_map_rows);
+        _block_zone_map_index_builder->add_values(ptr, num_add);
+        _block_zone_map_rows += num_add;
+        if (_block_zone_map_rows == _block_zone_map_granularity) {
+            RETURN_IF_ERROR(_block_zone_map_index_builder->flush());
+            _block_zone_map_rows = 0;
+        }
+        ptr += field_size * num_add;
+        count -= num_add;
+    }
+    return Status::OK();
+}
+
+Status ScalarColumnWriter::_block_zone_map_add_nulls(size_t count) {
+    if (_block_zone_map_index_builder == nullptr) {
+        return Status::OK();
+    }
+    while (count > 0) {
+        size_t num_add = std::min<size_t>(count, _block_zone_map_granularity - _block_zone_map_rows);
+        _block_zone_map_index_builder->add_nulls(num_add);
+        _block_zone_map_rows += num_add;
+        if (_block_zone_map_rows == _block_zone_map_granularity) {
+            RETURN_IF_ERROR(_block_zone_map_index_builder->flush());
+            _block_zone_map_rows = 0;
+        }
+        count -= num_add;
+    }
+    return Status::OK();
+}
+
 Status ScalarColumnWriter::finish_current_page() {
     if (_zone_map_index_builder != nullptr) {
         RETURN_IF_ERROR(_zone_map_index_builder->flush());
@@ -777,22 +895,28 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                 auto [run, is_null] = pair;
                 if (is_null) {
                     INDEX_ADD_NULLS(_zone_map_index_builder, run);
+                    RETURN_IF_ERROR(_block_zone_map_add_nulls(run));
                     INDEX_ADD_NULLS(_bitmap_index_builder, run);
                     INDEX_ADD_NULLS(_bloom_filter_index_builder, run);
                     INDEX_ADD_NULLS(_inverted_index_builder, run);
+                    INDEX_ADD_NULLS(_ndv_sketch_builder, run);
                 } else {
                     INDEX_ADD_VALUES(_zone_map_index_builder, pdata, run);
+                    RETURN_IF_ERROR(_block_zone_map_add_values(pdata, run));
                     INDEX_ADD_VALUES(_bitmap_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bloom_filter_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_inverted_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_ndv_sketch_builder, pdata, run);
                 }
                 pdata += type_info()->size() * run;
             }
         } else {
             INDEX_ADD_VALUES(_zone_map_index_builder, data, num_written);
+            RETURN_IF_ERROR(_block_zone_map_add_values(data, num_written));
             INDEX_ADD_VALUES(_bitmap_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bloom_filter_index_builder, data, num_written);
             INDEX_ADD_VALUES(_inverted_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_ndv_sketch_builder, data, num_written);
         }
 
         _next_rowid += num_written;
@@ -53,6 +53,7 @@ namespace starrocks {
 
 class TypeInfo;
 class BlockCompressionCodec;
+class ColumnDictCache;
 class WritableFile;
 
 class Column;
@@ -70,9 +71,13 @@ struct ColumnWriterOptions {
     // space saving = 1 - compressed_size / uncompressed_size
     double compression_min_space_saving = 0.1;
     bool need_zone_map = false;
+    // build an extra zone map per fixed-size row block (finer than data pages),
+    // only meaningful when need_zone_map is true
+    bool need_block_zone_map = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
     bool need_inverted_index = false;
+    bool need_ndv_sketch = false;
     std::unordered_map<IndexType, std::string> standalone_index_file_paths;
     std::unordered_map<IndexType, TabletIndex> tablet_index;
 
@@ -84,6 +89,10 @@ struct ColumnWriterOptions {
     // if global_dict is not nullptr, will checkout whether global_dict can cover all data
     GlobalDictMap* global_dict = nullptr;
 
+    // if not nullptr, seed the dictionary from previously finished segments of the same
+    // rowset and publish the finished dictionary back (see ColumnDictCache)
+    ColumnDictCache* dict_cache = nullptr;
+
     bool need_flat = false;
 
     std::string field_name;
@@ -91,6 +100,7 @@ struct ColumnWriterOptions {
 
 class BitmapIndexWriter;
 class EncodingInfo;
+class NdvSketchBuilder;
 class NullMapRLEBuilder;
 class NullFlagsBuilder;
 class OrdinalIndexWriter;
@@ -231,6 +241,12 @@ private:
 
     Status _write_data_page(Page* page);
 
+    // feed values/nulls into the block zone map builder, flushing one zone map every
+    // _block_zone_map_granularity rows. Block boundaries are row-count based and
+    // independent of data page boundaries. No-op when the builder is null.
+    Status _block_zone_map_add_values(const void* values, size_t count);
+    Status _block_zone_map_add_nulls(size_t count);
+
     ColumnWriterOptions _opts;
     WritableFile* _wfile;
     uint32_t _curr_page_format;
@@ -256,9 +272,14 @@ private:
 
     std::unique_ptr<OrdinalIndexWriter> _ordinal_index_builder;
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
+    std::unique_ptr<ZoneMapIndexWriter> _block_zone_map_index_builder;
+    // rows accumulated in the current (unflushed) zone map block
+    uint32_t _block_zone_map_rows = 0;
+    uint32_t _block_zone_map_granularity = 0;
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
     std::unique_ptr<BloomFilterIndexWriter> _bloom_filter_index_builder;
     std::unique_ptr<InvertedWriter> _inverted_index_builder;
+    std::unique_ptr<NdvSketchBuilder> _ndv_sketch_builder;
 
     // _zone_map_index_builder != NULL || _bitmap_index_builder != NULL || _bloom_filter_index_builder != NULL
     bool _has_index_builder = false;
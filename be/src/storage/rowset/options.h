@@ -35,6 +35,9 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "io/seekable_input_stream.h"
 #include "storage/rowset/page_handle.h"
@@ -50,6 +53,11 @@ public:
     uint32_t data_page_size = DEFAULT_PAGE_SIZE;
 
     uint32_t dict_page_size = config::dictionary_page_size;
+
+    // Dictionary of a previously finished segment of the same rowset, values ordered by
+    // code. A dict page builder preloads them so the shared values keep the same code in
+    // every segment (see ColumnDictCache).
+    std::shared_ptr<const std::vector<std::string>> dict_seed;
 };
 
 class IndexReadOptions {
@@ -35,6 +35,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 #include "common/status.h"
@@ -113,6 +114,9 @@ public:
     // this information is used for doing low-cardinality string column read optimization.
     virtual bool all_dict_encoded() const { return false; }
 
+    // Dictionary values ordered by code, empty unless the builder is dict encoded.
+    virtual std::vector<std::string> dictionary_values() const { return {}; }
+
 private:
     PageBuilder(const PageBuilder&) = delete;
     const PageBuilder& operator=(const PageBuilder&) = delete;
@@ -38,6 +38,7 @@
 #include <string>
 
 #include "column/column.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
@@ -54,6 +55,10 @@ namespace starrocks {
 
 using strings::Substitute;
 
+// Separates compressed-tier entries from decompressed pages of the same file
+// in the page cache key space.
+static const char* const kCompressedPageCacheKeySuffix = "!z";
+
 Status PageIO::compress_page_body(const BlockCompressionCodec* codec, double min_space_saving,
                                   const std::vector<Slice>& body, faststring* compressed_body) {
     size_t uncompressed_size = Slice::compute_total_size(body);
@@ -140,10 +145,17 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     auto cache = StoragePageCache::instance();
     PageCacheHandle cache_handle;
     StoragePageCache::CacheKey cache_key(opts.read_file->filename(), opts.page_pointer.offset);
+    auto* group_stats = opts.page_cache_group_stats;
+    if (opts.use_page_cache && group_stats != nullptr) {
+        group_stats->lookup_count.fetch_add(1, std::memory_order_relaxed);
+    }
     if (opts.use_page_cache && cache->lookup(cache_key, &cache_handle)) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
+        if (group_stats != nullptr) {
+            group_stats->hit_count.fetch_add(1, std::memory_order_relaxed);
+        }
         // parse body and footer
         Slice page_slice = handle->data();
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
@@ -164,35 +176,59 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
                 strings::Substitute("Bad page: too small size ($0), file($1)", page_size, opts.read_file->filename()));
     }
 
+    // The compressed tier keeps the raw page (with the checksum stripped) under its own
+    // key namespace, so hot pages evicted from the decompressed working set cost one
+    // decompression instead of one IO when they are touched again.
+    const bool use_compressed_cache = opts.use_page_cache && config::enable_compressed_page_cache;
+    // soft per-group quota: a group over its cache share keeps probing the cache
+    // but does not populate it, so its pages age out of the LRU first instead of
+    // evicting the working sets of the other groups.
+    const bool fill_page_cache = opts.fill_page_cache && (group_stats == nullptr || !group_stats->over_quota());
+    StoragePageCache::CacheKey compressed_cache_key(opts.read_file->filename() + kCompressedPageCacheKeySuffix,
+                                                    opts.page_pointer.offset);
+    PageCacheHandle compressed_cache_handle;
+    bool hit_compressed_cache = false;
+
     // hold compressed page at first, reset to decompressed page later
-    // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
-    std::unique_ptr<char[]> page(new char[page_size + Column::APPEND_OVERFLOW_MAX_SIZE]);
-    Slice page_slice(page.get(), page_size);
-    {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        // todo override is_cache_hit
-        if (opts.read_file->is_cache_hit()) {
-            RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
-            ++opts.stats->pages_from_local_disk;
-        } else {
-            RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
+    std::unique_ptr<char[]> page;
+    Slice page_slice;
+    if (use_compressed_cache && cache->lookup(compressed_cache_key, &compressed_cache_handle)) {
+        // decompress directly out of the cache entry, the handle keeps it pinned
+        page_slice = compressed_cache_handle.data();
+        hit_compressed_cache = true;
+        opts.stats->cached_pages_num++;
+    } else {
+        // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
+        page.reset(new char[page_size + Column::APPEND_OVERFLOW_MAX_SIZE]);
+        page_slice = Slice(page.get(), page_size);
+        {
+            SCOPED_RAW_TIMER(&opts.stats->io_ns);
+            // todo override is_cache_hit
+            if (opts.read_file->is_cache_hit()) {
+                RETURN_IF_ERROR(
+                        opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
+                ++opts.stats->pages_from_local_disk;
+            } else {
+                RETURN_IF_ERROR(
+                        opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
+            }
+            opts.stats->compressed_bytes_read_request += page_size;
+            ++opts.stats->io_count_request;
         }
-        opts.stats->compressed_bytes_read_request += page_size;
-        ++opts.stats->io_count_request;
-    }
 
-    if (opts.verify_checksum) {
-        uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
-        uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
-        if (expect != actual) {
-            return Status::Corruption(
-                    strings::Substitute("Bad page: checksum mismatch (actual=$0 vs expect=$1), file=$2", actual, expect,
-                                        opts.read_file->filename()));
+        if (opts.verify_checksum) {
+            uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
+            uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
+            if (expect != actual) {
+                return Status::Corruption(
+                        strings::Substitute("Bad page: checksum mismatch (actual=$0 vs expect=$1), file=$2", actual,
+                                            expect, opts.read_file->filename()));
+            }
         }
-    }
 
-    // remove checksum suffix
-    page_slice.size -= 4;
+        // remove checksum suffix
+        page_slice.size -= 4;
+    }
     // parse and set footer
     uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
     if (!footer->ParseFromArray(page_slice.data + page_slice.size - 4 - footer_size, footer_size)) {
@@ -207,6 +243,16 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
             return Status::Corruption(strings::Substitute(
                     "Bad page: page is compressed but codec is NO_COMPRESSION, file=$0", opts.read_file->filename()));
         }
+        if (use_compressed_cache && fill_page_cache && !hit_compressed_cache) {
+            // keep a compressed copy for the second tier
+            auto* compressed_copy = new char[page_slice.size];
+            memcpy(compressed_copy, page_slice.data, page_slice.size);
+            PageCacheHandle compressed_insert_handle;
+            cache->insert(compressed_cache_key, Slice(compressed_copy, page_slice.size), &compressed_insert_handle);
+            if (group_stats != nullptr) {
+                group_stats->inserted_bytes.fetch_add(page_slice.size, std::memory_order_relaxed);
+            }
+        }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
         // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
         std::unique_ptr<char[]> decompressed_page(
@@ -228,15 +274,20 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         page_slice = Slice(page.get(), footer->uncompressed_size() + footer_size + 4);
         opts.stats->uncompressed_bytes_read += page_slice.size;
     } else {
+        // only compressed pages are inserted into the compressed tier
+        DCHECK(!hit_compressed_cache);
         opts.stats->uncompressed_bytes_read += body_size;
     }
 
     RETURN_IF_ERROR(StoragePageDecoder::decode_page(footer, footer_size + 4, opts.encoding_type, &page, &page_slice));
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
-    if (opts.use_page_cache) {
+    if (opts.use_page_cache && fill_page_cache) {
         // insert this page into cache and return the cache handle
         cache->insert(cache_key, page_slice, &cache_handle, opts.kept_in_memory);
+        if (group_stats != nullptr) {
+            group_stats->inserted_bytes.fetch_add(page_slice.size, std::memory_order_relaxed);
+        }
         *handle = PageHandle(std::move(cache_handle));
     } else {
         *handle = PageHandle(page_slice);
@@ -49,6 +49,7 @@ class BlockCompressionCodec;
 class RandomAccessFile;
 class WritableFile;
 struct OlapReaderStatistics;
+struct PageCacheGroupStats;
 
 struct PageReadOptions {
     // block to read page
@@ -64,9 +65,16 @@ struct PageReadOptions {
     bool verify_checksum = true;
     // whether to use page cache in read path
     bool use_page_cache = true;
+    // whether a missed page may be inserted into the page cache. One-shot large
+    // scans read with the lookup enabled but the population disabled.
+    bool fill_page_cache = true;
     // if true, use DURABLE CachePriority in page cache
     // currently used for in memory olap table
     bool kept_in_memory = false;
+    // per-resource-group cache accounting, may be null when the reader does not
+    // belong to a resource group. A group over its soft quota still probes the
+    // cache but does not populate it.
+    PageCacheGroupStats* page_cache_group_stats = nullptr;
     // page encoding type
     EncodingTypePB encoding_type = UNKNOWN_ENCODING;
 
@@ -487,7 +487,7 @@ Status Rowset::copy_files_to(KVStore* kvstore, const std::string& dir) {
             return Status::AlreadyExist(fmt::format("Path already exist: {}", dst_path));
         }
         std::string src_path = segment_file_path(_rowset_path, rowset_id(), i);
-        if (!fs::copy_file(src_path, dst_path).ok()) {
+        if (!fs::link_or_copy_file(src_path, dst_path).ok()) {
             LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path
                          << ", errno=" << std::strerror(Errno::no());
             return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ", src_path, dst_path,
@@ -515,7 +515,7 @@ Status Rowset::copy_files_to(KVStore* kvstore, const std::string& dir) {
                         auto dst_absolute_path =
                                 fmt::format("{}/{}_{}_{}_{}", dir, rowset_id().to_string(), i, index.index_id(), file);
 
-                        if (!fs::copy_file(src_absolute_path, dst_absolute_path).ok()) {
+                        if (!fs::link_or_copy_file(src_absolute_path, dst_absolute_path).ok()) {
                             LOG(WARNING) << "Error to copy index. src:" << src_absolute_path
                                          << ", dst:" << dst_absolute_path << ", errno=" << std::strerror(Errno::no());
                             return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ",
@@ -535,7 +535,7 @@ Status Rowset::copy_files_to(KVStore* kvstore, const std::string& dir) {
                 LOG(WARNING) << "Path already exist: " << dst_path;
                 return Status::AlreadyExist(fmt::format("Path already exist: {}", dst_path));
             }
-            if (!fs::copy_file(src_path, dst_path).ok()) {
+            if (!fs::link_or_copy_file(src_path, dst_path).ok()) {
                 LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path
                              << ", errno=" << std::strerror(Errno::no());
                 return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ", src_path,
@@ -551,7 +551,7 @@ Status Rowset::copy_files_to(KVStore* kvstore, const std::string& dir) {
                 LOG(WARNING) << "Path already exist: " << dst_path;
                 return Status::AlreadyExist(fmt::format("Path already exist: {}", dst_path));
             }
-            if (!fs::copy_file(src_path, dst_path).ok()) {
+            if (!fs::link_or_copy_file(src_path, dst_path).ok()) {
                 LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path
                              << ", errno=" << std::strerror(Errno::no());
                 return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ", src_path,
@@ -590,7 +590,7 @@ Status Rowset::_copy_delta_column_group_files(KVStore* kvstore, const std::strin
                         return Status::AlreadyExist(fmt::format("Path already exist: {}", dst_copy_path));
                     }
 
-                    if (!fs::copy_file(src_file_path.c_str(), dst_copy_path.c_str()).ok()) {
+                    if (!fs::link_or_copy_file(src_file_path.c_str(), dst_copy_path.c_str()).ok()) {
                         LOG(WARNING) << "Fail to copy " << src_file_path << " to " << dst_copy_path;
                         return Status::RuntimeError(fmt::format("Fail to copy segment cols file, src: {}, dst {}",
                                                                 src_file_path, dst_copy_path));
@@ -661,6 +661,8 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
     seg_options.predicates = options.predicates;
     seg_options.predicates_for_zone_map = options.predicates_for_zone_map;
     seg_options.use_page_cache = options.use_page_cache;
+    seg_options.fill_page_cache = options.fill_page_cache;
+    seg_options.page_cache_group_stats = options.page_cache_group_stats;
     seg_options.profile = options.profile;
     seg_options.reader_type = options.reader_type;
     seg_options.chunk_size = options.chunk_size;
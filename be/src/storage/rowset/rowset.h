@@ -288,7 +288,8 @@ public:
     // `version` is used for link col files, default using INT64_MAX means link all col files
     Status link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version = INT64_MAX);
 
-    // copy all files to `dir`
+    // copy all files to `dir`. Files are hard linked instead of copied when `dir` is on
+    // the same filesystem, which is safe because all of them are immutable.
     Status copy_files_to(KVStore* kvstore, const std::string& dir);
 
     static std::string segment_file_path(const std::string& segment_dir, const RowsetId& rowset_id, int segment_id);
@@ -35,6 +35,7 @@
 #include "storage/rowset/rowset_meta_manager.h"
 
 #include <fmt/format.h>
+#include <rocksdb/write_batch.h>
 
 #include <string>
 #include <vector>
@@ -75,6 +76,23 @@ Status RowsetMetaManager::remove(KVStore* meta, const TabletUid& tablet_uid, con
     return meta->remove(META_COLUMN_FAMILY_INDEX, key);
 }
 
+Status RowsetMetaManager::remove_batch(KVStore* meta, const TabletUid& tablet_uid,
+                                       const std::vector<RowsetId>& rowset_ids) {
+    if (rowset_ids.empty()) {
+        return Status::OK();
+    }
+    rocksdb::WriteBatch batch;
+    rocksdb::ColumnFamilyHandle* cf = meta->handle(META_COLUMN_FAMILY_INDEX);
+    for (const RowsetId& rowset_id : rowset_ids) {
+        rocksdb::Status st = batch.Delete(cf, get_rowset_meta_key(tablet_uid, rowset_id));
+        if (!st.ok()) {
+            return Status::InternalError(
+                    fmt::format("fail to batch delete rowset meta, rowset_id: {}", rowset_id.to_string()));
+        }
+    }
+    return meta->write_batch(&batch);
+}
+
 string RowsetMetaManager::get_rowset_meta_key(const TabletUid& tablet_uid, const RowsetId& rowset_id) {
     return fmt::format("{}{}_{}", ROWSET_PREFIX, tablet_uid.to_string(), rowset_id.to_string());
 }
@@ -37,6 +37,7 @@ class TabletSchema;
 
 class ColumnPredicate;
 class DeletePredicates;
+struct PageCacheGroupStats;
 struct RowidRangeOption;
 struct ShortKeyRangesOption;
 
@@ -69,6 +70,10 @@ public:
     RuntimeState* runtime_state = nullptr;
     RuntimeProfile* profile = nullptr;
     bool use_page_cache = false;
+    // whether pages missed in the page cache may be inserted into it
+    bool fill_page_cache = true;
+    // per-resource-group page cache accounting, may be null
+    PageCacheGroupStats* page_cache_group_stats = nullptr;
     LakeIOOptions lake_io_opts;
 
     ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
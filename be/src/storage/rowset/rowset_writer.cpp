@@ -122,6 +122,11 @@ Status RowsetWriter::init() {
     _writer_options.global_dicts = _context.global_dicts != nullptr ? _context.global_dicts : nullptr;
     _writer_options.referenced_column_ids = _context.referenced_column_ids;
 
+    if (config::enable_rowset_shared_dict) {
+        _dict_cache = std::make_unique<ColumnDictCache>();
+        _writer_options.dict_cache = _dict_cache.get();
+    }
+
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS &&
         (_context.is_partial_update || !_context.merge_condition.empty() || _context.miss_auto_increment_column)) {
         _rowset_txn_meta_pb = std::make_unique<RowsetTxnMetaPB>();
@@ -132,7 +137,12 @@ Status RowsetWriter::init() {
 }
 
 StatusOr<RowsetSharedPtr> RowsetWriter::build() {
-    if (_num_rows_written > 0 || (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS && _num_delfile > 0)) {
+    // Syncing the directory entries is only meaningful when the segment files themselves were
+    // synced, which is gated by the same config. Unconditionally fsyncing the tablet directory
+    // here would charge every small load one fsync without any durability gain, which dominates
+    // the commit latency of high-frequency tiny loads.
+    if (config::sync_tablet_meta &&
+        (_num_rows_written > 0 || (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS && _num_delfile > 0))) {
         RETURN_IF_ERROR(_fs->sync_dir(_context.rowset_path_prefix));
     }
     _rowset_meta_pb->set_num_rows(_num_rows_written);
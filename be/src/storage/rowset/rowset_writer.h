@@ -46,6 +46,7 @@
 #include "runtime/global_dict/types_fwd_decl.h"
 #include "storage/column_mapping.h"
 #include "storage/compaction_utils.h"
+#include "storage/rowset/column_dict_cache.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
@@ -173,6 +174,8 @@ protected:
     std::unique_ptr<RowsetMetaPB> _rowset_meta_pb;
     std::unique_ptr<RowsetTxnMetaPB> _rowset_txn_meta_pb;
     SegmentWriterOptions _writer_options;
+    // shared string dictionaries across all segments of this rowset
+    std::unique_ptr<ColumnDictCache> _dict_cache;
 
     int _num_segment = 0;
     int _num_delfile = 0;
@@ -60,12 +60,56 @@
 #include "storage/update_manager.h"
 #include "types/array_type_info.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
+#include "util/lru_cache.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
 constexpr static const LogicalType kDictCodeType = TYPE_INT;
 
+namespace {
+
+// Per-BE cache of zone-map pruning results keyed by (segment file, predicate digest), so that
+// point-lookup-heavy workloads which repeatedly scan the same segments with a bounded set of
+// predicate shapes skip the per-column zone-map evaluation after the first query. Segment files
+// are immutable, so entries never go stale; rewritten tablets produce new file names and the
+// superseded entries simply age out of the LRU.
+class SegmentRowRangeCache {
+public:
+    static SegmentRowRangeCache* instance() {
+        static SegmentRowRangeCache s_instance;
+        return &s_instance;
+    }
+
+    bool lookup(const std::string& key, SparseRange<>* range) {
+        auto* handle = _cache->lookup(CacheKey(key));
+        if (handle == nullptr) {
+            return false;
+        }
+        DeferOp defer([&]() { _cache->release(handle); });
+        *range = *static_cast<const SparseRange<>*>(_cache->value(handle));
+        return true;
+    }
+
+    void insert(const std::string& key, const SparseRange<>& range) {
+        auto* value = new SparseRange<>(range);
+        size_t charge = key.size() + sizeof(SparseRange<>) + range.size() * sizeof(Range<>);
+        auto* handle = _cache->insert(CacheKey(key), value, charge,
+                                      [](const CacheKey&, void* v) { delete static_cast<SparseRange<>*>(v); });
+        if (handle != nullptr) {
+            _cache->release(handle);
+        }
+    }
+
+private:
+    SegmentRowRangeCache() : _cache(new_lru_cache(config::segment_row_range_cache_capacity)) {}
+
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace
+
 // compare |tuple| with the first row of |chunk|.
 // NULL will be treated as a minimal value.
 static int compare(const SeekTuple& tuple, const Chunk& chunk) {
@@ -196,6 +240,7 @@ private:
     StatusOr<SparseRange<>> _get_row_ranges_by_key_ranges();
     StatusOr<SparseRange<>> _get_row_ranges_by_short_key_ranges();
     Status _get_row_ranges_by_zone_map();
+    std::string _zone_map_range_cache_key(const std::set<ColumnId>& columns) const;
     Status _get_row_ranges_by_bloom_filter();
     Status _get_row_ranges_by_rowid_range();
 
@@ -204,7 +249,7 @@ private:
 
     Status _lookup_ordinal(const SeekTuple& key, bool lower, rowid_t end, rowid_t* rowid);
     Status _lookup_ordinal(const Slice& index_key, const Schema& short_key_schema, bool lower, rowid_t end,
-                           rowid_t* rowid);
+                           rowid_t* rowid, rowid_t start_hint = 0);
     Status _seek_columns(const Schema& schema, rowid_t pos);
     Status _read_columns(const Schema& schema, Chunk* chunk, size_t nrows);
 
@@ -456,6 +501,9 @@ Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
                 del_pred = iter != _del_predicates.end() ? &(iter->second) : nullptr;
                 SparseRange<> r;
                 RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(predicates, del_pred, &r));
+                // A runtime filter that collapsed to a point becomes an EQ predicate,
+                // which can additionally probe the bloom filter index of the column.
+                RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_bloom_filter(predicates, &r));
                 size_t prev_size = _scan_range.span_size();
                 SparseRange<> res;
                 res.set_sorted(_scan_range.is_sorted());
@@ -520,6 +568,8 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
     ColumnIteratorOptions iter_opts;
     iter_opts.stats = _opts.stats;
     iter_opts.use_page_cache = _opts.use_page_cache;
+    iter_opts.fill_page_cache = _opts.fill_page_cache;
+    iter_opts.page_cache_group_stats = _opts.page_cache_group_stats;
     iter_opts.check_dict_encoding = check_dict_enc;
     iter_opts.reader_type = _opts.reader_type;
     iter_opts.lake_io_opts = _opts.lake_io_opts;
@@ -544,8 +594,9 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
         const auto& col = tablet_schema->column(cid);
         ASSIGN_OR_RETURN(_column_iterators[cid], _segment->new_column_iterator_or_default(col, access_path));
         ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
-        if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
-            _segment->lake_tablet_manager() != nullptr) {
+        bool io_coalesce_enable = _segment->lake_tablet_manager() != nullptr ? config::io_coalesce_lake_read_enable
+                                                                             : config::io_coalesce_local_read_enable;
+        if (io_coalesce_enable && !_segment->is_default_column(col)) {
             int64_t file_size = 0;
             if (_segment->file_info().size.has_value()) {
                 file_size = _segment->file_info().size.value();
@@ -559,6 +610,18 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
                     .max_dist_size = config::io_coalesce_read_max_distance_size,
                     .max_buffer_size = config::io_coalesce_read_max_buffer_size};
             shared_buffered_input_stream->set_coalesce_options(options);
+            // Register the root pages of the column's unloaded indexes up front, so that
+            // the ordinal index load in init() and the zone map/bloom filter/bitmap index
+            // loads triggered by predicates hit shared buffers and are coalesced into one
+            // read instead of one small read (an object-store round trip on lake tablets)
+            // each. Data page ranges are registered later by convert_sparse_range_to_io_range.
+            if (const ColumnReader* reader = _segment->column_with_uid(col.unique_id()); reader != nullptr) {
+                std::vector<io::SharedBufferedInputStream::IORange> index_ranges;
+                reader->collect_index_io_ranges(_opts.predicates.count(cid) > 0, &index_ranges);
+                if (!index_ranges.empty()) {
+                    RETURN_IF_ERROR(shared_buffered_input_stream->set_io_ranges(index_ranges));
+                }
+            }
             iter_opts.read_file = shared_buffered_input_stream.get();
             iter_opts.is_io_coalesce = true;
             _column_files[cid] = std::move(shared_buffered_input_stream);
@@ -747,10 +810,27 @@ StatusOr<SparseRange<>> SegmentIterator::_get_row_ranges_by_short_key_ranges() {
     }
 
     RETURN_IF_ERROR(_segment->load_index(_opts.lake_io_opts));
+    // Where the previous range's lower search landed. Ranges usually arrive in ascending key
+    // order (e.g. the splits of one segment), so the searches of the next range can start from
+    // there once the encoded-key order is verified.
+    Slice prev_lower_key;
+    rowid_t prev_lower_rowid = 0;
+    bool prev_lower_inclusive = false;
     for (const auto& short_key_range : _opts.short_key_ranges) {
         rowid_t lower_rowid = 0;
         rowid_t upper_rowid = num_rows();
 
+        const auto& lower = short_key_range->lower;
+        rowid_t start_hint = 0;
+        if (!prev_lower_key.empty() && lower->tuple_key == nullptr && !lower->short_key.empty()) {
+            // An exclusive previous bound may land behind an equal key's lower bound, so an
+            // equal key only inherits the position of an inclusive search.
+            int cmp = prev_lower_key.compare(lower->short_key);
+            if (cmp < 0 || (cmp == 0 && prev_lower_inclusive)) {
+                start_hint = prev_lower_rowid;
+            }
+        }
+
         const auto& upper = short_key_range->upper;
         if (upper->tuple_key != nullptr) {
             RETURN_IF_ERROR(_init_column_iterators<false>(upper->tuple_key->schema()));
@@ -758,18 +838,20 @@ StatusOr<SparseRange<>> SegmentIterator::_get_row_ranges_by_short_key_ranges() {
         } else if (!upper->short_key.empty()) {
             RETURN_IF_ERROR(_init_column_iterators<false>(*(upper->short_key_schema)));
             RETURN_IF_ERROR(_lookup_ordinal(upper->short_key, *(upper->short_key_schema), !upper->inclusive, num_rows(),
-                                            &upper_rowid));
+                                            &upper_rowid, start_hint));
         }
 
         if (upper_rowid > 0) {
-            const auto& lower = short_key_range->lower;
             if (lower->tuple_key != nullptr) {
                 RETURN_IF_ERROR(_init_column_iterators<false>(lower->tuple_key->schema()));
                 RETURN_IF_ERROR(_lookup_ordinal(*(lower->tuple_key), lower->inclusive, upper_rowid, &lower_rowid));
             } else if (!lower->short_key.empty()) {
                 RETURN_IF_ERROR(_init_column_iterators<false>(*(lower->short_key_schema)));
                 RETURN_IF_ERROR(_lookup_ordinal(lower->short_key, *(lower->short_key_schema), lower->inclusive,
-                                                upper_rowid, &lower_rowid));
+                                                upper_rowid, &lower_rowid, start_hint));
+                prev_lower_key = lower->short_key;
+                prev_lower_rowid = lower_rowid;
+                prev_lower_inclusive = lower->inclusive;
             }
         }
 
@@ -812,21 +894,37 @@ Status SegmentIterator::_get_row_ranges_by_zone_map() {
         columns.insert(pair.first);
     }
 
-    std::vector<const ColumnPredicate*> query_preds;
-    for (ColumnId cid : columns) {
-        auto iter1 = _opts.predicates_for_zone_map.find(cid);
-        if (iter1 != _opts.predicates_for_zone_map.end()) {
-            query_preds = iter1->second;
-        } else {
-            query_preds.clear();
-        }
+    // The pruning result only depends on the (immutable) segment and the predicates, so repeated
+    // scans with the same predicate shape can reuse it and skip the index evaluation entirely.
+    // Delta column groups patch column data in place without renaming the segment file, so the
+    // cache is bypassed for segments carrying them.
+    std::string cache_key;
+    bool cache_hit = false;
+    if (config::enable_segment_row_range_cache && !columns.empty() && _dcgs.empty()) {
+        cache_key = _zone_map_range_cache_key(columns);
+        cache_hit = SegmentRowRangeCache::instance()->lookup(cache_key, &zm_range);
+    }
 
-        const ColumnPredicate* del_pred;
-        auto iter = _del_predicates.find(cid);
-        del_pred = iter != _del_predicates.end() ? &(iter->second) : nullptr;
-        SparseRange<> r;
-        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(query_preds, del_pred, &r));
-        zm_range = zm_range.intersection(r);
+    if (!cache_hit) {
+        std::vector<const ColumnPredicate*> query_preds;
+        for (ColumnId cid : columns) {
+            auto iter1 = _opts.predicates_for_zone_map.find(cid);
+            if (iter1 != _opts.predicates_for_zone_map.end()) {
+                query_preds = iter1->second;
+            } else {
+                query_preds.clear();
+            }
+
+            const ColumnPredicate* del_pred;
+            auto iter = _del_predicates.find(cid);
+            del_pred = iter != _del_predicates.end() ? &(iter->second) : nullptr;
+            SparseRange<> r;
+            RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(query_preds, del_pred, &r));
+            zm_range = zm_range.intersection(r);
+        }
+        if (!cache_key.empty()) {
+            SegmentRowRangeCache::instance()->insert(cache_key, zm_range);
+        }
     }
     StarRocksMetrics::instance()->segment_rows_read_by_zone_map.increment(zm_range.span_size());
     size_t prev_size = _scan_range.span_size();
@@ -835,6 +933,27 @@ Status SegmentIterator::_get_row_ranges_by_zone_map() {
     return Status::OK();
 }
 
+std::string SegmentIterator::_zone_map_range_cache_key(const std::set<ColumnId>& columns) const {
+    std::string key = _segment->file_name();
+    for (ColumnId cid : columns) {
+        key.append("|");
+        key.append(std::to_string(cid));
+        auto iter1 = _opts.predicates_for_zone_map.find(cid);
+        if (iter1 != _opts.predicates_for_zone_map.end()) {
+            for (const auto* pred : iter1->second) {
+                key.append(":");
+                key.append(pred->debug_string());
+            }
+        }
+        auto iter = _del_predicates.find(cid);
+        if (iter != _del_predicates.end()) {
+            key.append("#");
+            key.append(iter->second.debug_string());
+        }
+    }
+    return key;
+}
+
 // if |lower| is true, return the first row in the range [0, end) that is not less than |key|,
 // or end if no such row is found.
 // if |lower| is false, return the first row in the range [0, end) that is greater than |key|,
@@ -899,7 +1018,7 @@ Status SegmentIterator::_lookup_ordinal(const SeekTuple& key, bool lower, rowid_
 }
 
 Status SegmentIterator::_lookup_ordinal(const Slice& index_key, const Schema& short_key_schema, bool lower, rowid_t end,
-                                        rowid_t* rowid) {
+                                        rowid_t* rowid, rowid_t start_hint) {
     uint32_t start_block_id;
     auto start_iter = _segment->lower_bound(index_key);
     if (start_iter.valid()) {
@@ -915,7 +1034,10 @@ Status SegmentIterator::_lookup_ordinal(const Slice& index_key, const Schema& sh
         // row block. so we set the rowid to first row of last row block.
         start_block_id = _segment->last_block();
     }
-    rowid_t start = start_block_id * _segment->num_rows_per_block();
+    // A caller walking keys in ascending order passes where the previous search landed as
+    // |start_hint|, so successive searches only move forward instead of rereading the rows
+    // the previous search already passed.
+    rowid_t start = std::max<rowid_t>(start_block_id * _segment->num_rows_per_block(), start_hint);
 
     auto end_iter = _segment->upper_bound(index_key);
     if (end_iter.valid()) {
@@ -31,6 +31,7 @@
 namespace starrocks {
 class Condition;
 struct OlapReaderStatistics;
+struct PageCacheGroupStats;
 class RuntimeProfile;
 class TabletSchema;
 class DeltaColumnGroupLoader;
@@ -74,6 +75,10 @@ public:
     RuntimeProfile* profile = nullptr;
 
     bool use_page_cache = false;
+    // whether pages missed in the page cache may be inserted into it
+    bool fill_page_cache = true;
+    // per-resource-group page cache accounting, may be null
+    PageCacheGroupStats* page_cache_group_stats = nullptr;
     LakeIOOptions lake_io_opts{.fill_data_cache = true};
 
     ReaderType reader_type = READER_QUERY;
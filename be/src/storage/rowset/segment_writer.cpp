@@ -167,8 +167,20 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         if (column.type() == LogicalType::TYPE_ARRAY) {
             opts.need_zone_map = false;
         }
+        // block zone maps pay off for time-ordered data where a page spans a wide value
+        // range, so build them for date/datetime columns only
+        opts.need_block_zone_map =
+                opts.need_zone_map && config::enable_block_zone_map &&
+                (column.type() == LogicalType::TYPE_DATE || column.type() == LogicalType::TYPE_DATETIME);
         opts.need_bloom_filter = column.is_bf_column();
         opts.need_bitmap_index = column.has_bitmap_index();
+        // ndv sketches cover every scalar column whose values the sketch builder can hash,
+        // object-like types (hll/bitmap/percentile/json) have no meaningful distinct count.
+        opts.need_ndv_sketch = config::enable_segment_ndv_sketch &&
+                               is_scalar_field_type(delegate_type(column.type())) &&
+                               column.type() != LogicalType::TYPE_JSON &&
+                               column.type() != LogicalType::TYPE_OBJECT && column.type() != LogicalType::TYPE_HLL &&
+                               column.type() != LogicalType::TYPE_PERCENTILE;
         opts.need_inverted_index = _tablet_schema->has_index(column.unique_id(), GIN);
 
         RETURN_IF_ERROR(_tablet_schema->get_indexes_for_column(column.unique_id(), &opts.tablet_index));
@@ -195,6 +207,9 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
                 _global_dict_columns_valid_info[iter->first] = true;
             }
         }
+        if (column.type() == LogicalType::TYPE_VARCHAR || column.type() == LogicalType::TYPE_CHAR) {
+            opts.dict_cache = _opts.dict_cache;
+        }
 
         opts.need_flat = config::enable_json_flat;
         ASSIGN_OR_RETURN(auto writer, ColumnWriter::create(opts, &column, _wfile.get()));
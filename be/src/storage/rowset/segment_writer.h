@@ -55,6 +55,7 @@ class ShortKeyIndexBuilder;
 class MemTracker;
 class WritableFile;
 class Chunk;
+class ColumnDictCache;
 class ColumnWriter;
 class Schema;
 
@@ -76,6 +77,8 @@ struct SegmentWriterOptions {
     GlobalDictByNameMaps* global_dicts = nullptr;
     std::vector<int32_t> referenced_column_ids;
     SegmentFileMark segment_file_mark;
+    // shared by all segments of one rowset, see ColumnDictCache
+    ColumnDictCache* dict_cache = nullptr;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
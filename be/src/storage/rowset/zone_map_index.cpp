@@ -152,9 +152,13 @@ public:
 
     Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) override;
 
+    Status finish_block_index(WritableFile* wfile, ZoneMapIndexPB* meta, uint32_t granularity) override;
+
     uint64_t size() const override { return _estimated_size; }
 
 private:
+    Status _write_zone_maps(WritableFile* wfile, IndexedColumnMetaPB* meta);
+
     void _reset_zone_map(ZoneMap<type>* zone_map) {
         // we should allocate max varchar length and set to max for min value
         zone_map->min_value.reset(_type_info);
@@ -258,13 +262,7 @@ std::unique_ptr<ZoneMapIndexWriter> ZoneMapIndexWriter::create(TypeInfo* type_in
 }
 
 template <LogicalType type>
-Status ZoneMapIndexWriterImpl<type>::finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) {
-    index_meta->set_type(ZONE_MAP_INDEX);
-    ZoneMapIndexPB* meta = index_meta->mutable_zone_map_index();
-    // store segment zone map
-    _segment_zone_map.to_proto(meta->mutable_segment_zone_map(), _type_info);
-
-    // write out zone map for each data pages
+Status ZoneMapIndexWriterImpl<type>::_write_zone_maps(WritableFile* wfile, IndexedColumnMetaPB* meta) {
     TypeInfoPtr typeinfo = get_type_info(TYPE_OBJECT);
     IndexedColumnWriterOptions options;
     options.write_ordinal_index = true;
@@ -279,7 +277,25 @@ Status ZoneMapIndexWriterImpl<type>::finish(WritableFile* wfile, ColumnIndexMeta
         Slice value_slice(value);
         RETURN_IF_ERROR(writer.add(&value_slice));
     }
-    return writer.finish(meta->mutable_page_zone_maps());
+    return writer.finish(meta);
+}
+
+template <LogicalType type>
+Status ZoneMapIndexWriterImpl<type>::finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) {
+    index_meta->set_type(ZONE_MAP_INDEX);
+    ZoneMapIndexPB* meta = index_meta->mutable_zone_map_index();
+    // store segment zone map
+    _segment_zone_map.to_proto(meta->mutable_segment_zone_map(), _type_info);
+
+    // write out zone map for each data pages
+    return _write_zone_maps(wfile, meta->mutable_page_zone_maps());
+}
+
+template <LogicalType type>
+Status ZoneMapIndexWriterImpl<type>::finish_block_index(WritableFile* wfile, ZoneMapIndexPB* meta,
+                                                        uint32_t granularity) {
+    meta->set_block_zone_map_granularity(granularity);
+    return _write_zone_maps(wfile, meta->mutable_block_zone_maps());
 }
 
 ZoneMapIndexReader::ZoneMapIndexReader() {
@@ -290,7 +306,7 @@ ZoneMapIndexReader::~ZoneMapIndexReader() {
     MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->column_zonemap_index_mem_tracker(), mem_usage());
 }
 
-StatusOr<bool> ZoneMapIndexReader::load(const IndexReadOptions& opts, const ZoneMapIndexPB& meta) {
+StatusOr<bool> ZoneMapIndexReader::load(const IndexReadOptions& opts, const IndexedColumnMetaPB& meta) {
     return success_once(_load_once, [&]() {
         Status st = _do_load(opts, meta);
         if (st.ok()) {
@@ -303,8 +319,8 @@ StatusOr<bool> ZoneMapIndexReader::load(const IndexReadOptions& opts, const Zone
     });
 }
 
-Status ZoneMapIndexReader::_do_load(const IndexReadOptions& opts, const ZoneMapIndexPB& meta) {
-    IndexedColumnReader reader(meta.page_zone_maps());
+Status ZoneMapIndexReader::_do_load(const IndexReadOptions& opts, const IndexedColumnMetaPB& meta) {
+    IndexedColumnReader reader(meta);
     RETURN_IF_ERROR(reader.load(opts));
     std::unique_ptr<IndexedColumnIterator> iter;
     RETURN_IF_ERROR(reader.new_iterator(opts, &iter));
@@ -71,6 +71,12 @@ public:
 
     virtual Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) = 0;
 
+    // Write the collected zone maps into |meta|'s block_zone_maps instead of
+    // page_zone_maps. Used when this writer collects one zone map per fixed-size row
+    // block (flushed by the caller every |granularity| rows) rather than per data page,
+    // providing sub-page pruning granularity.
+    virtual Status finish_block_index(WritableFile* wfile, ZoneMapIndexPB* meta, uint32_t granularity) = 0;
+
     virtual uint64_t size() const = 0;
 };
 
@@ -87,7 +93,13 @@ public:
     //
     // Return true if the index data was successfully loaded by the caller, false if
     // the data was loaded by another caller.
-    StatusOr<bool> load(const IndexReadOptions& opts, const ZoneMapIndexPB& meta);
+    StatusOr<bool> load(const IndexReadOptions& opts, const ZoneMapIndexPB& meta) {
+        return load(opts, meta.page_zone_maps());
+    }
+
+    // load the zone maps stored in |meta|, which is either the page_zone_maps or the
+    // block_zone_maps column of a ZoneMapIndexPB.
+    StatusOr<bool> load(const IndexReadOptions& opts, const IndexedColumnMetaPB& meta);
 
     // REQUIRES: the index data has been successfully `load()`ed into memory.
     const std::vector<ZoneMapPB>& page_zone_maps() const { return _page_zone_maps; }
@@ -102,7 +114,7 @@ public:
 private:
     void _reset() { std::vector<ZoneMapPB>{}.swap(_page_zone_maps); }
 
-    Status _do_load(const IndexReadOptions& opts, const ZoneMapIndexPB& meta);
+    Status _do_load(const IndexReadOptions& opts, const IndexedColumnMetaPB& meta);
 
     OnceFlag _load_once;
     std::vector<ZoneMapPB> _page_zone_maps;
@@ -709,8 +709,19 @@ Status SchemaChangeUtils::parse_request_normal(const TabletSchemaCSPtr& base_sch
                 *sc_directly = true;
                 return Status::OK();
             } else if (new_column.length() != ref_column.length()) {
-                *sc_directly = true;
-                return Status::OK();
+                // Growing the declared length of a varchar column leaves the stored
+                // slices valid as-is, so the segments can still be linked unchanged.
+                // Char values however are stored zero-padded to the declared length,
+                // and so are the bitmap index dictionaries and bloom filters built over
+                // them, while predicates pad their operand to the current schema length:
+                // probing old segments after a linked char length change would use keys
+                // of the new padded length against entries of the old one and silently
+                // miss. So any char length change (and every other length change) still
+                // rewrites the data.
+                if (!(new_column.type() == TYPE_VARCHAR && new_column.length() > ref_column.length())) {
+                    *sc_directly = true;
+                    return Status::OK();
+                }
             } else if (new_column.is_bf_column() != ref_column.is_bf_column()) {
                 *sc_directly = true;
                 return Status::OK();
@@ -73,11 +73,13 @@
 #include "storage/update_manager.h"
 #include "testutil/sync_point.h"
 #include "util/bthreads/executor.h"
+#include "util/countdown_latch.h"
 #include "util/lru_cache.h"
 #include "util/scoped_cleanup.h"
 #include "util/starrocks_metrics.h"
 #include "util/stopwatch.hpp"
 #include "util/thread.h"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/time.h"
 #include "util/trace.h"
@@ -224,6 +226,23 @@ Status StorageEngine::_open(const EngineOptions& options) {
             async_delta_writer,
             static_cast<bthreads::ThreadPoolExecutor*>(_async_delta_writer_executor.get())->get_thread_pool());
 
+    if (config::number_tablet_writer_shards > 0) {
+        int num_shards = config::number_tablet_writer_shards;
+        int threads_per_shard = std::max<int>(1, config::number_tablet_writer_threads / num_shards);
+        _async_delta_writer_executor_shards.reserve(num_shards);
+        for (int i = 0; i < num_shards; i++) {
+            std::unique_ptr<ThreadPool> shard_pool;
+            RETURN_IF_ERROR(ThreadPoolBuilder(strings::Substitute("delta_writer_shard_$0", i))
+                                    .set_min_threads(1)
+                                    .set_max_threads(threads_per_shard)
+                                    .set_max_queue_size(40960)
+                                    .set_idle_timeout(MonoDelta::FromMilliseconds(/*5 minutes=*/5 * 60 * 1000))
+                                    .build(&shard_pool));
+            _async_delta_writer_executor_shards.emplace_back(
+                    std::make_unique<bthreads::ThreadPoolExecutor>(shard_pool.release(), kTakesOwnership));
+        }
+    }
+
     _memtable_flush_executor = std::make_unique<MemTableFlushExecutor>();
     RETURN_IF_ERROR_WITH_WARN(_memtable_flush_executor->init(dirs), "init MemTableFlushExecutor failed");
     REGISTER_THREAD_POOL_METRICS(memtable_flush, _memtable_flush_executor->get_thread_pool());
@@ -236,11 +255,33 @@ Status StorageEngine::_open(const EngineOptions& options) {
     RETURN_IF_ERROR_WITH_WARN(_segment_replicate_executor->init(dirs), "init SegmentReplicateExecutor failed");
     REGISTER_THREAD_POOL_METRICS(segment_replicate, _segment_replicate_executor->get_thread_pool());
 
+    RETURN_IF_ERROR_WITH_WARN(ThreadPoolBuilder("merge_prefetch")
+                                      .set_min_threads(0)
+                                      .set_max_threads(std::max(1, config::merge_prefetch_max_threads))
+                                      .set_idle_timeout(MonoDelta::FromMilliseconds(/*5 minutes=*/5 * 60 * 1000))
+                                      .build(&_merge_prefetch_thread_pool),
+                              "init merge prefetch thread pool failed");
+
+    RETURN_IF_ERROR_WITH_WARN(ThreadPoolBuilder("clone_prewarm")
+                                      .set_min_threads(0)
+                                      .set_max_threads(1)
+                                      .set_idle_timeout(MonoDelta::FromMilliseconds(/*5 minutes=*/5 * 60 * 1000))
+                                      .build(&_clone_prewarm_thread_pool),
+                              "init clone prewarm thread pool failed");
+
     RETURN_IF_ERROR_WITH_WARN(_replication_txn_manager->init(dirs), "init ReplicationTxnManager failed");
 
     return Status::OK();
 }
 
+bthread::Executor* StorageEngine::async_delta_writer_executor(int64_t tablet_id) {
+    if (_async_delta_writer_executor_shards.empty()) {
+        return _async_delta_writer_executor.get();
+    }
+    size_t idx = std::hash<int64_t>()(tablet_id) % _async_delta_writer_executor_shards.size();
+    return _async_delta_writer_executor_shards[idx].get();
+}
+
 Status StorageEngine::_init_store_map() {
     std::vector<std::pair<bool, DataDir*>> tmp_stores;
     ScopedCleanup release_guard([&] {
@@ -656,6 +697,14 @@ void StorageEngine::stop() {
     if (_compaction_manager) {
         _compaction_manager->stop();
     }
+
+    if (_merge_prefetch_thread_pool) {
+        _merge_prefetch_thread_pool->shutdown();
+    }
+
+    if (_clone_prewarm_thread_pool) {
+        _clone_prewarm_thread_pool->shutdown();
+    }
 }
 
 void StorageEngine::clear_transaction_task(const TTransactionId transaction_id) {
@@ -1242,7 +1291,7 @@ double StorageEngine::delete_unused_rowset() {
         return deleted_pct;
     }
     auto collect_time = timer.elapsed_time() / (1000 * 1000);
-    for (auto& rowset : delete_rowsets) {
+    auto remove_rowset = [this](const RowsetSharedPtr& rowset) {
         VLOG(3) << "start to remove rowset:" << rowset->rowset_id() << ", version:" << rowset->version().first << "-"
                 << rowset->version().second;
         Status status = rowset->remove();
@@ -1253,6 +1302,28 @@ double StorageEngine::delete_unused_rowset() {
         }
         LOG_IF(WARNING, !status.ok()) << "remove delta column group error rowset:" << rowset->rowset_id()
                                       << " finished. status:" << status;
+    };
+    // File removal is dominated by unlink latency, so spread it over the drop thread
+    // pool instead of unlinking from the GC thread one rowset at a time. Fall back to
+    // inline removal if a task cannot be submitted.
+    auto* tp = ExecEnv::GetInstance()->delete_file_thread_pool();
+    if (tp != nullptr && delete_rowsets.size() > 1) {
+        CountDownLatch latch(delete_rowsets.size());
+        for (auto& rowset : delete_rowsets) {
+            auto st = tp->submit_func([&remove_rowset, &rowset, &latch]() {
+                remove_rowset(rowset);
+                latch.count_down();
+            });
+            if (!st.ok()) {
+                remove_rowset(rowset);
+                latch.count_down();
+            }
+        }
+        latch.wait();
+    } else {
+        for (auto& rowset : delete_rowsets) {
+            remove_rowset(rowset);
+        }
     }
     LOG(INFO) << fmt::format("remove {}/{} rowsets num_multi_ref_rowsets:{} {} collect cost {}ms total {}ms",
                              delete_rowsets.size(), total_unused_rowsets, num_multi_ref_rowsets,
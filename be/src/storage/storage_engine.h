@@ -81,6 +81,7 @@ class PublishVersionManager;
 class DictionaryCacheManager;
 class SegmentFlushExecutor;
 class SegmentReplicateExecutor;
+class ThreadPool;
 
 struct DeltaColumnGroupKey {
     int64_t tablet_id;
@@ -230,12 +231,23 @@ public:
 
     bthread::Executor* async_delta_writer_executor() { return _async_delta_writer_executor.get(); }
 
+    // returns the executor shard that |tablet_id| is pinned to, so that one tablet's
+    // ingestion always runs on the same small set of threads. Falls back to the shared
+    // executor when sharding is disabled
+    bthread::Executor* async_delta_writer_executor(int64_t tablet_id);
+
     MemTableFlushExecutor* memtable_flush_executor() { return _memtable_flush_executor.get(); }
 
     SegmentReplicateExecutor* segment_replicate_executor() { return _segment_replicate_executor.get(); }
 
     SegmentFlushExecutor* segment_flush_executor() { return _segment_flush_executor.get(); }
 
+    // pool running the chunk prefetch of heap-merge children, see new_prefetch_iterator().
+    ThreadPool* merge_prefetch_thread_pool() { return _merge_prefetch_thread_pool.get(); }
+
+    // pool warming up freshly cloned tablets, see EngineCloneTask::_submit_prewarm_task().
+    ThreadPool* clone_prewarm_thread_pool() { return _clone_prewarm_thread_pool.get(); }
+
     UpdateManager* update_manager() { return _update_manager.get(); }
 
     bool check_rowset_id_in_unused_rowsets(const RowsetId& rowset_id);
@@ -468,12 +480,18 @@ private:
 
     std::unique_ptr<bthread::Executor> _async_delta_writer_executor;
 
+    std::vector<std::unique_ptr<bthread::Executor>> _async_delta_writer_executor_shards;
+
     std::unique_ptr<MemTableFlushExecutor> _memtable_flush_executor;
 
     std::unique_ptr<SegmentReplicateExecutor> _segment_replicate_executor;
 
     std::unique_ptr<SegmentFlushExecutor> _segment_flush_executor;
 
+    std::unique_ptr<ThreadPool> _merge_prefetch_thread_pool;
+
+    std::unique_ptr<ThreadPool> _clone_prewarm_thread_pool;
+
     std::unique_ptr<UpdateManager> _update_manager;
 
     std::unique_ptr<CompactionManager> _compaction_manager;
@@ -156,6 +156,8 @@ Status Tablet::_init_once_action() {
         _inc_rs_version_map[version] = std::move(rowset);
     }
 
+    _update_rowset_snapshot();
+
     if (keys_type() == DUP_KEYS) {
         std::shared_ptr<DupKeyRowsetFetcher> row_fetcher = std::make_shared<DupKeyRowsetFetcher>(*this);
         _binlog_manager = std::make_unique<BinlogManager>(tablet_id(), schema_hash_path(), config::binlog_file_max_size,
@@ -251,6 +253,7 @@ Status Tablet::revise_tablet_meta(const std::vector<RowsetMetaSharedPtr>& rowset
 
     // reconstruct from tablet meta
     _timestamped_version_tracker.construct_versioned_tracker(_tablet_meta->all_rs_metas());
+    _update_rowset_snapshot();
 
     LOG(INFO) << "finish to clone data to tablet. status=" << st << ", "
               << "table=" << full_name() << ", "
@@ -413,6 +416,8 @@ void Tablet::modify_rowsets(const std::vector<RowsetSharedPtr>& to_add, const st
 
     // add rs_metas_to_delete to tracker
     _timestamped_version_tracker.add_stale_path_version(rs_metas_to_delete);
+
+    _update_rowset_snapshot();
 }
 
 // snapshot manager may call this api to check if version exists, so that
@@ -607,6 +612,7 @@ Status Tablet::add_inc_rowset(const RowsetSharedPtr& rowset, int64_t version) {
     }
 
     _timestamped_version_tracker.add_version(rowset->version());
+    _update_rowset_snapshot();
     if (config::enable_event_based_compaction_framework) {
         StorageEngine::instance()->compaction_manager()->update_tablet_async(
                 std::static_pointer_cast<Tablet>(shared_from_this()));
@@ -842,6 +848,37 @@ Status Tablet::_capture_consistent_rowsets_unlocked(const std::vector<Version>&
     return Status::OK();
 }
 
+bool Tablet::try_capture_consistent_rowsets(const Version& spec_version, std::vector<RowsetSharedPtr>* rowsets) const {
+    if (_updates != nullptr || spec_version.first != 0) {
+        return false;
+    }
+    auto snapshot = std::atomic_load_explicit(&_rowset_snapshot, std::memory_order_acquire);
+    if (snapshot == nullptr || snapshot->version != spec_version.second) {
+        return false;
+    }
+    *rowsets = snapshot->rowsets;
+    return true;
+}
+
+void Tablet::_update_rowset_snapshot() {
+    if (_updates != nullptr) {
+        return;
+    }
+    std::shared_ptr<const RowsetSnapshot> new_snapshot;
+    int64_t max_version = _timestamped_version_tracker.get_max_continuous_version();
+    if (max_version >= 0) {
+        std::vector<Version> version_path;
+        auto snapshot = std::make_shared<RowsetSnapshot>();
+        if (_timestamped_version_tracker.capture_consistent_versions(Version(0, max_version), &version_path).ok() &&
+            _capture_consistent_rowsets_unlocked(version_path, &snapshot->rowsets).ok()) {
+            snapshot->version = max_version;
+            new_snapshot = std::move(snapshot);
+        }
+    }
+    // publish atomically so readers never observe a snapshot older than the version maps
+    std::atomic_store_explicit(&_rowset_snapshot, new_snapshot, std::memory_order_release);
+}
+
 bool Tablet::version_for_delete_predicate(const Version& version) {
     std::shared_lock rlock(get_header_lock());
     return version_for_delete_predicate_unlocked(version);
@@ -1066,6 +1103,8 @@ void Tablet::delete_all_files() {
     }
     _inc_rs_version_map.clear();
     _stale_rs_version_map.clear();
+    std::atomic_store_explicit(&_rowset_snapshot, std::shared_ptr<const RowsetSnapshot>(),
+                               std::memory_order_release);
 }
 
 // check rowset id in tablet-meta and in rowset-meta atomicly
@@ -1369,14 +1408,17 @@ void Tablet::do_tablet_meta_checkpoint() {
     LOG(INFO) << "start to do tablet meta checkpoint, tablet=" << full_name();
     save_meta();
     // if save meta successfully, then should remove the rowset meta existing in tablet
-    // meta from rowset meta store
+    // meta from rowset meta store. The removals are collected and written as one
+    // WriteBatch, so the whole checkpoint needs a single rocksdb write instead of one
+    // per rowset.
+    std::vector<RowsetId> removed_rowset_ids;
     for (auto& rs_meta : _tablet_meta->all_rs_metas()) {
         // If we delete it from rowset manager's meta explicitly in previous checkpoint, just skip.
         if (rs_meta->is_remove_from_rowset_meta()) {
             continue;
         }
         if (RowsetMetaManager::check_rowset_meta(_data_dir->get_meta(), tablet_uid(), rs_meta->rowset_id())) {
-            (void)RowsetMetaManager::remove(_data_dir->get_meta(), tablet_uid(), rs_meta->rowset_id());
+            removed_rowset_ids.push_back(rs_meta->rowset_id());
             VLOG(1) << "remove rowset id from meta store because it is already persistent with "
                        "tablet meta"
                     << ", rowset_id=" << rs_meta->rowset_id();
@@ -1391,13 +1433,15 @@ void Tablet::do_tablet_meta_checkpoint() {
             continue;
         }
         if (RowsetMetaManager::check_rowset_meta(_data_dir->get_meta(), tablet_uid(), rs_meta->rowset_id())) {
-            (void)RowsetMetaManager::remove(_data_dir->get_meta(), tablet_uid(), rs_meta->rowset_id());
+            removed_rowset_ids.push_back(rs_meta->rowset_id());
             VLOG(1) << "remove rowset id from meta store because it is already persistent with tablet meta"
                     << ", rowset_id=" << rs_meta->rowset_id();
         }
         rs_meta->set_remove_from_rowset_meta();
     }
 
+    (void)RowsetMetaManager::remove_batch(_data_dir->get_meta(), tablet_uid(), removed_rowset_ids);
+
     _newly_created_rowset_num = 0;
     _last_checkpoint_time = UnixMillis();
 }
@@ -157,6 +157,12 @@ public:
     [[nodiscard]] Status capture_consistent_rowsets(const Version& spec_version,
                                                     vector<RowsetSharedPtr>* rowsets) const;
 
+    // Lock-free fast path of `capture_consistent_rowsets` for the newest continuous version.
+    // Returns true and fills |rowsets| when |spec_version| matches the published snapshot,
+    // false when the caller must fall back to the locked capture path.
+    [[nodiscard]] bool try_capture_consistent_rowsets(const Version& spec_version,
+                                                      vector<RowsetSharedPtr>* rowsets) const;
+
     const DelPredicateArray& delete_predicates() const { return _tablet_meta->delete_predicates(); }
     [[nodiscard]] bool version_for_delete_predicate(const Version& version);
     [[nodiscard]] bool version_for_delete_predicate_unlocked(const Version& version);
@@ -345,6 +351,11 @@ private:
     Status _capture_consistent_rowsets_unlocked(const vector<Version>& version_path,
                                                 vector<RowsetSharedPtr>* rowsets) const;
 
+    /// Rebuild the immutable rowset snapshot covering [0, max continuous version]. Must be
+    /// called with _meta_lock held in write mode whenever _rs_version_map or the version
+    /// tracker changes, so the published snapshot never lags behind the version maps.
+    void _update_rowset_snapshot();
+
     // The process to generate binlog when publishing a rowset. These methods are protected by _meta_lock
     // _prepare_binlog_if_needed: persist the binlog file before saving the rowset meta in add_inc_rowset()
     //              but the in-memory binlog meta in BinlogManager is not modified, so the binlog
@@ -407,6 +418,15 @@ private:
     // this policy is judged and computed by TimestampedVersionTracker.
     std::unordered_map<Version, RowsetSharedPtr, HashOfVersion> _stale_rs_version_map;
 
+    // Immutable snapshot of the rowsets covering [0, max continuous version]. Readers load it
+    // with a single atomic operation and never touch _meta_lock or the version graph; a retired
+    // snapshot is reclaimed by the shared_ptr refcount once its last reader drops it.
+    struct RowsetSnapshot {
+        int64_t version = -1;
+        std::vector<RowsetSharedPtr> rowsets;
+    };
+    std::shared_ptr<const RowsetSnapshot> _rowset_snapshot;
+
     // States used for updatable tablets only
     std::unique_ptr<TabletUpdates> _updates;
 
@@ -63,6 +63,7 @@
 #include "storage/utils.h"
 #include "util/path_util.h"
 #include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -1279,9 +1280,34 @@ void TabletManager::do_tablet_meta_checkpoint(DataDir* data_dir) {
             related_tablets.push_back(tablet_ptr);
         }
     }
+    int checkpoint_threads = std::max<int>(1, config::tablet_meta_checkpoint_thread_num);
+    if (checkpoint_threads <= 1 || related_tablets.size() <= 1) {
+        for (const TabletSharedPtr& tablet : related_tablets) {
+            tablet->do_tablet_meta_checkpoint();
+        }
+        return;
+    }
+
+    // Tablet::do_tablet_meta_checkpoint only takes per-tablet locks and rocksdb writes
+    // are thread safe, so the tablets of one data dir can be checkpointed in parallel.
+    std::unique_ptr<ThreadPool> checkpoint_pool;
+    Status st = ThreadPoolBuilder("tablet_meta_ckpt")
+                        .set_min_threads(checkpoint_threads)
+                        .set_max_threads(checkpoint_threads)
+                        .build(&checkpoint_pool);
+    if (!st.ok()) {
+        LOG(WARNING) << "fail to create tablet meta checkpoint thread pool: " << st << ", fallback to sequential";
+        for (const TabletSharedPtr& tablet : related_tablets) {
+            tablet->do_tablet_meta_checkpoint();
+        }
+        return;
+    }
     for (const TabletSharedPtr& tablet : related_tablets) {
-        tablet->do_tablet_meta_checkpoint();
+        if (!checkpoint_pool->submit_func([tablet] { tablet->do_tablet_meta_checkpoint(); }).ok()) {
+            tablet->do_tablet_meta_checkpoint();
+        }
     }
+    checkpoint_pool->wait();
 }
 
 void TabletManager::_build_tablet_stat() {
@@ -32,8 +32,10 @@
 #include "storage/empty_iterator.h"
 #include "storage/merge_iterator.h"
 #include "storage/predicate_parser.h"
+#include "storage/prefetch_iterator.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/seek_range.h"
+#include "storage/storage_engine.h"
 #include "storage/tablet.h"
 #include "storage/tablet_updates.h"
 #include "storage/types.h"
@@ -95,7 +97,7 @@ Status TabletReader::prepare() {
     SCOPED_RAW_TIMER(&_stats.get_rowsets_ns);
     Status st = Status::OK();
     // Non-empty rowsets indicate that it is captured before creating this TabletReader.
-    if (_rowsets.empty()) {
+    if (_rowsets.empty() && !_tablet->try_capture_consistent_rowsets(_version, &_rowsets)) {
         std::shared_lock l(_tablet->get_header_lock());
         st = _tablet->capture_consistent_rowsets(_version, &_rowsets);
         if (!st.ok()) {
@@ -198,6 +200,8 @@ Status TabletReader::_init_collector_for_pk_index_read() {
     rs_opts.runtime_state = _reader_params->runtime_state;
     rs_opts.profile = _reader_params->profile;
     rs_opts.use_page_cache = _reader_params->use_page_cache;
+    rs_opts.fill_page_cache = _reader_params->fill_page_cache;
+    rs_opts.page_cache_group_stats = _reader_params->page_cache_group_stats;
     rs_opts.tablet_schema = _tablet_schema;
     rs_opts.global_dictmaps = _reader_params->global_dictmaps;
     rs_opts.unused_output_column_ids = _reader_params->unused_output_column_ids;
@@ -270,6 +274,8 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.runtime_state = params.runtime_state;
     rs_opts.profile = params.profile;
     rs_opts.use_page_cache = params.use_page_cache;
+    rs_opts.fill_page_cache = params.fill_page_cache;
+    rs_opts.page_cache_group_stats = params.page_cache_group_stats;
     rs_opts.tablet_schema = _tablet_schema;
     rs_opts.global_dictmaps = params.global_dictmaps;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
@@ -310,6 +316,16 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
         seg_iters.swap(children);
     }
 
+    // Keep one decoded chunk ahead per merged child, so the IO of losing children
+    // overlaps with the CPU of the heap merge instead of stalling it.
+    if (config::enable_merge_prefetch && seg_iters.size() > 1 &&
+        (is_compaction(params.reader_type) || params.sorted_by_keys_per_tablet)) {
+        auto* prefetch_pool = StorageEngine::instance()->merge_prefetch_thread_pool();
+        for (auto& seg_iter : seg_iters) {
+            seg_iter = new_prefetch_iterator(std::move(seg_iter), prefetch_pool);
+        }
+    }
+
     // If |keys_type| is UNIQUE_KEYS and |params.skip_aggregation| is true, must disable aggregate totally.
     // If |keys_type| is AGG_KEYS and |params.skip_aggregation| is true, aggregate is an optional operation.
     KeysType keys_type = _tablet_schema->keys_type();
@@ -333,10 +349,12 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
         } else {
             _collect_iter = new_heap_merge_iterator(seg_iters);
         }
-    } else if (params.sorted_by_keys_per_tablet && (keys_type == DUP_KEYS || keys_type == PRIMARY_KEYS) &&
+    } else if (params.sorted_by_keys_per_tablet &&
+               (keys_type == DUP_KEYS || keys_type == PRIMARY_KEYS || (keys_type == UNIQUE_KEYS && skip_aggr)) &&
                seg_iters.size() > 1) {
-        // when enable sorted by keys. we need call heap merge for DUP KEYS and PKS
-        // but for UNIQ KEYS or AGG KEYS we need build new_aggregate_iterator for them.
+        // when enable sorted by keys. we need call heap merge for DUP KEYS and PKS.
+        // UNIQ KEYS qualifies too once the planner has proven aggregation skippable,
+        // otherwise UNIQ KEYS and AGG KEYS need new_aggregate_iterator and are not supported here.
         if (params.profile != nullptr && (params.is_pipeline || params.profile->parent() != nullptr)) {
             RuntimeProfile* p;
             if (params.is_pipeline) {
@@ -32,6 +32,7 @@ class RuntimeProfile;
 class RuntimeState;
 
 class ColumnPredicate;
+struct PageCacheGroupStats;
 struct RowidRangeOption;
 using RowidRangeOptionPtr = std::shared_ptr<RowidRangeOption>;
 struct ShortKeyRangesOption;
@@ -57,6 +58,10 @@ struct TabletReaderParams {
     // 2. when read column index page
     //     if config::disable_storage_page_cache is false, we use page cache
     bool use_page_cache = false;
+    // whether pages missed in the page cache may be inserted into it
+    bool fill_page_cache = true;
+    // per-resource-group page cache accounting, may be null
+    PageCacheGroupStats* page_cache_group_stats = nullptr;
 
     // Options only applies to cloud-native table r/w IO
     LakeIOOptions lake_io_opts{.fill_data_cache = true};
@@ -2616,6 +2616,14 @@ Status TabletUpdates::compaction(MemTracker* mem_tracker) {
             break;
         }
     }
+    // rowsets whose segments stitch deep delta column group stacks are merged even when
+    // lazy delta column compaction skipped them or their size based score is zero: every
+    // read of such a rowset pays one extra file per dcg layer.
+    for (uint32_t rowsetid : _dcg_read_amplified_rowsets(rowsets)) {
+        if (std::find(info->inputs.begin(), info->inputs.end(), rowsetid) == info->inputs.end()) {
+            info->inputs.push_back(rowsetid);
+        }
+    }
     // give 10s time gitter, so same table's compaction don't start at same time
     _last_compaction_time_ms = UnixMillis() + rand() % 10000;
     if (info->inputs.empty()) {
@@ -2768,6 +2776,17 @@ Status TabletUpdates::compaction_for_size_tiered(MemTracker* mem_tracker) {
         }
     }
 
+    // rowsets whose segments stitch deep delta column group stacks are merged even when
+    // their level was not picked or their size based score is zero: every read of such a
+    // rowset pays one extra file per dcg layer.
+    bool has_dcg_force_merge = false;
+    for (uint32_t rowsetid : _dcg_read_amplified_rowsets(rowsets)) {
+        if (std::find(info->inputs.begin(), info->inputs.end(), rowsetid) == info->inputs.end()) {
+            info->inputs.emplace_back(rowsetid);
+            has_dcg_force_merge = true;
+        }
+    }
+
     size_t version_count = rowsets.size() - info->inputs.size() + _pending_commits.size();
     // too many rowsets, try to trigger compaction again
     if (version_count >= config::tablet_max_versions * 80 / 100) {
@@ -2783,7 +2802,8 @@ Status TabletUpdates::compaction_for_size_tiered(MemTracker* mem_tracker) {
     int64_t del_rows = total_rows - stat.num_rows;
     // 1. no candidate rowsets, skip compaction
     // 2. only an empty rowset, skip compaction
-    if (info->inputs.empty() || (info->inputs.size() <= 1 && compaction_level == -1 && del_rows == 0)) {
+    if (info->inputs.empty() ||
+        (info->inputs.size() <= 1 && compaction_level == -1 && del_rows == 0 && !has_dcg_force_merge)) {
         LOG(INFO) << "no candidate rowset to do update compaction, tablet:" << _tablet.tablet_id();
         _compaction_running = false;
         return Status::OK();
@@ -3123,6 +3143,41 @@ int32_t TabletUpdates::_calc_compaction_level(RowsetStats* stats) {
     }
 }
 
+std::vector<uint32_t> TabletUpdates::_dcg_read_amplified_rowsets(const std::vector<uint32_t>& rowsets) {
+    std::vector<uint32_t> picked;
+    const int32_t threshold = config::update_compaction_dcg_io_amp_threshold;
+    if (threshold <= 0) {
+        return picked;
+    }
+    std::map<uint32_t, DeltaColumnGroupList> dcgs_by_segment;
+    auto st = TabletMetaManager::scan_tablet_delta_column_group_by_segment(_tablet.data_dir()->get_meta(),
+                                                                           _tablet.tablet_id(), &dcgs_by_segment);
+    if (!st.ok()) {
+        LOG(WARNING) << "scan delta column group failed tablet:" << _tablet.tablet_id() << " " << st;
+        return picked;
+    }
+    if (dcgs_by_segment.empty()) {
+        return picked;
+    }
+    for (uint32_t rowsetid : rowsets) {
+        auto rowset = _get_rowset(rowsetid);
+        if (rowset == nullptr) {
+            continue;
+        }
+        size_t stitch_depth = 0;
+        for (uint32_t i = 0; i < rowset->num_segments(); i++) {
+            auto itr = dcgs_by_segment.find(rowsetid + i);
+            if (itr != dcgs_by_segment.end()) {
+                stitch_depth = std::max(stitch_depth, itr->second.size());
+            }
+        }
+        if (stitch_depth >= static_cast<size_t>(threshold)) {
+            picked.emplace_back(rowsetid);
+        }
+    }
+    return picked;
+}
+
 void TabletUpdates::_calc_compaction_score(RowsetStats* stats) {
     if (stats->num_rows == 0) {
         stats->compaction_score = config::update_compaction_size_threshold;
@@ -415,6 +415,12 @@ private:
     int32_t _calc_compaction_level(RowsetStats* stats);
     void _calc_compaction_score(RowsetStats* stats);
 
+    // Rowsets of |rowsets| whose segments have to stitch at least
+    // config::update_compaction_dcg_io_amp_threshold delta column group files on read.
+    // They are force-picked into compaction to merge the delta columns back into the
+    // base columns, regardless of their size based compaction score.
+    std::vector<uint32_t> _dcg_read_amplified_rowsets(const std::vector<uint32_t>& rowsets);
+
     Status _do_update(uint32_t rowset_id, int32_t upsert_idx, int32_t condition_column, int64_t read_version,
                       const std::vector<ColumnUniquePtr>& upserts, PrimaryIndex& index, int64_t tablet_id,
                       DeletesMap* new_deletes, const TabletSchemaCSPtr& tablet_schema);
@@ -37,8 +37,11 @@
 #include <fmt/format.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <set>
+#include <shared_mutex>
+#include <unordered_set>
 
 #include "agent/agent_common.h"
 #include "agent/finish_task.h"
@@ -60,6 +63,7 @@
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/snapshot_manager.h"
+#include "storage/tablet_meta.h"
 #include "storage/tablet_updates.h"
 #include "util/defer_op.h"
 #include "util/network_util.h"
@@ -117,14 +121,55 @@ Status EngineCloneTask::execute() {
             st = _do_clone(tablet.get());
         }
         _set_tablet_info(st, false);
+        if (st.ok() && config::enable_clone_prewarm) {
+            _submit_prewarm_task();
+        }
     } else {
         auto st = _do_clone(nullptr);
         _set_tablet_info(st, true);
+        if (st.ok() && config::enable_clone_prewarm) {
+            _submit_prewarm_task();
+        }
     }
 
     return Status::OK();
 }
 
+// Warm up the cloned tablet in the background: open the rowset segments and load their
+// short key indexes, so the first queries against the new replica don't pay the cold-open
+// cost. Best effort, a failure only leaves the corresponding segment cold.
+void EngineCloneTask::_submit_prewarm_task() {
+    int64_t tablet_id = _clone_req.tablet_id;
+    auto st = StorageEngine::instance()->clone_prewarm_thread_pool()->submit_func([tablet_id]() {
+        auto tablet = StorageEngine::instance()->tablet_manager()->get_tablet(tablet_id);
+        if (tablet == nullptr || tablet->updates() != nullptr) {
+            // rowsets of a primary key tablet are managed by TabletUpdates, skip it for now
+            return;
+        }
+        std::vector<RowsetSharedPtr> rowsets;
+        int64_t version = tablet->max_continuous_version();
+        if (!tablet->try_capture_consistent_rowsets(Version(0, version), &rowsets)) {
+            std::shared_lock l(tablet->get_header_lock());
+            if (!tablet->capture_consistent_rowsets(Version(0, version), &rowsets).ok()) {
+                return;
+            }
+        }
+        Rowset::acquire_readers(rowsets);
+        DeferOp release([&rowsets]() { Rowset::release_readers(rowsets); });
+        for (auto& rowset : rowsets) {
+            if (!rowset->load().ok()) {
+                continue;
+            }
+            for (const auto& segment : rowset->get_segments()) {
+                (void)segment->load_index();
+            }
+        }
+    });
+    if (!st.ok()) {
+        LOG(WARNING) << "Fail to submit prewarm task for cloned tablet " << tablet_id << ": " << st;
+    }
+}
+
 static string version_list_to_string(const std::vector<Version>& versions) {
     std::ostringstream str;
     size_t last = 0;
@@ -203,7 +248,7 @@ Status EngineCloneTask::_do_clone(Tablet* tablet) {
             LOG(INFO) << "Fail to do incremental clone: " << status
                       << ". switched to fully clone. tablet_id=" << tablet->tablet_id();
             incremental_clone = false;
-            status = _clone_copy(*tablet->data_dir(), download_path, _error_msgs, nullptr);
+            status = _clone_copy(*tablet->data_dir(), download_path, _error_msgs, nullptr, nullptr, tablet);
         }
 
         if (status.ok()) {
@@ -380,7 +425,7 @@ void EngineCloneTask::_set_tablet_info(Status status, bool is_new_tablet) {
 
 Status EngineCloneTask::_clone_copy(DataDir& data_dir, const string& local_data_path, std::vector<string>* error_msgs,
                                     const std::vector<Version>* missed_versions,
-                                    const std::vector<int64_t>* missing_version_ranges) {
+                                    const std::vector<int64_t>* missing_version_ranges, Tablet* tablet) {
     std::string local_path = local_data_path + "/";
     std::string token = get_master_token();
 
@@ -406,7 +451,7 @@ Status EngineCloneTask::_clone_copy(DataDir& data_dir, const string& local_data_
                 "http://$0$1?token=$2&type=V2&file=$3/$4/$5/", get_host_port(src.host, src.http_port),
                 HTTP_REQUEST_PREFIX, token, snapshot_path, _clone_req.tablet_id, _clone_req.schema_hash);
 
-        st = _download_files(&data_dir, download_url, local_path);
+        st = _download_files(&data_dir, download_url, local_path, tablet);
         (void)_release_snapshot(src.host, src.be_port, snapshot_path);
         if (!st.ok()) {
             LOG(WARNING) << "Fail to download snapshot from " << download_url << ": " << st.to_string()
@@ -505,8 +550,94 @@ Status EngineCloneTask::_release_snapshot(const std::string& ip, int port, const
     return {result.status};
 }
 
+Status EngineCloneTask::_download_file(const std::string& remote_file_url, const std::string& local_file_path,
+                                       uint64_t file_size) {
+    uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
+    if (estimate_timeout < config::download_low_speed_time) {
+        estimate_timeout = config::download_low_speed_time;
+    }
+
+    VLOG(1) << "Downloading " << remote_file_url << " to " << local_file_path << ". bytes=" << file_size
+            << " timeout=" << estimate_timeout;
+
+    auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size](HttpClient* client) {
+        RETURN_IF_ERROR(client->init(remote_file_url));
+        client->set_timeout_ms(estimate_timeout * 1000);
+        RETURN_IF_ERROR(client->download(local_file_path));
+
+        // Check file length
+        uint64_t local_file_size = std::filesystem::file_size(local_file_path);
+        if (local_file_size != file_size) {
+            LOG(WARNING) << "Fail to download " << remote_file_url << ". file_size=" << local_file_size << "/"
+                         << file_size;
+            return Status::InternalError("mismatched file size");
+        }
+        chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
+        return Status::OK();
+    };
+    return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+}
+
+Status EngineCloneTask::_collect_reusable_rowsets(Tablet* tablet, const std::string& remote_url_prefix,
+                                                  const std::string& local_path, uint64_t header_file_size,
+                                                  std::unordered_set<std::string>* reuse_rowset_ids) {
+    std::string header_name = std::to_string(_clone_req.tablet_id) + ".hdr";
+    std::string header_path = local_path + header_name;
+    RETURN_IF_ERROR(_download_file(remote_url_prefix + header_name, header_path, header_file_size));
+
+    TabletMeta cloned_tablet_meta;
+    RETURN_IF_ERROR(cloned_tablet_meta.create_from_file(header_path));
+
+    std::vector<Version> local_versions;
+    {
+        std::shared_lock rdlock(tablet->get_header_lock());
+        for (const auto& rs_meta : tablet->tablet_meta()->all_rs_metas()) {
+            local_versions.emplace_back(rs_meta->start_version(), rs_meta->end_version());
+        }
+    }
+
+    // _clone_full_data checks every local version against the max version of the cloned
+    // header; keep the rowset carrying that max version in the transfer so stripping the
+    // reused ones does not lower it.
+    Version cloned_max_version = cloned_tablet_meta.max_version();
+    for (const auto& rs_meta : cloned_tablet_meta.all_rs_metas()) {
+        Version version(rs_meta->start_version(), rs_meta->end_version());
+        if (version.second == cloned_max_version.second) {
+            continue;
+        }
+        if (std::find(local_versions.begin(), local_versions.end(), version) != local_versions.end()) {
+            reuse_rowset_ids->insert(rs_meta->rowset_id().to_string());
+            _reused_local_versions.push_back(version);
+        }
+    }
+    return Status::OK();
+}
+
+Status EngineCloneTask::_strip_reused_rowsets_from_header(const std::string& header_path,
+                                                          const std::unordered_set<std::string>& reuse_rowset_ids) {
+    TabletMeta cloned_tablet_meta;
+    RETURN_IF_ERROR(cloned_tablet_meta.create_from_file(header_path));
+    TabletMetaPB cloned_tablet_meta_pb;
+    cloned_tablet_meta.to_meta_pb(&cloned_tablet_meta_pb);
+
+    TabletMetaPB new_tablet_meta_pb = cloned_tablet_meta_pb;
+    new_tablet_meta_pb.clear_rs_metas();
+    new_tablet_meta_pb.clear_inc_rs_metas();
+    for (const auto& rs_meta : cloned_tablet_meta_pb.rs_metas()) {
+        if (reuse_rowset_ids.count(rs_meta.rowset_id()) == 0) {
+            *new_tablet_meta_pb.add_rs_metas() = rs_meta;
+        }
+    }
+    for (const auto& inc_rs_meta : cloned_tablet_meta_pb.inc_rs_metas()) {
+        if (reuse_rowset_ids.count(inc_rs_meta.rowset_id()) == 0) {
+            *new_tablet_meta_pb.add_inc_rs_metas() = inc_rs_meta;
+        }
+    }
+    return TabletMeta::save(header_path, new_tablet_meta_pb);
+}
+
 Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& remote_url_prefix,
-                                        const std::string& local_path) {
+                                        const std::string& local_path, Tablet* tablet) {
     bool bg_worker_stopped = StorageEngine::instance()->bg_worker_stopped();
     if (bg_worker_stopped) {
         return Status::InternalError("Process is going to quit. The download will stop.");
@@ -577,14 +708,48 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         }
     }
 
+    // For a full clone of an existing tablet the snapshot contains every version, most
+    // of which the local replica usually still holds. Fetch the header ahead of the data
+    // files to learn which remote rowsets cover a version already present locally, and
+    // leave their files out of the transfer; re-replication then moves only the bytes
+    // the two replicas actually differ by. The header is downloaded again at the end of
+    // the regular loop, so the copy-header-last ordering is preserved.
+    _reused_local_versions.clear();
+    std::unordered_set<std::string> reuse_rowset_ids;
+    bool has_dcgs_snapshot = std::any_of(file_name_list.begin(), file_name_list.end(), [](const std::string& name) {
+        return StringPiece(name).ends_with(".dcgs_snapshot");
+    });
+    if (tablet != nullptr && config::enable_clone_reuse_local_rowsets && use_file_name_and_size_format &&
+        !has_dcgs_snapshot && !file_name_list.empty() && StringPiece(file_name_list.back()).ends_with(".hdr")) {
+        auto st = _collect_reusable_rowsets(tablet, remote_url_prefix, local_path, file_size_list.back(),
+                                            &reuse_rowset_ids);
+        if (!st.ok()) {
+            // not fatal, fall back to transferring every file
+            LOG(WARNING) << "Fail to collect reusable rowsets, download all files. tablet:" << _clone_req.tablet_id
+                         << " status:" << st;
+            _reused_local_versions.clear();
+            reuse_rowset_ids.clear();
+        }
+    }
+
     // Get copy from remote
     uint64_t total_file_size = 0;
+    uint64_t reused_file_count = 0;
     MonotonicStopWatch watch;
     watch.start();
     for (int i = 0; i < file_name_list.size(); ++i) {
         std::string& file_name = file_name_list[i];
         auto remote_file_url = remote_url_prefix + file_name;
 
+        if (!reuse_rowset_ids.empty()) {
+            // data files are prefixed with the id of the rowset they belong to
+            size_t sep = file_name.find('_');
+            if (sep != std::string::npos && reuse_rowset_ids.count(file_name.substr(0, sep)) > 0) {
+                ++reused_file_count;
+                continue;
+            }
+        }
+
         uint64_t file_size = 0;
         if (use_file_name_and_size_format) {
             file_size = file_size_list[i];
@@ -605,42 +770,24 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         }
 
         total_file_size += file_size;
-        uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
-        if (estimate_timeout < config::download_low_speed_time) {
-            estimate_timeout = config::download_low_speed_time;
-        }
-
         std::string local_file_path = local_path + file_name;
-
-        VLOG(1) << "Downloading " << remote_file_url << " to " << local_path << ". bytes=" << file_size
-                << " timeout=" << estimate_timeout;
-
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size](HttpClient* client) {
-            RETURN_IF_ERROR(client->init(remote_file_url));
-            client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
-
-            // Check file length
-            uint64_t local_file_size = std::filesystem::file_size(local_file_path);
-            if (local_file_size != file_size) {
-                LOG(WARNING) << "Fail to download " << remote_file_url << ". file_size=" << local_file_size << "/"
-                             << file_size;
-                return Status::InternalError("mismatched file size");
-            }
-            chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
-            return Status::OK();
-        };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
+        RETURN_IF_ERROR(_download_file(remote_file_url, local_file_path, file_size));
     } // Clone files from remote backend
 
+    if (!reuse_rowset_ids.empty()) {
+        std::string header_path = local_path + std::to_string(_clone_req.tablet_id) + ".hdr";
+        RETURN_IF_ERROR(_strip_reused_rowsets_from_header(header_path, reuse_rowset_ids));
+    }
+
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
     if (total_time_ms > 0) {
         copy_rate = total_file_size / ((double)total_time_ms) / 1000;
     }
-    LOG(INFO) << "Copied tablet " << _signature << " files=" << file_name_list.size() << ". bytes=" << total_file_size
-              << " cost=" << total_time_ms << " ms"
+    LOG(INFO) << "Copied tablet " << _signature << " files=" << (file_name_list.size() - reused_file_count)
+              << " reused_files=" << reused_file_count << ". bytes=" << total_file_size << " cost=" << total_time_ms
+              << " ms"
               << " rate=" << copy_rate << " MB/s";
     return Status::OK();
 }
@@ -672,6 +819,31 @@ Status EngineCloneTask::_finish_clone(Tablet* tablet, const string& clone_dir, i
     DeferOp header_wrlock_release_guard([&tablet]() { tablet->release_header_lock(); });
 
     do {
+        // The reuse decision was made before the download, while the compaction locks
+        // were not held yet. A compaction that landed during the download may have
+        // replaced the reused versions, and the stripped snapshot header carries no data
+        // for them, so going on would persist a tablet meta with a version hole.
+        // Re-validate the reused versions now that the locks are held and fail the clone
+        // for retry when any of them is gone; the retry re-collects against fresh state.
+        if (!_reused_local_versions.empty()) {
+            std::vector<Version> local_versions;
+            for (const auto& rs_meta : tablet->tablet_meta()->all_rs_metas()) {
+                local_versions.emplace_back(rs_meta->start_version(), rs_meta->end_version());
+            }
+            for (const auto& version : _reused_local_versions) {
+                if (std::find(local_versions.begin(), local_versions.end(), version) == local_versions.end()) {
+                    res = Status::Aborted(strings::Substitute(
+                            "reused local version $0-$1 disappeared during clone download, tablet=$2", version.first,
+                            version.second, tablet->full_name()));
+                    LOG(WARNING) << "Fail to finish clone: " << res;
+                    break;
+                }
+            }
+            if (!res.ok()) {
+                break;
+            }
+        }
+
         // load src header
         std::string header_file = strings::Substitute("$0/$1.hdr", clone_dir, tablet->tablet_id());
         std::string dcgs_snapshot_file = strings::Substitute("$0/$1.dcgs_snapshot", clone_dir, tablet->tablet_id());
@@ -887,6 +1059,13 @@ Status EngineCloneTask::_clone_full_data(Tablet* tablet, TabletMeta* cloned_tabl
                 LOG(INFO) << "Delta has already existed in local header, no need to clone."
                           << "tablet=" << tablet->full_name() << ", version='" << local_version.first << "-"
                           << local_version.second;
+            } else if (std::find(_reused_local_versions.begin(), _reused_local_versions.end(), local_version) !=
+                       _reused_local_versions.end()) {
+                // the remote rowset for this version was deliberately left out of the
+                // transfer because the local one is byte-equivalent; keep the local one
+                LOG(INFO) << "Reuse local delta instead of cloned one."
+                          << "tablet=" << tablet->full_name() << ", version=" << local_version.first << "-"
+                          << local_version.second;
             } else {
                 // Delta labeled in local_version is not existed in clone header,
                 // some overlapping delta will be cloned to replace it.
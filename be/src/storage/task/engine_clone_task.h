@@ -34,6 +34,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "agent/task_worker_pool.h"
 #include "agent/utils.h"
 #include "gen_cpp/AgentService_types.h"
@@ -70,14 +72,31 @@ private:
     Status _clone_full_data(Tablet* tablet, TabletMeta* cloned_tablet_meta,
                             std::vector<RowsetMetaSharedPtr>& rs_to_clone);
 
+    // |tablet| is only set for a full clone of an existing non-primary tablet; it allows
+    // the download step to skip the data files of versions the local replica already has.
     Status _clone_copy(DataDir& data_dir, const string& local_data_path, vector<string>* error_msgs,
                        const vector<Version>* missing_versions,
-                       const std::vector<int64_t>* missing_version_ranges = nullptr);
+                       const std::vector<int64_t>* missing_version_ranges = nullptr, Tablet* tablet = nullptr);
 
     void _set_tablet_info(Status status, bool is_new_tablet);
 
     // Download tablet files from
-    Status _download_files(DataDir* data_dir, const std::string& remote_url_prefix, const std::string& local_path);
+    Status _download_files(DataDir* data_dir, const std::string& remote_url_prefix, const std::string& local_path,
+                           Tablet* tablet = nullptr);
+
+    Status _download_file(const std::string& remote_file_url, const std::string& local_file_path, uint64_t file_size);
+
+    // Fetch the remote tablet header ahead of the data files and collect the ids of remote
+    // rowsets whose exact version span already exists locally; their immutable data files
+    // are byte-equivalent to the local ones and need not be transferred.
+    Status _collect_reusable_rowsets(Tablet* tablet, const std::string& remote_url_prefix,
+                                     const std::string& local_path, uint64_t header_file_size,
+                                     std::unordered_set<std::string>* reuse_rowset_ids);
+
+    // Drop the reused rowsets from the downloaded header so the later steps do not look
+    // for their (never transferred) data files.
+    Status _strip_reused_rowsets_from_header(const std::string& header_path,
+                                             const std::unordered_set<std::string>& reuse_rowset_ids);
 
     Status _make_snapshot(const std::string& ip, int port, TTableId tablet_id, TSchemaHash schema_hash, int timeout_s,
                           const std::vector<Version>* missed_versions,
@@ -88,6 +107,8 @@ private:
 
     Status _finish_clone_primary(Tablet* tablet, const std::string& clone_dir);
 
+    void _submit_prewarm_task();
+
 private:
     std::unique_ptr<MemTracker> _mem_tracker;
     const TCloneReq& _clone_req;
@@ -95,6 +116,9 @@ private:
     vector<TTabletInfo>* _tablet_infos;
     AgentStatus* _res_status;
     int64_t _signature;
+    // Versions whose remote rowsets were skipped during the last download because the
+    // local replica already holds them; _clone_full_data keeps these local rowsets.
+    std::vector<Version> _reused_local_versions;
 }; // EngineTask
 
 } // namespace starrocks
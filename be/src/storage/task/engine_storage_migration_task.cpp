@@ -35,6 +35,7 @@
 #include "storage/task/engine_storage_migration_task.h"
 
 #include <fmt/format.h>
+#include <sys/stat.h>
 
 #include "runtime/exec_env.h"
 #include "storage/replication_txn_manager.h"
@@ -591,10 +592,24 @@ void EngineStorageMigrationTask::_generate_new_header(DataDir* store, const uint
     // remove old meta after the new tablet is loaded successfully
 }
 
+namespace {
+// Whether the two paths live on the same filesystem, in which case migration hard-links
+// the immutable files instead of copying them and consumes no disk bandwidth.
+bool on_same_filesystem(const std::string& lhs, const std::string& rhs) {
+    struct stat lhs_st;
+    struct stat rhs_st;
+    if (stat(lhs.c_str(), &lhs_st) != 0 || stat(rhs.c_str(), &rhs_st) != 0) {
+        return false;
+    }
+    return lhs_st.st_dev == rhs_st.st_dev;
+}
+} // namespace
+
 Status EngineStorageMigrationTask::_copy_index_and_data_files(
         const string& schema_hash_path, const TabletSharedPtr& ref_tablet,
         const std::vector<RowsetSharedPtr>& consistent_rowsets) const {
     Status status = Status::OK();
+    const bool same_fs = on_same_filesystem(ref_tablet->data_dir()->path(), schema_hash_path);
     for (const auto& rs : consistent_rowsets) {
         bool bg_worker_stopped = StorageEngine::instance()->bg_worker_stopped();
         if (bg_worker_stopped) {
@@ -605,8 +620,19 @@ Status EngineStorageMigrationTask::_copy_index_and_data_files(
         if (!status.ok()) {
             break;
         }
+        if (!same_fs) {
+            _throttle_io(rs->data_disk_size());
+        }
     }
     return status;
 }
 
+void EngineStorageMigrationTask::_throttle_io(int64_t bytes) const {
+    int64_t rate = config::migration_max_bytes_per_disk_per_sec;
+    if (rate <= 0) {
+        return;
+    }
+    _dest_store->migration_throttle()->acquire(bytes, rate);
+}
+
 } // namespace starrocks
@@ -63,6 +63,9 @@ private:
     Status _copy_index_and_data_files(const std::string& header_path, const TabletSharedPtr& ref_tablet,
                                       const std::vector<RowsetSharedPtr>& consistent_rowsets) const;
 
+    // Throttle the copy bandwidth on the destination dir, see config::migration_max_bytes_per_disk_per_sec.
+    void _throttle_io(int64_t bytes) const;
+
     Status _finish_migration(const TabletSharedPtr& tablet, int64_t end_version, uint64_t shard,
                              const std::vector<RowsetSharedPtr>& consistent_rowsets,
                              const std::shared_ptr<TabletMeta>& new_tablet_meta, const string& schema_hash_path,
@@ -222,6 +222,7 @@ StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chun
         ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet_schema, chunk.get());
 
         RETURN_IF_ERROR(output_rs_writer->add_columns(*chunk, column_group, is_key));
+        _throttle_io(chunk->bytes_usage());
 
         _task_info.total_output_num_rows += chunk->num_rows();
         _task_info.total_del_filtered_rows += reader->stats().rows_del_filtered - column_group_del_filtered_rows;
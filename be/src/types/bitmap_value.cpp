@@ -690,6 +690,50 @@ void BitmapValue::write(char* dst) const {
 
 // Deserialize a bitmap value from `src`.
 // Return false if `src` begins with unknown type code, true otherwise.
+BitmapValue BitmapValue::fastunion(const std::vector<const BitmapValue*>& values) {
+    BitmapValue result;
+    std::vector<const detail::Roaring64Map*> bitmaps;
+    bitmaps.reserve(values.size());
+    for (const auto* value : values) {
+        switch (value->_type) {
+        case EMPTY:
+            break;
+        case SINGLE:
+            result.add(value->_sv);
+            break;
+        case SET:
+            for (auto x : *value->_set) {
+                result.add(x);
+            }
+            break;
+        case BITMAP:
+            bitmaps.push_back(value->_bitmap.get());
+            break;
+        }
+    }
+    if (!bitmaps.empty()) {
+        auto united = std::make_shared<detail::Roaring64Map>(
+                detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+        // fold the values collected from SINGLE/SET inputs into the container union
+        switch (result._type) {
+        case SINGLE:
+            united->add(result._sv);
+            break;
+        case SET:
+            for (auto x : *result._set) {
+                united->add(x);
+            }
+            result._set.reset();
+            break;
+        default:
+            break;
+        }
+        result._bitmap = std::move(united);
+        result._type = BITMAP;
+    }
+    return result;
+}
+
 bool BitmapValue::deserialize(const char* src) {
     _mem_usage = 0;
     if (src == nullptr) {
@@ -21,6 +21,10 @@ constexpr int HLL_COLUMN_PRECISION = 14;
 constexpr int HLL_ZERO_COUNT_BITS = (64 - HLL_COLUMN_PRECISION);
 constexpr int HLL_EXPLICLIT_INT64_NUM = 160;
 constexpr int HLL_SPARSE_THRESHOLD = 4096;
+// Keep non-zero registers in a hash map until there are more than this many of
+// them, then promote to the dense register format. Above this count the map
+// would occupy about as much memory as the dense registers.
+constexpr int HLL_SPARSE_PROMOTION_NUM = 1024;
 constexpr int HLL_REGISTERS_COUNT = 16 * 1024;
 // maximum size in byte of serialized HLL: type(1) + registers (2^14)
 constexpr int HLL_COLUMN_DEFAULT_LEN = HLL_REGISTERS_COUNT + 1;
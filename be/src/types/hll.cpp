@@ -38,6 +38,7 @@
 #include <immintrin.h>
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 
@@ -61,7 +62,8 @@ std::string HyperLogLog::empty() {
     return buf;
 }
 
-HyperLogLog::HyperLogLog(const HyperLogLog& other) : _type(other._type), _hash_set(other._hash_set) {
+HyperLogLog::HyperLogLog(const HyperLogLog& other)
+        : _type(other._type), _hash_set(other._hash_set), _sparse_registers(other._sparse_registers) {
     if (other._registers.data != nullptr) {
         MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
         DCHECK_NE(_registers.data, nullptr);
@@ -74,6 +76,7 @@ HyperLogLog& HyperLogLog::operator=(const HyperLogLog& other) {
     if (this != &other) {
         this->_type = other._type;
         this->_hash_set = other._hash_set;
+        this->_sparse_registers = other._sparse_registers;
 
         if (_registers.data != nullptr) {
             MemChunkAllocator::instance()->free(_registers);
@@ -90,7 +93,10 @@ HyperLogLog& HyperLogLog::operator=(const HyperLogLog& other) {
     return *this;
 }
 
-HyperLogLog::HyperLogLog(HyperLogLog&& other) noexcept : _type(other._type), _hash_set(std::move(other._hash_set)) {
+HyperLogLog::HyperLogLog(HyperLogLog&& other) noexcept
+        : _type(other._type),
+          _hash_set(std::move(other._hash_set)),
+          _sparse_registers(std::move(other._sparse_registers)) {
     _registers = other._registers;
 
     other._type = HLL_DATA_EMPTY;
@@ -101,6 +107,7 @@ HyperLogLog& HyperLogLog::operator=(HyperLogLog&& other) noexcept {
     if (this != &other) {
         this->_type = other._type;
         this->_hash_set = std::move(other._hash_set);
+        this->_sparse_registers = std::move(other._sparse_registers);
 
         if (_registers.data != nullptr) {
             MemChunkAllocator::instance()->free(_registers);
@@ -149,8 +156,52 @@ void HyperLogLog::_convert_explicit_to_register() {
     phmap::flat_hash_set<uint64_t>().swap(_hash_set);
 }
 
-// Change HLL_DATA_EXPLICIT to HLL_DATA_FULL directly, because HLL_DATA_SPARSE
-// is implemented in the same way in memory with HLL_DATA_FULL.
+// Convert explicit values to the sparse register map, and clear explicit values.
+// NOTE: this function won't modify _type.
+void HyperLogLog::_convert_explicit_to_sparse() {
+    DCHECK(_type == HLL_DATA_EXPLICIT) << "_type(" << _type << ") should be explicit(" << HLL_DATA_EXPLICIT << ")";
+    DCHECK(_sparse_registers.empty());
+    for (auto value : _hash_set) {
+        _update_sparse_register(value);
+    }
+
+    // Clear _hash_set.
+    phmap::flat_hash_set<uint64_t>().swap(_hash_set);
+}
+
+// Convert the sparse register map to the dense register format, and clear the map.
+// NOTE: this function won't modify _type.
+void HyperLogLog::_promote_sparse_to_register() {
+    DCHECK_EQ(_registers.data, nullptr);
+    MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
+    DCHECK_NE(_registers.data, nullptr);
+    DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
+    memset(_registers.data, 0, HLL_REGISTERS_COUNT);
+
+    for (const auto& [idx, value] : _sparse_registers) {
+        _registers.data[idx] = value;
+    }
+
+    SparseRegisterMap().swap(_sparse_registers);
+}
+
+void HyperLogLog::_maybe_promote_sparse_to_full() {
+    if (_sparse_registers.size() > HLL_SPARSE_PROMOTION_NUM) {
+        _promote_sparse_to_register();
+        _type = HLL_DATA_FULL;
+    }
+}
+
+void HyperLogLog::_merge_sparse_registers(const SparseRegisterMap& other_registers) {
+    for (const auto& [idx, value] : other_registers) {
+        auto& reg = _sparse_registers[idx];
+        reg = std::max(reg, value);
+    }
+}
+
+// Change HLL_DATA_EXPLICIT to HLL_DATA_SPARSE first, which keeps the non-zero
+// registers in a hash map, and promote to HLL_DATA_FULL once the map grows past
+// HLL_SPARSE_PROMOTION_NUM registers.
 void HyperLogLog::update(uint64_t hash_value) {
     switch (_type) {
     case HLL_DATA_EMPTY:
@@ -162,10 +213,16 @@ void HyperLogLog::update(uint64_t hash_value) {
             _hash_set.insert(hash_value);
             break;
         }
-        _convert_explicit_to_register();
-        _type = HLL_DATA_FULL;
+        _convert_explicit_to_sparse();
+        _type = HLL_DATA_SPARSE;
         // fall through
     case HLL_DATA_SPARSE:
+        if (_using_sparse_registers()) {
+            _update_sparse_register(hash_value);
+            _maybe_promote_sparse_to_full();
+            break;
+        }
+        // fall through
     case HLL_DATA_FULL:
         _update_registers(hash_value);
         break;
@@ -187,6 +244,10 @@ void HyperLogLog::merge(const HyperLogLog& other) {
             break;
         case HLL_DATA_SPARSE:
         case HLL_DATA_FULL:
+            if (other._using_sparse_registers()) {
+                _sparse_registers = other._sparse_registers;
+                break;
+            }
             DCHECK_EQ(_registers.data, nullptr);
             MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
             DCHECK_NE(_registers.data, nullptr);
@@ -205,12 +266,20 @@ void HyperLogLog::merge(const HyperLogLog& other) {
             // HLL_EXPLICLIT_INT64_NUM. This is OK because the max value is 2 * 160.
             _hash_set.insert(other._hash_set.begin(), other._hash_set.end());
             if (_hash_set.size() > HLL_EXPLICLIT_INT64_NUM) {
-                _convert_explicit_to_register();
-                _type = HLL_DATA_FULL;
+                // at most 2 * 160 registers, well below HLL_SPARSE_PROMOTION_NUM
+                _convert_explicit_to_sparse();
+                _type = HLL_DATA_SPARSE;
             }
             break;
         case HLL_DATA_SPARSE:
         case HLL_DATA_FULL:
+            if (other._using_sparse_registers()) {
+                _convert_explicit_to_sparse();
+                _type = HLL_DATA_SPARSE;
+                _merge_sparse_registers(other._sparse_registers);
+                _maybe_promote_sparse_to_full();
+                break;
+            }
             _convert_explicit_to_register();
             _merge_registers(other._registers.data);
             _type = HLL_DATA_FULL;
@@ -224,13 +293,33 @@ void HyperLogLog::merge(const HyperLogLog& other) {
     case HLL_DATA_FULL: {
         switch (other._type) {
         case HLL_DATA_EXPLICIT:
+            if (_using_sparse_registers()) {
+                for (auto hash_value : other._hash_set) {
+                    _update_sparse_register(hash_value);
+                }
+                _maybe_promote_sparse_to_full();
+                break;
+            }
             for (auto hash_value : other._hash_set) {
                 _update_registers(hash_value);
             }
             break;
         case HLL_DATA_SPARSE:
         case HLL_DATA_FULL:
-            _merge_registers(other._registers.data);
+            if (_using_sparse_registers() && other._using_sparse_registers()) {
+                _merge_sparse_registers(other._sparse_registers);
+                _maybe_promote_sparse_to_full();
+            } else if (_using_sparse_registers()) {
+                _promote_sparse_to_register();
+                _type = HLL_DATA_FULL;
+                _merge_registers(other._registers.data);
+            } else if (other._using_sparse_registers()) {
+                for (const auto& [idx, value] : other._sparse_registers) {
+                    _registers.data[idx] = std::max((uint8_t)_registers.data[idx], value);
+                }
+            } else {
+                _merge_registers(other._registers.data);
+            }
             break;
         default:
             break;
@@ -248,6 +337,11 @@ size_t HyperLogLog::max_serialized_size() const {
     case HLL_DATA_EXPLICIT:
         return 2 + _hash_set.size() * 8;
     case HLL_DATA_SPARSE:
+        if (_using_sparse_registers()) {
+            // type(1) + number of registers(4) + 3 bytes per register
+            return 1 + 4 + 3 * _sparse_registers.size();
+        }
+        return 1 + HLL_REGISTERS_COUNT;
     case HLL_DATA_FULL:
         return 1 + HLL_REGISTERS_COUNT;
     }
@@ -277,6 +371,23 @@ size_t HyperLogLog::serialize(uint8_t* dst) const {
     }
     case HLL_DATA_SPARSE:
     case HLL_DATA_FULL: {
+        if (_using_sparse_registers()) {
+            // the map never holds more than HLL_SPARSE_PROMOTION_NUM registers,
+            // so the sparse encoding always fits. Emit registers in index order
+            // so that equal sets serialize identically in both representations.
+            *ptr++ = HLL_DATA_SPARSE;
+            encode_fixed32_le(ptr, _sparse_registers.size());
+            ptr += 4;
+            std::vector<std::pair<SparseIndexType, SparseValueType>> registers(_sparse_registers.begin(),
+                                                                               _sparse_registers.end());
+            std::sort(registers.begin(), registers.end());
+            for (const auto& [idx, value] : registers) {
+                encode_fixed16_le(ptr, idx);
+                ptr += 2;
+                *ptr++ = value;
+            }
+            break;
+        }
         uint32_t num_non_zero_registers = 0;
         for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
             num_non_zero_registers += (_registers.data[i] != 0);
@@ -384,15 +495,28 @@ bool HyperLogLog::deserialize(const Slice& slice) {
         break;
     }
     case HLL_DATA_SPARSE: {
+        // 2-5(4 byte): number of registers
+        uint32_t num_registers = decode_fixed32_le(ptr);
+        ptr += 4;
+        if (num_registers <= HLL_SPARSE_PROMOTION_NUM) {
+            // keep the sparse in-memory representation to avoid the dense allocation
+            _sparse_registers.reserve(num_registers);
+            for (uint32_t i = 0; i < num_registers; ++i) {
+                // 2 bytes: register index
+                // 1 byte: register value
+                uint16_t register_idx = decode_fixed16_le(ptr);
+                ptr += 2;
+                auto& reg = _sparse_registers[register_idx];
+                reg = std::max(reg, *ptr++);
+            }
+            break;
+        }
         DCHECK_EQ(_registers.data, nullptr);
         MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
         DCHECK_NE(_registers.data, nullptr);
         DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
         memset(_registers.data, 0, HLL_REGISTERS_COUNT);
 
-        // 2-5(4 byte): number of registers
-        uint32_t num_registers = decode_fixed32_le(ptr);
-        ptr += 4;
         for (uint32_t i = 0; i < num_registers; ++i) {
             // 2 bytes: register index
             // 1 byte: register value
@@ -512,11 +636,19 @@ int64_t HyperLogLog::estimate_cardinality() const {
     float harmonic_mean = 0;
     int num_zero_registers = 0;
 
-    for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += harmomic_tables[_registers.data[i]];
+    if (_using_sparse_registers()) {
+        num_zero_registers = HLL_REGISTERS_COUNT - _sparse_registers.size();
+        harmonic_mean = num_zero_registers * harmomic_tables[0];
+        for (const auto& [idx, value] : _sparse_registers) {
+            harmonic_mean += harmomic_tables[value];
+        }
+    } else {
+        for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
+            harmonic_mean += harmomic_tables[_registers.data[i]];
 
-        if (_registers.data[i] == 0) {
-            ++num_zero_registers;
+            if (_registers.data[i] == 0) {
+                ++num_zero_registers;
+            }
         }
     }
 
@@ -560,6 +692,13 @@ std::string HyperLogLog::to_string() const {
 void HyperLogLog::clear() {
     _type = HLL_DATA_EMPTY;
     _hash_set.clear();
+    _sparse_registers.clear();
+    // release the dense registers back to MemChunkAllocator's pool, otherwise a
+    // later update sequence would find a stale allocation
+    if (_registers.data != nullptr) {
+        MemChunkAllocator::instance()->free(_registers);
+        _registers.data = nullptr;
+    }
 }
 
 void HyperLogLog::_merge_registers(uint8_t* other_registers) {
@@ -78,6 +78,11 @@ class Slice;
 // A HLL value will change in the sequence empty -> explicit -> sparse -> full, and not
 // allow reverse.
 //
+// In memory, the sparse stage keeps the non-zero registers in a hash map and is
+// promoted lazily to the dense registers once there are more than
+// HLL_SPARSE_PROMOTION_NUM of them, so low-cardinality values don't pay the full
+// HLL_REGISTERS_COUNT bytes up front.
+//
 // NOTE: This values are persisted in storage devices, so don't change exist
 // enum values.
 enum HllDataType {
@@ -148,6 +153,7 @@ public:
 
 private:
     using ElementSet = phmap::flat_hash_set<uint64_t>;
+    using SparseRegisterMap = phmap::flat_hash_map<SparseIndexType, SparseValueType>;
 
     HllDataType _type = HLL_DATA_EMPTY;
     // Use raw object instead of pointer to give a chance to create multiple
@@ -155,6 +161,10 @@ private:
     // eg. by std::vector<ObjectColumn<HyperLogLog>>::resize/reserve.
     ElementSet _hash_set;
 
+    // Non-zero registers of the in-memory sparse stage, used while _type is
+    // HLL_DATA_SPARSE and the dense registers are not allocated yet.
+    SparseRegisterMap _sparse_registers;
+
     // This field is much space consumming(HLL_REGISTERS_COUNT), we create
     // it only when it is really needed.
     // Allocate memory by MemChunkAllocator in order to reuse memory.
@@ -163,9 +173,22 @@ private:
 private:
     void _convert_explicit_to_register();
 
+    void _convert_explicit_to_sparse();
+
+    void _promote_sparse_to_register();
+
+    void _maybe_promote_sparse_to_full();
+
+    // whether the in-memory sparse register map is the active representation
+    bool _using_sparse_registers() const { return _type == HLL_DATA_SPARSE && _registers.data == nullptr; }
+
     // absorb other registers into this registers
     void _merge_registers(uint8_t* other_registers);
 
+    // absorb other sparse registers into this sparse registers, the caller is
+    // responsible for promoting to the dense format when the map grows too large
+    void _merge_sparse_registers(const SparseRegisterMap& other_registers);
+
     // update one hash value into this registers
     void _update_registers(uint64_t hash_value) {
         // Use the lower bits to index into the number of streams and then
@@ -177,6 +200,17 @@ private:
         auto first_one_bit = (uint8_t)(__builtin_ctzl(hash_value) + 1);
         _registers.data[idx] = std::max((uint8_t)_registers.data[idx], first_one_bit);
     }
+
+    // update one hash value into the sparse register map, the caller is
+    // responsible for promoting to the dense format when the map grows too large
+    void _update_sparse_register(uint64_t hash_value) {
+        auto idx = (SparseIndexType)(hash_value % HLL_REGISTERS_COUNT);
+        hash_value >>= HLL_COLUMN_PRECISION;
+        hash_value |= ((uint64_t)1 << HLL_ZERO_COUNT_BITS);
+        auto first_one_bit = (uint8_t)(__builtin_ctzl(hash_value) + 1);
+        auto& reg = _sparse_registers[idx];
+        reg = std::max(reg, first_one_bit);
+    }
 };
 
 } // namespace starrocks
@@ -0,0 +1,213 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace starrocks {
+
+typedef __int128 int128_t;
+typedef unsigned __int128 uint128_t;
+
+// A signed 256-bit integer stored as two 128-bit halves, i.e. four 64-bit limbs on
+// x86-64, where GCC lowers the carry propagation below to add/adc chains. It provides
+// the arithmetic that high-precision decimal kernels need: add/sub/mul (both wrapping
+// and overflow-checked), comparison, negation and string conversion. Division is
+// intentionally left out until a DECIMAL256 logical type requires it.
+struct int256_t {
+    uint128_t low = 0;
+    int128_t high = 0;
+
+    constexpr int256_t() = default;
+    constexpr int256_t(int128_t h, uint128_t l) : low(l), high(h) {}
+    constexpr int256_t(int v) : low(static_cast<uint128_t>(static_cast<int128_t>(v))), high(v < 0 ? -1 : 0) {}
+    constexpr int256_t(int64_t v) : low(static_cast<uint128_t>(static_cast<int128_t>(v))), high(v < 0 ? -1 : 0) {}
+    constexpr int256_t(uint64_t v) : low(v), high(0) {}
+    constexpr int256_t(int128_t v) : low(static_cast<uint128_t>(v)), high(v < 0 ? -1 : 0) {}
+    constexpr int256_t(uint128_t v) : low(v), high(0) {}
+
+    constexpr bool is_negative() const { return high < 0; }
+
+    static constexpr int256_t max_value() { return {static_cast<int128_t>((static_cast<uint128_t>(1) << 127) - 1), ~static_cast<uint128_t>(0)}; }
+    static constexpr int256_t min_value() { return {static_cast<int128_t>(static_cast<uint128_t>(1) << 127), 0}; }
+
+    std::string to_string() const;
+};
+
+constexpr bool operator==(const int256_t& a, const int256_t& b) {
+    return a.low == b.low && a.high == b.high;
+}
+constexpr bool operator!=(const int256_t& a, const int256_t& b) {
+    return !(a == b);
+}
+constexpr bool operator<(const int256_t& a, const int256_t& b) {
+    return a.high != b.high ? a.high < b.high : a.low < b.low;
+}
+constexpr bool operator>(const int256_t& a, const int256_t& b) {
+    return b < a;
+}
+constexpr bool operator<=(const int256_t& a, const int256_t& b) {
+    return !(b < a);
+}
+constexpr bool operator>=(const int256_t& a, const int256_t& b) {
+    return !(a < b);
+}
+
+// Wrapping arithmetic. The comparison against the operand's low half is the
+// carry/borrow of the limb addition, which GCC turns into a single adc/sbb.
+constexpr int256_t operator+(const int256_t& a, const int256_t& b) {
+    int256_t r;
+    r.low = a.low + b.low;
+    r.high = a.high + b.high + static_cast<int128_t>(r.low < a.low);
+    return r;
+}
+
+constexpr int256_t operator-(const int256_t& a, const int256_t& b) {
+    int256_t r;
+    r.low = a.low - b.low;
+    r.high = a.high - b.high - static_cast<int128_t>(a.low < b.low);
+    return r;
+}
+
+constexpr int256_t operator-(const int256_t& v) {
+    int256_t r;
+    r.low = ~v.low + 1;
+    r.high = ~v.high + static_cast<int128_t>(r.low == 0);
+    return r;
+}
+
+inline int256_t& operator+=(int256_t& a, const int256_t& b) {
+    a = a + b;
+    return a;
+}
+
+inline int256_t& operator-=(int256_t& a, const int256_t& b) {
+    a = a - b;
+    return a;
+}
+
+namespace int256_detail {
+
+// Schoolbook multiplication of the 64-bit limbs, keeping the low 256 bits of the
+// 512-bit product in r. Returns true if any bit above the low 256 is set.
+inline bool umul256_overflow(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]) {
+    uint64_t acc[8] = {0};
+    for (int i = 0; i < 4; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; ++j) {
+            uint128_t product = static_cast<uint128_t>(a[i]) * b[j] + acc[i + j] + carry;
+            acc[i + j] = static_cast<uint64_t>(product);
+            carry = static_cast<uint64_t>(product >> 64);
+        }
+        acc[i + 4] += carry;
+    }
+    for (int i = 0; i < 4; ++i) {
+        r[i] = acc[i];
+    }
+    return (acc[4] | acc[5] | acc[6] | acc[7]) != 0;
+}
+
+inline void to_limbs(const int256_t& v, uint64_t limbs[4]) {
+    limbs[0] = static_cast<uint64_t>(v.low);
+    limbs[1] = static_cast<uint64_t>(v.low >> 64);
+    limbs[2] = static_cast<uint64_t>(static_cast<uint128_t>(v.high));
+    limbs[3] = static_cast<uint64_t>(static_cast<uint128_t>(v.high) >> 64);
+}
+
+inline int256_t from_limbs(const uint64_t limbs[4]) {
+    int256_t v;
+    v.low = (static_cast<uint128_t>(limbs[1]) << 64) | limbs[0];
+    v.high = static_cast<int128_t>((static_cast<uint128_t>(limbs[3]) << 64) | limbs[2]);
+    return v;
+}
+
+inline int256_t abs_value(const int256_t& v) {
+    return v.is_negative() ? -v : v;
+}
+
+} // namespace int256_detail
+
+inline int256_t operator*(const int256_t& a, const int256_t& b) {
+    uint64_t lhs[4];
+    uint64_t rhs[4];
+    uint64_t res[4];
+    int256_detail::to_limbs(a, lhs);
+    int256_detail::to_limbs(b, rhs);
+    int256_detail::umul256_overflow(lhs, rhs, res);
+    return int256_detail::from_limbs(res);
+}
+
+inline int256_t& operator*=(int256_t& a, const int256_t& b) {
+    a = a * b;
+    return a;
+}
+
+// Overflow-checked arithmetic, mirroring int128_{add,sub,mul}_overflow in
+// runtime/integer_overflow_arithmetics.h.
+constexpr bool int256_add_overflow(const int256_t& a, const int256_t& b, int256_t* c) {
+    *c = a + b;
+    return a.is_negative() == b.is_negative() && c->is_negative() != a.is_negative();
+}
+
+constexpr bool int256_sub_overflow(const int256_t& a, const int256_t& b, int256_t* c) {
+    *c = a - b;
+    return a.is_negative() != b.is_negative() && c->is_negative() != a.is_negative();
+}
+
+inline bool int256_mul_overflow(const int256_t& a, const int256_t& b, int256_t* c) {
+    const bool negative = a.is_negative() != b.is_negative();
+    uint64_t lhs[4];
+    uint64_t rhs[4];
+    uint64_t res[4];
+    int256_detail::to_limbs(int256_detail::abs_value(a), lhs);
+    int256_detail::to_limbs(int256_detail::abs_value(b), rhs);
+    bool overflow = int256_detail::umul256_overflow(lhs, rhs, res);
+    int256_t magnitude = int256_detail::from_limbs(res);
+    // The magnitude must fit into 255 bits, except for -2^255 itself.
+    if (magnitude.is_negative()) {
+        overflow |= !negative || magnitude != int256_t::min_value();
+    }
+    *c = negative ? -magnitude : magnitude;
+    return overflow;
+}
+
+inline std::string int256_t::to_string() const {
+    if (*this == int256_t(0)) {
+        return "0";
+    }
+    uint64_t limbs[4];
+    int256_detail::to_limbs(int256_detail::abs_value(*this), limbs);
+    // -2^255 survives abs_value() unchanged; its limbs already hold the magnitude.
+    std::string digits;
+    while ((limbs[0] | limbs[1] | limbs[2] | limbs[3]) != 0) {
+        // divide the magnitude by 10^18 and print the remainder.
+        constexpr uint64_t chunk = 1000000000000000000ULL;
+        uint128_t remainder = 0;
+        for (int i = 3; i >= 0; --i) {
+            uint128_t value = (remainder << 64) | limbs[i];
+            limbs[i] = static_cast<uint64_t>(value / chunk);
+            remainder = value % chunk;
+        }
+        std::string part = std::to_string(static_cast<uint64_t>(remainder));
+        if ((limbs[0] | limbs[1] | limbs[2] | limbs[3]) != 0) {
+            part.insert(0, 18 - part.size(), '0');
+        }
+        digits.insert(0, part);
+    }
+    return is_negative() ? "-" + digits : digits;
+}
+
+} // namespace starrocks
@@ -14,6 +14,10 @@
 
 #include "util/arrow/starrocks_column_to_arrow.h"
 
+#include <arrow/util/bit_util.h>
+
+#include <limits>
+
 #include "column/array_column.h"
 #include "column/column_helper.h"
 #include "column/map_column.h"
@@ -547,6 +551,139 @@ static inline StarRocksToArrowConvertFunc resolve_convert_func(LogicalType lt, A
     return it != end ? it->second : nullptr;
 }
 
+// Zero-copy fast path. For columns whose memory layout matches the arrow layout
+// exactly, the column buffers are wrapped as arrow buffers instead of being rebuilt
+// element by element through a builder:
+//   - fixed-length numeric columns: the data vector is the arrow data buffer
+//   - VARCHAR/CHAR: BinaryColumn offsets (uint32, n+1 entries starting at 0) and
+//     bytes map to the offset/value buffers of arrow::StringArray
+// The wrapping buffer shares ownership of the column, so the memory stays valid for
+// as long as the record batch references it. Only the validity bitmap is rebuilt,
+// because the engine stores null flags as one byte per row while arrow packs them
+// into bits.
+
+class ColumnDataBuffer final : public arrow::Buffer {
+public:
+    ColumnDataBuffer(ColumnPtr column, const uint8_t* data, int64_t size)
+            : arrow::Buffer(data, size), _column(std::move(column)) {}
+
+private:
+    ColumnPtr _column;
+};
+
+static bool is_zero_copy_compatible(LogicalType lt, arrow::Type::type at) {
+    switch (lt) {
+    case TYPE_TINYINT:
+        return at == arrow::Type::INT8;
+    case TYPE_SMALLINT:
+        return at == arrow::Type::INT16;
+    case TYPE_INT:
+        return at == arrow::Type::INT32;
+    case TYPE_BIGINT:
+        return at == arrow::Type::INT64;
+    case TYPE_FLOAT:
+        return at == arrow::Type::FLOAT;
+    case TYPE_DOUBLE:
+    case TYPE_TIME:
+        return at == arrow::Type::DOUBLE;
+    case TYPE_VARCHAR:
+    case TYPE_CHAR:
+        return at == arrow::Type::STRING;
+    default:
+        // TYPE_BOOLEAN is excluded on purpose: the engine stores one byte per value
+        // while arrow packs booleans into bits.
+        return false;
+    }
+}
+
+static arrow::Result<std::shared_ptr<arrow::Buffer>> build_null_bitmap(const NullColumn& null_column,
+                                                                       arrow::MemoryPool* pool) {
+    const auto& null_data = null_column.get_data();
+    ARROW_ASSIGN_OR_RAISE(auto bitmap, arrow::AllocateEmptyBitmap(null_data.size(), pool));
+    uint8_t* bits = bitmap->mutable_data();
+    for (size_t i = 0; i < null_data.size(); ++i) {
+        if (null_data[i] == 0) {
+            arrow::BitUtil::SetBit(bits, i);
+        }
+    }
+    return std::shared_ptr<arrow::Buffer>(std::move(bitmap));
+}
+
+template <LogicalType LT>
+static std::shared_ptr<arrow::Buffer> make_fixed_data_buffer(const ColumnPtr& owner, const Column* data_column) {
+    const auto& data = down_cast<const RunTimeColumnType<LT>*>(data_column)->get_data();
+    return std::make_shared<ColumnDataBuffer>(owner, reinterpret_cast<const uint8_t*>(data.data()),
+                                              data.size() * sizeof(RunTimeCppType<LT>));
+}
+
+// Returns the zero-copy array for |column|, or nullptr when the layout does not
+// allow zero-copy and the builder-based conversion must be used instead.
+static arrow::Result<std::shared_ptr<arrow::Array>> try_convert_zero_copy(
+        const ColumnPtr& column, const TypeDescriptor& type_desc, const std::shared_ptr<arrow::DataType>& arrow_type,
+        arrow::MemoryPool* pool) {
+    if (column->is_constant() || !is_zero_copy_compatible(type_desc.type, arrow_type->id())) {
+        return std::shared_ptr<arrow::Array>();
+    }
+
+    int64_t null_count = 0;
+    std::shared_ptr<arrow::Buffer> null_bitmap;
+    const Column* data_column = column.get();
+    if (column->is_nullable()) {
+        const auto* nullable_column = down_cast<const NullableColumn*>(column.get());
+        data_column = nullable_column->data_column().get();
+        if (nullable_column->has_null()) {
+            null_count = nullable_column->null_count();
+            ARROW_ASSIGN_OR_RAISE(null_bitmap, build_null_bitmap(*nullable_column->null_column(), pool));
+        }
+    }
+
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+    if (type_desc.type == TYPE_VARCHAR || type_desc.type == TYPE_CHAR) {
+        const auto* binary_column = down_cast<const BinaryColumn*>(data_column);
+        const auto& offsets = binary_column->get_offset();
+        const auto& bytes = binary_column->get_bytes();
+        if (bytes.size() > std::numeric_limits<int32_t>::max()) {
+            // arrow::StringArray carries int32 offsets, so an oversized column has to
+            // go through the builder, which reports the capacity error explicitly.
+            return std::shared_ptr<arrow::Array>();
+        }
+        buffers = {std::move(null_bitmap),
+                   std::make_shared<ColumnDataBuffer>(column, reinterpret_cast<const uint8_t*>(offsets.data()),
+                                                      offsets.size() * sizeof(uint32_t)),
+                   std::make_shared<ColumnDataBuffer>(column, bytes.data(), bytes.size())};
+    } else {
+        std::shared_ptr<arrow::Buffer> data_buffer;
+        switch (type_desc.type) {
+        case TYPE_TINYINT:
+            data_buffer = make_fixed_data_buffer<TYPE_TINYINT>(column, data_column);
+            break;
+        case TYPE_SMALLINT:
+            data_buffer = make_fixed_data_buffer<TYPE_SMALLINT>(column, data_column);
+            break;
+        case TYPE_INT:
+            data_buffer = make_fixed_data_buffer<TYPE_INT>(column, data_column);
+            break;
+        case TYPE_BIGINT:
+            data_buffer = make_fixed_data_buffer<TYPE_BIGINT>(column, data_column);
+            break;
+        case TYPE_FLOAT:
+            data_buffer = make_fixed_data_buffer<TYPE_FLOAT>(column, data_column);
+            break;
+        case TYPE_DOUBLE:
+            data_buffer = make_fixed_data_buffer<TYPE_DOUBLE>(column, data_column);
+            break;
+        case TYPE_TIME:
+            data_buffer = make_fixed_data_buffer<TYPE_TIME>(column, data_column);
+            break;
+        default:
+            return std::shared_ptr<arrow::Array>();
+        }
+        buffers = {std::move(null_bitmap), std::move(data_buffer)};
+    }
+    auto array_data = arrow::ArrayData::Make(arrow_type, column->size(), std::move(buffers), null_count);
+    return arrow::MakeArray(std::move(array_data));
+}
+
 class ColumnToArrowArrayConverter : public arrow::TypeVisitor {
 public:
     ColumnToArrowArrayConverter(const ColumnPtr& column, arrow::MemoryPool* pool, const TypeDescriptor& type_desc,
@@ -558,6 +695,12 @@ public:
 
 #define DEF_VISIT_METHOD(Type)                                                                          \
     arrow::Status Visit(const arrow::Type& type) override {                                             \
+        ARROW_ASSIGN_OR_RAISE(auto zero_copy_array, try_convert_zero_copy(_column, _type_desc,          \
+                                                                          _arrow_type, _pool));         \
+        if (zero_copy_array != nullptr) {                                                               \
+            _array = std::move(zero_copy_array);                                                        \
+            return arrow::Status::OK();                                                                 \
+        }                                                                                               \
         auto func = resolve_convert_func(_type_desc.type, type.type_id, _column->is_nullable());        \
         if (func == nullptr) {                                                                          \
             return arrow::Status::NotImplemented(                                                       \
@@ -80,6 +80,20 @@ public:
     /// remain stable.
     static int get_current_core();
 
+    /// Returns the maximum number of NUMA nodes in the system. Always >= 1.
+    static int max_num_numa_nodes() {
+        DCHECK(initialized_);
+        return max_num_numa_nodes_;
+    }
+
+    /// Returns the NUMA node of the core that the current thread is running on.
+    /// Like get_current_core(), the answer may change at any time because of
+    /// thread migration, so callers should only use it as a locality hint.
+    static int get_current_numa_node() {
+        DCHECK(initialized_);
+        return core_to_numa_node_[get_current_core()];
+    }
+
     static std::string debug_string();
 
 private:
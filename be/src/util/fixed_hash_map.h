@@ -31,13 +31,15 @@ namespace starrocks {
 // FixedSizeHashMap
 // Key: KeyType integer type eg: uint8 uint16
 // value shouldn't be nullptr
+// table_size defaults to the whole key space. Pass a smaller table_size when the keys are
+// known to be bounded (eg. global-dict codes), every inserted key must be in [0, table_size).
 
-template <typename KeyType, typename ValueType, PhmapSeed seed>
+template <typename KeyType, typename ValueType, PhmapSeed seed, int table_size = (1 << sizeof(KeyType) * 8)>
 class SmallFixedSizeHashMap {
 public:
     static_assert(std::is_integral_v<KeyType>);
     static_assert(std::is_pointer_v<ValueType>);
-    static constexpr int hash_table_size = 1 << sizeof(KeyType) * 8;
+    static constexpr int hash_table_size = table_size;
 
     using key_type = KeyType;
     using search_key_type = typename std::make_unsigned<KeyType>::type;
@@ -61,6 +63,10 @@ public:
 
         PPair operator->() const { return {static_cast<KeyType>(_hash_table_key), _hash_table_begin[_hash_table_key]}; }
 
+        typename PPair::Cell operator*() const {
+            return {static_cast<KeyType>(_hash_table_key), _hash_table_begin[_hash_table_key]};
+        }
+
         iterator& operator++() {
             _hash_table_key++;
             skip_empty_value();
@@ -84,6 +90,7 @@ public:
     template <class F>
     iterator lazy_emplace(KeyType key, F&& f) {
         auto search_key = static_cast<search_key_type>(key);
+        DCHECK_LT(static_cast<size_t>(search_key), static_cast<size_t>(hash_table_size));
         if (_hash_table[search_key] == nullptr) {
             _size++;
             f([&](KeyType key, ValueType value) {
@@ -96,6 +103,7 @@ public:
 
     iterator find(KeyType key) {
         auto search_key = static_cast<search_key_type>(key);
+        DCHECK_LT(static_cast<size_t>(search_key), static_cast<size_t>(hash_table_size));
         if (_hash_table[search_key] == nullptr) {
             return end();
         }
@@ -136,11 +144,11 @@ private:
     ValueType _hash_table[hash_table_size + 1];
 };
 
-template <typename KeyType, PhmapSeed seed>
+template <typename KeyType, PhmapSeed seed, int table_size = (1 << sizeof(KeyType) * 8)>
 class SmallFixedSizeHashSet {
 public:
     static_assert(std::is_integral_v<KeyType>);
-    static constexpr int hash_table_size = 1 << sizeof(KeyType) * 8;
+    static constexpr int hash_table_size = table_size;
 
     using key_type = KeyType;
     using search_key_type = typename std::make_unsigned<KeyType>::type;
@@ -185,11 +193,15 @@ public:
     iterator end() { return iterator(_hash_table, hash_table_size); }
 
     void emplace(KeyType key) {
+        DCHECK_LT(static_cast<size_t>(static_cast<search_key_type>(key)), static_cast<size_t>(hash_table_size));
         _size += _hash_table[static_cast<search_key_type>(key)] == 0;
         _hash_table[static_cast<search_key_type>(key)] = 1;
     }
 
-    bool contains(KeyType key) { return _hash_table[static_cast<search_key_type>(key)]; }
+    bool contains(KeyType key) {
+        DCHECK_LT(static_cast<size_t>(static_cast<search_key_type>(key)), static_cast<size_t>(hash_table_size));
+        return _hash_table[static_cast<search_key_type>(key)];
+    }
 
     size_t dump_bound() { return hash_table_size; }
 
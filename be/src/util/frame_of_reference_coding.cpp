@@ -282,7 +282,28 @@ bool ForDecoder<T>::init() {
     return true;
 }
 
-// todo(kks): improve this method by SIMD instructions
+// Unpack through a wide accumulator: refill a whole byte at a time and extract each
+// value with one shift and one mask, instead of assembling it bit by bit. The MSB-first
+// layout written by bit_pack means values sit in the high end of the accumulator, so a
+// value is complete as soon as enough bits have been buffered.
+template <typename AccType, typename T>
+static inline void bit_unpack_with_accumulator(const uint8_t* __restrict__ input, uint8_t in_num, int bit_width,
+                                               T* __restrict__ output) {
+    constexpr int ACC_BITS = sizeof(AccType) * 8;
+    const AccType mask = bit_width == ACC_BITS ? ~static_cast<AccType>(0)
+                                               : (static_cast<AccType>(1) << bit_width) - 1;
+    AccType buffer = 0;
+    int bits_in_buffer = 0;
+    for (int i = 0; i < in_num; ++i) {
+        while (bits_in_buffer < bit_width) {
+            buffer = (buffer << 8) | *input++;
+            bits_in_buffer += 8;
+        }
+        bits_in_buffer -= bit_width;
+        output[i] = static_cast<T>((buffer >> bits_in_buffer) & mask);
+    }
+}
+
 // The reverse of bit_pack method, get original integer data list from packed bits
 // param[in] input: the packed bits need to unpack
 // param[in] in_num: the integer number in packed bits
@@ -290,20 +311,34 @@ bool ForDecoder<T>::init() {
 // param[out] output: the original integer data list
 template <typename T>
 void ForDecoder<T>::bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output) {
-    unsigned char in_mask = 0x80;
-    int bit_index = 0;
-    while (in_num > 0) {
-        *output = 0;
-        for (int i = 0; i < bit_width; i++) {
-            if (bit_index > 7) {
-                input++;
-                bit_index = 0;
+    if (bit_width == 0) {
+        memset(output, 0, sizeof(T) * in_num);
+        return;
+    }
+    // A refill appends 8 bits, so the accumulator needs room for bit_width - 1 buffered
+    // bits plus one more byte.
+    if (bit_width <= 56) {
+        bit_unpack_with_accumulator<uint64_t>(input, in_num, bit_width, output);
+    } else if (bit_width <= 120) {
+        bit_unpack_with_accumulator<uint128_t>(input, in_num, bit_width, output);
+    } else {
+        // Wider than even the 128-bit accumulator can buffer together with a refill byte.
+        // Only reachable for uint128 frames that keep the original values, assemble bit by bit.
+        unsigned char in_mask = 0x80;
+        int bit_index = 0;
+        while (in_num > 0) {
+            *output = 0;
+            for (int i = 0; i < bit_width; i++) {
+                if (bit_index > 7) {
+                    input++;
+                    bit_index = 0;
+                }
+                *output |= ((T)((*input & (in_mask >> bit_index)) >> (7 - bit_index))) << (bit_width - i - 1);
+                bit_index++;
             }
-            *output |= ((T)((*input & (in_mask >> bit_index)) >> (7 - bit_index))) << (bit_width - i - 1);
-            bit_index++;
+            output++;
+            in_num--;
         }
-        output++;
-        in_num--;
     }
 }
 
@@ -337,18 +372,18 @@ void ForDecoder<T>::decode_current_frame(T* output) {
         bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
     } else {
         bool is_ascending = _storage_formats[_current_decoded_frame] == 1;
-        std::vector<T> delta_values(current_frame_size);
-        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, delta_values.data());
+        // unpack the deltas straight into the output and restore the values in place,
+        // instead of materializing them in a temporary vector first
+        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
         if (is_ascending) {
             T pre_value = min;
             for (uint8_t i = 0; i < current_frame_size; i++) {
-                T value = delta_values[i] + pre_value;
-                output[i] = value;
-                pre_value = value;
+                pre_value += output[i];
+                output[i] = pre_value;
             }
         } else {
             for (uint8_t i = 0; i < current_frame_size; i++) {
-                output[i] = delta_values[i] + min;
+                output[i] += min;
             }
         }
     }
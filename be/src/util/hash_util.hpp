@@ -46,6 +46,8 @@
 #endif
 #include <zlib.h>
 
+#include <cstring>
+
 #include "gen_cpp/Types_types.h"
 #include "storage/decimal12.h"
 #include "storage/uint24.h"
@@ -55,12 +57,69 @@
 
 namespace starrocks {
 
+namespace zlib_crc_detail {
+// slicing tables for the zlib crc32 polynomial (0xedb88320), generated at compile time
+struct Tables {
+    uint32_t t[8][256];
+};
+
+constexpr Tables make_tables() {
+    Tables tb{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        }
+        tb.t[0][i] = c;
+    }
+    for (int j = 1; j < 8; j++) {
+        for (uint32_t i = 0; i < 256; i++) {
+            tb.t[j][i] = (tb.t[j - 1][i] >> 8) ^ tb.t[0][tb.t[j - 1][i] & 0xff];
+        }
+    }
+    return tb;
+}
+
+inline constexpr Tables kTables = make_tables();
+} // namespace zlib_crc_detail
+
 // Utility class to compute hash values.
 class HashUtil {
 public:
     static uint32_t zlib_crc_hash(const void* data, int32_t bytes, uint32_t hash) {
         return crc32(hash, (const unsigned char*)data, bytes);
     }
+
+    // Same polynomial and result as zlib_crc_hash, specialized for small fixed-size keys:
+    // fully unrolled and inlined, so columnar hash loops avoid a call into zlib per row,
+    // and the sliced table lookups let several rows be in flight at once.
+    template <int N>
+    ALWAYS_INLINE static uint32_t zlib_crc_hash_fixed(const void* data, uint32_t hash) {
+        const auto& t = zlib_crc_detail::kTables.t;
+        const auto* p = reinterpret_cast<const uint8_t*>(data);
+        uint32_t c = ~hash;
+        for (int k = 0; k < N / 8; k++) {
+            uint32_t w1;
+            uint32_t w2;
+            memcpy(&w1, p, 4);
+            memcpy(&w2, p + 4, 4);
+            w1 ^= c;
+            c = t[7][w1 & 0xff] ^ t[6][(w1 >> 8) & 0xff] ^ t[5][(w1 >> 16) & 0xff] ^ t[4][w1 >> 24] ^ t[3][w2 & 0xff] ^
+                t[2][(w2 >> 8) & 0xff] ^ t[1][(w2 >> 16) & 0xff] ^ t[0][w2 >> 24];
+            p += 8;
+        }
+        if constexpr ((N & 4) != 0) {
+            uint32_t w;
+            memcpy(&w, p, 4);
+            w ^= c;
+            c = t[3][w & 0xff] ^ t[2][(w >> 8) & 0xff] ^ t[1][(w >> 16) & 0xff] ^ t[0][w >> 24];
+            p += 4;
+        }
+        for (int k = 0; k < (N & 3); k++) {
+            c = t[0][(c ^ *p++) & 0xff] ^ (c >> 8);
+        }
+        return ~c;
+    }
 #ifdef __SSE4_2__
     // Compute the Crc32 hash for data using SSE4 instructions.  The input hash parameter is
     // the current hash/seed value.
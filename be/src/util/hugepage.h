@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "common/config.h"
+
+namespace starrocks {
+
+// The default huge page size on x86-64 and aarch64.
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// Advise the kernel to back [ptr, ptr + size) with transparent huge pages, to cut
+// dTLB misses on large random-access structures such as aggregation hash tables.
+// madvise operates on whole pages, so the range is shrunk to the enclosed
+// huge-page-aligned region and small or unaligned allocations are left alone.
+// Gated by config::madvise_huge_pages and best-effort: when THP is unavailable the
+// mapping simply keeps working with 4K pages.
+inline void advise_huge_pages(void* ptr, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (!config::madvise_huge_pages || size < HUGE_PAGE_SIZE) {
+        return;
+    }
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(HUGE_PAGE_SIZE - 1);
+    if (end > begin) {
+        (void)madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+// An std::allocator that additionally advises transparent huge pages for large
+// allocations. Plugged in as the backing-array allocator of the aggregation hash
+// maps, whose flat arrays grow far beyond the huge page size.
+template <typename T>
+class HugePageAdvisedAllocator : public std::allocator<T> {
+public:
+    using std::allocator<T>::allocator;
+
+    template <typename U>
+    struct rebind {
+        using other = HugePageAdvisedAllocator<U>;
+    };
+
+    T* allocate(size_t n) {
+        T* p = std::allocator<T>::allocate(n);
+        advise_huge_pages(p, n * sizeof(T));
+        return p;
+    }
+};
+
+} // namespace starrocks
@@ -37,6 +37,8 @@
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "column/column_helper.h"
@@ -119,6 +121,16 @@ Status from_json(const std::string& json_value, std::map<std::string, std::map<s
     return Status::OK();
 }
 
+JsonFlater::JsonFlater(std::vector<std::string> paths) : _flat_paths(std::move(paths)) {
+    for (const auto& path : _flat_paths) {
+        if (path.size() >= 2 && path.front() == '"' && path.back() == '"') {
+            _flat_keys.emplace_back(path.substr(1, path.size() - 2));
+        } else {
+            _flat_keys.emplace_back(path);
+        }
+    }
+}
+
 void JsonFlater::flatten(const Column* json_column, std::vector<ColumnPtr>* result) {
     DCHECK(result->size() == _flat_paths.size());
 
@@ -141,6 +153,14 @@ void JsonFlater::flatten(const Column* json_column, std::vector<ColumnPtr>* resu
         flat_nulls.emplace_back(down_cast<NullColumn*>(flat_nullable->null_column().get()));
     }
 
+    // one pass over the object's key-value pairs per row, instead of one vpack
+    // lookup from the root per flat path
+    std::unordered_map<std::string_view, size_t> key_to_index;
+    for (size_t k = 0; k < _flat_keys.size(); k++) {
+        key_to_index[_flat_keys[k]] = k;
+    }
+    std::vector<uint8_t> filled(_flat_keys.size());
+
     for (size_t i = 0; i < json_column->size(); i++) {
         if (json_column->is_null(i)) {
             for (size_t k = 0; k < result->size(); k++) {
@@ -163,14 +183,36 @@ void JsonFlater::flatten(const Column* json_column, std::vector<ColumnPtr>* resu
             }
             continue;
         }
-        for (size_t k = 0; k < _flat_paths.size(); k++) {
-            auto st = obj->get_obj(_flat_paths[k]);
-            if (st.ok() && !st.value().is_none()) {
-                flat_jsons[k]->append(st.value());
+
+        filled.assign(_flat_keys.size(), 0);
+        size_t remaining = _flat_keys.size();
+        for (auto [key, value] : vpack::ObjectIterator(vslice)) {
+            auto iter = key_to_index.find(key.stringView());
+            if (iter == key_to_index.end()) {
+                continue;
+            }
+            size_t k = iter->second;
+            // vpack objects may legally contain duplicate keys; only the first
+            // occurrence counts, like the per-path lookup did, and appending more
+            // than once per row would misalign the subcolumns.
+            if (filled[k]) {
+                continue;
+            }
+            filled[k] = 1;
+            if (!value.isNone()) {
+                flat_jsons[k]->append(JsonValue(value));
                 flat_nulls[k]->append(0);
             } else {
                 (*result)[k]->append_nulls(1);
             }
+            if (--remaining == 0) {
+                break;
+            }
+        }
+        for (size_t k = 0; k < _flat_keys.size(); k++) {
+            if (!filled[k]) {
+                (*result)[k]->append_nulls(1);
+            }
         }
     }
     for (auto& col : *result) {
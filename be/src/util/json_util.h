@@ -85,7 +85,7 @@ Status from_json(const std::string& json_value, std::map<std::string, std::map<s
 
 class JsonFlater {
 public:
-    JsonFlater(std::vector<std::string> paths) : _flat_paths(paths){};
+    JsonFlater(std::vector<std::string> paths);
 
     ~JsonFlater() = default;
 
@@ -93,6 +93,9 @@ public:
 
 private:
     std::vector<std::string> _flat_paths;
+    // object key of each flat path, with the quote-escaping of dotted keys removed,
+    // so rows can be flattened in one pass over their key-value pairs
+    std::vector<std::string> _flat_keys;
 };
 
 } // namespace starrocks
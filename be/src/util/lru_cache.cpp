@@ -151,9 +151,11 @@ bool HandleTable::_resize() {
 }
 
 LRUCache::LRUCache() {
-    // Make empty circular linked list
+    // Make empty circular linked lists
     _lru.next = &_lru;
     _lru.prev = &_lru;
+    _lru_protected.next = &_lru_protected;
+    _lru_protected.prev = &_lru_protected;
 }
 
 LRUCache::~LRUCache() noexcept {
@@ -170,6 +172,9 @@ void LRUCache::_lru_remove(LRUHandle* e) {
     e->next->prev = e->prev;
     e->prev->next = e->next;
     e->prev = e->next = nullptr;
+    if (e->in_protected) {
+        _protected_usage -= e->charge;
+    }
 }
 
 void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
@@ -185,7 +190,9 @@ void LRUCache::set_capacity(size_t capacity) {
     {
         std::lock_guard l(_mutex);
         _capacity = capacity;
+        _protected_capacity = capacity * kProtectedCapacityPercent / 100;
         _evict_from_lru(0, &last_ref_list);
+        _demote_from_protected();
     }
 
     for (auto entry : last_ref_list) {
@@ -198,13 +205,11 @@ void LRUCache::set_charge_mode(ChargeMode charge_mode) {
 }
 
 uint64_t LRUCache::get_lookup_count() const {
-    std::lock_guard l(_mutex);
-    return _lookup_count;
+    return _lookup_count.load(std::memory_order_relaxed);
 }
 
 uint64_t LRUCache::get_hit_count() const {
-    std::lock_guard l(_mutex);
-    return _hit_count;
+    return _hit_count.load(std::memory_order_relaxed);
 }
 
 size_t LRUCache::get_usage() const {
@@ -219,7 +224,7 @@ size_t LRUCache::get_capacity() const {
 
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
-    ++_lookup_count;
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
@@ -228,8 +233,10 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
             // only in LRU free list, remove it from list
             _lru_remove(e);
         }
+        // a second reference promotes the entry to the protected segment
+        e->in_protected = true;
         e->refs++;
-        ++_hit_count;
+        _hit_count.fetch_add(1, std::memory_order_relaxed);
     }
     return reinterpret_cast<Cache::Handle*>(e);
 }
@@ -254,8 +261,13 @@ void LRUCache::release(Cache::Handle* handle) {
                 _unref(e);
                 _usage -= e->charge;
                 last_ref = true;
+            } else if (e->in_protected) {
+                // put it to the protected LRU free list
+                _lru_append(&_lru_protected, e);
+                _protected_usage += e->charge;
+                _demote_from_protected();
             } else {
-                // put it to LRU free list
+                // put it to the probation LRU free list
                 _lru_append(&_lru, e);
             }
         }
@@ -268,23 +280,34 @@ void LRUCache::release(Cache::Handle* handle) {
 }
 
 void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted) {
-    LRUHandle* cur = &_lru;
-    // 1. evict normal cache entries
-    while (_usage + charge > _capacity && cur->next != &_lru) {
+    // 1. evict normal cache entries, the probation segment first
+    _evict_list_from_lru(&_lru, charge, false, deleted);
+    _evict_list_from_lru(&_lru_protected, charge, false, deleted);
+    // 2. evict durable cache entries if need
+    _evict_list_from_lru(&_lru, charge, true, deleted);
+    _evict_list_from_lru(&_lru_protected, charge, true, deleted);
+}
+
+void LRUCache::_evict_list_from_lru(LRUHandle* list, size_t charge, bool evict_durable,
+                                    std::vector<LRUHandle*>* deleted) {
+    LRUHandle* cur = list;
+    while (_usage + charge > _capacity && cur->next != list) {
         LRUHandle* old = cur->next;
-        if (old->priority == CachePriority::DURABLE) {
+        if (!evict_durable && old->priority == CachePriority::DURABLE) {
             cur = cur->next;
             continue;
         }
         _evict_one_entry(old);
         deleted->push_back(old);
     }
-    // 2. evict durable cache entries if need
-    while (_usage + charge > _capacity && _lru.next != &_lru) {
-        LRUHandle* old = _lru.next;
-        DCHECK(old->priority == CachePriority::DURABLE);
-        _evict_one_entry(old);
-        deleted->push_back(old);
+}
+
+void LRUCache::_demote_from_protected() {
+    while (_protected_usage > _protected_capacity && _lru_protected.next != &_lru_protected) {
+        LRUHandle* old = _lru_protected.next;
+        _lru_remove(old);
+        old->in_protected = false;
+        _lru_append(&_lru, old);
     }
 }
 
@@ -310,6 +333,7 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->refs = 2; // one for the returned handle, one for LRUCache.
     e->next = e->prev = nullptr;
     e->in_cache = true;
+    e->in_protected = false;
     e->priority = priority;
     e->value_size = value_size;
     memcpy(e->key_data, key.data(), key.size());
@@ -375,16 +399,14 @@ int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
-        while (_lru.next != &_lru) {
-            LRUHandle* old = _lru.next;
-            DCHECK(old->in_cache);
-            DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
-            _lru_remove(old);
-            _table.remove(old->key(), old->hash);
-            old->in_cache = false;
-            _unref(old);
-            _usage -= old->charge;
-            last_ref_list.push_back(old);
+        for (LRUHandle* list : {&_lru, &_lru_protected}) {
+            while (list->next != list) {
+                LRUHandle* old = list->next;
+                DCHECK(old->in_cache);
+                DCHECK(old->refs == 1); // LRU lists contain elements which may be evicted
+                _evict_one_entry(old);
+                last_ref_list.push_back(old);
+            }
         }
     }
     for (auto entry : last_ref_list) {
@@ -6,6 +6,7 @@
 
 #include <rapidjson/document.h>
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <mutex>
@@ -28,7 +29,7 @@ enum class ChargeMode {
 };
 
 // Create a new cache with a fixed size capacity.  This implementation
-// of Cache uses a least-recently-used eviction policy.
+// of Cache uses a segmented least-recently-used (SLRU) eviction policy.
 extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
 
 class CacheKey {
@@ -209,7 +210,8 @@ typedef struct LRUHandle {
     LRUHandle* prev;
     size_t charge;
     size_t key_length;
-    bool in_cache; // Whether entry is in the cache.
+    bool in_cache;     // Whether entry is in the cache.
+    bool in_protected; // Whether entry belongs to the protected LRU segment.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -266,6 +268,14 @@ private:
 };
 
 // A single shard of sharded cache.
+//
+// Each shard runs a segmented LRU: a new entry starts in the probation
+// segment and is promoted to the protected segment when it is referenced a
+// second time.  Eviction drains the probation segment first, so a burst of
+// one-hit entries (e.g. a big scan filling the page cache) cannot flush out
+// entries that have proven to be reused.  When the protected segment grows
+// beyond its share of the capacity, its oldest entries are demoted back to
+// the probation segment and have to earn promotion again.
 class LRUCache {
 public:
     LRUCache();
@@ -291,11 +301,16 @@ public:
     size_t get_capacity() const;
 
 private:
+    // The protected segment may use at most this percentage of the capacity.
+    static constexpr size_t kProtectedCapacityPercent = 80;
+
     void _lru_remove(LRUHandle* e);
     void _lru_append(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
+    void _evict_list_from_lru(LRUHandle* list, size_t charge, bool evict_durable, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
+    void _demote_from_protected();
 
     // Initialized before use.
     size_t _capacity{0};
@@ -306,15 +321,20 @@ private:
     mutable std::mutex _mutex;
     size_t _usage{0};
 
-    // Dummy head of LRU list.
+    // Dummy heads of the probation and protected LRU lists.
     // lru.prev is newest entry, lru.next is oldest entry.
     // Entries have refs==1 and in_cache==true.
     LRUHandle _lru;
+    LRUHandle _lru_protected;
+    // Total charge of the entries currently on the protected list.
+    size_t _protected_usage{0};
+    size_t _protected_capacity{0};
 
     HandleTable _table;
 
-    uint64_t _lookup_count{0};
-    uint64_t _hit_count{0};
+    // Kept atomic so stats polling does not contend with lookups for _mutex.
+    std::atomic<uint64_t> _lookup_count{0};
+    std::atomic<uint64_t> _hit_count{0};
 };
 
 static const int kNumShardBits = 5;
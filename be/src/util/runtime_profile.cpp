@@ -466,6 +466,7 @@ void RuntimeProfile::copy_all_info_strings_from(RuntimeProfile* src_profile) {
 
 ADD_COUNTER_IMPL(AddHighWaterMarkCounter, HighWaterMarkCounter)
 ADD_COUNTER_IMPL(AddLowWaterMarkCounter, LowWaterMarkCounter)
+ADD_COUNTER_IMPL(AddCoreLocalCounter, CoreLocalCounter)
 
 RuntimeProfile::Counter* RuntimeProfile::add_child_counter(const std::string& name, TUnit::type type,
                                                            const TCounterStrategy& strategy,
@@ -761,20 +762,20 @@ void RuntimeProfile::to_thrift(std::vector<TRuntimeProfileNode>* nodes) {
         node.__set_version(_version);
     }
 
-    CounterMap counter_map;
     {
+        // serialize the counters directly under the lock instead of deep-copying the
+        // whole counter map first; periodic reports walk thousands of nodes and the
+        // per-node map copy dominated the serialization cost
         std::lock_guard<std::mutex> l(_counter_lock);
-        counter_map = _counter_map;
         node.child_counters_map = _child_counter_map;
-    }
-
-    for (auto& iter : counter_map) {
-        TCounter counter;
-        counter.__set_name(iter.first);
-        counter.__set_value(iter.second.first->value());
-        counter.__set_type(iter.second.first->type());
-        counter.__set_strategy(iter.second.first->strategy());
-        node.counters.push_back(counter);
+        node.counters.reserve(_counter_map.size());
+        for (auto& iter : _counter_map) {
+            TCounter& counter = node.counters.emplace_back();
+            counter.__set_name(iter.first);
+            counter.__set_value(iter.second.first->value());
+            counter.__set_type(iter.second.first->type());
+            counter.__set_strategy(iter.second.first->strategy());
+        }
     }
 
     {
@@ -49,6 +49,7 @@
 #include "common/object_pool.h"
 #include "gen_cpp/RuntimeProfile_types.h"
 #include "gutil/casts.h"
+#include "util/core_local.h"
 #include "util/stopwatch.hpp"
 
 namespace starrocks {
@@ -301,6 +302,42 @@ public:
         DerivedCounterFunction _counter_fn;
     };
 
+    // A Counter whose updates go to a per-core slot (see util/core_local.h) and whose
+    // value() sums the slots on read. Use it for counters that many driver or IO threads
+    // update concurrently, where a single shared atomic would bounce its cache line.
+    // Reads are much more expensive than for a plain Counter, so it only pays off for
+    // write-heavy counters that are read rarely, e.g. when the profile is reported.
+    // DOUBLE_VALUE units are not supported.
+    class CoreLocalCounter : public Counter {
+    public:
+        explicit CoreLocalCounter(TUnit::type type, int64_t value = 0) : Counter(type, value) {
+            DCHECK(type != TUnit::DOUBLE_VALUE);
+        }
+        explicit CoreLocalCounter(TUnit::type type, const TCounterStrategy& strategy, int64_t value = 0)
+                : Counter(type, strategy, value) {
+            DCHECK(type != TUnit::DOUBLE_VALUE);
+        }
+
+        void update(int64_t delta) override { __sync_fetch_and_add(_local_sums.access(), delta); }
+
+        // Folds the delta against the aggregated value into the base counter, so the
+        // per-core slots keep their content and concurrent update()s are not lost.
+        void set(int64_t value) override { Counter::set(value - _local_sum()); }
+
+        int64_t value() const override { return Counter::value() + _local_sum(); }
+
+    private:
+        int64_t _local_sum() const {
+            int64_t sum = 0;
+            for (size_t i = 0; i < _local_sums.size(); ++i) {
+                sum += __atomic_load_n(_local_sums.access_at_core(i), __ATOMIC_RELAXED);
+            }
+            return sum;
+        }
+
+        CoreLocalValue<int64_t> _local_sums;
+    };
+
     // A set of counters that measure thread info, such as total time, user time, sys time.
     class ThreadCounters {
     private:
@@ -536,6 +573,11 @@ public:
     LowWaterMarkCounter* AddLowWaterMarkCounter(const std::string& name, TUnit::type unit,
                                                 const TCounterStrategy& strategy, const std::string& parent_name = "");
 
+    /// Adds a core-local counter to the runtime profile. Otherwise, same behavior
+    /// as AddCounter().
+    CoreLocalCounter* AddCoreLocalCounter(const std::string& name, TUnit::type unit, const TCounterStrategy& strategy,
+                                          const std::string& parent_name = "");
+
     // Recursively compute the fraction of the 'total_time' spent in this profile and
     // its children.
     // This function updates _local_time_percent for each profile.
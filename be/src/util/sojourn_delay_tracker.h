@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace starrocks {
+
+// Tracks how long tasks sojourn in a queue before they start executing, CoDel style:
+// per observation interval only the *minimum* delay is kept, because a queue is congested
+// only if even the fastest task of a whole interval had to wait. A short burst that drains
+// within the interval drops the minimum back to ~0 and is not mistaken for overload.
+//
+// record() is called by the worker threads when a task is dequeued, last_min_delay_ns() by
+// the admission side. Both are lock-free and wait-free except for a bounded CAS loop.
+class SojournDelayTracker {
+public:
+    explicit SojournDelayTracker(int64_t interval_ns) : _interval_ns(interval_ns) {}
+
+    SojournDelayTracker(const SojournDelayTracker&) = delete;
+    void operator=(const SojournDelayTracker&) = delete;
+
+    // |now_ns| is the dequeue timestamp, |delay_ns| the time the task spent queued.
+    void record(int64_t now_ns, int64_t delay_ns) {
+        int64_t cur_min = _interval_min_ns.load(std::memory_order_relaxed);
+        while (delay_ns < cur_min &&
+               !_interval_min_ns.compare_exchange_weak(cur_min, delay_ns, std::memory_order_relaxed)) {
+        }
+        int64_t start = _interval_start_ns.load(std::memory_order_relaxed);
+        if (now_ns - start >= _interval_ns &&
+            _interval_start_ns.compare_exchange_strong(start, now_ns, std::memory_order_relaxed)) {
+            // the winner of the CAS closes the interval and publishes its minimum.
+            int64_t min = _interval_min_ns.exchange(kNoDelay, std::memory_order_relaxed);
+            _last_min_ns.store(min, std::memory_order_relaxed);
+        }
+    }
+
+    // Minimum sojourn delay of the last completed interval, or 0 if the queue has been
+    // idle: no rotation for two intervals means there is no backlog to report.
+    int64_t last_min_delay_ns(int64_t now_ns) const {
+        if (now_ns - _interval_start_ns.load(std::memory_order_relaxed) >= 2 * _interval_ns) {
+            return 0;
+        }
+        int64_t min = _last_min_ns.load(std::memory_order_relaxed);
+        return min == kNoDelay ? 0 : min;
+    }
+
+private:
+    static constexpr int64_t kNoDelay = std::numeric_limits<int64_t>::max();
+
+    const int64_t _interval_ns;
+    std::atomic<int64_t> _interval_start_ns{0};
+    std::atomic<int64_t> _interval_min_ns{kNoDelay};
+    std::atomic<int64_t> _last_min_ns{kNoDelay};
+};
+
+} // namespace starrocks
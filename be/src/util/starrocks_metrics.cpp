@@ -54,6 +54,10 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(query_scan_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_rows);
 
+    REGISTER_STARROCKS_METRIC(pipe_driver_overloaded);
+    REGISTER_STARROCKS_METRIC(pipe_driver_pull_chunk_time);
+    REGISTER_STARROCKS_METRIC(pipe_driver_push_chunk_time);
+
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_total);
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_duration_us);
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_wait_memtable_duration_us);
@@ -162,6 +166,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
                              &update_compaction_outputs_bytes_total);
     _metrics.register_metric("update_compaction_duration_us", MetricLabels().add("type", "update"),
                              &update_compaction_duration_us);
+    _metrics.register_metric("compaction_throttled_time_us_total", &compaction_throttled_time_us_total);
 
     _metrics.register_metric("meta_request_total", MetricLabels().add("type", "write"), &meta_write_request_total);
     _metrics.register_metric("meta_request_total", MetricLabels().add("type", "read"), &meta_read_request_total);
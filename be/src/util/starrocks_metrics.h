@@ -91,9 +91,16 @@ public:
     // query execution
     METRIC_DEFINE_INT_GAUGE(pipe_prepare_pool_queue_len, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_scan_executor_queuing, MetricUnit::NOUNIT);
+    // worker counts decided by the scan executor tuners
+    METRIC_DEFINE_INT_GAUGE(pipe_scan_executor_threads, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(pipe_connector_scan_executor_threads, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_overloaded, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_schedule_count, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_execution_time, MetricUnit::NANOSECONDS);
+    // cumulative time drivers spent inside operator pull_chunk/push_chunk, the on-core part of
+    // pipe_driver_execution_time. The gap between them is driver bookkeeping and operator glue.
+    METRIC_DEFINE_INT_GAUGE(pipe_driver_pull_chunk_time, MetricUnit::NANOSECONDS);
+    METRIC_DEFINE_INT_GAUGE(pipe_driver_push_chunk_time, MetricUnit::NANOSECONDS);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_queue_len, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_poller_block_queue_len, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(query_scan_bytes_per_second, MetricUnit::BYTES);
@@ -163,6 +170,9 @@ public:
     METRIC_DEFINE_INT_COUNTER(update_compaction_outputs_bytes_total, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(update_compaction_duration_us, MetricUnit::MICROSECONDS);
 
+    // total time compaction tasks spent blocked on the per-disk IO token bucket
+    METRIC_DEFINE_INT_COUNTER(compaction_throttled_time_us_total, MetricUnit::MICROSECONDS);
+
     METRIC_DEFINE_INT_COUNTER(publish_task_request_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(publish_task_failed_total, MetricUnit::REQUESTS);
 
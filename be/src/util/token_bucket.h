@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "util/time.h"
+
+namespace starrocks {
+
+// A thread-safe token bucket used to throttle the bytes/s of background IO, such
+// as compaction on one data dir. The refill rate is passed on every acquire so
+// callers can drive it from a mutable config; the burst capacity is one second's
+// worth of tokens. Acquire uses a debt model: a request larger than the remaining
+// tokens passes immediately and delays the following requests instead, so a big
+// chunk never stalls forever.
+class TokenBucket {
+public:
+    TokenBucket() : _last_refill_us(MonotonicMicros()) {}
+
+    // Draw |bytes| tokens at |rate_bytes_per_sec|, blocking until the bucket has
+    // paid off the debt. A rate <= 0 disables throttling. Returns the time spent
+    // waiting, in microseconds.
+    int64_t acquire(int64_t bytes, int64_t rate_bytes_per_sec) {
+        if (rate_bytes_per_sec <= 0 || bytes <= 0) {
+            return 0;
+        }
+        int64_t wait_us = 0;
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            int64_t now = MonotonicMicros();
+            double rate = static_cast<double>(rate_bytes_per_sec);
+            _tokens = std::min(_tokens + (now - _last_refill_us) * rate / 1e6, rate);
+            _last_refill_us = now;
+            _tokens -= static_cast<double>(bytes);
+            if (_tokens < 0) {
+                wait_us = static_cast<int64_t>(-_tokens * 1e6 / rate);
+            }
+        }
+        if (wait_us > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+        }
+        return wait_us;
+    }
+
+private:
+    std::mutex _mutex;
+    double _tokens = 0;
+    int64_t _last_refill_us = 0;
+};
+
+} // namespace starrocks
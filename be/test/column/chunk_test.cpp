@@ -255,6 +255,27 @@ TEST_F(ChunkTest, test_swap_chunk) {
     ASSERT_EQ(1, chk2->get_slot_id_to_index_map().size());
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_scatter_selective) {
+    auto src = std::make_shared<Chunk>(make_columns(2, 6), make_schema(2));
+
+    auto dst0 = src->clone_empty();
+    auto dst1 = src->clone_empty();
+
+    // rows grouped by destination: dst0 gets rows {0, 2, 4}, dst1 gets rows {1, 3, 5}
+    std::vector<uint32_t> indexes{0, 2, 4, 1, 3, 5};
+    std::vector<uint32_t> froms{0, 3};
+    std::vector<uint32_t> sizes{3, 3};
+    src->scatter_selective({dst0.get(), dst1.get()}, indexes.data(), froms, sizes);
+
+    ASSERT_EQ(3, dst0->num_rows());
+    ASSERT_EQ(3, dst1->num_rows());
+    check_column(down_cast<FixedLengthColumn<int32_t>*>(dst0->get_column_by_index(0).get()), {0, 2, 4});
+    check_column(down_cast<FixedLengthColumn<int32_t>*>(dst0->get_column_by_index(1).get()), {1, 3, 5});
+    check_column(down_cast<FixedLengthColumn<int32_t>*>(dst1->get_column_by_index(0).get()), {1, 3, 5});
+    check_column(down_cast<FixedLengthColumn<int32_t>*>(dst1->get_column_by_index(1).get()), {2, 4, 6});
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunkTest, test_reset) {
     auto chk = std::make_unique<Chunk>(make_columns(1), make_schema(1));
@@ -15,7 +15,10 @@
 #include "column/column_helper.h"
 
 #include "column/column_builder.h"
+#include "column/column_pool.h"
+#include "common/config.h"
 #include "gtest/gtest.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -38,6 +41,26 @@ protected:
     }
 };
 
+TEST_F(ColumnHelperTest, create_column_from_pool) {
+    config::enable_expr_column_pool = true;
+    DeferOp defer([]() {
+        config::enable_expr_column_pool = false;
+        TEST_clear_all_columns_this_thread();
+    });
+    TEST_clear_all_columns_this_thread();
+
+    TypeDescriptor type = TypeDescriptor(TYPE_INT);
+    auto col = ColumnHelper::create_column(type, false);
+    col->append_datum(Datum((int32_t)1));
+    Column* raw = col.get();
+    // dropping the last reference returns the column to the thread-local pool.
+    col.reset();
+
+    auto recycled = ColumnHelper::create_column(type, false);
+    ASSERT_EQ(raw, recycled.get());
+    ASSERT_EQ(0, recycled->size());
+}
+
 TEST_F(ColumnHelperTest, cast_to_nullable_column) {
     auto col = ColumnHelper::cast_to_nullable_column(create_column());
     ASSERT_TRUE(col->is_nullable());
@@ -48,6 +71,31 @@ TEST_F(ColumnHelperTest, cast_to_nullable_column) {
     ASSERT_FALSE(col->is_constant());
 }
 
+TEST_F(ColumnHelperTest, is_single_value_run) {
+    ColumnBuilder<TYPE_VARCHAR> run_builder(4);
+    for (int i = 0; i < 4; i++) {
+        run_builder.append(Slice("v1"));
+    }
+    ASSERT_TRUE(ColumnHelper::is_single_value_run(*run_builder.build(false)));
+
+    ColumnBuilder<TYPE_VARCHAR> mixed_builder(4);
+    for (int i = 0; i < 3; i++) {
+        mixed_builder.append(Slice("v1"));
+    }
+    mixed_builder.append(Slice("v2"));
+    ASSERT_FALSE(ColumnHelper::is_single_value_run(*mixed_builder.build(false)));
+
+    ColumnBuilder<TYPE_VARCHAR> null_builder(4);
+    for (int i = 0; i < 3; i++) {
+        null_builder.append(Slice("v1"));
+    }
+    null_builder.append(Slice("v1"), true);
+    ASSERT_FALSE(ColumnHelper::is_single_value_run(*null_builder.build(false)));
+
+    ASSERT_TRUE(ColumnHelper::is_single_value_run(*create_column()));
+    ASSERT_FALSE(ColumnHelper::is_single_value_run(*create_nullable_column()));
+}
+
 TEST_F(ColumnHelperTest, align_return_type) {
     auto nullable_column = create_nullable_column();
     auto not_null_column = create_column();
@@ -43,6 +43,24 @@ TEST_F(ColumnPoolTest, mem_statistics) {
     ASSERT_EQ(usage_1 - usage_2, 81920);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ColumnPoolTest, return_large_binary_column) {
+    const size_t chunk_size = config::vector_chunk_size;
+    auto* c1 = get_column<BinaryColumn>();
+    std::string str(1024, 'x');
+    for (size_t i = 0; i < chunk_size; i++) {
+        c1->append_string(str);
+    }
+    ASSERT_GT(c1->get_bytes().capacity(), chunk_size * 512);
+    return_column<BinaryColumn>(c1, chunk_size);
+
+    // The oversized byte buffer is freed at return, the column object itself is recycled.
+    auto* c2 = get_column<BinaryColumn>();
+    ASSERT_EQ(c1, c2);
+    ASSERT_EQ(0u, c2->get_bytes().capacity());
+    return_column<BinaryColumn>(c2, chunk_size);
+}
+
 // NOLINTNEXTLINE
 TEST_F(ColumnPoolTest, single_thread) {
     auto c1 = get_column<Int32Column>();
@@ -175,6 +175,21 @@ TEST(HashMapTest, TwoLevelConvert) {
     }
 }
 
+TEST(HashMapTest, TwoLevelConvertInt32) {
+    Int32AggHashSet<PhmapSeed1> set;
+    Int32AggTwoLevelHashSet<PhmapSeed1> two_level_set;
+
+    for (int32_t i = 0; i < 1000; i++) {
+        set.emplace(i);
+    }
+    two_level_set.insert(set.begin(), set.end());
+
+    ASSERT_EQ(set.size(), two_level_set.size());
+    for (const auto& key : set) {
+        ASSERT_TRUE(two_level_set.contains(key));
+    }
+}
+
 class AggHashMapKeyNotFoundsTest : public ::testing::Test {
 public:
     template <typename HashMapWithKey>
@@ -304,6 +319,16 @@ TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_NullInt32AggH
     TestAggHashMapKeyWithIntType<TestAggHashMapKey>(true);
 }
 
+TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_DictCodeAggHashMapWithOneNumberKey) {
+    using TestAggHashMapKey = DictCodeAggHashMapWithOneNumberKey<PhmapSeed1>;
+    TestAggHashMapKeyWithIntType<TestAggHashMapKey>(false);
+}
+
+TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_NullDictCodeAggHashMapWithOneNumberKey) {
+    using TestAggHashMapKey = NullDictCodeAggHashMapWithOneNumberKey<PhmapSeed1>;
+    TestAggHashMapKeyWithIntType<TestAggHashMapKey>(true);
+}
+
 TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_OneStringAggHashMap) {
     using TestAggHashMapKey = OneStringAggHashMap<PhmapSeed1>;
     TestAggHashMapKeyWithStringType<TestAggHashMapKey>(false);
@@ -0,0 +1,196 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/arrow_ipc_scanner.h"
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "column/chunk.h"
+#include "common/status.h"
+#include "fs/fs_util.h"
+#include "gen_cpp/Descriptors_types.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "runtime/types.h"
+#include "testutil/assert.h"
+#include "testutil/desc_tbl_helper.h"
+
+namespace starrocks {
+
+class ArrowIPCScannerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _runtime_state = _obj_pool.add(new RuntimeState(TQueryGlobals()));
+        _file_path = "./arrow_ipc_scanner_test.arrow";
+        write_test_file();
+    }
+
+    void TearDown() override { (void)fs::delete_file(_file_path); }
+
+    void write_test_file() {
+        auto schema = arrow::schema(
+                {arrow::field("id", arrow::int64(), false), arrow::field("name", arrow::utf8(), true)});
+
+        arrow::Int64Builder id_builder;
+        arrow::StringBuilder name_builder;
+        for (int64_t i = 0; i < 100; ++i) {
+            ASSERT_TRUE(id_builder.Append(i).ok());
+            if (i % 10 == 0) {
+                ASSERT_TRUE(name_builder.AppendNull().ok());
+            } else {
+                ASSERT_TRUE(name_builder.Append("name_" + std::to_string(i)).ok());
+            }
+        }
+        std::shared_ptr<arrow::Array> id_array;
+        std::shared_ptr<arrow::Array> name_array;
+        ASSERT_TRUE(id_builder.Finish(&id_array).ok());
+        ASSERT_TRUE(name_builder.Finish(&name_array).ok());
+        auto batch = arrow::RecordBatch::Make(schema, 100, {id_array, name_array});
+
+        auto sink_res = arrow::io::FileOutputStream::Open(_file_path);
+        ASSERT_TRUE(sink_res.ok());
+        auto writer_res = arrow::ipc::MakeFileWriter(sink_res.ValueOrDie(), schema);
+        ASSERT_TRUE(writer_res.ok());
+        auto writer = writer_res.ValueOrDie();
+        // write the same batch twice to exercise multi-batch reading
+        ASSERT_TRUE(writer->WriteRecordBatch(*batch).ok());
+        ASSERT_TRUE(writer->WriteRecordBatch(*batch).ok());
+        ASSERT_TRUE(writer->Close().ok());
+    }
+
+    starrocks::TExpr create_column_ref(int32_t slot_id, const TypeDescriptor& type_desc, bool is_nullable) {
+        starrocks::TExpr e = starrocks::TExpr();
+        e.nodes.emplace_back(TExprNode());
+        e.nodes[0].__set_type(type_desc.to_thrift());
+        e.nodes[0].__set_node_type(TExprNodeType::SLOT_REF);
+        e.nodes[0].__set_is_nullable(is_nullable);
+        e.nodes[0].__set_slot_ref(TSlotRef());
+        e.nodes[0].slot_ref.__set_slot_id((::starrocks::TSlotId)slot_id);
+        return e;
+    }
+
+    std::unique_ptr<ArrowIPCScanner> create_scanner(DescriptorTbl* desc_tbl,
+                                                    const std::vector<TBrokerRangeDesc>& ranges) {
+        auto query_globals = TQueryGlobals();
+        query_globals.time_zone = "UTC";
+        RuntimeState* state = _obj_pool.add(new RuntimeState(TUniqueId(), TQueryOptions(), query_globals, nullptr));
+        state->set_desc_tbl(desc_tbl);
+        state->init_instance_mem_tracker();
+
+        TBrokerScanRangeParams* params = _obj_pool.add(new TBrokerScanRangeParams());
+        params->strict_mode = true;
+        std::vector<TupleDescriptor*> tuples;
+        desc_tbl->get_tuple_descs(&tuples);
+        params->src_tuple_id = 0;
+        params->dest_tuple_id = tuples.size() - 1;
+        const auto* src_tuple = desc_tbl->get_tuple_descriptor(params->src_tuple_id);
+        const auto* dst_tuple = desc_tbl->get_tuple_descriptor(params->dest_tuple_id);
+        for (int i = 0; i < src_tuple->slots().size(); i++) {
+            auto& src_slot = src_tuple->slots()[i];
+            auto& dst_slot = dst_tuple->slots()[i];
+            params->expr_of_dest_slot[dst_slot->id()] =
+                    create_column_ref(src_slot->id(), src_slot->type(), src_slot->is_nullable());
+        }
+        for (int i = 0; i < src_tuple->slots().size(); i++) {
+            params->src_slot_ids.emplace_back(i);
+        }
+
+        RuntimeProfile* profile = _obj_pool.add(new RuntimeProfile("test_prof", true));
+        ScannerCounter* counter = _obj_pool.add(new ScannerCounter());
+
+        TBrokerScanRange* broker_scan_range = _obj_pool.add(new TBrokerScanRange());
+        broker_scan_range->params = *params;
+        broker_scan_range->ranges = ranges;
+
+        return std::make_unique<ArrowIPCScanner>(state, profile, *broker_scan_range, counter);
+    }
+
+    std::vector<TBrokerRangeDesc> generate_ranges(int32_t num_columns_from_file) {
+        TBrokerRangeDesc range;
+        range.__set_num_of_columns_from_file(num_columns_from_file);
+        range.__set_columns_from_path({});
+        range.__set_path(_file_path);
+        range.start_offset = 0;
+        range.size = LONG_MAX;
+        range.file_type = TFileType::FILE_LOCAL;
+        return {range};
+    }
+
+    ObjectPool _obj_pool;
+    RuntimeState* _runtime_state = nullptr;
+    std::string _file_path;
+};
+
+TEST_F(ArrowIPCScannerTest, ScanBasic) {
+    SlotTypeDescInfoArray slot_infos{
+            {"id", TypeDescriptor::from_logical_type(TYPE_BIGINT), true},
+            {"name", TypeDescriptor::from_logical_type(TYPE_VARCHAR), true},
+    };
+    auto* desc_tbl = DescTblHelper::generate_desc_tbl(_runtime_state, _obj_pool, {slot_infos, {}});
+    auto ranges = generate_ranges(slot_infos.size());
+    auto scanner = create_scanner(desc_tbl, ranges);
+    ASSERT_OK(scanner->open());
+
+    size_t num_rows = 0;
+    size_t num_nulls = 0;
+    while (true) {
+        auto res = scanner->get_next();
+        if (!res.ok()) {
+            ASSERT_TRUE(res.status().is_end_of_file());
+            break;
+        }
+        ChunkPtr chunk = res.value();
+        if (chunk == nullptr || chunk->num_rows() == 0) {
+            break;
+        }
+        auto& id_col = chunk->columns()[0];
+        auto& name_col = chunk->columns()[1];
+        for (size_t i = 0; i < chunk->num_rows(); ++i) {
+            ASSERT_FALSE(id_col->is_null(i));
+            num_nulls += name_col->is_null(i);
+        }
+        num_rows += chunk->num_rows();
+    }
+    ASSERT_EQ(200, num_rows);
+    ASSERT_EQ(20, num_nulls);
+    scanner->close();
+}
+
+TEST_F(ArrowIPCScannerTest, GetSchema) {
+    SlotTypeDescInfoArray slot_infos{
+            {"id", TypeDescriptor::from_logical_type(TYPE_BIGINT), true},
+            {"name", TypeDescriptor::from_logical_type(TYPE_VARCHAR), true},
+    };
+    auto* desc_tbl = DescTblHelper::generate_desc_tbl(_runtime_state, _obj_pool, {slot_infos, {}});
+    auto ranges = generate_ranges(slot_infos.size());
+    auto scanner = create_scanner(desc_tbl, ranges);
+    ASSERT_OK(scanner->open());
+
+    std::vector<SlotDescriptor> schema;
+    ASSERT_OK(scanner->get_schema(&schema));
+    ASSERT_EQ(2, schema.size());
+    ASSERT_EQ("id", schema[0].col_name());
+    ASSERT_EQ(TYPE_BIGINT, schema[0].type().type);
+    ASSERT_EQ("name", schema[1].col_name());
+    ASSERT_EQ(TYPE_VARCHAR, schema[1].type().type);
+    scanner->close();
+}
+
+} // namespace starrocks
@@ -20,6 +20,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <numeric>
 #include <string_view>
 
 #include "column/column_helper.h"
@@ -342,6 +343,40 @@ TEST_F(ChunksSorterTest, full_sort_incremental) {
     clear_sort_exprs(sort_exprs);
 }
 
+TEST_F(ChunksSorterTest, full_sort_presorted_input) {
+    std::vector<bool> is_asc{true};
+    std::vector<bool> is_null_first{true};
+    auto expr_int = std::make_unique<ColumnRef>(TypeDescriptor(TYPE_INT), 0);
+    std::vector<ExprContext*> sort_exprs{new ExprContext(expr_int.get())};
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+    auto pool = std::make_unique<ObjectPool>();
+    ChunksSorterFullSort sorter(_runtime_state.get(), &sort_exprs, &is_asc, &is_null_first, "", 1024000, 16777216,
+                                std::vector<SlotId>());
+    sorter.setup_runtime(_runtime_state.get(), pool->add(new RuntimeProfile("", false)),
+                         pool->add(new MemTracker(1L << 62, "", nullptr)));
+
+    // clustered input: each chunk is ascending and chunks do not overlap,
+    // so the sorter takes the presorted fast path and must still emit global order
+    Chunk::SlotHashMap slot_map;
+    slot_map[0] = 0;
+    for (int32_t base : {0, 100, 200}) {
+        std::vector<int32_t> values(100);
+        std::iota(values.begin(), values.end(), base);
+        Columns columns{make_int32_column(values)};
+        ASSERT_OK(sorter.update(_runtime_state.get(), std::make_shared<Chunk>(columns, slot_map)));
+    }
+    ASSERT_OK(sorter.done(_runtime_state.get()));
+
+    ChunkPtr page = consume_page_from_sorter(sorter);
+    ASSERT_EQ(300, page->num_rows());
+    for (size_t i = 0; i < page->num_rows(); i++) {
+        EXPECT_EQ(static_cast<int32_t>(i), page->get(i).get(0).get_int32());
+    }
+
+    clear_sort_exprs(sort_exprs);
+}
+
 // NOTE: this test case runs too slow
 // TEST_F(ChunksSorterTest, full_sort_chunk_overflow) {
 //     std::vector<bool> is_asc{true};
@@ -464,6 +499,52 @@ TEST_F(ChunksSorterTest, topn_sort_with_limit) {
     }
 }
 
+TEST_F(ChunksSorterTest, topn_sort_with_shared_boundary) {
+    std::vector<bool> is_asc{true, true};
+    std::vector<bool> is_null_first{true, true};
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(new ExprContext(_expr_nation.get()));
+    sort_exprs.push_back(new ExprContext(_expr_cust_key.get()));
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+
+    std::vector<int32_t> expected{69, 70, 71, 4, 54, 16, 41, 49, 55, 56, 52, 2, 12, 24, 58};
+    constexpr int kTotalRows = 16;
+    for (int limit = 1; limit < kTotalRows; limit++) {
+        SharedTopnBoundary boundary;
+
+        // The first sorter publishes its Kth row as the shared boundary once done.
+        ChunksSorterTopn sorter_1(_runtime_state.get(), &sort_exprs, &is_asc, &is_null_first, "", 0, limit);
+        sorter_1.set_shared_topn_boundary(&boundary);
+        ASSERT_OK(sorter_1.update(_runtime_state.get(), ChunkPtr(_chunk_1->clone_unique().release())));
+        ASSERT_OK(sorter_1.update(_runtime_state.get(), ChunkPtr(_chunk_2->clone_unique().release())));
+        ASSERT_OK(sorter_1.update(_runtime_state.get(), ChunkPtr(_chunk_3->clone_unique().release())));
+        ASSERT_OK(sorter_1.done(_runtime_state.get()));
+        ASSERT_TRUE(boundary.inited());
+
+        // The second sorter prunes its input by the published boundary and
+        // must still produce the same result.
+        ChunksSorterTopn sorter_2(_runtime_state.get(), &sort_exprs, &is_asc, &is_null_first, "", 0, limit);
+        sorter_2.set_shared_topn_boundary(&boundary);
+        ASSERT_OK(sorter_2.update(_runtime_state.get(), ChunkPtr(_chunk_1->clone_unique().release())));
+        ASSERT_OK(sorter_2.update(_runtime_state.get(), ChunkPtr(_chunk_2->clone_unique().release())));
+        ASSERT_OK(sorter_2.update(_runtime_state.get(), ChunkPtr(_chunk_3->clone_unique().release())));
+        ASSERT_OK(sorter_2.done(_runtime_state.get()));
+
+        ChunkPtr page = consume_page_from_sorter(sorter_2);
+        ASSERT_EQ(limit, page->num_rows());
+        std::vector<int32_t> permutation = expected;
+        permutation.resize(limit);
+        std::vector<int32_t> result;
+        for (size_t i = 0; i < page->num_rows(); ++i) {
+            result.push_back(page->get(i).get(0).get_int32());
+        }
+        EXPECT_EQ(permutation, result);
+    }
+
+    clear_sort_exprs(sort_exprs);
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunksSorterTest, rank_topn) {
     std::vector<bool> is_asc{true};
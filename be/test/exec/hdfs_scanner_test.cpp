@@ -1546,6 +1546,35 @@ TEST_F(HdfsScannerTest, TestParquetCoalesceReadAcrossRowGroup) {
     scanner->close();
 }
 
+TEST_F(HdfsScannerTest, TestParquetCrossRowGroupCoalesceRead) {
+    SlotDesc parquet_descs[] = {{"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+                                {"c2", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+                                {"c3", TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR, 22)},
+                                {""}};
+
+    const std::string parquet_file = "./be/test/exec/test_data/parquet_scanner/small_row_group_data.parquet";
+
+    bool old_value = config::parquet_cross_row_group_coalesce_enable;
+    config::parquet_cross_row_group_coalesce_enable = true;
+
+    auto scanner = std::make_shared<HdfsParquetScanner>();
+
+    auto* range = _create_scan_range(parquet_file, 0, 0);
+    auto* tuple_desc = _create_tuple_desc(parquet_descs);
+    auto* param = _create_param(parquet_file, range, tuple_desc);
+
+    Status status = scanner->init(_runtime_state, *param);
+    ASSERT_TRUE(status.ok()) << status.message();
+
+    status = scanner->open(_runtime_state);
+    ASSERT_TRUE(status.ok()) << status.message();
+
+    READ_SCANNER_ROWS(scanner, 100000);
+
+    scanner->close();
+    config::parquet_cross_row_group_coalesce_enable = old_value;
+}
+
 TEST_F(HdfsScannerTest, TestParquetRuntimeFilter) {
     SlotDesc parquet_descs[] = {{"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
                                 {"c2", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
@@ -850,6 +850,54 @@ TEST_F(JoinHashMapTest, CalcBucketNums) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, LookupInitWithPrefetch) {
+    const uint32_t row_count = 100;
+    JoinHashTableItems table_items;
+    // large enough to take the prefetching path
+    table_items.first.resize(JoinHashMapHelper::MIN_BUCKET_SIZE_TO_PREFETCH);
+    auto& first = table_items.first;
+    for (uint32_t i = 0; i < first.size(); i++) {
+        first[i] = i % 2 == 0 ? i + 1 : 0;
+    }
+    Buffer<uint32_t> buckets(row_count);
+    for (uint32_t i = 0; i < row_count; i++) {
+        buckets[i] = (i * 97) % first.size();
+    }
+    Buffer<uint8_t> is_nulls(row_count);
+    for (uint32_t i = 0; i < row_count; i++) {
+        is_nulls[i] = i % 3 == 0;
+    }
+
+    Buffer<uint32_t> next(row_count);
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, buckets, row_count, &next);
+    for (uint32_t i = 0; i < row_count; i++) {
+        ASSERT_EQ(next[i], first[buckets[i]]);
+    }
+
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, buckets, is_nulls, row_count, &next);
+    for (uint32_t i = 0; i < row_count; i++) {
+        ASSERT_EQ(next[i], is_nulls[i] == 0 ? first[buckets[i]] : 0);
+    }
+
+    // With a bucket filter, the results must not change: the filter marks exactly the
+    // non-empty buckets.
+    table_items.bucket_filter.assign((first.size() + 7) / 8, 0);
+    for (uint32_t i = 0; i < first.size(); i++) {
+        table_items.bucket_filter[i >> 3] |= (first[i] != 0) << (i & 0b111);
+    }
+
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, buckets, row_count, &next);
+    for (uint32_t i = 0; i < row_count; i++) {
+        ASSERT_EQ(next[i], first[buckets[i]]);
+    }
+
+    JoinHashMapHelper::lookup_init_with_prefetch(table_items, buckets, is_nulls, row_count, &next);
+    for (uint32_t i = 0; i < row_count; i++) {
+        ASSERT_EQ(next[i], is_nulls[i] == 0 ? first[buckets[i]] : 0);
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, GetHashKey) {
     auto c1 = JoinHashMapTest::create_int32_column(2, 0);
@@ -980,7 +1028,9 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFunc) {
 
     JoinBuildFunc<LogicalType::TYPE_INT>::prepare(nullptr, &table_items);
     JoinProbeFunc<LogicalType::TYPE_INT>::prepare(runtime_state.get(), &probe_state);
-    JoinBuildFunc<LogicalType::TYPE_INT>::construct_hash_table(runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(JoinBuildFunc<LogicalType::TYPE_INT>::construct_hash_table(runtime_state.get(), &table_items,
+                                                                           &probe_state)
+                        .ok());
     JoinProbeFunc<LogicalType::TYPE_INT>::lookup_init(table_items, &probe_state);
 
     for (size_t i = 0; i < 10; i++) {
@@ -1022,7 +1072,7 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
 
     JoinBuildFunc<TYPE_INT>::prepare(nullptr, &table_items);
     JoinProbeFunc<TYPE_INT>::prepare(runtime_state.get(), &probe_state);
-    JoinBuildFunc<TYPE_INT>::construct_hash_table(runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(JoinBuildFunc<TYPE_INT>::construct_hash_table(runtime_state.get(), &table_items, &probe_state).ok());
     JoinProbeFunc<TYPE_INT>::lookup_init(table_items, &probe_state);
 
     for (size_t i = 0; i < 10; i++) {
@@ -1211,7 +1261,9 @@ TEST_F(JoinHashMapTest, FixedSizeJoinBuildProbeFunc) {
 
     FixedSizeJoinBuildFunc<TYPE_BIGINT>::prepare(runtime_state.get(), &table_items);
     FixedSizeJoinProbeFunc<TYPE_BIGINT>::prepare(runtime_state.get(), &probe_state);
-    FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(runtime_state.get(), &table_items,
+                                                                          &probe_state)
+                        .ok());
     FixedSizeJoinProbeFunc<TYPE_BIGINT>::lookup_init(table_items, &probe_state);
 
     for (size_t i = 0; i < 10; i++) {
@@ -1263,7 +1315,9 @@ TEST_F(JoinHashMapTest, FixedSizeJoinBuildProbeFuncNullable) {
 
     FixedSizeJoinBuildFunc<TYPE_BIGINT>::prepare(runtime_state.get(), &table_items);
     FixedSizeJoinProbeFunc<TYPE_BIGINT>::prepare(runtime_state.get(), &probe_state);
-    FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(runtime_state.get(), &table_items,
+                                                                          &probe_state)
+                        .ok());
     FixedSizeJoinProbeFunc<TYPE_BIGINT>::lookup_init(table_items, &probe_state);
 
     for (size_t i = 0; i < 10; i++) {
@@ -1322,7 +1376,7 @@ TEST_F(JoinHashMapTest, SerializedJoinBuildProbeFunc) {
 
     SerializedJoinBuildFunc::prepare(runtime_state.get(), &table_items);
     SerializedJoinProbeFunc::prepare(runtime_state.get(), &probe_state);
-    SerializedJoinBuildFunc::construct_hash_table(runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(SerializedJoinBuildFunc::construct_hash_table(runtime_state.get(), &table_items, &probe_state).ok());
     SerializedJoinProbeFunc::lookup_init(table_items, &probe_state);
 
     for (size_t i = 0; i < 10; i++) {
@@ -1378,7 +1432,7 @@ TEST_F(JoinHashMapTest, SerializedJoinBuildProbeFuncNullable) {
 
     SerializedJoinBuildFunc::prepare(runtime_state.get(), &table_items);
     SerializedJoinProbeFunc::prepare(runtime_state.get(), &probe_state);
-    SerializedJoinBuildFunc::construct_hash_table(runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(SerializedJoinBuildFunc::construct_hash_table(runtime_state.get(), &table_items, &probe_state).ok());
     SerializedJoinProbeFunc::lookup_init(table_items, &probe_state);
 
     Columns probe_data_columns;
@@ -2126,7 +2180,9 @@ TEST_F(JoinHashMapTest, FixedSizeJoinBuildFuncForNotNullableColumn) {
 
     // Construct Hash Table
     FixedSizeJoinBuildFunc<TYPE_BIGINT>::prepare(_runtime_state.get(), &table_items);
-    FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(_runtime_state.get(), &table_items,
+                                                                          &probe_state)
+                        .ok());
 
     // Check
     check_build_index(table_items.first, table_items.next, build_row_count);
@@ -2161,7 +2217,9 @@ TEST_F(JoinHashMapTest, FixedSizeJoinBuildFuncForNullableColumn) {
 
     // Construct Hash Table
     FixedSizeJoinBuildFunc<TYPE_BIGINT>::prepare(_runtime_state.get(), &table_items);
-    FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(_runtime_state.get(), &table_items,
+                                                                          &probe_state)
+                        .ok());
 
     // Check
     check_build_index(table_items.first, table_items.next, build_row_count);
@@ -2196,7 +2254,9 @@ TEST_F(JoinHashMapTest, FixedSizeJoinBuildFuncForPartialNullableColumn) {
 
     // Construct Hash Table
     FixedSizeJoinBuildFunc<TYPE_BIGINT>::prepare(_runtime_state.get(), &table_items);
-    FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(_runtime_state.get(), &table_items,
+                                                                          &probe_state)
+                        .ok());
 
     // Check
     auto nulls = create_bools(build_row_count, 4);
@@ -2230,7 +2290,7 @@ TEST_F(JoinHashMapTest, SerializedJoinBuildFuncForNotNullableColumn) {
 
     // Construct Hash Table
     SerializedJoinBuildFunc::prepare(_runtime_state.get(), &table_items);
-    SerializedJoinBuildFunc::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(SerializedJoinBuildFunc::construct_hash_table(_runtime_state.get(), &table_items, &probe_state).ok());
 
     // Check
     check_build_index(table_items.first, table_items.next, build_row_count);
@@ -2265,7 +2325,7 @@ TEST_F(JoinHashMapTest, SerializedJoinBuildFuncForNullableColumn) {
 
     // Construct Hash Table
     SerializedJoinBuildFunc::prepare(_runtime_state.get(), &table_items);
-    SerializedJoinBuildFunc::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(SerializedJoinBuildFunc::construct_hash_table(_runtime_state.get(), &table_items, &probe_state).ok());
 
     // Check
     check_build_index(table_items.first, table_items.next, build_row_count);
@@ -2300,7 +2360,7 @@ TEST_F(JoinHashMapTest, SerializedJoinBuildFuncForPartialNullColumn) {
 
     // Construct Hash Table
     SerializedJoinBuildFunc::prepare(_runtime_state.get(), &table_items);
-    SerializedJoinBuildFunc::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(SerializedJoinBuildFunc::construct_hash_table(_runtime_state.get(), &table_items, &probe_state).ok());
 
     // Check
     auto nulls = create_bools(build_row_count, 4);
@@ -21,6 +21,7 @@
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/work_group.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -88,6 +89,34 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_basic) {
     }
 }
 
+PARALLEL_TEST(QuerySharedDriverQueueTest, test_query_cpu_quota_demotion) {
+    const int64_t old_quota = config::pipeline_driver_queue_query_cpu_quota_ns_per_epoch;
+    config::pipeline_driver_queue_query_cpu_quota_ns_per_epoch = 100'000'000;
+    DeferOp restore_quota([old_quota] { config::pipeline_driver_queue_query_cpu_quota_ns_per_epoch = old_quota; });
+
+    QuerySharedDriverQueue queue;
+
+    // A hungry query that has already consumed two quotas within the current scheduling
+    // epoch, and a fresh query without any consumption.
+    QueryContext hungry_query;
+    hungry_query.cpu_cost_in_sched_epoch(config::pipeline_driver_queue_epoch_ns);
+    hungry_query.incr_cpu_cost(2 * config::pipeline_driver_queue_query_cpu_quota_ns_per_epoch);
+    QueryContext fresh_query;
+
+    auto hungry_driver = std::make_shared<PipelineDriver>(_gen_operators(), &hungry_query, nullptr, nullptr, -1);
+    _set_driver_level(hungry_driver.get(), 0);
+    auto fresh_driver = std::make_shared<PipelineDriver>(_gen_operators(), &fresh_query, nullptr, nullptr, -1);
+    _set_driver_level(fresh_driver.get(), 0);
+
+    queue.put_back(hungry_driver.get());
+    queue.put_back(fresh_driver.get());
+
+    // The fresh driver stays at the highest level, while the hungry driver is demoted
+    // one level per exhausted quota although it has spent no time itself.
+    ASSERT_EQ(0, fresh_driver->get_driver_queue_level());
+    ASSERT_EQ(2, hungry_driver->get_driver_queue_level());
+}
+
 PARALLEL_TEST(QuerySharedDriverQueueTest, test_cancel) {
     QuerySharedDriverQueue queue;
 
@@ -165,6 +194,71 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(NumaAwareDriverQueueTest, test_basic) {
+    NumaAwareDriverQueue queue;
+
+    // Prepare drivers.
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver1.get(), 1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver2.get(), 1);
+
+    std::vector<DriverRawPtr> in_drivers = {driver1.get(), driver2.get()};
+    for (auto* in_driver : in_drivers) {
+        queue.update_statistics(in_driver);
+        queue.put_back(in_driver);
+    }
+    ASSERT_EQ(2, queue.size());
+
+    // All the drivers must be taken out, regardless of the node-local queue they were routed to.
+    std::vector<DriverRawPtr> taken_drivers;
+    for (size_t i = 0; i < in_drivers.size(); i++) {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        taken_drivers.emplace_back(maybe_driver.value());
+    }
+    std::sort(taken_drivers.begin(), taken_drivers.end());
+    std::sort(in_drivers.begin(), in_drivers.end());
+    ASSERT_EQ(in_drivers, taken_drivers);
+    ASSERT_EQ(0, queue.size());
+}
+
+PARALLEL_TEST(NumaAwareDriverQueueTest, test_take_block) {
+    NumaAwareDriverQueue queue;
+
+    // Prepare drivers.
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver1.get(), 1);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+
+    sleep(1);
+    queue.update_statistics(driver1.get());
+    queue.put_back(driver1.get());
+
+    consumer_thread->join();
+}
+
+PARALLEL_TEST(NumaAwareDriverQueueTest, test_take_close) {
+    NumaAwareDriverQueue queue;
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+}
+
 class WorkGroupDriverQueueTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -160,6 +160,39 @@ TEST_F(QueryCacheTest, testCacheManager) {
     ASSERT_GE(cache_mgr->memory_usage(), 0);
 }
 
+TEST_F(QueryCacheTest, testCacheManagerKeepsFreshestVersion) {
+    auto cache_mgr = std::make_shared<query_cache::CacheManager>(10240);
+
+    auto create_cache_value = [](int64_t version, size_t num_rows) {
+        auto chk = std::make_shared<Chunk>();
+        auto col = Int8Column::create();
+        col->resize(num_rows);
+        chk->append_column(col, 0);
+        query_cache::CacheValue value(0, version, {chk});
+        return value;
+    };
+
+    cache_mgr->populate("key", create_cache_value(10, 100));
+    auto status = cache_mgr->probe("key");
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(status.value().version, 10);
+
+    // A stale or duplicate populate must not replace the fresher entry.
+    cache_mgr->populate("key", create_cache_value(9, 50));
+    cache_mgr->populate("key", create_cache_value(10, 50));
+    status = cache_mgr->probe("key");
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(status.value().version, 10);
+    ASSERT_EQ(status.value().result[0]->num_rows(), 100);
+
+    // A fresher populate replaces the entry.
+    cache_mgr->populate("key", create_cache_value(11, 50));
+    status = cache_mgr->probe("key");
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(status.value().version, 11);
+    ASSERT_EQ(status.value().result[0]->num_rows(), 50);
+}
+
 ChunkPtr create_test_chunk(query_cache::LaneOwnerType owner, long from, long to, bool is_last_chunk) {
     ChunkPtr chunk = std::make_shared<Chunk>();
     chunk->owner_info().set_owner_id(owner, is_last_chunk);
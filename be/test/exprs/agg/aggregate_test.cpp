@@ -971,6 +971,75 @@ TEST_F(AggregateTest, test_min) {
                                             DateValue::create(1000, 1, 1));
 }
 
+// Simulate the analytic node's removable cumulative evaluation of a sliding ROWS frame and
+// compare each row's result against a from-scratch evaluation of the same frame.
+static void test_removable_window_minmax(FunctionContext* ctx, bool is_max, const std::vector<int64_t>& values,
+                                         const std::vector<uint8_t>& nulls, int64_t rows_start_offset,
+                                         int64_t rows_end_offset) {
+    const AggregateFunction* func = get_window_function(is_max ? "max" : "min", TYPE_BIGINT, TYPE_BIGINT, true);
+    ASSERT_NE(nullptr, func);
+    auto state = ManagedAggrState::create(ctx, func);
+
+    auto data_column = Int64Column::create();
+    auto null_column = NullColumn::create();
+    const int64_t num_rows = values.size();
+    for (int64_t i = 0; i < num_rows; i++) {
+        data_column->append(values[i]);
+        null_column->append(nulls[i]);
+    }
+    auto column = NullableColumn::create(std::move(data_column), std::move(null_column));
+    const Column* row_column = column.get();
+
+    auto result_column = NullableColumn::create(Int64Column::create(), NullColumn::create());
+    result_column->resize(num_rows);
+
+    for (int64_t r = 0; r < num_rows; r++) {
+        func->update_state_removable_cumulatively(ctx, state->state(), &row_column, r, 0, num_rows, rows_start_offset,
+                                                  rows_end_offset, false, false);
+        func->get_values(ctx, state->state(), result_column.get(), r, r + 1);
+    }
+
+    for (int64_t r = 0; r < num_rows; r++) {
+        const int64_t frame_start = std::max<int64_t>(r + rows_start_offset, 0);
+        const int64_t frame_end = std::min<int64_t>(r + rows_end_offset + 1, num_rows);
+        bool has_value = false;
+        int64_t expect = 0;
+        for (int64_t i = frame_start; i < frame_end; i++) {
+            if (nulls[i]) {
+                continue;
+            }
+            expect = !has_value ? values[i] : (is_max ? std::max(expect, values[i]) : std::min(expect, values[i]));
+            has_value = true;
+        }
+        if (!has_value) {
+            ASSERT_TRUE(result_column->is_null(r)) << "row " << r;
+        } else {
+            ASSERT_FALSE(result_column->is_null(r)) << "row " << r;
+            const auto& result_data = down_cast<const Int64Column&>(result_column->data_column_ref());
+            ASSERT_EQ(expect, result_data.get_data()[r]) << "row " << r;
+        }
+    }
+}
+
+TEST_F(AggregateTest, test_removable_cumulative_window_min_max) {
+    std::vector<int64_t> values;
+    std::vector<uint8_t> no_nulls;
+    std::vector<uint8_t> some_nulls;
+    for (int64_t i = 0; i < 100; i++) {
+        values.push_back((i * 37 + 11) % 71);
+        no_nulls.push_back(0);
+        some_nulls.push_back(i % 3 == 0 ? 1 : 0);
+    }
+
+    const std::vector<std::pair<int64_t, int64_t>> frames{{-3, 0}, {-2, 2}, {0, 3}, {-5, -2}};
+    for (const auto& [rows_start_offset, rows_end_offset] : frames) {
+        for (bool is_max : {true, false}) {
+            test_removable_window_minmax(ctx, is_max, values, no_nulls, rows_start_offset, rows_end_offset);
+            test_removable_window_minmax(ctx, is_max, values, some_nulls, rows_start_offset, rows_end_offset);
+        }
+    }
+}
+
 //TEST_F(AggregateTest, test_bitmap_count) {
 //    const AggregateFunction* func = get_aggregate_function("bitmap_union_int", TYPE_SMALLINT, TYPE_BIGINT, false);
 //    test_agg_function<int16_t, int64_t>(ctx, func, 1024, 1000, 2024);
@@ -21,6 +21,7 @@
 #include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "exprs/in_const_predicate.hpp"
 #include "exprs/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -213,6 +214,49 @@ TEST_F(VectorizedInPredicateTest, intNotInTrue) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, largeIntListUsesSortedArray) {
+    // lists this large switch from hash probing to the sorted-array binary search
+    constexpr int kListSize = 2000;
+
+    expr_node.child_type = TPrimitiveType::INT;
+    expr_node.opcode = TExprOpcode::FILTER_IN;
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    expr_node.in_predicate.is_not_in = false;
+
+    auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+
+    MockVectorizedExpr<TYPE_INT> col1(expr_node, 10, 6);
+    expr->_children.push_back(&col1);
+
+    std::vector<std::unique_ptr<MockConstVectorizedExpr<TYPE_INT>>> values;
+    values.reserve(kListSize);
+    for (int v = 0; v < kListSize; ++v) {
+        // even values only, so every odd probe misses between two neighbors
+        values.emplace_back(std::make_unique<MockConstVectorizedExpr<TYPE_INT>>(expr_node, v * 2));
+        expr->_children.push_back(values.back().get());
+    }
+
+    ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+    ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+
+    {
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ASSERT_TRUE(ptr->is_numeric());
+        auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+        for (int j = 0; j < ptr->size(); ++j) {
+            ASSERT_TRUE(v->get_data()[j]);
+        }
+    }
+
+    auto* in_pred = down_cast<VectorizedInConstPredicate<TYPE_INT>*>(expr.get());
+    // hits on both ends, misses below, between and above the list
+    ASSERT_EQ(1, in_pred->check_value_existence<false>(0));
+    ASSERT_EQ(1, in_pred->check_value_existence<false>((kListSize - 1) * 2));
+    ASSERT_EQ(0, in_pred->check_value_existence<false>(-2));
+    ASSERT_EQ(0, in_pred->check_value_existence<false>(7));
+    ASSERT_EQ(0, in_pred->check_value_existence<false>(kListSize * 2));
+}
+
 TEST_F(VectorizedInPredicateTest, nullSliceIn) {
     for (auto i = 0; i < 2; i++) {
         if (i == 0) {
@@ -0,0 +1,67 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/unary_function.h"
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "testutil/column_test_helper.h"
+
+namespace starrocks {
+
+DEFINE_UNARY_FN_WITH_IMPL(UnaryNegateImpl, v) {
+    return -v;
+}
+
+class VectorizedUnaryNullableTest : public ::testing::Test {};
+
+TEST_F(VectorizedUnaryNullableTest, nullFreeBitmapElided) {
+    auto column = ColumnTestHelper::create_nullable_column<TYPE_INT>();
+    auto* arg = ColumnHelper::as_raw_column<NullableColumn>(column);
+    for (int32_t i = 0; i < 100; ++i) {
+        arg->append_datum(i);
+    }
+    ASSERT_FALSE(column->has_null());
+
+    auto result = VectorizedStrictUnaryFunction<UnaryNegateImpl>::evaluate<TYPE_INT>(column);
+
+    // a nullable input without nulls takes the fast path and skips the null column copy.
+    ASSERT_FALSE(result->is_nullable());
+    auto* data = ColumnHelper::cast_to_raw<TYPE_INT>(result);
+    for (int32_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(-i, data->get_data()[i]);
+    }
+}
+
+TEST_F(VectorizedUnaryNullableTest, partialNulls) {
+    auto column = ColumnTestHelper::create_nullable_column<TYPE_INT>();
+    auto* arg = ColumnHelper::as_raw_column<NullableColumn>(column);
+    arg->append_datum(1);
+    arg->append_nulls(1);
+    arg->append_datum(3);
+
+    auto result = VectorizedStrictUnaryFunction<UnaryNegateImpl>::evaluate<TYPE_INT>(column);
+
+    ASSERT_TRUE(result->is_nullable());
+    ASSERT_FALSE(result->is_null(0));
+    ASSERT_TRUE(result->is_null(1));
+    ASSERT_FALSE(result->is_null(2));
+    ASSERT_EQ(-1, result->get(0).get_int32());
+    ASSERT_EQ(-3, result->get(2).get_int32());
+}
+
+} // namespace starrocks
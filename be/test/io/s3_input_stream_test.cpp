@@ -132,6 +132,49 @@ TEST_F(S3InputStreamTest, test_read) {
     ASSERT_EQ(10, *f->position());
 }
 
+TEST_F(S3InputStreamTest, test_read_with_prefetch) {
+    config::enable_s3_stream_prefetch = true;
+    auto f = new_random_access_file();
+    char buf[4];
+    // first read is blocking and issues a readahead for the next range
+    ASSIGN_OR_ABORT(auto r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ("0123", std::string_view(buf, r));
+    // served from the readahead
+    ASSIGN_OR_ABORT(r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ("4567", std::string_view(buf, r));
+    // a seek in between drops the readahead
+    ASSERT_OK(f->seek(2));
+    ASSIGN_OR_ABORT(r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ("2345", std::string_view(buf, r));
+    config::enable_s3_stream_prefetch = false;
+}
+
+TEST_F(S3InputStreamTest, test_parallel_read) {
+    auto saved_min = config::s3_parallel_read_min_bytes;
+    auto saved_part = config::s3_parallel_read_part_bytes;
+    config::s3_parallel_read_min_bytes = 4;
+    config::s3_parallel_read_part_bytes = 3;
+    auto f = new_random_access_file();
+    char buf[10];
+    // served by concurrent sub-range GETs of at most 3 bytes each
+    ASSIGN_OR_ABORT(auto r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ("0123456789", std::string_view(buf, r));
+    ASSERT_EQ(10, *f->position());
+    config::s3_parallel_read_min_bytes = saved_min;
+    config::s3_parallel_read_part_bytes = saved_part;
+}
+
+TEST_F(S3InputStreamTest, test_hedged_read) {
+    config::enable_s3_hedged_read = true;
+    auto f = new_random_access_file();
+    char buf[6];
+    ASSIGN_OR_ABORT(auto r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ("012345", std::string_view(buf, r));
+    ASSIGN_OR_ABORT(r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ("6789", std::string_view(buf, r));
+    config::enable_s3_hedged_read = false;
+}
+
 TEST_F(S3InputStreamTest, test_skip) {
     auto f = new_random_access_file();
     char buf[6];
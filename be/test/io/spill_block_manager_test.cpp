@@ -266,6 +266,45 @@ TEST_F(SpillBlockManagerTest, file_block_allocation_test) {
     }
 }
 
+TEST_F(SpillBlockManagerTest, remote_block_buffered_read_test) {
+    // a RemoteDir backed by the local fs, to exercise the buffered read path of remote blocks
+    auto fs = FileSystem::CreateSharedFromString(remote_path);
+    auto remote_dir = std::make_shared<spill::RemoteDir>(remote_path, fs.value(), nullptr, INT64_MAX);
+    auto dir_mgr = create_spill_dir_manager({remote_dir});
+    auto block_mgr = std::make_shared<spill::FileBlockManager>(dummy_query_id, dir_mgr.get());
+    ASSERT_OK(block_mgr->open());
+
+    spill::AcquireBlockOptions opts{.query_id = dummy_query_id,
+                                    .fragment_instance_id = dummy_query_id,
+                                    .plan_node_id = 1,
+                                    .name = "node1",
+                                    .block_size = 4096};
+    auto res = block_mgr->acquire_block(opts);
+    ASSERT_TRUE(res.ok());
+    auto block = res.value();
+    ASSERT_TRUE(block->is_remote());
+
+    std::string data(100, 0);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = 'a' + i % 26;
+    }
+    ASSERT_OK(block->append({Slice(data)}));
+    ASSERT_OK(block->flush());
+
+    // use a tiny readahead so reading triggers several buffer refills
+    int64_t saved_readahead_bytes = config::spill_remote_block_readahead_bytes;
+    config::spill_remote_block_readahead_bytes = 16;
+    DeferOp defer([&]() { config::spill_remote_block_readahead_bytes = saved_readahead_bytes; });
+
+    auto reader = block->get_reader();
+    std::string read_data(data.size(), 0);
+    for (size_t off = 0; off < read_data.size(); off += 10) {
+        ASSERT_OK(reader->read_fully(read_data.data() + off, 10));
+    }
+    ASSERT_EQ(data, read_data);
+    ASSERT_TRUE(reader->read_fully(read_data.data(), 1).is_end_of_file());
+}
+
 TEST_F(SpillBlockManagerTest, hybird_block_allocation_test) {
     std::shared_ptr<spill::HyBirdBlockManager> hybird_block_mgr;
     {
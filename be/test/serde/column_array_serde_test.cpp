@@ -242,6 +242,39 @@ PARALLEL_TEST(ColumnArraySerdeTest, binary_column) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, dict_encoded_binary_column) {
+    // low-cardinality column should round-trip through the per-chunk dictionary
+    auto c1 = BinaryColumn::create();
+    for (int i = 0; i < 1000; i++) {
+        c1->append(Slice("dict_value_" + std::to_string(i % 5)));
+    }
+    for (auto level : {8, 9, 14, 15}) {
+        auto c2 = BinaryColumn::create();
+        std::vector<uint8_t> buffer;
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+        ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+        ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level);
+        for (size_t i = 0; i < c1->size(); i++) {
+            ASSERT_EQ(c1->get_slice(i), c2->get_slice(i));
+        }
+    }
+
+    // high-cardinality column should fall back to lz4 and still round-trip
+    auto c3 = BinaryColumn::create();
+    for (int i = 0; i < 1000; i++) {
+        c3->append(Slice("distinct_value_" + std::to_string(i)));
+    }
+    auto c4 = BinaryColumn::create();
+    std::vector<uint8_t> buffer;
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c3, 8));
+    ColumnArraySerde::serialize(*c3, buffer.data(), false, 8);
+    ColumnArraySerde::deserialize(buffer.data(), c4.get(), false, 8);
+    for (size_t i = 0; i < c3->size(); i++) {
+        ASSERT_EQ(c3->get_slice(i), c4->get_slice(i));
+    }
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ColumnArraySerdeTest, large_binary_column) {
     std::vector<Slice> strings{{"bbb"}, {"bbc"}, {"ccc"}};
@@ -22,6 +22,7 @@
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
 #include "runtime/types.h"
+#include "serde/column_array_serde.h"
 #include "testutil/parallel_test.h"
 
 namespace starrocks::serde {
@@ -96,6 +97,26 @@ PARALLEL_TEST(ProtobufChunkSerde, test_serde) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ProtobufChunkSerde, test_column_offsets) {
+    auto chunk = std::make_unique<Chunk>(make_columns(3), make_schema(3));
+
+    StatusOr<ChunkPB> res = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+    ASSERT_TRUE(res.ok()) << res.status();
+    ASSERT_EQ(3, res->column_offsets_size());
+
+    // every recorded offset must point exactly at the start of its column's payload.
+    const auto* base = reinterpret_cast<const uint8_t*>(res->data().data());
+    const uint8_t* cur = base + 8; // skip version and row count
+    for (int i = 0; i < res->column_offsets_size(); ++i) {
+        ASSERT_EQ(cur - base, res->column_offsets(i));
+        auto column = FixedLengthColumn<int32_t>::create();
+        cur = ColumnArraySerde::deserialize(cur, column.get());
+        ASSERT_EQ(100, column->size());
+    }
+    ASSERT_EQ(cur - base, res->serialized_size());
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ProtobufChunkSerde, TestChunkWithExtraData) {
     auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
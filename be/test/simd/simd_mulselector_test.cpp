@@ -80,7 +80,8 @@ bool test_all() {
     return (... && test_function_wrapper<TYPE, 1, chunk_size>()) &&
            (... && test_function_wrapper<TYPE, 2, chunk_size>()) &&
            (... && test_function_wrapper<TYPE, 4, chunk_size>()) &&
-           (... && test_function_wrapper<TYPE, 8, chunk_size>());
+           (... && test_function_wrapper<TYPE, 8, chunk_size>()) &&
+           (... && test_function_wrapper<TYPE, 12, chunk_size>());
 }
 
 PARALLEL_TEST(SIMDMultiSelectorTest, TestVarVar) {
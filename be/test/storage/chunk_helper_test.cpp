@@ -14,11 +14,14 @@
 
 #include "storage/chunk_helper.h"
 
+#include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "gtest/gtest.h"
+#include "util/defer_op.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/descriptors.h"
 #include "runtime/mem_tracker.h"
@@ -190,6 +193,7 @@ TEST_F(ChunkHelperTest, Accumulator) {
 class ChunkPipelineAccumulatorTest : public ::testing::Test {
 protected:
     ChunkPtr _generate_chunk(size_t rows, size_t cols, size_t reserve_size = 0);
+    ChunkPtr _generate_binary_chunk(size_t rows, size_t payload_bytes);
 };
 
 ChunkPtr ChunkPipelineAccumulatorTest::_generate_chunk(size_t rows, size_t cols, size_t reserve_size) {
@@ -201,6 +205,18 @@ ChunkPtr ChunkPipelineAccumulatorTest::_generate_chunk(size_t rows, size_t cols,
     return chunk;
 }
 
+ChunkPtr ChunkPipelineAccumulatorTest::_generate_binary_chunk(size_t rows, size_t payload_bytes) {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(Int8Column::create(rows), 0);
+    auto bin_col = BinaryColumn::create();
+    for (size_t i = 0; i + 1 < rows; i++) {
+        bin_col->append_string("x");
+    }
+    bin_col->append_string(std::string(std::max<size_t>(payload_bytes, 1), 'x'));
+    chunk->append_column(std::move(bin_col), 1);
+    return chunk;
+}
+
 TEST_F(ChunkPipelineAccumulatorTest, test_push) {
     ChunkPipelineAccumulator accumulator;
 
@@ -274,6 +290,50 @@ TEST_F(ChunkPipelineAccumulatorTest, test_push) {
     ASSERT_FALSE(accumulator.has_output());
 }
 
+TEST_F(ChunkPipelineAccumulatorTest, test_adaptive_target_bytes) {
+    int64_t saved_target_bytes = config::chunk_accumulate_target_bytes;
+    config::chunk_accumulate_target_bytes = 16 * 1024;
+    DeferOp defer([&]() { config::chunk_accumulate_target_bytes = saved_target_bytes; });
+
+    // 64 bytes per row, so the byte target caps a batch at 256 rows
+    ChunkPipelineAccumulator accumulator;
+    accumulator.push(_generate_chunk(128, 64));
+    ASSERT_FALSE(accumulator.has_output());
+    accumulator.push(_generate_chunk(128, 64));
+    ASSERT_TRUE(accumulator.has_output());
+    auto result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 256);
+
+    // narrow rows are far below the byte target and still accumulate to the row limit
+    accumulator.reset_state();
+    accumulator.push(_generate_chunk(3000, 1));
+    ASSERT_FALSE(accumulator.has_output());
+    accumulator.push(_generate_chunk(1000, 1));
+    ASSERT_TRUE(accumulator.has_output());
+    result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 4000);
+}
+
+TEST_F(ChunkPipelineAccumulatorTest, test_oversized_cell_does_not_shrink_batches) {
+    int64_t saved_target_bytes = config::chunk_accumulate_target_bytes;
+    config::chunk_accumulate_target_bytes = 64 * 1024;
+    DeferOp defer([&]() { config::chunk_accumulate_target_bytes = saved_target_bytes; });
+
+    ChunkPipelineAccumulator accumulator;
+    accumulator.push(_generate_binary_chunk(1000, 1));
+    ASSERT_FALSE(accumulator.has_output());
+    // one 40KB cell inflates only the average width of the chunk carrying it,
+    // so the batch size target must stay row-bound instead of collapsing
+    accumulator.push(_generate_binary_chunk(100, 40 * 1024));
+    ASSERT_FALSE(accumulator.has_output());
+    accumulator.push(_generate_binary_chunk(1000, 1));
+    ASSERT_FALSE(accumulator.has_output());
+    accumulator.finalize();
+    ASSERT_TRUE(accumulator.has_output());
+    auto result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 2100);
+}
+
 TEST_F(ChunkPipelineAccumulatorTest, test_owner_info) {
     constexpr size_t kDesiredSize = 4096;
 
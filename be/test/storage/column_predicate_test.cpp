@@ -1955,6 +1955,70 @@ TEST(ColumnPredicateTest, test_or) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, test_range) {
+    // int
+    {
+        std::unique_ptr<ColumnPredicate> p(
+                new_column_range_predicate(get_type_info(TYPE_INT), 0, Datum(100), Datum(200)));
+        ASSERT_NE(nullptr, p);
+        auto c = ChunkHelper::column_from_field_type(TYPE_INT, false);
+        c->append_datum(Datum(99));
+        c->append_datum(Datum(100));
+        c->append_datum(Datum(150));
+        c->append_datum(Datum(200));
+
+        ASSERT_EQ(PredicateType::kAnd, p->type());
+        ASSERT_TRUE(p->can_vectorized());
+        ASSERT_EQ(2u, p->values().size());
+        ASSERT_EQ(100, p->values()[0].get_int32());
+        ASSERT_EQ(200, p->values()[1].get_int32());
+
+        // ---------------------------------------------
+        // evaluate()
+        // ---------------------------------------------
+        std::vector<uint8_t> buff(4);
+        p->evaluate(c.get(), buff.data(), 0, 4);
+        ASSERT_EQ("0,1,1,0", to_string(buff));
+
+        // ---------------------------------------------
+        // evaluate_and()
+        // ---------------------------------------------
+        buff.assign(4, 1);
+        buff[1] = 0;
+        p->evaluate_and(c.get(), buff.data(), 0, 4);
+        ASSERT_EQ("0,0,1,0", to_string(buff));
+
+        // ---------------------------------------------
+        // evaluate_or()
+        // ---------------------------------------------
+        buff.assign(4, 0);
+        buff[0] = 1;
+        p->evaluate_or(c.get(), buff.data(), 0, 4);
+        ASSERT_EQ("1,1,1,0", to_string(buff));
+    }
+    // nullable int: null rows are never selected.
+    {
+        std::unique_ptr<ColumnPredicate> p(
+                new_column_range_predicate(get_type_info(TYPE_INT), 0, Datum(100), Datum(200)));
+        auto c = ChunkHelper::column_from_field_type(TYPE_INT, true);
+        c->append_datum(Datum(99));
+        c->append_datum(Datum(100));
+        c->append_datum(Datum(199));
+        (void)c->append_nulls(2);
+
+        std::vector<uint8_t> buff(5);
+        p->evaluate(c.get(), buff.data(), 0, 5);
+        ASSERT_EQ("0,1,1,0,0", to_string(buff));
+    }
+    // binary types do not support fusion.
+    {
+        std::unique_ptr<ColumnPredicate> p(
+                new_column_range_predicate(get_type_info(TYPE_VARCHAR), 0, Datum(Slice("a")), Datum(Slice("b"))));
+        ASSERT_EQ(nullptr, p);
+    }
+}
+
 #define ZMF(min, max) zone_map_filter(ZoneMapDetail(min, max))
 
 // NOLINTNEXTLINE
@@ -2023,6 +2087,14 @@ TEST(ColumnPredicateTest, zone_map_filter) {
     EXPECT_TRUE(not_in_90_100->ZMF(Datum(90), Datum(99)));
     EXPECT_TRUE(not_in_90_100->ZMF(Datum(80), Datum(89)));
     EXPECT_TRUE(not_in_90_100->ZMF(Datum(101), Datum(110)));
+
+    std::unique_ptr<ColumnPredicate> range_100_200(
+            new_column_range_predicate(get_type_info(TYPE_INT), 0, Datum(100), Datum(200)));
+    EXPECT_TRUE(range_100_200->ZMF(Datum(90), Datum(110)));
+    EXPECT_TRUE(range_100_200->ZMF(Datum(150), Datum(300)));
+    EXPECT_FALSE(range_100_200->ZMF(Datum(90), Datum(99)));
+    EXPECT_FALSE(range_100_200->ZMF(Datum(200), Datum(300)));
+    EXPECT_FALSE(range_100_200->ZMF(Datum(), Datum()));
 }
 
 // NOLINTNEXTLINE
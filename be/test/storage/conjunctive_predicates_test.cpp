@@ -169,6 +169,36 @@ TEST(ConjunctivePredicatesTest, test_evaluate) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST(ConjunctivePredicatesTest, test_evaluate_short_circuit) {
+    SchemaPtr schema(new Schema());
+    auto c0_field = std::make_shared<Field>(0, "c0", TYPE_INT, true);
+    schema->append(c0_field);
+
+    auto c0 = ChunkHelper::column_from_field(*c0_field);
+    constexpr int kNumRows = 512;
+    for (int i = 0; i < kNumRows; i++) {
+        c0->append_datum(Datum(i));
+    }
+
+    ChunkPtr chunk = std::make_shared<Chunk>(Columns{c0}, schema);
+
+    // c0 < 10 and c0 >= 5 and c0 != 7.
+    // The first predicate zeroes all the 64-row blocks but the first one,
+    // so the remaining predicates only evaluate the first block.
+    PredicatePtr p0(new_column_lt_predicate(get_type_info(TYPE_INT), 0, "10"));
+    PredicatePtr p1(new_column_ge_predicate(get_type_info(TYPE_INT), 0, "5"));
+    PredicatePtr p2(new_column_ne_predicate(get_type_info(TYPE_INT), 0, "7"));
+
+    ConjunctivePredicates conjuncts({p0.get(), p1.get(), p2.get()});
+
+    std::vector<uint8_t> selection(chunk->num_rows(), 0);
+    ASSERT_OK(conjuncts.evaluate(chunk.get(), selection.data()));
+    for (int i = 0; i < kNumRows; i++) {
+        EXPECT_EQ(i >= 5 && i < 10 && i != 7, selection[i] != 0) << "row=" << i;
+    }
+}
+
 // NOLINTNEXTLINE
 TEST(ConjunctivePredicatesTest, test_evaluate_and) {
     SchemaPtr schema(new Schema());
@@ -54,4 +54,38 @@ TEST(DelVector, testLoadSave) {
     ASSERT_EQ(dv2.cardinality(), dels.size());
 };
 
+// NOLINTNEXTLINE
+TEST(DelVector, testChainedVersionsShareContainers) {
+    DelVector dv;
+    dv.set_empty();
+    std::shared_ptr<DelVector> v1;
+    std::vector<uint32_t> dels1;
+    // enough rows to span multiple roaring containers
+    for (uint32_t i = 0; i < 300000; i += 3) {
+        dels1.push_back(i);
+    }
+    dv.add_dels_as_new_version(dels1, 1, &v1);
+    ASSERT_EQ(dels1.size(), v1->cardinality());
+
+    std::shared_ptr<DelVector> v2;
+    std::vector<uint32_t> dels2 = {1, 4, 7, 299998};
+    v1->add_dels_as_new_version(dels2, 2, &v2);
+    ASSERT_EQ(dels1.size() + dels2.size(), v2->cardinality());
+    // deriving v2 must not change v1
+    ASSERT_EQ(dels1.size(), v1->cardinality());
+    for (uint32_t d : dels2) {
+        ASSERT_FALSE(v1->roaring()->contains(d));
+        ASSERT_TRUE(v2->roaring()->contains(d));
+    }
+
+    // both versions still serialize and reload correctly with shared containers
+    std::string raw = v2->save();
+    DelVector reloaded;
+    ASSERT_TRUE(reloaded.load(2, raw.data(), raw.size()).ok());
+    ASSERT_EQ(v2->cardinality(), reloaded.cardinality());
+    raw = v1->save();
+    ASSERT_TRUE(reloaded.load(1, raw.data(), raw.size()).ok());
+    ASSERT_EQ(v1->cardinality(), reloaded.cardinality());
+};
+
 } // namespace starrocks
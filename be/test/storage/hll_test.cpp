@@ -167,7 +167,7 @@ TEST_F(TestHll, Normal) {
             for (int i = 100; i < 200; ++i) {
                 other_hll.update(hash(i));
             }
-            // this is converted to full
+            // this is converted to sparse
             other_hll.merge(new_explicit_hll);
             ASSERT_TRUE(other_hll.estimate_cardinality() > 190);
         }
@@ -193,6 +193,53 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, SparsePromotion) {
+    uint8_t buf[HLL_REGISTERS_COUNT + 1];
+
+    // stays in the sparse register map below HLL_SPARSE_PROMOTION_NUM registers
+    HyperLogLog sparse_hll;
+    for (int i = 0; i < 512; ++i) {
+        sparse_hll.update(hash(i));
+    }
+    ASSERT_LE(sparse_hll.max_serialized_size(), 1 + 4 + 3 * HLL_SPARSE_PROMOTION_NUM);
+    auto sparse_estimate = sparse_hll.estimate_cardinality();
+
+    HyperLogLog dense_hll;
+    for (int i = 0; i < 64 * 1024; ++i) {
+        dense_hll.update(hash(i));
+    }
+
+    // sparse merged with a dense superset promotes and matches the dense estimate
+    {
+        HyperLogLog merged(sparse_hll);
+        merged.merge(dense_hll);
+        ASSERT_EQ(dense_hll.estimate_cardinality(), merged.estimate_cardinality());
+    }
+    // and the same in the dense-absorbs-sparse direction
+    {
+        HyperLogLog merged(dense_hll);
+        merged.merge(sparse_hll);
+        ASSERT_EQ(dense_hll.estimate_cardinality(), merged.estimate_cardinality());
+    }
+
+    // both in-memory representations produce identical serialized bytes
+    size_t len = sparse_hll.serialize(buf);
+    HyperLogLog round_trip(Slice((char*)buf, len));
+    ASSERT_EQ(sparse_estimate, round_trip.estimate_cardinality());
+    uint8_t buf2[HLL_REGISTERS_COUNT + 1];
+    size_t len2 = round_trip.serialize(buf2);
+    ASSERT_EQ(len, len2);
+    ASSERT_EQ(0, memcmp(buf, buf2, len));
+
+    // clear releases the registers and the object can be reused
+    dense_hll.clear();
+    ASSERT_EQ(0, dense_hll.estimate_cardinality());
+    for (int i = 0; i < 512; ++i) {
+        dense_hll.update(hash(i));
+    }
+    ASSERT_EQ(sparse_estimate, dense_hll.estimate_cardinality());
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
@@ -92,6 +92,23 @@ TEST_F(LakeMetacacheTest, test_txn_log_cache) {
     ASSERT_TRUE(schema == nullptr);
 }
 
+TEST_F(LakeMetacacheTest, test_txn_log_negative_cache) {
+    auto* metacache = _tablet_mgr->metacache();
+
+    ASSERT_FALSE(metacache->lookup_txn_log_not_found("log3"));
+
+    metacache->cache_txn_log_not_found("log3");
+    ASSERT_TRUE(metacache->lookup_txn_log_not_found("log3"));
+    // a negative entry is not a txn log
+    ASSERT_TRUE(metacache->lookup_txn_log("log3") == nullptr);
+
+    // caching a real log on the same key replaces the negative entry
+    auto log = std::make_shared<TxnLogPB>();
+    metacache->cache_txn_log("log3", log);
+    ASSERT_FALSE(metacache->lookup_txn_log_not_found("log3"));
+    ASSERT_EQ(log.get(), metacache->lookup_txn_log("log3").get());
+}
+
 TEST_F(LakeMetacacheTest, test_tablet_schema_cache) {
     auto* metacache = _tablet_mgr->metacache();
 
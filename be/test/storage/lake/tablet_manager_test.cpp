@@ -26,12 +26,14 @@
 #include "storage/lake/fixed_location_provider.h"
 #include "storage/lake/join_path.h"
 #include "storage/lake/location_provider.h"
+#include "storage/lake/metacache.h"
 #include "storage/lake/update_manager.h"
 #include "storage/lake/versioned_tablet.h"
 #include "storage/options.h"
 #include "storage/tablet_schema.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
+#include "util/defer_op.h"
 #include "util/filesystem_util.h"
 
 // NOTE: intend to put the following header to the end of the include section
@@ -93,6 +95,28 @@ TEST_F(LakeTabletManagerTest, tablet_meta_write_and_read) {
     EXPECT_TRUE(res.status().is_not_found());
 }
 
+// NOLINTNEXTLINE
+TEST_F(LakeTabletManagerTest, tablet_meta_write_and_read_compressed) {
+    config::lake_compress_tablet_metadata = true;
+    DeferOp defer([]() { config::lake_compress_tablet_metadata = false; });
+    starrocks::lake::TabletMetadata metadata;
+    metadata.set_id(23456);
+    metadata.set_version(3);
+    auto rowset_meta_pb = metadata.add_rowsets();
+    rowset_meta_pb->set_id(2);
+    rowset_meta_pb->set_overlapped(false);
+    rowset_meta_pb->set_data_size(1024);
+    rowset_meta_pb->set_num_rows(5);
+    EXPECT_OK(_tablet_manager->put_tablet_metadata(metadata));
+    // drop the cached copy so the read goes through the on-disk compressed layout
+    _tablet_manager->metacache()->erase(_tablet_manager->tablet_metadata_location(23456, 3));
+    auto res = _tablet_manager->get_tablet_metadata(23456, 3);
+    EXPECT_TRUE(res.ok());
+    EXPECT_EQ(res.value()->id(), 23456);
+    EXPECT_EQ(res.value()->version(), 3);
+    EXPECT_EQ(res.value()->rowsets_size(), 1);
+}
+
 // NOLINTNEXTLINE
 TEST_F(LakeTabletManagerTest, txnlog_write_and_read) {
     starrocks::lake::TxnLog txnLog;
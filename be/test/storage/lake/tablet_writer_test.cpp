@@ -31,6 +31,7 @@
 #include "test_util.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
+#include "util/threadpool.h"
 
 namespace starrocks::lake {
 
@@ -142,6 +143,69 @@ TEST_P(LakeTabletWriterTest, test_write_success) {
     check_segment(seg1);
 }
 
+TEST_P(LakeTabletWriterTest, test_write_with_flush_pool) {
+    std::unique_ptr<ThreadPool> flush_pool;
+    ASSERT_OK(ThreadPoolBuilder("flush_segment").set_min_threads(1).set_max_threads(2).build(&flush_pool));
+
+    std::vector<int> k0{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22};
+    std::vector<int> v0{2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 41, 44};
+
+    auto c0 = Int32Column::create();
+    auto c1 = Int32Column::create();
+    c0->append_numbers(k0.data(), k0.size() * sizeof(int));
+    c1->append_numbers(v0.data(), v0.size() * sizeof(int));
+
+    Chunk chunk0({c0, c1}, _schema);
+    const int segment_rows = chunk0.num_rows();
+
+    VersionedTablet tablet(_tablet_mgr.get(), _tablet_metadata);
+    ASSIGN_OR_ABORT(auto writer, tablet.new_writer(kHorizontal, next_id(), 0, flush_pool.get()));
+    ASSERT_OK(writer->open());
+
+    // segment #1, finalized in the background while segment #2 is written
+    ASSERT_OK(writer->write(chunk0));
+    ASSERT_OK(writer->flush());
+
+    // segment #2
+    ASSERT_OK(writer->write(chunk0));
+    ASSERT_OK(writer->finish());
+
+    auto files = writer->files();
+    ASSERT_EQ(2, files.size());
+    ASSERT_NE(files[0].path, files[1].path);
+    ASSERT_GT(files[0].size.value(), 0);
+    ASSERT_GT(files[1].size.value(), 0);
+    ASSERT_EQ(2 * segment_rows, writer->num_rows());
+    ASSERT_EQ(files[0].size.value() + files[1].size.value(), writer->data_size());
+
+    writer->close();
+
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(kTestDirectory));
+    OlapReaderStatistics statistics;
+    SegmentReadOptions opts;
+    opts.fs = fs;
+    opts.tablet_id = _tablet_metadata->id();
+    opts.stats = &statistics;
+    opts.chunk_size = 1024;
+
+    for (int seg_id = 0; seg_id < 2; seg_id++) {
+        ASSIGN_OR_ABORT(auto segment,
+                        Segment::open(fs,
+                                      FileInfo{_tablet_mgr->segment_location(_tablet_metadata->id(),
+                                                                             files[seg_id].path)},
+                                      seg_id, _tablet_schema));
+        ASSIGN_OR_ABORT(auto seg_iter, segment->new_iterator(*_schema, opts));
+        auto read_chunk_ptr = ChunkHelper::new_chunk(*_schema, 1024);
+        ASSERT_OK(seg_iter->get_next(read_chunk_ptr.get()));
+        ASSERT_EQ(segment_rows, read_chunk_ptr->num_rows());
+        for (int i = 0, sz = k0.size(); i < sz; i++) {
+            EXPECT_EQ(k0[i], read_chunk_ptr->get(i)[0].get_int32());
+            EXPECT_EQ(v0[i], read_chunk_ptr->get(i)[1].get_int32());
+        }
+        seg_iter->close();
+    }
+}
+
 TEST_P(LakeTabletWriterTest, test_vertical_write_success) {
     std::vector<int> k0{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22};
     std::vector<int> v0{2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 41, 44};
@@ -184,4 +184,21 @@ TEST_F(StoragePageCacheTest, metrics) {
     ASSERT_EQ(cache.get_hit_count(), 2);
 }
 
+TEST_F(StoragePageCacheTest, group_stats_over_quota) {
+    PageCacheGroupStats stats;
+
+    // no quota configured means unlimited
+    stats.inserted_bytes = 4096;
+    ASSERT_FALSE(stats.over_quota());
+
+    stats.quota_bytes = 8192;
+    ASSERT_FALSE(stats.over_quota());
+    stats.inserted_bytes = 8193;
+    ASSERT_TRUE(stats.over_quota());
+
+    // decay restores the fill permission of a group that backed off
+    stats.inserted_bytes = stats.inserted_bytes.load() / 2;
+    ASSERT_FALSE(stats.over_quota());
+}
+
 } // namespace starrocks
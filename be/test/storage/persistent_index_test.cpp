@@ -1222,6 +1222,19 @@ TEST_P(PersistentIndexTest, test_flush_fixlen_to_immutable) {
     ASSERT_TRUE(fs::remove_all("./index.l1.1.1").ok());
 }
 
+TEST_P(PersistentIndexTest, test_estimate_nshard_with_skewed_inputs) {
+    const size_t total_usage = 16 * 1024 * 1024;
+    auto [nshard, npage_hint] = MutableIndex::estimate_nshard_and_npage(total_usage);
+    // balanced inputs keep the shard count unchanged
+    auto [balanced_nshard, balanced_npage] =
+            MutableIndex::estimate_nshard_and_npage(total_usage, total_usage / 32, 32);
+    ASSERT_EQ(nshard, balanced_nshard);
+    // an input shard 4x the average raises the shard count by 4x, with smaller pages
+    auto [skewed_nshard, skewed_npage] = MutableIndex::estimate_nshard_and_npage(total_usage, total_usage / 8, 32);
+    ASSERT_EQ(nshard * 4, skewed_nshard);
+    ASSERT_LT(skewed_npage, npage_hint);
+}
+
 TEST_P(PersistentIndexTest, test_flush_varlen_to_immutable) {
     const std::string kPersistentIndexDir = "./PersistentIndexTest_test_flush_varlen_to_immutable";
     ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString("posix://"));
@@ -0,0 +1,98 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/prefetch_iterator.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/column_pool.h"
+#include "column/fixed_length_column.h"
+#include "column/schema.h"
+#include "storage/chunk_helper.h"
+#include "util/threadpool.h"
+
+namespace starrocks {
+
+class PrefetchIteratorTest : public testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override { TEST_clear_all_columns_this_thread(); }
+
+    // return chunk with single column of type int32_t.
+    class IntIterator final : public ChunkIterator {
+    public:
+        explicit IntIterator(std::vector<int32_t> numbers) : ChunkIterator(schema()), _numbers(std::move(numbers)) {}
+
+        // 10 elements at most every time.
+        Status do_get_next(Chunk* chunk) override {
+            if (_idx >= _numbers.size()) {
+                return Status::EndOfFile("eof");
+            }
+            size_t n = std::min(10LU, _numbers.size() - _idx);
+            ColumnPtr c = chunk->get_column_by_index(0);
+            (void)c->append_numbers(_numbers.data() + _idx, n * sizeof(int32_t));
+            _idx += n;
+            return Status::OK();
+        }
+
+        void close() override {}
+
+        static Schema schema() {
+            FieldPtr f = std::make_shared<Field>(0, "c1", get_type_info(TYPE_INT), false);
+            return Schema(std::vector<FieldPtr>{f});
+        }
+
+    private:
+        size_t _idx = 0;
+        std::vector<int32_t> _numbers;
+    };
+};
+
+// NOLINTNEXTLINE
+TEST_F(PrefetchIteratorTest, prefetch_all) {
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_TRUE(ThreadPoolBuilder("prefetch_test").set_min_threads(0).set_max_threads(2).build(&pool).ok());
+
+    std::vector<int32_t> numbers;
+    for (int32_t i = 0; i < 95; i++) {
+        numbers.push_back(i);
+    }
+    auto iter = new_prefetch_iterator(std::make_shared<IntIterator>(numbers), pool.get());
+
+    std::vector<int32_t> fetched;
+    ChunkPtr chunk = ChunkHelper::new_chunk(iter->schema(), 10);
+    Status st;
+    while ((st = iter->get_next(chunk.get())).ok()) {
+        auto c = std::dynamic_pointer_cast<FixedLengthColumn<int32_t>>(chunk->get_column_by_index(0));
+        fetched.insert(fetched.end(), c->get_data().begin(), c->get_data().end());
+        chunk->reset();
+    }
+    ASSERT_TRUE(st.is_end_of_file());
+    ASSERT_EQ(numbers, fetched);
+    iter->close();
+    pool->shutdown();
+}
+
+// NOLINTNEXTLINE
+TEST_F(PrefetchIteratorTest, null_pool_returns_child) {
+    auto child = std::make_shared<IntIterator>(std::vector<int32_t>{1, 2, 3});
+    auto iter = new_prefetch_iterator(child, nullptr);
+    ASSERT_EQ(child.get(), iter.get());
+}
+
+} // namespace starrocks
@@ -299,4 +299,33 @@ TEST_F(BinaryDictPageTest, TestEncodingRatio) {
     test_with_large_data_size(slices);
 }
 
+// NOLINTNEXTLINE
+TEST_F(BinaryDictPageTest, TestDictSeedKeepsCodes) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    options.dict_page_size = 256 * 1024;
+    BinaryDictPageBuilder first_builder(options);
+    std::vector<Slice> slices{Slice("Individual"), Slice("Lifetime"), Slice("Objective")};
+    size_t count = first_builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size());
+    ASSERT_EQ(slices.size(), count);
+
+    auto seed = std::make_shared<std::vector<std::string>>(first_builder.dictionary_values());
+    ASSERT_EQ(3, seed->size());
+
+    // a builder seeded with the finished dictionary must assign the same codes
+    // to shared values and append new values after the seed
+    options.dict_seed = seed;
+    BinaryDictPageBuilder second_builder(options);
+    std::vector<Slice> more{Slice("Objective"), Slice("Value")};
+    count = second_builder.add(reinterpret_cast<const uint8_t*>(more.data()), more.size());
+    ASSERT_EQ(more.size(), count);
+
+    auto values = second_builder.dictionary_values();
+    ASSERT_EQ(4, values.size());
+    EXPECT_EQ((*seed)[0], values[0]);
+    EXPECT_EQ((*seed)[1], values[1]);
+    EXPECT_EQ((*seed)[2], values[2]);
+    EXPECT_EQ("Value", values[3]);
+}
+
 } // namespace starrocks
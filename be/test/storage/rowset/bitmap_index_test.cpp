@@ -187,6 +187,56 @@ TEST_F(BitmapIndexTest, test_invert_2) {
     delete[] val;
 }
 
+TEST_F(BitmapIndexTest, test_union_range_across_pages) {
+    size_t num_rows = 1024 * 64;
+    auto* val = new int64_t[num_rows];
+    for (int i = 0; i < num_rows; ++i) {
+        val[i] = i;
+    }
+
+    std::string file_name = kTestDir + "/union_range";
+    ColumnIndexMetaPB meta;
+    write_index_file<TYPE_BIGINT>(file_name, val, num_rows, 0, &meta);
+    {
+        BitmapIndexReader* reader = nullptr;
+        BitmapIndexIterator* iter = nullptr;
+        ASSIGN_OR_ABORT(auto rfile, _fs->new_random_access_file(file_name));
+        get_bitmap_reader_iter(rfile.get(), meta, &reader, &iter);
+
+        // A wide range whose bitmaps span multiple bitmap-column pages, read in one batch.
+        Roaring bitmap;
+        ASSERT_OK(iter->read_union_bitmap(100, 1024 * 40, &bitmap));
+        ASSERT_EQ(1024 * 40 - 100, bitmap.cardinality());
+        ASSERT_FALSE(bitmap.contains(99));
+        ASSERT_TRUE(bitmap.contains(100));
+        ASSERT_TRUE(bitmap.contains(1024 * 40 - 1));
+        ASSERT_FALSE(bitmap.contains(1024 * 40));
+
+        // The batched result must match unioning the bitmaps one by one.
+        Roaring expected;
+        for (rowid_t ord = 100; ord < 200; ord++) {
+            Roaring one;
+            ASSERT_OK(iter->read_bitmap(ord, &one));
+            expected |= one;
+        }
+        Roaring batched;
+        ASSERT_OK(iter->read_union_bitmap(100, 200, &batched));
+        ASSERT_TRUE(expected == batched);
+
+        // Empty and single-ordinal ranges.
+        Roaring empty;
+        ASSERT_OK(iter->read_union_bitmap(10, 10, &empty));
+        ASSERT_EQ(0, empty.cardinality());
+        Roaring single;
+        ASSERT_OK(iter->read_union_bitmap(10, 11, &single));
+        ASSERT_TRUE(Roaring::bitmapOf(1, 10) == single);
+
+        delete reader;
+        delete iter;
+    }
+    delete[] val;
+}
+
 TEST_F(BitmapIndexTest, test_multi_pages) {
     size_t num_uint8_rows = 1024 * 1024;
     auto* val = new int64_t[num_uint8_rows];
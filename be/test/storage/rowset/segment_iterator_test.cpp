@@ -34,6 +34,7 @@
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -526,4 +527,74 @@ TEST_F(SegmentIteratorTest, TestGlobalDictNoLocalDict) {
     res_chunk->reset();
 }
 
+// NOLINTNEXTLINE
+TEST_F(SegmentIteratorTest, TestRowRangeCache) {
+    using namespace starrocks::test;
+
+    config::enable_segment_row_range_cache = true;
+    DeferOp defer([]() { config::enable_segment_row_range_cache = false; });
+
+    std::string file_name = kSegmentDir + "/row_range_cache";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+    TabletSchemaBuilder builder;
+    std::shared_ptr<TabletSchema> tablet_schema = builder.create(1, false, TYPE_INT, true).build();
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+
+    const int32_t chunk_size = config::vector_chunk_size;
+    const size_t num_rows = 10000;
+
+    auto i32_provider = [](int32_t i) { return i; };
+    TabletDataBuilder segment_data_builder(writer, tablet_schema, chunk_size, num_rows);
+    ASSERT_OK(segment_data_builder.append(0, i32_provider));
+    ASSERT_OK(segment_data_builder.finalize_footer());
+
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    VecSchemaBuilder schema_builder;
+    schema_builder.add(0, "c0", TYPE_INT);
+    auto vec_schema = schema_builder.build();
+
+    // The first scan populates the cache, the second one reuses the pruned row ranges.
+    auto scan = [&](const std::string& lower_bound) {
+        OlapReaderStatistics stats;
+        SegmentReadOptions seg_opts;
+        seg_opts.fs = _fs;
+        seg_opts.stats = &stats;
+
+        std::unique_ptr<ColumnPredicate> predicate(
+                new_column_ge_predicate(get_type_info(TYPE_INT), 0, lower_bound.c_str()));
+        seg_opts.predicates[0].push_back(predicate.get());
+        seg_opts.predicates_for_zone_map[0].push_back(predicate.get());
+
+        ColumnIdToGlobalDictMap empty_dict_map;
+        auto chunk_iter = new_segment_iterator(segment, vec_schema, seg_opts);
+        ASSERT_OK(chunk_iter->init_encoded_schema(empty_dict_map));
+        ASSERT_OK(chunk_iter->init_output_schema(std::unordered_set<uint32_t>()));
+
+        size_t count = 0;
+        auto res_chunk = ChunkHelper::new_chunk(chunk_iter->output_schema(), chunk_size);
+        while (true) {
+            res_chunk->reset();
+            auto st = chunk_iter->get_next(res_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (size_t i = 0; i < res_chunk->num_rows(); ++i) {
+                ASSERT_GE(res_chunk->get(i)[0].get_int32(), std::stoi(lower_bound));
+            }
+            count += res_chunk->num_rows();
+        }
+        ASSERT_EQ(num_rows - std::stoi(lower_bound), count);
+    };
+
+    scan("9990");
+    scan("9990");
+    // A different predicate shape must not collide with the cached entry.
+    scan("100");
+}
+
 } // namespace starrocks
@@ -40,6 +40,7 @@
 #include <iostream>
 
 #include "column/datum_tuple.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "fs/fs_memory.h"
 #include "gutil/strings/substitute.h"
@@ -55,6 +56,8 @@
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
+#include "types/hll.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -163,6 +166,33 @@ TEST_F(SegmentReaderWriterTest, estimate_segment_size) {
     ASSERT_NE(segment_size, 0);
 }
 
+TEST_F(SegmentReaderWriterTest, TestNdvSketch) {
+    config::enable_segment_ndv_sketch = true;
+    DeferOp defer([]() { config::enable_segment_ndv_sketch = false; });
+
+    std::shared_ptr<TabletSchema> schema =
+            TabletSchemaHelper::create_tablet_schema({create_int_key_pb(1), create_int_value_pb(2)});
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 1024;
+    shared_ptr<Segment> segment;
+    size_t nrows = 10000;
+    build_segment(opts, schema, schema, nrows, DefaultIntGenerator, &segment);
+
+    for (int cid = 0; cid < schema->num_columns(); ++cid) {
+        const ColumnReader* col_reader = segment->column(cid);
+        ASSERT_TRUE(col_reader != nullptr);
+        ASSERT_TRUE(col_reader->ndv_hll() != nullptr);
+
+        HyperLogLog hll;
+        ASSERT_TRUE(hll.deserialize(Slice(*col_reader->ndv_hll())));
+        // every row produces a distinct value, allow the usual hll estimation error.
+        int64_t ndv = hll.estimate_cardinality();
+        ASSERT_GT(ndv, nrows * 0.9);
+        ASSERT_LT(ndv, nrows * 1.1);
+    }
+}
+
 TEST_F(SegmentReaderWriterTest, TestBloomFilterIndexUniqueModel) {
     std::shared_ptr<TabletSchema> schema =
             TabletSchemaHelper::create_tablet_schema({create_int_key_pb(1), create_int_key_pb(2), create_int_key_pb(3),
@@ -271,6 +301,110 @@ TEST_F(SegmentReaderWriterTest, TestHorizontalWrite) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(SegmentReaderWriterTest, TestLocalIOCoalesce) {
+    config::io_coalesce_local_read_enable = true;
+    DeferOp defer([]() { config::io_coalesce_local_read_enable = false; });
+
+    std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
+            {create_int_key_pb(1), create_int_key_pb(2), create_int_value_pb(3), create_int_value_pb(4)});
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+
+    const size_t num_rows = 10000;
+    shared_ptr<Segment> segment;
+    build_segment(opts, tablet_schema, tablet_schema, num_rows, DefaultIntGenerator, &segment);
+
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    SegmentReadOptions seg_options;
+    seg_options.fs = _fs;
+    OlapReaderStatistics stats;
+    seg_options.stats = &stats;
+    ASSIGN_OR_ABORT(auto seg_iterator, segment->new_iterator(schema, seg_options));
+
+    auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+    size_t count = 0;
+    while (true) {
+        chunk->reset();
+        auto st = seg_iterator->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (auto i = 0; i < chunk->num_rows(); ++i) {
+            for (int cid = 0; cid < 4; ++cid) {
+                EXPECT_EQ(count * 10 + cid, chunk->get(i)[cid].get_int32());
+            }
+            ++count;
+        }
+    }
+    EXPECT_EQ(count, num_rows);
+}
+
+// NOLINTNEXTLINE
+TEST_F(SegmentReaderWriterTest, TestIOCoalesceIndexRanges) {
+    config::io_coalesce_local_read_enable = true;
+    DeferOp defer([]() { config::io_coalesce_local_read_enable = false; });
+
+    std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
+            {create_int_key_pb(1), create_int_key_pb(2), create_int_value_pb(3), create_int_value_pb(4)});
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+
+    const size_t num_rows = 10000;
+    shared_ptr<Segment> segment;
+    build_segment(opts, tablet_schema, tablet_schema, num_rows, DefaultIntGenerator, &segment);
+
+    // before any index is loaded, each column's index root pages are collectable
+    // and the collected ranges do not overlap.
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    for (size_t cid = 0; cid < 4; ++cid) {
+        segment->column(cid)->collect_index_io_ranges(true, &ranges);
+    }
+    ASSERT_GE(ranges.size(), 4);
+    std::sort(ranges.begin(), ranges.end());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        ASSERT_GT(ranges[i].size, 0);
+        if (i > 0) {
+            ASSERT_GE(ranges[i].offset, ranges[i - 1].offset + ranges[i - 1].size);
+        }
+    }
+
+    // the ordinal index loads in iterator init now go through the shared stream.
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    SegmentReadOptions seg_options;
+    seg_options.fs = _fs;
+    OlapReaderStatistics stats;
+    seg_options.stats = &stats;
+    ASSIGN_OR_ABORT(auto seg_iterator, segment->new_iterator(schema, seg_options));
+
+    auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+    size_t count = 0;
+    while (true) {
+        chunk->reset();
+        auto st = seg_iterator->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (auto i = 0; i < chunk->num_rows(); ++i) {
+            for (int cid = 0; cid < 4; ++cid) {
+                EXPECT_EQ(count * 10 + cid, chunk->get(i)[cid].get_int32());
+            }
+            ++count;
+        }
+    }
+    EXPECT_EQ(count, num_rows);
+
+    // after the read every ordinal index has been loaded, so there is nothing
+    // left to collect.
+    std::vector<io::SharedBufferedInputStream::IORange> loaded_ranges;
+    for (size_t cid = 0; cid < 4; ++cid) {
+        segment->column(cid)->collect_index_io_ranges(false, &loaded_ranges);
+    }
+    ASSERT_TRUE(loaded_ranges.empty());
+}
+
 // NOLINTNEXTLINE
 TEST_F(SegmentReaderWriterTest, TestVerticalWrite) {
     std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
@@ -347,6 +347,58 @@ TEST_F(ColumnZoneMapTest, NormalTestIntPage) {
     check_result(zone_maps[2], false, false, "", "", true, false);
 }
 
+// Test the fixed-granularity block zone maps written next to the page zone maps
+TEST_F(ColumnZoneMapTest, BlockZoneMap) {
+    std::string filename = kTestDir + "/BlockZoneMap";
+
+    TabletColumn int_column = create_int_key(0);
+    TypeInfoPtr type_info = get_type_info(int_column);
+
+    // page zone maps, one page covering everything
+    auto page_builder = ZoneMapIndexWriter::create(type_info.get());
+    // block zone maps at a granularity of 4 rows
+    auto block_builder = ZoneMapIndexWriter::create(type_info.get());
+
+    std::vector<int> values = {1, 10, 11, 20, 21, 22, 30, 31, 40, 41, 50, 51};
+    page_builder->add_values(values.data(), values.size());
+    ASSERT_OK(page_builder->flush());
+    for (size_t i = 0; i < values.size(); i += 4) {
+        block_builder->add_values(values.data() + i, 4);
+        ASSERT_OK(block_builder->flush());
+    }
+
+    ColumnIndexMetaPB index_meta;
+    {
+        ASSIGN_OR_ABORT(auto file, _fs->new_writable_file(filename))
+        ASSERT_OK(page_builder->finish(file.get(), &index_meta));
+        ASSERT_OK(block_builder->finish_block_index(file.get(), index_meta.mutable_zone_map_index(), 4));
+        ASSERT_OK(file->close());
+    }
+    ASSERT_TRUE(index_meta.zone_map_index().has_block_zone_maps());
+    ASSERT_EQ(4, index_meta.zone_map_index().block_zone_map_granularity());
+
+    IndexReadOptions opts;
+    ASSIGN_OR_ABORT(auto rfile, _fs->new_random_access_file(filename))
+    opts.read_file = rfile.get();
+    opts.use_page_cache = false;
+    opts.kept_in_memory = false;
+    OlapReaderStatistics stats;
+    opts.stats = &stats;
+
+    ZoneMapIndexReader block_reader;
+    ASSERT_TRUE(block_reader.load(opts, index_meta.zone_map_index().block_zone_maps()).value());
+    ASSERT_EQ(3, block_reader.num_pages());
+    const auto& block_zone_maps = block_reader.page_zone_maps();
+    check_result(block_zone_maps[0], true, true, "1", "20", false, true);
+    check_result(block_zone_maps[1], true, true, "21", "31", false, true);
+    check_result(block_zone_maps[2], true, true, "40", "51", false, true);
+
+    ZoneMapIndexReader page_reader;
+    ASSERT_TRUE(page_reader.load(opts, index_meta.zone_map_index()).value());
+    ASSERT_EQ(1, page_reader.num_pages());
+    check_result(page_reader.page_zone_maps()[0], true, true, "1", "51", false, true);
+}
+
 // Test for string
 TEST_F(ColumnZoneMapTest, NormalTestVarcharPage) {
     TabletColumn varchar_column = create_varchar_key(0);
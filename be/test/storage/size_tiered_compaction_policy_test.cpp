@@ -1583,4 +1583,42 @@ TEST_F(SizeTieredCompactionPolicyTest, test_one_delete_shortcut_compaction) {
     }
 }
 
+TEST_F(SizeTieredCompactionPolicyTest, test_delete_below_data_shortcut_compaction) {
+    LOG(INFO) << "test_delete_below_data_shortcut_compaction";
+    create_tablet_schema(UNIQUE_KEYS);
+
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(tablet_meta, starrocks::StorageEngine::instance()->get_stores()[0]);
+    ASSERT_OK(tablet->init());
+    init_compaction_context(tablet);
+
+    write_empty_version(tablet);
+    write_empty_version(tablet);
+    write_delete_version(tablet, 2);
+    _version += 1;
+    write_specify_version(tablet, 3);
+    _version += 1;
+
+    ASSERT_EQ(4, tablet->version_count());
+
+    {
+        // the delete version sits below the only data version, so its predicate cannot filter
+        // any input rows and the data rowset can be hard linked.
+        auto is_shortcut_compaction = false;
+        auto res = base_compact(tablet, &is_shortcut_compaction);
+        ASSERT_TRUE(res.ok());
+        ASSERT_TRUE(is_shortcut_compaction);
+
+        ASSERT_EQ(1, tablet->version_count());
+        std::vector<Version> versions;
+        tablet->list_versions(&versions);
+        ASSERT_EQ(1, versions.size());
+        ASSERT_EQ(0, versions[0].first);
+        ASSERT_EQ(3, versions[0].second);
+    }
+}
+
 } // namespace starrocks
@@ -1187,4 +1187,26 @@ TEST(BitmapValueTest1, Roaring64Map) {
     ASSERT_EQ(r1_sum, sum);
 }
 
+TEST_F(BitmapValueTest, fastunion) {
+    BitmapValue b1 = gen_bitmap(0, 64);
+    BitmapValue b2 = gen_bitmap(32, 128);
+    BitmapValue b3 = gen_bitmap(100, 200);
+
+    // bitmaps only
+    BitmapValue united = BitmapValue::fastunion({&b1, &b2, &b3});
+    check_bitmap(BitmapDataType::BITMAP, united, 0, 200);
+
+    // mixed with single, set and empty inputs
+    united = BitmapValue::fastunion({&b1, &_single_bitmap, &_medium_bitmap, &_empty_bitmap});
+    check_bitmap(BitmapDataType::BITMAP, united, 0, 64);
+
+    // no bitmap inputs at all
+    united = BitmapValue::fastunion({&_single_bitmap, &_medium_bitmap, &_empty_bitmap});
+    check_bitmap(BitmapDataType::SET, united, 0, 14);
+
+    // empty input list
+    united = BitmapValue::fastunion({});
+    check_bitmap(BitmapDataType::EMPTY, united, 0, 0);
+}
+
 } // namespace starrocks
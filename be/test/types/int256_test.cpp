@@ -0,0 +1,116 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "types/int256.h"
+
+#include <gtest/gtest.h>
+
+#include "runtime/integer_overflow_arithmetics.h"
+
+namespace starrocks {
+
+TEST(Int256Test, test_construction_and_compare) {
+    ASSERT_EQ(int256_t(0), int256_t(0));
+    ASSERT_NE(int256_t(0), int256_t(1));
+    ASSERT_LT(int256_t(-1), int256_t(0));
+    ASSERT_LT(int256_t(-2), int256_t(-1));
+    ASSERT_GT(int256_t(1), int256_t(-1));
+    ASSERT_LT(int256_t::min_value(), int256_t::max_value());
+    ASSERT_LT(int256_t::min_value(), int256_t(-1));
+    ASSERT_GT(int256_t::max_value(), int256_t(1));
+
+    int256_t negative(static_cast<int64_t>(-5));
+    ASSERT_TRUE(negative.is_negative());
+    ASSERT_EQ(int256_t(0) - int256_t(5), negative);
+}
+
+TEST(Int256Test, test_add_sub_carry_across_limbs) {
+    // all-ones low half + 1 carries into the high half.
+    int256_t v(0, ~static_cast<uint128_t>(0));
+    int256_t r = v + int256_t(1);
+    ASSERT_EQ(int256_t(1, 0), r);
+    ASSERT_EQ(v, r - int256_t(1));
+
+    // 2^128 * 3 == 2^128 + 2^128 + 2^128.
+    int256_t two_pow_128(1, 0);
+    ASSERT_EQ(int256_t(3, 0), two_pow_128 + two_pow_128 + two_pow_128);
+
+    ASSERT_EQ(int256_t(-1), int256_t(0) - int256_t(1));
+    ASSERT_EQ(int256_t(0), int256_t(-1) + int256_t(1));
+}
+
+TEST(Int256Test, test_negate) {
+    ASSERT_EQ(int256_t(0), -int256_t(0));
+    ASSERT_EQ(int256_t(-7), -int256_t(7));
+    ASSERT_EQ(int256_t(7), -int256_t(-7));
+    // -(-2^255) wraps to itself, like -INT64_MIN does.
+    ASSERT_EQ(int256_t::min_value(), -int256_t::min_value());
+}
+
+TEST(Int256Test, test_multiply) {
+    ASSERT_EQ(int256_t(0), int256_t(12345) * int256_t(0));
+    ASSERT_EQ(int256_t(35), int256_t(5) * int256_t(7));
+    ASSERT_EQ(int256_t(-35), int256_t(-5) * int256_t(7));
+    ASSERT_EQ(int256_t(35), int256_t(-5) * int256_t(-7));
+
+    // (2^64)^2 == 2^128 crosses the 128-bit boundary.
+    int256_t two_pow_64(static_cast<uint128_t>(1) << 64);
+    ASSERT_EQ(int256_t(1, 0), two_pow_64 * two_pow_64);
+
+    // 10^38 (beyond DECIMAL128 range) squared is representable in 256 bits.
+    int256_t pow10_38 = int256_t(static_cast<uint128_t>(10000000000000000000ULL) * 10000000000000000000ULL);
+    int256_t product = pow10_38 * pow10_38;
+    ASSERT_EQ("10000000000000000000000000000000000000000000000000000000000000000000000000000",
+              product.to_string());
+}
+
+TEST(Int256Test, test_overflow_checked_arithmetics) {
+    int256_t result;
+    ASSERT_FALSE(add_overflow(int256_t(1), int256_t(2), &result));
+    ASSERT_EQ(int256_t(3), result);
+    ASSERT_TRUE(add_overflow(int256_t::max_value(), int256_t(1), &result));
+    ASSERT_FALSE(add_overflow(int256_t::max_value(), int256_t(-1), &result));
+    ASSERT_TRUE(add_overflow(int256_t::min_value(), int256_t(-1), &result));
+
+    ASSERT_FALSE(sub_overflow(int256_t(1), int256_t(2), &result));
+    ASSERT_EQ(int256_t(-1), result);
+    ASSERT_TRUE(sub_overflow(int256_t::min_value(), int256_t(1), &result));
+    ASSERT_TRUE(sub_overflow(int256_t::max_value(), int256_t(-1), &result));
+
+    ASSERT_FALSE(mul_overflow(int256_t(1000), int256_t(-1000), &result));
+    ASSERT_EQ(int256_t(-1000000), result);
+    // 2^128 * 2^128 does not fit.
+    ASSERT_TRUE(mul_overflow(int256_t(1, 0), int256_t(1, 0), &result));
+    // 2^127 * 2^127 == 2^254 still fits.
+    int256_t two_pow_127(static_cast<int128_t>(0), static_cast<uint128_t>(1) << 127);
+    ASSERT_FALSE(mul_overflow(two_pow_127, two_pow_127, &result));
+    // 2^127 * 2^128 == 2^255 only fits when negative.
+    ASSERT_TRUE(mul_overflow(two_pow_127, int256_t(1, 0), &result));
+    ASSERT_FALSE(mul_overflow(-two_pow_127, int256_t(1, 0), &result));
+    ASSERT_EQ(int256_t::min_value(), result);
+}
+
+TEST(Int256Test, test_to_string) {
+    ASSERT_EQ("0", int256_t(0).to_string());
+    ASSERT_EQ("1", int256_t(1).to_string());
+    ASSERT_EQ("-1", int256_t(-1).to_string());
+    ASSERT_EQ("123456789012345678", int256_t(static_cast<int64_t>(123456789012345678LL)).to_string());
+    ASSERT_EQ("340282366920938463463374607431768211456", int256_t(1, 0).to_string()); // 2^128
+    ASSERT_EQ("57896044618658097711785492504343953926634992332820282019728792003956564819967",
+              int256_t::max_value().to_string());
+    ASSERT_EQ("-57896044618658097711785492504343953926634992332820282019728792003956564819968",
+              int256_t::min_value().to_string());
+}
+
+} // namespace starrocks
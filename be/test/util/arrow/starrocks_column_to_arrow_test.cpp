@@ -836,4 +836,57 @@ TEST_F(StarRocksColumnToArrowTest, testNestedArrayStructMap) {
     ASSERT_TRUE(expect_array->Equals(array));
 }
 
+TEST_F(StarRocksColumnToArrowTest, testZeroCopyBuffers) {
+    // fixed-length and string columns share their buffers with the arrow arrays
+    // instead of being copied through a builder
+    auto chunk = std::make_shared<Chunk>();
+    auto int_column = Int64Column::create();
+    for (int64_t i = 0; i < 100; ++i) {
+        int_column->append(i);
+    }
+    auto string_column = BinaryColumn::create();
+    auto null_column = NullColumn::create();
+    for (int i = 0; i < 100; ++i) {
+        if (i % 7 == 0) {
+            string_column->append_default();
+            null_column->append(DATUM_NULL);
+        } else {
+            string_column->append(Slice(std::to_string(i)));
+            null_column->append(DATUM_NOT_NULL);
+        }
+    }
+    auto nullable_string_column = NullableColumn::create(string_column, null_column);
+    chunk->append_column(int_column, SlotId(0));
+    chunk->append_column(nullable_string_column, SlotId(1));
+
+    TypeDescriptor int_type_desc(TYPE_BIGINT);
+    auto varchar_type_desc = TypeDescriptor::create_varchar_type(100);
+    std::vector<const TypeDescriptor*> slot_types{&int_type_desc, &varchar_type_desc};
+    std::vector<SlotId> slot_ids{SlotId(0), SlotId(1)};
+    auto arrow_schema = arrow::schema({arrow::field("c0", arrow::int64()), arrow::field("c1", arrow::utf8())});
+    auto memory_pool = arrow::MemoryPool::CreateDefault();
+    std::shared_ptr<arrow::RecordBatch> result;
+    convert_chunk_to_arrow_batch(chunk.get(), slot_types, slot_ids, arrow_schema, memory_pool.get(), &result);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(2, result->num_columns());
+
+    auto* int_array = down_cast<arrow::Int64Array*>(result->column(0).get());
+    ASSERT_EQ(100, int_array->length());
+    ASSERT_EQ(reinterpret_cast<const uint8_t*>(int_column->get_data().data()), int_array->values()->data());
+    auto* string_array = down_cast<arrow::StringArray*>(result->column(1).get());
+    ASSERT_EQ(100, string_array->length());
+    ASSERT_EQ(reinterpret_cast<const uint8_t*>(string_column->get_offset().data()),
+              string_array->value_offsets()->data());
+    ASSERT_EQ(string_column->get_bytes().data(), string_array->value_data()->data());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i, int_array->Value(i));
+        if (i % 7 == 0) {
+            ASSERT_FALSE(string_array->IsValid(i));
+        } else {
+            ASSERT_TRUE(string_array->IsValid(i));
+            ASSERT_EQ(std::to_string(i), string_array->GetString(i));
+        }
+    }
+}
+
 } // namespace starrocks
@@ -70,4 +70,22 @@ TEST(CRC, Extend) {
     ASSERT_EQ(Value("hello world", 11), Value(slices));
 }
 
+TEST(CRC, LargeBuffer) {
+    // Buffers above the interleaving threshold must produce the same crc as the
+    // byte-at-a-time incremental path, for any split point and initial crc.
+    std::vector<char> buf(64 * 1024 + 13);
+    for (size_t i = 0; i < buf.size(); i++) {
+        buf[i] = static_cast<char>(i * 131 + 7);
+    }
+    uint32_t incremental = 0;
+    for (char c : buf) {
+        incremental = Extend(incremental, &c, 1);
+    }
+    ASSERT_EQ(incremental, Value(buf.data(), buf.size()));
+
+    for (size_t split : {size_t(1), size_t(4095), size_t(8192), buf.size() - 1}) {
+        ASSERT_EQ(incremental, Extend(Value(buf.data(), split), buf.data() + split, buf.size() - split));
+    }
+}
+
 } // namespace starrocks::crc32c
@@ -0,0 +1,42 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/hash_util.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace starrocks {
+
+// zlib_crc_hash_fixed must produce exactly the same result as zlib_crc_hash,
+// the data distribution of bucketed tables depends on it.
+TEST(HashUtilTest, zlib_crc_hash_fixed_matches_zlib) {
+    std::mt19937_64 rng(0x5a5a5a5a);
+    uint8_t buf[16];
+    for (int iter = 0; iter < 1000; iter++) {
+        for (auto& b : buf) {
+            b = static_cast<uint8_t>(rng());
+        }
+        auto seed = static_cast<uint32_t>(rng());
+        EXPECT_EQ(HashUtil::zlib_crc_hash(buf, 1, seed), HashUtil::zlib_crc_hash_fixed<1>(buf, seed));
+        EXPECT_EQ(HashUtil::zlib_crc_hash(buf, 2, seed), HashUtil::zlib_crc_hash_fixed<2>(buf, seed));
+        EXPECT_EQ(HashUtil::zlib_crc_hash(buf, 4, seed), HashUtil::zlib_crc_hash_fixed<4>(buf, seed));
+        EXPECT_EQ(HashUtil::zlib_crc_hash(buf, 8, seed), HashUtil::zlib_crc_hash_fixed<8>(buf, seed));
+        EXPECT_EQ(HashUtil::zlib_crc_hash(buf, 12, seed), HashUtil::zlib_crc_hash_fixed<12>(buf, seed));
+        EXPECT_EQ(HashUtil::zlib_crc_hash(buf, 16, seed), HashUtil::zlib_crc_hash_fixed<16>(buf, seed));
+    }
+}
+
+} // namespace starrocks
@@ -239,6 +239,16 @@ static void insert_LRUCache(LRUCache& cache, const CacheKey& key, int value, Cac
     cache.release(cache.insert(key, hash, EncodeValue(value), value, &deleter, priority));
 }
 
+static bool lookup_LRUCache(LRUCache& cache, const CacheKey& key) {
+    uint32_t hash = key.hash(key.data(), key.size(), 0);
+    Cache::Handle* handle = cache.lookup(key, hash);
+    if (handle == nullptr) {
+        return false;
+    }
+    cache.release(handle);
+    return true;
+}
+
 TEST_F(CacheTest, Usage) {
     LRUCache cache;
     cache.set_capacity(1000);
@@ -272,6 +282,47 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(950, cache.get_usage());
 }
 
+TEST_F(CacheTest, SegmentedEvictionIsScanResistant) {
+    LRUCache cache;
+    cache.set_capacity(10);
+
+    // a second reference promotes the entry to the protected segment
+    CacheKey hot("hot");
+    insert_LRUCache(cache, hot, 2, CachePriority::NORMAL);
+    ASSERT_TRUE(lookup_LRUCache(cache, hot));
+
+    // a scan of one-hit entries larger than the cache stays in the probation
+    // segment and cannot evict the promoted entry
+    for (int i = 0; i < 20; i++) {
+        insert_LRUCache(cache, CacheKey(std::to_string(i)), 1, CachePriority::NORMAL);
+    }
+    ASSERT_FALSE(lookup_LRUCache(cache, CacheKey("0")));
+    ASSERT_TRUE(lookup_LRUCache(cache, hot));
+}
+
+TEST_F(CacheTest, ProtectedSegmentOverflowDemotes) {
+    LRUCache cache;
+    cache.set_capacity(10); // the protected segment may use at most 8
+
+    CacheKey key1("100");
+    CacheKey key2("200");
+    CacheKey key3("300");
+    insert_LRUCache(cache, key1, 3, CachePriority::NORMAL);
+    ASSERT_TRUE(lookup_LRUCache(cache, key1));
+    insert_LRUCache(cache, key2, 3, CachePriority::NORMAL);
+    ASSERT_TRUE(lookup_LRUCache(cache, key2));
+    // promoting key3 overflows the protected segment and demotes key1, the
+    // oldest protected entry, back to the probation segment
+    insert_LRUCache(cache, key3, 3, CachePriority::NORMAL);
+    ASSERT_TRUE(lookup_LRUCache(cache, key3));
+
+    // the demoted entry is the first one evicted under capacity pressure
+    insert_LRUCache(cache, CacheKey("400"), 3, CachePriority::NORMAL);
+    ASSERT_FALSE(lookup_LRUCache(cache, key1));
+    ASSERT_TRUE(lookup_LRUCache(cache, key2));
+    ASSERT_TRUE(lookup_LRUCache(cache, key3));
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
@@ -581,4 +581,41 @@ TEST(TestRuntimeProfile, testUpdateWithOldAndNewProfile) {
     ASSERT_EQ(2, child_profile->get_version());
 }
 
+TEST(TestRuntimeProfile, testCoreLocalCounter) {
+    auto profile = std::make_shared<RuntimeProfile>("profile");
+    auto* counter = profile->AddCoreLocalCounter("counter", TUnit::UNIT, create_strategy(TUnit::UNIT));
+    ASSERT_EQ(0, counter->value());
+
+    COUNTER_UPDATE(counter, 3);
+    COUNTER_UPDATE(counter, 4);
+    ASSERT_EQ(7, counter->value());
+
+    // concurrent updates from many threads must not lose increments
+    constexpr int num_threads = 8;
+    constexpr int updates_per_thread = 10000;
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int i = 0; i < num_threads; i++) {
+        threads.emplace_back([counter]() {
+            for (int j = 0; j < updates_per_thread; j++) {
+                counter->update(1);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    ASSERT_EQ(7 + num_threads * updates_per_thread, counter->value());
+
+    // set() folds the delta into the base value without touching the per-core slots
+    COUNTER_SET(counter, int64_t(5));
+    ASSERT_EQ(5, counter->value());
+    COUNTER_UPDATE(counter, 1);
+    ASSERT_EQ(6, counter->value());
+
+    // re-adding returns the existing counter
+    ASSERT_EQ(counter, profile->AddCoreLocalCounter("counter", TUnit::UNIT, create_strategy(TUnit::UNIT)));
+    ASSERT_EQ(counter, profile->get_counter("counter"));
+}
+
 } // namespace starrocks
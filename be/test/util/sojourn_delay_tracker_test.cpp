@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/sojourn_delay_tracker.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(SojournDelayTrackerTest, test_burst_is_not_overload) {
+    const int64_t interval = 1000;
+    SojournDelayTracker tracker(interval);
+    // a burst: large delays mixed with one fast task inside the same interval
+    tracker.record(100, 500);
+    tracker.record(200, 800);
+    tracker.record(300, 5);
+    // interval rotates, publishing the minimum
+    tracker.record(1200, 700);
+    ASSERT_EQ(5, tracker.last_min_delay_ns(1300));
+}
+
+TEST(SojournDelayTrackerTest, test_persistent_backlog) {
+    const int64_t interval = 1000;
+    SojournDelayTracker tracker(interval);
+    // every task of the first interval waited at least 400
+    tracker.record(100, 600);
+    tracker.record(500, 400);
+    tracker.record(900, 900);
+    tracker.record(1100, 450);
+    ASSERT_EQ(400, tracker.last_min_delay_ns(1200));
+}
+
+TEST(SojournDelayTrackerTest, test_idle_queue_reports_no_delay) {
+    const int64_t interval = 1000;
+    SojournDelayTracker tracker(interval);
+    tracker.record(100, 600);
+    tracker.record(1100, 700);
+    ASSERT_EQ(600, tracker.last_min_delay_ns(1200));
+    // no tasks for two intervals: the stale minimum must not report overload
+    ASSERT_EQ(0, tracker.last_min_delay_ns(3200));
+}
+
+TEST(SojournDelayTrackerTest, test_empty_tracker) {
+    SojournDelayTracker tracker(1000);
+    ASSERT_EQ(0, tracker.last_min_delay_ns(500));
+    tracker.record(100, 50);
+    // the first interval has not completed yet
+    ASSERT_EQ(0, tracker.last_min_delay_ns(500));
+}
+
+} // namespace starrocks